@@ -225,6 +225,12 @@ class RigidBody : public CollisionBody {
         /// Set the gravity factor to apply to this rigid body
         void setGravityScale(decimal gravityScale);
 
+        /// Return the solver priority of the body
+        decimal getSolverPriority() const;
+
+        /// Set the solver priority of the body (fraction of the solver iterations used by its island)
+        void setSolverPriority(decimal solverPriority);
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Set the profiler
@@ -75,6 +75,9 @@ class Collider {
         /// changed by the user
         void setHasCollisionShapeChangedSize(bool hasCollisionShapeChangedSize);
 
+        /// Notify the collider that the friction or the bounciness of its material has been modified
+        void notifyMaterialChanged();
+
     public:
 
         // -------------------- Methods -------------------- //
@@ -157,6 +160,18 @@ class Collider {
         /// Set whether the collider is a trigger
         void setIsTrigger(bool isTrigger) const;
 
+        /// Return true if the contacts of the collider are reported to the event listener
+        bool getReportContacts() const;
+
+        /// Set whether the contacts of the collider are reported to the event listener
+        void setReportContacts(bool reportContacts) const;
+
+        /// Return the minimum penetration impulse for a persisting contact to be reported
+        decimal getContactReportImpulseThreshold() const;
+
+        /// Set the minimum penetration impulse for a persisting contact to be reported
+        void setContactReportImpulseThreshold(decimal impulseThreshold) const;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Set the profiler
@@ -178,6 +193,7 @@ class Collider {
         friend class CollisionShape;
         friend class ContactManifoldSet;
 		friend class MiddlePhaseTriangleCallback;
+        friend class Material;
 
 };
 
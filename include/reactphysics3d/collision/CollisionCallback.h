@@ -216,6 +216,90 @@ class CollisionCallback {
                 friend class CollisionCallback;
         };
 
+        // Structure FlatContactPoint
+        /**
+         * This structure contains the plain data of a contact point. It is part of
+         * the flat view of the contacts returned by CallbackData::getFlatContactPoints().
+         */
+        struct FlatContactPoint {
+
+            /// World-space contact point on the first collider
+            Vector3 worldPointOnCollider1;
+
+            /// World-space contact point on the second collider
+            Vector3 worldPointOnCollider2;
+
+            /// World-space contact normal (from the first collider toward the second collider)
+            Vector3 worldNormal;
+
+            /// Penetration depth between the two colliders at this contact point
+            decimal penetrationDepth;
+
+            /// Penetration impulse applied at this contact point by the solver during the
+            /// previous simulation step (zero for a new contact point)
+            decimal penetrationImpulse;
+        };
+
+        // Structure FlatContactManifold
+        /**
+         * This structure contains the plain data of a contact manifold. It is part of
+         * the flat view of the contacts returned by CallbackData::getFlatContactManifolds().
+         */
+        struct FlatContactManifold {
+
+            /// Index of the first contact point of the manifold in the array of contact points data
+            uint32 contactPointsIndex;
+
+            /// Number of contact points in the manifold
+            uint32 nbContactPoints;
+
+            /// Friction impulse in the first friction direction (from the previous simulation step)
+            decimal frictionImpulse1;
+
+            /// Friction impulse in the second friction direction (from the previous simulation step)
+            decimal frictionImpulse2;
+
+            /// Twist friction impulse (from the previous simulation step)
+            decimal frictionTwistImpulse;
+        };
+
+        // Structure FlatContactPair
+        /**
+         * This structure contains the plain data of a contact pair. It is part of
+         * the flat view of the contacts returned by CallbackData::getFlatContactPairs().
+         * The bodies and colliders are identified by their entities (see CollisionBody::getEntity()
+         * and Collider::getEntity()).
+         */
+        struct FlatContactPair {
+
+            /// Entity of the first body in contact
+            Entity body1Entity;
+
+            /// Entity of the second body in contact
+            Entity body2Entity;
+
+            /// Entity of the first collider in contact
+            Entity collider1Entity;
+
+            /// Entity of the second collider in contact
+            Entity collider2Entity;
+
+            /// Type of contact event for this contact pair
+            ContactPair::EventType eventType;
+
+            /// Index of the first contact manifold of the pair in the array of contact manifolds data
+            uint32 contactManifoldsIndex;
+
+            /// Number of contact manifolds of the pair
+            uint32 nbContactManifolds;
+
+            /// Index of the first contact point of the pair in the array of contact points data
+            uint32 contactPointsIndex;
+
+            /// Total number of contact points of the pair
+            uint32 nbContactPoints;
+        };
+
         // Class CallbackData
         /**
          * This class contains data about contacts between bodies
@@ -247,11 +331,21 @@ class CollisionCallback {
                 /// Reference to the physics world
                 PhysicsWorld& mWorld;
 
+                /// Pointer to the flat array of contact pairs data (nullptr until the flat view is requested)
+                mutable const Array<FlatContactPair>* mFlatContactPairs;
+
+                /// Pointer to the flat array of contact manifolds data (nullptr until the flat view is requested)
+                mutable const Array<FlatContactManifold>* mFlatContactManifolds;
+
+                /// Pointer to the flat array of contact points data (nullptr until the flat view is requested)
+                mutable const Array<FlatContactPoint>* mFlatContactPoints;
+
                 // -------------------- Methods -------------------- //
 
                 /// Constructor
                 CallbackData(Array<reactphysics3d::ContactPair>* contactPairs, Array<ContactManifold>* manifolds,
                              Array<reactphysics3d::ContactPoint>* contactPoints, Array<reactphysics3d::ContactPair>& lostContactPairs,
+                             const Array<uint64>* contactPairsToReport, const Array<uint64>* lostContactPairsToReport,
                              PhysicsWorld& world);
 
                 /// Deleted copy constructor
@@ -263,6 +357,9 @@ class CollisionCallback {
                 /// Destructor
                 ~CallbackData() = default;
 
+                /// Compute the flat view of the contacts
+                void computeFlatContacts() const;
+
             public:
 
                 // -------------------- Methods -------------------- //
@@ -280,6 +377,28 @@ class CollisionCallback {
                  */
                 ContactPair getContactPair(uint64 index) const;
 
+                /// Return the flat array with the data of the contact pairs
+                /**
+                 * The i-th element of this array corresponds to the contact pair returned by getContactPair(i).
+                 * The flat view of the contacts is only computed the first time one of the getFlatContact*()
+                 * methods is called. The flat arrays are reused by the world and are only valid during the
+                 * onContact() call. You need to copy them if you want to use them later or from another thread.
+                 * @return A reference to the array of contact pairs data
+                 */
+                const Array<FlatContactPair>& getFlatContactPairs() const;
+
+                /// Return the flat array with the data of the contact manifolds
+                /**
+                 * @return A reference to the array of contact manifolds data
+                 */
+                const Array<FlatContactManifold>& getFlatContactManifolds() const;
+
+                /// Return the flat array with the data of the contact points
+                /**
+                 * @return A reference to the array of contact points data
+                 */
+                const Array<FlatContactPoint>& getFlatContactPoints() const;
+
                 // -------------------- Friendship -------------------- //
 
                 friend class CollisionDetectionSystem;
@@ -310,7 +429,8 @@ RP3D_FORCE_INLINE uint32 CollisionCallback::ContactPair::getNbContactPoints() co
 
 // Return the penetration depth between the two bodies in contact
 /**
- * @return The penetration depth (larger than zero)
+ * @return The penetration depth (larger than zero, or negative for a speculative contact
+ *         when the contact margin of the world is not zero)
  */
 RP3D_FORCE_INLINE decimal CollisionCallback::ContactPoint::getPenetrationDepth() const {
    return mContactPoint.getPenetrationDepth();
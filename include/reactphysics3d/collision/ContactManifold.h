@@ -98,13 +98,20 @@ class ContactManifold {
         /// True if the contact manifold has already been added into an island
         bool isAlreadyInIsland;
 
+        /// Mixed friction coefficient of the materials of the two colliders
+        decimal frictionCoefficient;
+
+        /// Mixed restitution factor of the materials of the two colliders
+        decimal restitutionFactor;
+
     public:
 
         // -------------------- Methods -------------------- //
 
         /// Constructor
         ContactManifold(Entity bodyEntity1, Entity bodyEntity2, Entity colliderEntity1, Entity colliderEntity2,
-                        uint32 contactPointsIndex, uint8 nbContactPoints);
+                        uint32 contactPointsIndex, uint8 nbContactPoints, decimal frictionCoefficient,
+                        decimal restitutionFactor);
 
         // -------------------- Friendship -------------------- //
 
@@ -89,15 +89,23 @@ struct ContactPair {
         /// True if one of the two involved colliders is a trigger
         bool isTrigger;
 
+        /// Mixed friction coefficient of the materials of the two colliders
+        decimal frictionCoefficient;
+
+        /// Mixed restitution factor of the materials of the two colliders
+        decimal restitutionFactor;
+
         // -------------------- Methods -------------------- //
 
         /// Constructor
         ContactPair(uint64 pairId, Entity body1Entity, Entity body2Entity, Entity collider1Entity,
-                    Entity collider2Entity, uint32 contactPairIndex, bool collidingInPreviousFrame, bool isTrigger)
+                    Entity collider2Entity, uint32 contactPairIndex, bool collidingInPreviousFrame, bool isTrigger,
+                    decimal frictionCoefficient = decimal(0.0), decimal restitutionFactor = decimal(0.0))
             : pairId(pairId), nbPotentialContactManifolds(0), potentialContactManifoldsIndices{0}, body1Entity(body1Entity), body2Entity(body2Entity),
               collider1Entity(collider1Entity), collider2Entity(collider2Entity),
               isAlreadyInIsland(false), contactPairIndex(contactPairIndex), contactManifoldsIndex(0), nbContactManifolds(0),
-              contactPointsIndex(0), nbToTalContactPoints(0), collidingInPreviousFrame(collidingInPreviousFrame), isTrigger(isTrigger) {
+              contactPointsIndex(0), nbToTalContactPoints(0), collidingInPreviousFrame(collidingInPreviousFrame), isTrigger(isTrigger),
+              frictionCoefficient(frictionCoefficient), restitutionFactor(restitutionFactor) {
 
         }
 
@@ -58,8 +58,29 @@ class PolyhedronMesh {
         /// Half-edge structure of the mesh
         HalfEdgeStructure mHalfEdgeStructure;
 
-        /// Array with the face normals
-        Vector3* mFacesNormals;
+        /// Buffer with the baked geometry of the mesh (vertices, face planes and edge directions)
+        void* mBakedDataBuffer;
+
+        /// Size (in bytes) of the buffer with the baked geometry
+        size_t mBakedDataBufferSize;
+
+        /// Coordinates of the vertices (in decimal precision and in the half-edge vertices order)
+        decimal* mVerticesX;
+        decimal* mVerticesY;
+        decimal* mVerticesZ;
+
+        /// Normals of the faces
+        decimal* mFacesNormalsX;
+        decimal* mFacesNormalsY;
+        decimal* mFacesNormalsZ;
+
+        /// Offsets of the face planes (dot product of the face normal with a vertex of the face)
+        decimal* mFacesPlaneOffsets;
+
+        /// Directions of the half-edges (end vertex minus start vertex)
+        decimal* mEdgesDirectionsX;
+        decimal* mEdgesDirectionsY;
+        decimal* mEdgesDirectionsZ;
 
         /// Centroid of the polyhedron
         Vector3 mCentroid;
@@ -72,8 +93,17 @@ class PolyhedronMesh {
         /// Create the half-edge structure of the mesh
         bool createHalfEdgeStructure();
 
-        /// Compute the faces normals
-        void computeFacesNormals();
+        /// Read a vertex from the user polygon vertex array
+        Vector3 readVertex(uint32 index) const;
+
+        /// Allocate the baked data arrays and copy the vertices and edge directions in them
+        void bakeVerticesAndEdges();
+
+        /// Compute the faces normals and plane offsets
+        void computeFacesPlanes();
+
+        /// Return the number of values of a baked array (rounded up to keep the next array aligned)
+        static uint32 computeNbBakedValues(uint32 nbValues);
 
         /// Compute the centroid of the polyhedron
         void computeCentroid() ;
@@ -103,6 +133,12 @@ class PolyhedronMesh {
         /// Return a face normal
         Vector3 getFaceNormal(uint32 faceIndex) const;
 
+        /// Return the offset of a face plane
+        decimal getFacePlaneOffset(uint32 faceIndex) const;
+
+        /// Return the direction of a half-edge
+        Vector3 getEdgeDirection(uint32 edgeIndex) const;
+
         /// Return the half-edge structure of the mesh
         const HalfEdgeStructure& getHalfEdgeStructure() const;
 
@@ -115,6 +151,7 @@ class PolyhedronMesh {
         // ---------- Friendship ---------- //
 
         friend class PhysicsCommon;
+        friend class ConvexMeshShape;
 };
 
 // Return the number of vertices
@@ -125,6 +162,16 @@ RP3D_FORCE_INLINE uint32 PolyhedronMesh::getNbVertices() const {
     return mHalfEdgeStructure.getNbVertices();
 }
 
+// Return a vertex
+/**
+ * @param index Index of a given vertex in the mesh
+ * @return The coordinates of a given vertex in the mesh
+ */
+RP3D_FORCE_INLINE Vector3 PolyhedronMesh::getVertex(uint32 index) const {
+    assert(index < getNbVertices());
+    return Vector3(mVerticesX[index], mVerticesY[index], mVerticesZ[index]);
+}
+
 // Return the number of faces
 /**
  * @return The number of faces in the mesh
@@ -140,7 +187,28 @@ RP3D_FORCE_INLINE uint32 PolyhedronMesh::getNbFaces() const {
  */
 RP3D_FORCE_INLINE Vector3 PolyhedronMesh::getFaceNormal(uint32 faceIndex) const {
     assert(faceIndex < mHalfEdgeStructure.getNbFaces());
-    return mFacesNormals[faceIndex];
+    return Vector3(mFacesNormalsX[faceIndex], mFacesNormalsY[faceIndex], mFacesNormalsZ[faceIndex]);
+}
+
+// Return the offset of a face plane
+/// The face plane is the set of points p with faceNormal.dot(p) = offset
+/**
+ * @param faceIndex The index of a given face of the mesh
+ * @return The offset of the plane of a given face of the mesh
+ */
+RP3D_FORCE_INLINE decimal PolyhedronMesh::getFacePlaneOffset(uint32 faceIndex) const {
+    assert(faceIndex < mHalfEdgeStructure.getNbFaces());
+    return mFacesPlaneOffsets[faceIndex];
+}
+
+// Return the direction of a half-edge
+/**
+ * @param edgeIndex The index of a given half-edge of the mesh
+ * @return The vector from the start vertex to the end vertex of the half-edge
+ */
+RP3D_FORCE_INLINE Vector3 PolyhedronMesh::getEdgeDirection(uint32 edgeIndex) const {
+    assert(edgeIndex < mHalfEdgeStructure.getNbHalfEdges());
+    return Vector3(mEdgesDirectionsX[edgeIndex], mEdgesDirectionsY[edgeIndex], mEdgesDirectionsZ[edgeIndex]);
 }
 
 // Return the half-edge structure of the mesh
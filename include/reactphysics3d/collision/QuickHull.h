@@ -0,0 +1,150 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_QUICK_HULL_H
+#define REACTPHYSICS3D_QUICK_HULL_H
+
+// Libraries
+#include <reactphysics3d/mathematics/mathematics.h>
+#include <reactphysics3d/containers/Array.h>
+#include <reactphysics3d/containers/Map.h>
+#include <reactphysics3d/collision/PolygonVertexArray.h>
+
+namespace reactphysics3d {
+
+// Declarations
+class MemoryAllocator;
+
+/// Cosine of the maximal angle between the normals of two adjacent coplanar faces of a convex
+/// hull for these faces to be merged into a single polygon face
+constexpr decimal QUICKHULL_COPLANAR_FACES_MIN_COS_ANGLE = decimal(0.9999);
+
+// Class QuickHull
+/**
+ * This class computes the convex hull of a set of points with the Quickhull algorithm.
+ * The hull starts as a tetrahedron made of extreme points. Then, the point that is the
+ * furthest outside of the hull is added at each iteration: the faces that are visible from
+ * this point are removed and new triangles are created between the point and the horizon
+ * edges. The algorithm can be stopped when the hull has a maximum number of vertices (the
+ * resulting hull is then inside the exact convex hull). Finally, the adjacent triangles that
+ * are coplanar (up to a distance tolerance) are merged into polygon faces.
+ */
+class QuickHull {
+
+    private:
+
+        /// Triangle face of the hull during its construction
+        struct HullFace {
+
+            /// Indices of the three vertices (counter-clockwise order around the outward normal)
+            uint32 vertices[3];
+
+            /// Outward unit normal of the face
+            Vector3 normal;
+
+            /// Offset of the plane of the face
+            decimal planeOffset;
+
+            /// True if the face is still part of the hull
+            bool isAlive;
+        };
+
+        // -------------------- Attributes -------------------- //
+
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
+
+        /// Input points
+        const Vector3* mPoints;
+
+        /// Number of input points
+        uint32 mNbPoints;
+
+        /// Distance tolerance (scaled with the size of the input points)
+        decimal mTolerance;
+
+        /// Triangle faces of the hull (the faces that have been removed are not alive)
+        Array<HullFace> mFaces;
+
+        /// Map from a directed edge (start and end vertices) to the face of the hull that contains it
+        Map<uint64, uint32> mMapEdgeToFace;
+
+        /// For each input point, index of the face that it is outside of (or -1 if the point is not outside of the hull)
+        Array<uint32> mPointsFaces;
+
+        /// For each input point, distance to the face that it is outside of
+        Array<decimal> mPointsDistances;
+
+        // -------------------- Methods -------------------- //
+
+        /// Return the key of a directed edge of the hull
+        static uint64 getEdgeKey(uint32 startVertex, uint32 endVertex);
+
+        /// Create the initial tetrahedron of the hull and return false if the points are degenerate
+        bool createInitialTetrahedron();
+
+        /// Add a triangle face to the hull and return its index
+        uint32 addFace(uint32 vertex1, uint32 vertex2, uint32 vertex3);
+
+        /// Remove a face from the hull
+        void removeFace(uint32 faceIndex);
+
+        /// Assign a point to the face (among some candidate faces) it is the furthest outside of
+        void assignPointToFace(uint32 pointIndex, const Array<uint32>& candidateFaces);
+
+        /// Add a point to the hull
+        void addPointToHull(uint32 pointIndex);
+
+        /// Return true if a face is coplanar with a reference face
+        bool isFaceCoplanar(uint32 faceIndex, uint32 referenceFaceIndex) const;
+
+        /// Merge the coplanar triangles of the hull into polygons and return the faces of the hull
+        void computeHullPolygons(Array<Vector3>& outVertices, Array<uint32>& outIndices,
+                                 Array<PolygonVertexArray::PolygonFace>& outFaces);
+
+        /// Compute the polygon made of a group of triangles and return false if it is not a simple polygon
+        bool computeGroupPolygon(const Array<uint32>& groupFaces, const Array<uint32>& facesGroups, uint32 group,
+                                 Array<uint32>& outPolygon) const;
+
+    public:
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        QuickHull(MemoryAllocator& allocator);
+
+        /// Compute the convex hull of a set of points
+        bool computeConvexHull(const Vector3* points, uint32 nbPoints, uint32 maxNbVertices, Array<Vector3>& outVertices,
+                               Array<uint32>& outIndices, Array<PolygonVertexArray::PolygonFace>& outFaces);
+};
+
+// Return the key of a directed edge of the hull
+RP3D_FORCE_INLINE uint64 QuickHull::getEdgeKey(uint32 startVertex, uint32 endVertex) {
+    return (static_cast<uint64>(startVertex) << 32) | static_cast<uint64>(endVertex);
+}
+
+}
+
+#endif
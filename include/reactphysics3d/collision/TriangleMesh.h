@@ -48,12 +48,22 @@ class TriangleMesh {
 
     protected:
 
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
+
         /// All the triangle arrays of the mesh (one triangle array per part)
         Array<TriangleVertexArray*> mTriangleArrays;
 
+        /// Internal edges flags of all the triangles of the mesh. The bit i of the flags of a triangle is set
+        /// if the edge between the vertices i and (i+1)%3 of the triangle is an internal edge of the mesh
+        Array<uint8> mTrianglesInternalEdges;
+
         /// Constructor
         TriangleMesh(reactphysics3d::MemoryAllocator& allocator);
 
+        /// Compute the adjacency of the triangles of a subpart and the internal edges flags of its triangles
+        void computeInternalEdges(const TriangleVertexArray* triangleVertexArray);
+
     public:
 
         /// Destructor
@@ -68,20 +78,15 @@ class TriangleMesh {
         /// Return the number of subparts of the mesh
         uint32 getNbSubparts() const;
 
+        /// Return the internal edges flags of a triangle of the mesh
+        uint8 getTriangleInternalEdges(uint32 triangleIndex) const;
+
 
         // ---------- Friendship ---------- //
 
         friend class PhysicsCommon;
 };
 
-// Add a subpart of the mesh
-/**
- * @param triangleVertexArray Pointer to the TriangleVertexArray to add into the mesh
- */
-RP3D_FORCE_INLINE void TriangleMesh::addSubpart(TriangleVertexArray* triangleVertexArray) {
-    mTriangleArrays.add(triangleVertexArray );
-}
-
 // Return a pointer to a given subpart (triangle vertex array) of the mesh
 /**
  * @param indexSubpart The index of the sub-part of the mesh
@@ -100,6 +105,18 @@ RP3D_FORCE_INLINE uint32 TriangleMesh::getNbSubparts() const {
     return static_cast<uint32>(mTriangleArrays.size());
 }
 
+// Return the internal edges flags of a triangle of the mesh
+/**
+ * @param triangleIndex Index of the triangle in the whole mesh (the triangles of the subparts are
+ *                      indexed in the order of the subparts)
+ * @return The internal edges flags of the triangle (the bit i is set if the edge between the
+ *         vertices i and (i+1)%3 of the triangle is an internal edge of the mesh)
+ */
+RP3D_FORCE_INLINE uint8 TriangleMesh::getTriangleInternalEdges(uint32 triangleIndex) const {
+    assert(triangleIndex < mTrianglesInternalEdges.size());
+    return mTrianglesInternalEdges[triangleIndex];
+}
+
 }
 
 #endif
@@ -228,6 +228,12 @@ class DynamicAABBTree {
         /// Remove an object from the tree
         void removeObject(int32 nodeID);
 
+        /// Reserve the ID of a node that is not inserted into the tree
+        int32 reserveNodeID();
+
+        /// Release the ID of a node reserved with reserveNodeID()
+        void releaseReservedNodeID(int32 nodeID);
+
         /// Update the dynamic tree after an object has moved.
         bool updateObject(int32 nodeID, const AABB& newAABB, bool forceReinsert = false);
 
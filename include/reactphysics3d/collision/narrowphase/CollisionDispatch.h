@@ -33,6 +33,7 @@
 #include <reactphysics3d/collision/narrowphase/CapsuleVsCapsuleAlgorithm.h>
 #include <reactphysics3d/collision/narrowphase/CapsuleVsConvexPolyhedronAlgorithm.h>
 #include <reactphysics3d/collision/narrowphase/ConvexPolyhedronVsConvexPolyhedronAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/GenericConvexVsConvexAlgorithm.h>
 #include <reactphysics3d/collision/shapes/CollisionShape.h>
 
 namespace reactphysics3d {
@@ -46,7 +47,8 @@ enum class NarrowPhaseAlgorithmType {
     CapsuleVsCapsule,
     SphereVsConvexPolyhedron,
     CapsuleVsConvexPolyhedron,
-    ConvexPolyhedronVsConvexPolyhedron
+    ConvexPolyhedronVsConvexPolyhedron,
+    GenericConvexVsConvex
 };
 
 // Class CollisionDispatch
@@ -80,6 +82,9 @@ class CollisionDispatch {
         /// True if the convex polyhedron vs convex polyhedron algorithm is the default one
         bool mIsConvexPolyhedronVsConvexPolyhedronDefault = true;
 
+        /// True if the generic convex vs convex algorithm is the default one
+        bool mIsGenericConvexVsConvexDefault = true;
+
         /// Sphere vs Sphere collision algorithm
         SphereVsSphereAlgorithm* mSphereVsSphereAlgorithm;
 
@@ -98,6 +103,9 @@ class CollisionDispatch {
         /// Convex Polyhedron vs Convex Polyhedron collision algorithm
         ConvexPolyhedronVsConvexPolyhedronAlgorithm* mConvexPolyhedronVsConvexPolyhedronAlgorithm;
 
+        /// Generic Convex vs Convex collision algorithm
+        GenericConvexVsConvexAlgorithm* mGenericConvexVsConvexAlgorithm;
+
         /// Collision detection matrix (algorithms to use)
         NarrowPhaseAlgorithmType mCollisionMatrix[NB_COLLISION_SHAPE_TYPES][NB_COLLISION_SHAPE_TYPES];
 
@@ -156,6 +164,12 @@ class CollisionDispatch {
         /// Get the Convex Polyhedron vs Convex Polyhedron narrow-phase collision detection algorithm
         ConvexPolyhedronVsConvexPolyhedronAlgorithm* getConvexPolyhedronVsConvexPolyhedronAlgorithm();
 
+        /// Set the Generic Convex vs Convex narrow-phase collision detection algorithm
+        void setGenericConvexVsConvexAlgorithm(GenericConvexVsConvexAlgorithm* algorithm);
+
+        /// Get the Generic Convex vs Convex narrow-phase collision detection algorithm
+        GenericConvexVsConvexAlgorithm* getGenericConvexVsConvexAlgorithm();
+
         /// Fill-in the collision detection matrix
         void fillInCollisionMatrix();
 
@@ -202,6 +216,11 @@ RP3D_FORCE_INLINE ConvexPolyhedronVsConvexPolyhedronAlgorithm* CollisionDispatch
     return mConvexPolyhedronVsConvexPolyhedronAlgorithm;
 }
 
+// Get the Generic Convex vs Convex narrow-phase collision detection algorithm
+RP3D_FORCE_INLINE GenericConvexVsConvexAlgorithm* CollisionDispatch::getGenericConvexVsConvexAlgorithm() {
+    return mGenericConvexVsConvexAlgorithm;
+}
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 // Set the profiler
@@ -214,6 +233,7 @@ RP3D_FORCE_INLINE void CollisionDispatch::setProfiler(Profiler* profiler) {
     mSphereVsConvexPolyhedronAlgorithm->setProfiler(profiler);
     mCapsuleVsConvexPolyhedronAlgorithm->setProfiler(profiler);
     mConvexPolyhedronVsConvexPolyhedronAlgorithm->setProfiler(profiler);
+    mGenericConvexVsConvexAlgorithm->setProfiler(profiler);
 }
 
 #endif
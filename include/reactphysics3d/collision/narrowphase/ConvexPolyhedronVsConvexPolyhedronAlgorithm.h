@@ -28,26 +28,46 @@
 
 // Libraries
 #include <reactphysics3d/collision/narrowphase/NarrowPhaseAlgorithm.h>
+#include <reactphysics3d/mathematics/Vector3.h>
 
 /// Namespace ReactPhysics3D
 namespace reactphysics3d {
 
 // Declarations
 class ContactPoint;
+class SATAlgorithm;
+class MemoryAllocator;
 struct NarrowPhaseInfoBatch;
 
 // Class ConvexPolyhedronVsConvexPolyhedronAlgorithm
 /**
  * This class is used to compute the narrow-phase collision detection
- * between two convex polyhedra. Here we do not use the GJK algorithm but
- * we run the SAT algorithm to get the contact points and normal.
- * This is based on the "Robust Contact Creation for Physics Simulation"
- * presentation by Dirk Gregorius.
+ * between two convex polyhedra. By default, we run the SAT algorithm to get
+ * the contact points and normal. This is based on the "Robust Contact Creation
+ * for Physics Simulation" presentation by Dirk Gregorius. Because the cost of the
+ * SAT algorithm grows with the product of the numbers of edges of the polyhedra,
+ * the pairs of polyhedra with many edges can instead use the GJK algorithm and the
+ * EPA algorithm to compute the penetration normal and depth. The contact points
+ * are then obtained by clipping the faces of the polyhedra along this normal.
  */
 class ConvexPolyhedronVsConvexPolyhedronAlgorithm : public NarrowPhaseAlgorithm {
 
     protected :
 
+        // -------------------- Methods -------------------- //
+
+        /// Return true if the collision between two convex polyhedra is computed with the GJK and EPA algorithms
+        bool isUsingGJKAndEPA(const NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex, uint32 epaMinNbEdgePairs) const;
+
+        /// Compute the narrow-phase collision detection between two convex polyhedra with GJK and EPA
+        bool testCollisionWithGJKAndEPA(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex, uint32 batchNbItems,
+                                        SATAlgorithm& satAlgorithm, MemoryAllocator& memoryAllocator);
+
+        /// Compute the contact points between two convex polyhedra from a penetration normal
+        void computeContactPoints(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex, SATAlgorithm& satAlgorithm,
+                                  const Vector3& normalShape1, decimal penetrationDepth,
+                                  const Vector3& contactPointShape1, const Vector3& contactPointShape2) const;
+
     public :
 
         // -------------------- Methods -------------------- //
@@ -66,7 +86,8 @@ class ConvexPolyhedronVsConvexPolyhedronAlgorithm : public NarrowPhaseAlgorithm
 
         /// Compute the narrow-phase collision detection between two convex polyhedra
         bool testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex, uint32 batchNbItems,
-                           bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& memoryAllocator);
+                           bool clipWithPreviousAxisIfStillColliding, uint32 epaMinNbEdgePairs,
+                           MemoryAllocator& memoryAllocator);
 };
 
 }
@@ -0,0 +1,177 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_EPA_ALGORITHM_H
+#define REACTPHYSICS3D_EPA_ALGORITHM_H
+
+// Libraries
+#include <reactphysics3d/decimal.h>
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/mathematics/Vector3.h>
+#include <reactphysics3d/mathematics/Transform.h>
+#include <reactphysics3d/containers/Array.h>
+#include <reactphysics3d/collision/narrowphase/GJK/GJKAlgorithm.h>
+
+/// ReactPhysics3D namespace
+namespace reactphysics3d {
+
+// Declarations
+class ConvexShape;
+class MemoryAllocator;
+class Profiler;
+
+// Constants
+constexpr uint32 EPA_MAX_NB_VERTICES = 128;
+constexpr uint32 EPA_MAX_NB_ITERATIONS = 64;
+constexpr decimal EPA_RELATIVE_TOLERANCE = decimal(0.0001);
+constexpr decimal EPA_ABSOLUTE_TOLERANCE = decimal(0.00001);
+
+// Class EPAAlgorithm
+/**
+ * This class implements the Expanding Polytope Algorithm (EPA) to compute the penetration
+ * depth between two interpenetrating convex shapes. The algorithm starts from the final
+ * simplex of the GJK algorithm (that contains the origin) and iteratively expands a
+ * polytope inside the Minkowski difference A-B of the two shapes towards its boundary. The
+ * face of the polytope closest to the origin then gives the penetration normal and depth.
+ * The shapes with a margin (sphere and capsule) are enlarged by their margin.
+ * This implementation is based on the book "Collision Detection in Interactive 3D
+ * Environments" by Gino van den Bergen.
+ */
+class EPAAlgorithm {
+
+    private :
+
+        /// Triangular face of the expanding polytope
+        struct PolytopeFace {
+
+            /// Indices of the three vertices of the face (counter clockwise from outside)
+            uint32 vertices[3];
+
+            /// Unit outward normal of the face
+            Vector3 normal;
+
+            /// Distance between the origin and the plane of the face
+            decimal distance;
+        };
+
+        /// Edge of the polytope (pair of vertex indices)
+        struct PolytopeEdge {
+
+            uint32 vertex1;
+            uint32 vertex2;
+        };
+
+        // -------------------- Attributes -------------------- //
+
+        /// Points of the polytope (points of the Minkowski difference A-B in the local-space of shape 1)
+        Array<Vector3> mPoints;
+
+        /// Support points of shape 1 of each point of the polytope (in the local-space of shape 1)
+        Array<Vector3> mSuppPointsA;
+
+        /// Support points of shape 2 of each point of the polytope (in the local-space of shape 1)
+        Array<Vector3> mSuppPointsB;
+
+        /// Faces of the polytope
+        Array<PolytopeFace> mFaces;
+
+        /// Edges of the horizon when a new point is added to the polytope
+        Array<PolytopeEdge> mHorizonEdges;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+		/// Pointer to the profiler
+		Profiler* mProfiler;
+
+#endif
+
+        // -------------------- Methods -------------------- //
+
+        /// Compute the support point of the Minkowski difference A-B in a given direction
+        void computeSupportPoint(const ConvexShape* shape1, const ConvexShape* shape2, const Transform& shape2ToShape1,
+                                 const Vector3& direction, uint32& supportVertexIndex1, uint32& supportVertexIndex2,
+                                 Vector3& outSuppPointA, Vector3& outSuppPointB) const;
+
+        /// Add a point of the Minkowski difference A-B to the polytope and return its index
+        uint32 addPoint(const Vector3& suppPointA, const Vector3& suppPointB);
+
+        /// Create the initial tetrahedron of the polytope from the GJK simplex
+        bool createInitialTetrahedron(const GJKAlgorithm::GJKSimplex& simplex, const ConvexShape* shape1,
+                                      const ConvexShape* shape2, const Transform& shape2ToShape1,
+                                      uint32& supportVertexIndex1, uint32& supportVertexIndex2);
+
+        /// Add a face to the polytope
+        bool addFace(uint32 vertex1, uint32 vertex2, uint32 vertex3);
+
+        /// Return the index of the face of the polytope that is closest to the origin
+        uint32 findClosestFace() const;
+
+        /// Add an edge of a removed face to the horizon
+        void addHorizonEdge(uint32 vertex1, uint32 vertex2);
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        EPAAlgorithm(MemoryAllocator& memoryAllocator);
+
+        /// Destructor
+        ~EPAAlgorithm() = default;
+
+        /// Deleted copy-constructor
+        EPAAlgorithm(const EPAAlgorithm& algorithm) = delete;
+
+        /// Deleted assignment operator
+        EPAAlgorithm& operator=(const EPAAlgorithm& algorithm) = delete;
+
+        /// Compute the penetration depth and contact points between two interpenetrating convex shapes
+        bool computePenetrationDepthAndContactPoints(const GJKAlgorithm::GJKSimplex& simplex, const ConvexShape* shape1,
+                                                     const ConvexShape* shape2, const Transform& shape2ToShape1,
+                                                     uint32& supportVertexIndex1, uint32& supportVertexIndex2,
+                                                     Vector3& outNormal, decimal& outPenetrationDepth,
+                                                     Vector3& outContactPointShape1, Vector3& outContactPointShape2);
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+		/// Set the profiler
+		void setProfiler(Profiler* profiler);
+
+#endif
+
+};
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+// Set the profiler
+RP3D_FORCE_INLINE void EPAAlgorithm::setProfiler(Profiler* profiler) {
+	mProfiler = profiler;
+}
+
+#endif
+
+}
+
+#endif
@@ -29,6 +29,7 @@
 // Libraries
 #include <reactphysics3d/decimal.h>
 #include <reactphysics3d/configuration.h>
+#include <reactphysics3d/mathematics/Vector3.h>
 
 /// ReactPhysics3D namespace
 namespace reactphysics3d {
@@ -82,6 +83,23 @@ class GJKAlgorithm {
             INTERPENETRATE          // The two shapes overlap event without the margin (deep penetration)
         };
 
+        /// Simplex of the GJK algorithm when the two shapes interpenetrate. The EPA
+        /// algorithm starts from this simplex to compute the penetration depth.
+        struct GJKSimplex {
+
+            /// Points of the simplex (points of the Minkowski difference A-B in the local-space of shape 1)
+            Vector3 points[4];
+
+            /// Support points of shape 1 (in the local-space of shape 1)
+            Vector3 suppPointsA[4];
+
+            /// Support points of shape 2 (in the local-space of shape 1)
+            Vector3 suppPointsB[4];
+
+            /// Number of points of the simplex
+            int nbPoints;
+        };
+
         // -------------------- Methods -------------------- //
 
         /// Constructor
@@ -98,7 +116,8 @@ class GJKAlgorithm {
 
         /// Compute a contact info if the two bounding volumes collide.
         void testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex,
-                           uint32 batchNbItems, Array<GJKResult>& gjkResults);
+                           uint32 batchNbItems, Array<GJKResult>& gjkResults,
+                           Array<GJKSimplex>* interpenetrationSimplices = nullptr);
 
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -0,0 +1,98 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_GENERIC_CONVEX_VS_CONVEX_ALGORITHM_H
+#define	REACTPHYSICS3D_GENERIC_CONVEX_VS_CONVEX_ALGORITHM_H
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/NarrowPhaseAlgorithm.h>
+#include <reactphysics3d/mathematics/Vector3.h>
+
+/// Namespace ReactPhysics3D
+namespace reactphysics3d {
+
+// Declarations
+class ContactPoint;
+class CollisionShape;
+class ConvexPolyhedronShape;
+struct NarrowPhaseInfoBatch;
+
+// Class GenericConvexVsConvexAlgorithm
+/**
+ * This class is used to compute the narrow-phase collision detection between a
+ * generic convex shape (a shape only described by its support function like a
+ * cylinder or a cone) and any other convex shape. We use the GJK algorithm first.
+ * If GJK reports that the two shapes are separated, we are done. If GJK reports
+ * that the shapes are overlapping in their margins, GJK also reports a contact point
+ * and a contact normal. If the shapes are interpenetrating, we run the EPA algorithm
+ * to get the contact point and contact normal. When the flat disc of a cylinder or a
+ * cone lies on a face of a convex polyhedron, some contact points are added on the
+ * rim of the disc so that the shape can rest on the face.
+ */
+class GenericConvexVsConvexAlgorithm : public NarrowPhaseAlgorithm {
+
+    protected :
+
+        // -------------------- Methods -------------------- //
+
+        /// Return the flat disc of a generic convex shape whose normal is aligned with a given direction
+        bool getContactDisc(const CollisionShape* shape, const Vector3& direction, Vector3& outDiscCenter,
+                            decimal& outDiscRadius, Vector3& outDiscNormal) const;
+
+        /// Return true if a point on the plane of a face of a polyhedron is inside this face
+        bool isPointInsideFace(const ConvexPolyhedronShape* polyhedron, uint32 faceIndex, const Vector3& faceNormal,
+                               const Vector3& point) const;
+
+        /// Add the contact points on the rim of the disc of one shape resting on a flat face of the other shape
+        uint32 addDiscContactPoints(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex, bool isDiscOnShape1,
+                                    const Vector3& normalShape1) const;
+
+        /// Replace the contact point of a colliding pair by the contact points of a resting disc (if any)
+        void computeDiscContactPoints(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex, const Vector3& normalShape1) const;
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        GenericConvexVsConvexAlgorithm() = default;
+
+        /// Destructor
+        virtual ~GenericConvexVsConvexAlgorithm() override = default;
+
+        /// Deleted copy-constructor
+        GenericConvexVsConvexAlgorithm(const GenericConvexVsConvexAlgorithm& algorithm) = delete;
+
+        /// Deleted assignment operator
+        GenericConvexVsConvexAlgorithm& operator=(const GenericConvexVsConvexAlgorithm& algorithm) = delete;
+
+        /// Compute the narrow-phase collision detection between a generic convex shape and a convex shape
+        bool testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex, uint32 batchNbItems,
+                           MemoryAllocator& memoryAllocator);
+};
+
+}
+
+#endif
@@ -61,9 +61,6 @@ struct NarrowPhaseInfoBatch {
         /// Collision info of the previous frame
         LastFrameCollisionInfo* lastFrameCollisionInfo;
 
-        /// Memory allocator for the collision shape (Used to release TriangleShape memory in destructor)
-        MemoryAllocator* collisionShapeAllocator;
-
         /// Shape local to world transform of sphere 1
         Transform shape1ToWorldTransform;
 
@@ -79,6 +76,9 @@ struct NarrowPhaseInfoBatch {
         /// True if we need to report contacts (false for triggers for instance)
         bool reportContacts;
 
+        /// Distance under which the separated shapes generate speculative contacts (with a negative penetration depth)
+        decimal contactMargin;
+
         /// Result of the narrow-phase collision detection test
         bool isColliding;
 
@@ -89,13 +89,13 @@ struct NarrowPhaseInfoBatch {
         ContactPointInfo contactPoints[NB_MAX_CONTACT_POINTS_IN_NARROWPHASE_INFO];
 
         /// Constructor
-        NarrowPhaseInfo(uint64 pairId, Entity collider1, Entity collider2, LastFrameCollisionInfo* lastFrameInfo, MemoryAllocator& shapeAllocator,
+        NarrowPhaseInfo(uint64 pairId, Entity collider1, Entity collider2, LastFrameCollisionInfo* lastFrameInfo,
                              const Transform& shape1ToWorldTransform, const Transform& shape2ToWorldTransform, CollisionShape* shape1,
-                             CollisionShape* shape2, bool needToReportContacts)
+                             CollisionShape* shape2, bool needToReportContacts, decimal contactMargin)
                       : overlappingPairId(pairId), colliderEntity1(collider1), colliderEntity2(collider2), lastFrameCollisionInfo(lastFrameInfo),
-                         collisionShapeAllocator(&shapeAllocator), shape1ToWorldTransform(shape1ToWorldTransform),
+                         shape1ToWorldTransform(shape1ToWorldTransform),
                          shape2ToWorldTransform(shape2ToWorldTransform), collisionShape1(shape1),
-                        collisionShape2(shape2), reportContacts(needToReportContacts), isColliding(false), nbContactPoints(0) {
+                        collisionShape2(shape2), reportContacts(needToReportContacts), contactMargin(contactMargin), isColliding(false), nbContactPoints(0) {
 
         }
     };
@@ -125,7 +125,7 @@ struct NarrowPhaseInfoBatch {
         /// Add shapes to be tested during narrow-phase collision detection into the batch
         void addNarrowPhaseInfo(uint64 pairId, Entity collider1, Entity collider2, CollisionShape* shape1,
                                                       CollisionShape* shape2, const Transform& shape1Transform, const Transform& shape2Transform,
-                                                      bool needToReportContacts, LastFrameCollisionInfo* lastFrameInfo, MemoryAllocator& shapeAllocator);
+                                                      bool needToReportContacts, decimal contactMargin, LastFrameCollisionInfo* lastFrameInfo);
 
         /// Return the number of objects in the batch
         uint32 getNbObjects() const;
@@ -152,16 +152,18 @@ RP3D_FORCE_INLINE uint32 NarrowPhaseInfoBatch::getNbObjects() const {
 // Add shapes to be tested during narrow-phase collision detection into the batch
 RP3D_FORCE_INLINE void NarrowPhaseInfoBatch::addNarrowPhaseInfo(uint64 pairId, Entity collider1, Entity collider2, CollisionShape* shape1,
                                               CollisionShape* shape2, const Transform& shape1Transform, const Transform& shape2Transform,
-                                              bool needToReportContacts, LastFrameCollisionInfo* lastFrameInfo, MemoryAllocator& shapeAllocator) {
+                                              bool needToReportContacts, decimal contactMargin, LastFrameCollisionInfo* lastFrameInfo) {
 
     // Create a meta data object
-    narrowPhaseInfos.emplace(pairId, collider1, collider2, lastFrameInfo, shapeAllocator, shape1Transform, shape2Transform, shape1, shape2, needToReportContacts);
+    narrowPhaseInfos.emplace(pairId, collider1, collider2, lastFrameInfo, shape1Transform, shape2Transform, shape1, shape2, needToReportContacts,
+                             contactMargin);
 }
 
 // Add a new contact point
 RP3D_FORCE_INLINE void NarrowPhaseInfoBatch::addContactPoint(uint32 index, const Vector3& contactNormal, decimal penDepth, const Vector3& localPt1, const Vector3& localPt2) {
 
-    assert(penDepth > decimal(0.0));
+    // The penetration depth is negative for a speculative contact between separated shapes
+    assert(penDepth > -narrowPhaseInfos[index].contactMargin);
 
     if (narrowPhaseInfos[index].nbContactPoints < NB_MAX_CONTACT_POINTS_IN_NARROWPHASE_INFO) {
 
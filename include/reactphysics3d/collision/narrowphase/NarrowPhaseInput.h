@@ -43,6 +43,8 @@ class NarrowPhaseAlgorithm;
 enum class NarrowPhaseAlgorithmType;
 class Transform;
 struct Vector3;
+class TriangleShape;
+class HalfEdgeStructure;
 
 // Class NarrowPhaseInput
 /**
@@ -59,17 +61,41 @@ class NarrowPhaseInput {
         NarrowPhaseInfoBatch mSphereVsConvexPolyhedronBatch;
         NarrowPhaseInfoBatch mCapsuleVsConvexPolyhedronBatch;
         NarrowPhaseInfoBatch mConvexPolyhedronVsConvexPolyhedronBatch;
+        NarrowPhaseInfoBatch mGenericConvexVsConvexBatch;
+
+        /// Memory allocator of the triangle shapes
+        MemoryAllocator& mTriangleShapesAllocator;
+
+        /// Triangle shapes for the triangles of the concave shapes to test. Those shapes are
+        /// not destroyed when the input is cleared but they are reused in the next frames
+        Array<TriangleShape*> mTriangleShapes;
+
+        /// Number of triangle shapes of the mTriangleShapes array used by the current tests
+        uint32 mNbUsedTriangleShapes;
 
     public:
 
         /// Constructor
-        NarrowPhaseInput(MemoryAllocator& allocator, OverlappingPairs& overlappingPairs);
+        NarrowPhaseInput(MemoryAllocator& allocator, MemoryAllocator& triangleShapesAllocator, OverlappingPairs& overlappingPairs);
+
+        /// Destructor
+        ~NarrowPhaseInput();
+
+        /// Deleted copy-constructor
+        NarrowPhaseInput(const NarrowPhaseInput& input) = delete;
+
+        /// Deleted assignment operator
+        NarrowPhaseInput& operator=(const NarrowPhaseInput& input) = delete;
 
         /// Add shapes to be tested during narrow-phase collision detection into the batch
         void addNarrowPhaseTest(uint64 pairId, Entity collider1, Entity collider2, CollisionShape* shape1,
                         CollisionShape* shape2, const Transform& shape1Transform,
                         const Transform& shape2Transform, NarrowPhaseAlgorithmType narrowPhaseAlgorithmType, bool reportContacts,
-                        LastFrameCollisionInfo* lastFrameInfo, MemoryAllocator& shapeAllocator);
+                        decimal contactMargin, LastFrameCollisionInfo* lastFrameInfo);
+
+        /// Return a triangle shape set with a given triangle of a concave shape
+        TriangleShape* getTriangleShape(const Vector3* vertices, const Vector3* verticesNormals, uint32 shapeId,
+                                        uint8 internalEdges, HalfEdgeStructure& triangleHalfEdgeStructure);
 
         /// Get a reference to the sphere vs sphere batch
         NarrowPhaseInfoBatch& getSphereVsSphereBatch();
@@ -89,6 +115,9 @@ class NarrowPhaseInput {
         /// Get a reference to the convex polyhedron vs convex polyhedron batch
         NarrowPhaseInfoBatch& getConvexPolyhedronVsConvexPolyhedronBatch();
 
+        /// Get a reference to the generic convex vs convex batch
+        NarrowPhaseInfoBatch& getGenericConvexVsConvexBatch();
+
         /// Reserve memory for the containers with cached capacity
         void reserveMemory();
 
@@ -127,30 +156,38 @@ RP3D_FORCE_INLINE NarrowPhaseInfoBatch &NarrowPhaseInput::getConvexPolyhedronVsC
    return mConvexPolyhedronVsConvexPolyhedronBatch;
 }
 
+// Get a reference to the generic convex vs convex batch contacts
+RP3D_FORCE_INLINE NarrowPhaseInfoBatch& NarrowPhaseInput::getGenericConvexVsConvexBatch() {
+   return mGenericConvexVsConvexBatch;
+}
+
 // Add shapes to be tested during narrow-phase collision detection into the batch
 RP3D_FORCE_INLINE void NarrowPhaseInput::addNarrowPhaseTest(uint64 pairId, Entity collider1, Entity collider2, CollisionShape* shape1, CollisionShape* shape2,
                                           const Transform& shape1Transform, const Transform& shape2Transform,
-                                          NarrowPhaseAlgorithmType narrowPhaseAlgorithmType, bool reportContacts, LastFrameCollisionInfo* lastFrameInfo,
-                                          MemoryAllocator& shapeAllocator) {
+                                          NarrowPhaseAlgorithmType narrowPhaseAlgorithmType, bool reportContacts, decimal contactMargin,
+                                          LastFrameCollisionInfo* lastFrameInfo) {
 
     switch (narrowPhaseAlgorithmType) {
         case NarrowPhaseAlgorithmType::SphereVsSphere:
-            mSphereVsSphereBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
+            mSphereVsSphereBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, contactMargin, lastFrameInfo);
             break;
         case NarrowPhaseAlgorithmType::SphereVsCapsule:
-            mSphereVsCapsuleBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
+            mSphereVsCapsuleBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, contactMargin, lastFrameInfo);
             break;
         case NarrowPhaseAlgorithmType::CapsuleVsCapsule:
-            mCapsuleVsCapsuleBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
+            mCapsuleVsCapsuleBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, contactMargin, lastFrameInfo);
             break;
         case NarrowPhaseAlgorithmType::SphereVsConvexPolyhedron:
-            mSphereVsConvexPolyhedronBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
+            mSphereVsConvexPolyhedronBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, contactMargin, lastFrameInfo);
             break;
         case NarrowPhaseAlgorithmType::CapsuleVsConvexPolyhedron:
-            mCapsuleVsConvexPolyhedronBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
+            mCapsuleVsConvexPolyhedronBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, contactMargin, lastFrameInfo);
             break;
         case NarrowPhaseAlgorithmType::ConvexPolyhedronVsConvexPolyhedron:
-            mConvexPolyhedronVsConvexPolyhedronBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, lastFrameInfo, shapeAllocator);
+            mConvexPolyhedronVsConvexPolyhedronBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, contactMargin, lastFrameInfo);
+            break;
+        case NarrowPhaseAlgorithmType::GenericConvexVsConvex:
+            mGenericConvexVsConvexBatch.addNarrowPhaseInfo(pairId, collider1, collider2, shape1, shape2, shape1Transform, shape2Transform, reportContacts, contactMargin, lastFrameInfo);
             break;
         case NarrowPhaseAlgorithmType::None:
             // Must never happen
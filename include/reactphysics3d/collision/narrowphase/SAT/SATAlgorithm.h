@@ -87,9 +87,16 @@ class SATAlgorithm {
 
         // -------------------- Methods -------------------- //
 
+        /// Compute the penetration depth between two polyhedrons along a given axis
+        decimal computePenetrationDepthAlongAxis(const ConvexPolyhedronShape* polyhedron1, const ConvexPolyhedronShape* polyhedron2,
+                                                 const Transform& polyhedron2ToPolyhedron1, const Transform& polyhedron1ToPolyhedron2,
+                                                 const Vector3& axisPolyhedron2Space, uint32& supportVertexIndex1,
+                                                 uint32& supportVertexIndex2) const;
+
         /// Return true if two edges of two polyhedrons build a minkowski face (and can therefore be a separating axis)
         bool testEdgesBuildMinkowskiFace(const ConvexPolyhedronShape* polyhedron1, const HalfEdgeStructure::Edge& edge1,
-                                         const ConvexPolyhedronShape* polyhedron2, const HalfEdgeStructure::Edge& edge2,
+                                         const Vector3& edge1Direction, const ConvexPolyhedronShape* polyhedron2,
+                                         const HalfEdgeStructure::Edge& edge2, const Vector3& edge2Direction,
                                          const Transform& polyhedron1ToPolyhedron2) const;
 
         /// Return true if the arcs AB and CD on the Gauss Map intersect
@@ -107,12 +114,13 @@ class SATAlgorithm {
         decimal testSingleFaceDirectionPolyhedronVsPolyhedron(const ConvexPolyhedronShape* polyhedron1,
                                                               const ConvexPolyhedronShape* polyhedron2,
                                                               const Transform& polyhedron1ToPolyhedron2,
-                                                              uint32 faceIndex) const;
+                                                              uint32 faceIndex, uint32& supportVertexIndex) const;
 
 
         /// Test all the normals of a polyhedron for separating axis in the polyhedron vs polyhedron case
         decimal testFacesDirectionPolyhedronVsPolyhedron(const ConvexPolyhedronShape* polyhedron1, const ConvexPolyhedronShape* polyhedron2,
-                                                        const Transform& polyhedron1ToPolyhedron2, uint& minFaceIndex) const;
+                                                        const Transform& polyhedron1ToPolyhedron2, decimal contactMargin,
+                                                        uint& minFaceIndex, uint32& supportVertexIndex) const;
 
         /// Compute the penetration depth between a face of the polyhedron and a sphere along the polyhedron face normal direction
         decimal computePolyhedronFaceVsSpherePenetrationDepth(uint32 faceIndex, const ConvexPolyhedronShape* polyhedron,
@@ -129,12 +137,6 @@ class SATAlgorithm {
                                                                  const Vector3& edgeDirectionCapsuleSpace,
                                                                  const Transform& polyhedronToCapsuleTransform, Vector3& outAxis) const;
 
-        /// Compute the contact points between two faces of two convex polyhedra.
-        bool computePolyhedronVsPolyhedronFaceContactPoints(bool isMinPenetrationFaceNormalPolyhedron1, const ConvexPolyhedronShape* polyhedron1,
-                                                            const ConvexPolyhedronShape* polyhedron2, const Transform& polyhedron1ToPolyhedron2,
-                                                            const Transform& polyhedron2ToPolyhedron1, uint32 minFaceIndex,
-                                                            NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex) const;
-
 
     public :
 
@@ -173,6 +175,12 @@ class SATAlgorithm {
         /// Test collision between two convex meshes
         bool testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex, uint32 batchNbItems) const;
 
+        /// Compute the contact points between two faces of two convex polyhedra.
+        bool computePolyhedronVsPolyhedronFaceContactPoints(bool isMinPenetrationFaceNormalPolyhedron1, const ConvexPolyhedronShape* polyhedron1,
+                                                            const ConvexPolyhedronShape* polyhedron2, const Transform& polyhedron1ToPolyhedron2,
+                                                            const Transform& polyhedron2ToPolyhedron1, uint32 minFaceIndex,
+                                                            NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex) const;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Set the profiler
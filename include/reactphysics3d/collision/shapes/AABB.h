@@ -112,6 +112,9 @@ class AABB {
         /// Apply a scale factor to the AABB
         void applyScale(const Vector3& scale);
 
+        /// Replace the AABB by the AABB of the current one transformed by a given transform
+        void applyTransform(const Transform& transform);
+
         /// Create and return an AABB for a triangle
         static AABB createAABBForTriangle(const Vector3* trianglePoints);
 
@@ -202,6 +205,20 @@ RP3D_FORCE_INLINE void AABB::applyScale(const Vector3& scale) {
     mMaxCoordinates = mMaxCoordinates * scale;
 }
 
+// Replace the AABB by the AABB of the current one transformed by a given transform
+/// The resulting AABB contains the transformed box and therefore it can be larger than the
+/// AABB of the object that was inside the current AABB.
+RP3D_FORCE_INLINE void AABB::applyTransform(const Transform& transform) {
+
+    const Vector3 center = transform * getCenter();
+    const Vector3 halfExtent = getExtent() * decimal(0.5);
+    const Matrix3x3 matrix = transform.getOrientation().getMatrix().getAbsoluteMatrix();
+    const Vector3 transformedHalfExtent = matrix * halfExtent;
+
+    mMinCoordinates = center - transformedHalfExtent;
+    mMaxCoordinates = center + transformedHalfExtent;
+}
+
 // Merge the AABB in parameter with the current one
 RP3D_FORCE_INLINE void AABB::mergeWithAABB(const AABB& aabb) {
     mMinCoordinates.x = std::min(mMinCoordinates.x, aabb.mMinCoordinates.x);
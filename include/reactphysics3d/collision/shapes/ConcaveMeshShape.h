@@ -171,6 +171,7 @@ class ConcaveMeshShape : public ConcaveShape {
         /// Compute all the triangles of the mesh that are overlapping with the AABB in parameter
         virtual void computeOverlappingTriangles(const AABB& localAABB, Array<Vector3>& triangleVertices,
                                                  Array<Vector3> &triangleVerticesNormals, Array<uint32>& shapeIds,
+                                                 Array<uint8>& trianglesInternalEdges,
                                                  MemoryAllocator& allocator) const override;
 
         /// Destructor
@@ -74,6 +74,9 @@ class ConvexMeshShape : public ConvexPolyhedronShape {
         /// Return a local support point in a given direction without the object margin.
         virtual Vector3 getLocalSupportPointWithoutMargin(const Vector3& direction) const override;
 
+        /// Return a local support point without the object margin starting the search from a given vertex
+        virtual Vector3 getLocalSupportPointWithoutMarginFromVertex(const Vector3& direction, uint32& supportVertexIndex) const override;
+
         /// Return true if a point is inside the collision shape
         virtual bool testPointInside(const Vector3& localPoint, Collider* collider) const override;
 
@@ -132,6 +135,9 @@ class ConvexMeshShape : public ConvexPolyhedronShape {
         /// Return the normal vector of a given face of the polyhedron
         virtual Vector3 getFaceNormal(uint32 faceIndex) const override;
 
+        /// Return the direction (end vertex minus start vertex) of a given half-edge
+        virtual Vector3 getEdgeDirection(uint32 edgeIndex) const override;
+
         /// Return the centroid of the polyhedron
         virtual Vector3 getCentroid() const override;
 
@@ -236,6 +242,12 @@ RP3D_FORCE_INLINE Vector3 ConvexMeshShape::getFaceNormal(uint32 faceIndex) const
     return mPolyhedronMesh->getFaceNormal(faceIndex);
 }
 
+// Return the direction (end vertex minus start vertex) of a given half-edge
+RP3D_FORCE_INLINE Vector3 ConvexMeshShape::getEdgeDirection(uint32 edgeIndex) const {
+    assert(edgeIndex < getNbHalfEdges());
+    return mPolyhedronMesh->getEdgeDirection(edgeIndex) * mScale;
+}
+
 // Return the centroid of the polyhedron
 RP3D_FORCE_INLINE Vector3 ConvexMeshShape::getCentroid() const {
     return mPolyhedronMesh->getCentroid() * mScale;
@@ -82,6 +82,9 @@ class ConvexPolyhedronShape : public ConvexShape {
         /// Return a given half-edge of the polyhedron
         virtual const HalfEdgeStructure::Edge& getHalfEdge(uint32 edgeIndex) const=0;
 
+        /// Return the direction (end vertex minus start vertex) of a given half-edge
+        virtual Vector3 getEdgeDirection(uint32 edgeIndex) const;
+
         /// Return true if the collision shape is a polyhedron
         virtual bool isPolyhedron() const override;
 
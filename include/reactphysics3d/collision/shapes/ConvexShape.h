@@ -54,6 +54,9 @@ class ConvexShape : public CollisionShape {
         /// Return a local support point in a given direction without the object margin
         virtual Vector3 getLocalSupportPointWithoutMargin(const Vector3& direction) const=0;
 
+        /// Return a local support point without the object margin starting the search from a given vertex
+        virtual Vector3 getLocalSupportPointWithoutMarginFromVertex(const Vector3& direction, uint32& supportVertexIndex) const;
+
     public :
 
         // -------------------- Methods -------------------- //
@@ -80,6 +83,7 @@ class ConvexShape : public CollisionShape {
 
         friend class GJKAlgorithm;
         friend class SATAlgorithm;
+        friend class EPAAlgorithm;
 };
 
 // Return true if the collision shape is convex, false if it is concave
@@ -94,6 +94,10 @@ class HeightFieldShape : public ConcaveShape {
         /// Reference to the half-edge structure
         HalfEdgeStructure& mTriangleHalfEdgeStructure;
 
+        /// Internal edges flags of the triangles of the height field (indexed by the triangle shape IDs).
+        /// The bit i is set if the edge between the vertices i and (i+1)%3 of the triangle is an internal edge
+        Array<uint8> mTrianglesInternalEdges;
+
         // -------------------- Methods -------------------- //
 
         /// Constructor
@@ -123,6 +127,9 @@ class HeightFieldShape : public ConcaveShape {
         /// Compute the shape Id for a given triangle
         uint32 computeTriangleShapeId(uint32 iIndex, uint32 jIndex, uint32 secondTriangleIncrement) const;
 
+        /// Compute the internal edges flags of all the triangles of the height field
+        void computeInternalEdges();
+
         /// Compute the first grid cell of the heightfield intersected by a ray
         bool computeEnteringRayGridCoordinates(const Ray& ray, int& i, int& j, Vector3& outHitPoint) const;
         
@@ -158,6 +165,7 @@ class HeightFieldShape : public ConcaveShape {
         /// Use a callback method on all triangles of the concave shape inside a given AABB
         virtual void computeOverlappingTriangles(const AABB& localAABB, Array<Vector3>& triangleVertices,
                                                    Array<Vector3>& triangleVerticesNormals, Array<uint32>& shapeIds,
+                                                   Array<uint8>& trianglesInternalEdges,
                                                    MemoryAllocator& allocator) const override;
 
         /// Return the string representation of the shape
@@ -79,6 +79,10 @@ class TriangleShape : public ConvexPolyhedronShape {
         /// Reference to triangle half-edge structure
         HalfEdgeStructure& mTriangleHalfEdgeStructure;
 
+        /// Internal edges flags of the triangle in its mesh (bit i is set if the
+        /// edge between the vertices i and (i+1)%3 is an internal edge of the mesh)
+        uint8 mInternalEdges;
+
         // -------------------- Methods -------------------- //
 
         /// Return a local support point in a given direction without the object margin
@@ -99,6 +103,9 @@ class TriangleShape : public ConvexPolyhedronShape {
         /// Generate the id of the shape (used for temporal coherence)
         void generateId();
 
+        /// Set the vertices, the vertices normals and the id of the triangle
+        void setTriangle(const Vector3* vertices, const Vector3* verticesNormals, uint32 shapeId, uint8 internalEdges);
+
         // -------------------- Methods -------------------- //
 
         /// This method implements the technique described in Game Physics Pearl book
@@ -107,8 +114,8 @@ class TriangleShape : public ConvexPolyhedronShape {
                                       Vector3& outNewLocalContactPointOtherShape, Vector3& outSmoothWorldContactTriangleNormal) const;
 
         /// Constructor
-        TriangleShape(const Vector3* vertices, const Vector3* verticesNormals, uint32 shapeId, HalfEdgeStructure& triangleHalfEdgeStructure,
-                      MemoryAllocator& allocator);
+        TriangleShape(const Vector3* vertices, const Vector3* verticesNormals, uint32 shapeId, uint8 internalEdges,
+                      HalfEdgeStructure& triangleHalfEdgeStructure, MemoryAllocator& allocator);
 
         /// Constructor
         TriangleShape(const Vector3* vertices, uint32 shapeId, HalfEdgeStructure& triangleHalfEdgeStructure, MemoryAllocator& allocator);
@@ -187,6 +194,7 @@ class TriangleShape : public ConvexPolyhedronShape {
         friend class MiddlePhaseTriangleCallback;
         friend class HeightFieldShape;
         friend class CollisionDetectionSystem;
+        friend class NarrowPhaseInput;
 };
 
 // Return the number of bytes used by the collision shape
@@ -305,7 +313,8 @@ RP3D_FORCE_INLINE decimal TriangleShape::getVolume() const {
 /// of the Game Physics Pearl book by Gino van der Bergen and Dirk Gregorius. The vertices normals of the
 /// mesh are either provided by the user or precomputed if the user did not provide them. Note that we only
 /// use the interpolated normal if the contact point is on an edge of the triangle. If the contact is in the
-/// middle of the triangle, we return the true triangle normal.
+/// middle of the triangle or only on edges that are flat or concave internal edges of the mesh (precomputed
+/// from the triangles adjacency), we return the true triangle normal.
 RP3D_FORCE_INLINE Vector3 TriangleShape::computeSmoothLocalContactNormalForTriangle(const Vector3& localContactPoint) const {
 
     assert(mNormal.length() > decimal(0.0));
@@ -321,6 +330,28 @@ RP3D_FORCE_INLINE Vector3 TriangleShape::computeSmoothLocalContactNormalForTrian
         return mNormal;
     }
 
+    // If the triangle has internal edges
+    if (mInternalEdges != 0) {
+
+        // Barycentric coordinate of the vertex opposite to each edge (edge i is between vertices i and (i+1)%3)
+        const decimal oppositeVertexWeights[3] = {w, u, v};
+
+        // Check if all the edges touched by the contact point are internal edges
+        bool isOnInternalEdgesOnly = true;
+        for (uint8 i = 0; i < 3; i++) {
+            if (oppositeVertexWeights[i] <= MACHINE_EPSILON && (mInternalEdges & (1 << i)) == 0) {
+                isOnInternalEdgesOnly = false;
+                break;
+            }
+        }
+
+        // A contact on an internal edge must not push the other shape away from the surface
+        // of the mesh. Therefore, we use the triangle face normal
+        if (isOnInternalEdgesOnly) {
+            return mNormal;
+        }
+    }
+
     // We compute the contact normal as the barycentric interpolation of the three vertices normals
     const Vector3 interpolatedNormal = u * mVerticesNormals[0] + v * mVerticesNormals[1] + w * mVerticesNormals[2];
 
@@ -76,6 +76,21 @@ class BallAndSocketJointComponents : public Components {
         /// Inertia tensor of body 2 (in world-space coordinates)
         Matrix3x3* mI2;
 
+        /// Inverse mass of body 1
+        decimal* mInverseMassBody1;
+
+        /// Inverse mass of body 2
+        decimal* mInverseMassBody2;
+
+        /// Index of the joint in the joint components (resolved before solving)
+        uint32* mJointComponentIndices;
+
+        /// Index of body 1 in the rigid body components (resolved before solving)
+        uint32* mBody1ComponentIndices;
+
+        /// Index of body 2 in the rigid body components (resolved before solving)
+        uint32* mBody2ComponentIndices;
+
         /// Bias vector for the constraint
         Vector3* mBiasVector;
 
@@ -246,6 +261,8 @@ class BallAndSocketJointComponents : public Components {
 
         friend class BroadPhaseSystem;
         friend class SolveBallAndSocketJointSystem;
+        friend class ArticulationSolverSystem;
+        friend class ConstraintSolverSystem;
 };
 
 // Return a pointer to a given joint
@@ -93,6 +93,10 @@ class ColliderComponents : public Components {
         /// Array with the involved overlapping pairs for each collider
         Array<uint64>* mOverlappingPairs;
 
+        /// Array with the minimum total penetration impulse of a persisting contact
+        /// for it to be reported to the event listener
+        decimal* mContactReportImpulseThresholds;
+
         /// True if the size of the collision shape associated with the collider
         /// has been changed by the user
         bool* mHasCollisionShapeChangedSize;
@@ -100,9 +104,16 @@ class ColliderComponents : public Components {
         /// True if the collider is a trigger
         bool* mIsTrigger;
 
+        /// True if the contacts of the collider must be reported to the event listener
+        bool* mReportContacts;
+
         /// Array with the material of each collider
         Material* mMaterials;
 
+        /// True if the material of the collider might have been modified by the user since the
+        /// mixed materials of its overlapping pairs have been computed
+        bool* mHasMaterialChanged;
+
 
         // -------------------- Methods -------------------- //
 
@@ -209,6 +220,18 @@ class ColliderComponents : public Components {
         /// Set whether a collider is a trigger
         void setIsTrigger(Entity colliderEntity, bool isTrigger);
 
+        /// Return true if the contacts of a collider must be reported to the event listener
+        bool getReportContacts(Entity colliderEntity) const;
+
+        /// Set whether the contacts of a collider must be reported to the event listener
+        void setReportContacts(Entity colliderEntity, bool reportContacts);
+
+        /// Return the contact report impulse threshold of a collider
+        decimal getContactReportImpulseThreshold(Entity colliderEntity) const;
+
+        /// Set the contact report impulse threshold of a collider
+        void setContactReportImpulseThreshold(Entity colliderEntity, decimal impulseThreshold);
+
         /// Return a reference to the material of a collider
         Material& getMaterial(Entity colliderEntity);
 
@@ -370,6 +393,38 @@ RP3D_FORCE_INLINE void ColliderComponents::setIsTrigger(Entity colliderEntity, b
     mIsTrigger[mMapEntityToComponentIndex[colliderEntity]] = isTrigger;
 }
 
+// Return true if the contacts of a collider must be reported to the event listener
+RP3D_FORCE_INLINE bool ColliderComponents::getReportContacts(Entity colliderEntity) const {
+
+    assert(mMapEntityToComponentIndex.containsKey(colliderEntity));
+
+    return mReportContacts[mMapEntityToComponentIndex[colliderEntity]];
+}
+
+// Set whether the contacts of a collider must be reported to the event listener
+RP3D_FORCE_INLINE void ColliderComponents::setReportContacts(Entity colliderEntity, bool reportContacts) {
+
+    assert(mMapEntityToComponentIndex.containsKey(colliderEntity));
+
+    mReportContacts[mMapEntityToComponentIndex[colliderEntity]] = reportContacts;
+}
+
+// Return the contact report impulse threshold of a collider
+RP3D_FORCE_INLINE decimal ColliderComponents::getContactReportImpulseThreshold(Entity colliderEntity) const {
+
+    assert(mMapEntityToComponentIndex.containsKey(colliderEntity));
+
+    return mContactReportImpulseThresholds[mMapEntityToComponentIndex[colliderEntity]];
+}
+
+// Set the contact report impulse threshold of a collider
+RP3D_FORCE_INLINE void ColliderComponents::setContactReportImpulseThreshold(Entity colliderEntity, decimal impulseThreshold) {
+
+    assert(mMapEntityToComponentIndex.containsKey(colliderEntity));
+
+    mContactReportImpulseThresholds[mMapEntityToComponentIndex[colliderEntity]] = impulseThreshold;
+}
+
 // Return a reference to the material of a collider
 RP3D_FORCE_INLINE Material& ColliderComponents::getMaterial(Entity colliderEntity) {
 
@@ -383,6 +438,7 @@ RP3D_FORCE_INLINE void ColliderComponents::setMaterial(Entity colliderEntity, co
 
     assert(mMapEntityToComponentIndex.containsKey(colliderEntity));
 
+    // The material keeps its collider that is notified of the modification
     mMaterials[mMapEntityToComponentIndex[colliderEntity]] = material;
 }
 
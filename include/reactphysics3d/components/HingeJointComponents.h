@@ -77,6 +77,21 @@ class HingeJointComponents : public Components {
         /// Inertia tensor of body 2 (in world-space coordinates)
         Matrix3x3* mI2;
 
+        /// Inverse mass of body 1
+        decimal* mInverseMassBody1;
+
+        /// Inverse mass of body 2
+        decimal* mInverseMassBody2;
+
+        /// Index of the joint in the joint components (resolved before solving)
+        uint32* mJointComponentIndices;
+
+        /// Index of body 1 in the rigid body components (resolved before solving)
+        uint32* mBody1ComponentIndices;
+
+        /// Index of body 2 in the rigid body components (resolved before solving)
+        uint32* mBody2ComponentIndices;
+
         /// Accumulated impulse for the 3 translation constraints
         Vector3* mImpulseTranslation;
 
@@ -412,6 +427,8 @@ class HingeJointComponents : public Components {
 
         friend class BroadPhaseSystem;
         friend class SolveHingeJointSystem;
+        friend class ArticulationSolverSystem;
+        friend class ConstraintSolverSystem;
         friend class HingeJoint;
 };
 
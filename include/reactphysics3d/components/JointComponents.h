@@ -76,6 +76,15 @@ class JointComponents : public Components {
         /// True if the joint has already been added into an island during islands creation
         bool* mIsAlreadyInIsland;
 
+        /// True if the joint is part of an articulation
+        bool* mIsArticulated;
+
+        /// True if the equality constraints of the joint are solved directly by the articulation solver in the current step
+        bool* mIsSolvedDirectly;
+
+        /// True if the position error of the joint is larger than the slop after the integration of the positions
+        bool* mHasPositionError;
+
         // -------------------- Methods -------------------- //
 
         /// Allocate memory for a given number of components
@@ -101,12 +110,15 @@ class JointComponents : public Components {
             JointType jointType;
             JointsPositionCorrectionTechnique positionCorrectionTechnique;
             bool isCollisionEnabled;
+            bool isArticulated;
 
             /// Constructor
             JointComponent(Entity body1Entity, Entity body2Entity, Joint* joint, JointType jointType,
-                           JointsPositionCorrectionTechnique positionCorrectionTechnique, bool isCollisionEnabled)
+                           JointsPositionCorrectionTechnique positionCorrectionTechnique, bool isCollisionEnabled,
+                           bool isArticulated)
                 : body1Entity(body1Entity), body2Entity(body2Entity), joint(joint), jointType(jointType),
-                  positionCorrectionTechnique(positionCorrectionTechnique), isCollisionEnabled(isCollisionEnabled)  {
+                  positionCorrectionTechnique(positionCorrectionTechnique), isCollisionEnabled(isCollisionEnabled),
+                  isArticulated(isArticulated) {
 
             }
         };
@@ -146,6 +158,12 @@ class JointComponents : public Components {
         /// Set whether the collision is enabled between the two bodies of a joint
         void setIsCollisionEnabled(Entity jointEntity, bool isCollisionEnabled);
 
+        /// Return true if the joint is part of an articulation
+        bool getIsArticulated(Entity jointEntity) const;
+
+        /// Set whether the joint is part of an articulation
+        void setIsArticulated(Entity jointEntity, bool isArticulated);
+
         /// Return true if the joint has already been added into an island during island creation
         bool getIsAlreadyInIsland(Entity jointEntity) const;
 
@@ -156,6 +174,7 @@ class JointComponents : public Components {
 
         friend class BroadPhaseSystem;
         friend class ConstraintSolverSystem;
+        friend class ArticulationSolverSystem;
         friend class PhysicsWorld;
         friend class SolveBallAndSocketJointSystem;
         friend class SolveFixedJointSystem;
@@ -212,6 +231,18 @@ RP3D_FORCE_INLINE void JointComponents::setIsCollisionEnabled(Entity jointEntity
     mIsCollisionEnabled[mMapEntityToComponentIndex[jointEntity]] = isCollisionEnabled;
 }
 
+// Return true if the joint is part of an articulation
+RP3D_FORCE_INLINE bool JointComponents::getIsArticulated(Entity jointEntity) const {
+    assert(mMapEntityToComponentIndex.containsKey(jointEntity));
+    return mIsArticulated[mMapEntityToComponentIndex[jointEntity]];
+}
+
+// Set whether the joint is part of an articulation
+RP3D_FORCE_INLINE void JointComponents::setIsArticulated(Entity jointEntity, bool isArticulated) {
+    assert(mMapEntityToComponentIndex.containsKey(jointEntity));
+    mIsArticulated[mMapEntityToComponentIndex[jointEntity]] = isArticulated;
+}
+
 // Return true if the joint has already been added into an island during island creation
 RP3D_FORCE_INLINE bool JointComponents::getIsAlreadyInIsland(Entity jointEntity) const {
     assert(mMapEntityToComponentIndex.containsKey(jointEntity));
@@ -160,6 +160,9 @@ class RigidBodyComponents : public Components {
         /// Array with gravity scales
         decimal* mGravityScales;
 
+        /// Array with the solver priorities (fraction of the solver iterations used by the island of the body)
+        decimal* mSolverPriorities;
+
         // -------------------- Methods -------------------- //
 
         /// Allocate memory for a given number of components
@@ -381,6 +384,12 @@ class RigidBodyComponents : public Components {
         /// Set the gravity scale of a body component.
         void setGravityScale(Entity bodyEntity, decimal gravityScale);
 
+        /// Return the solver priority of a body component
+        decimal getSolverPriority(Entity bodyEntity) const;
+
+        /// Set the solver priority of a body component
+        void setSolverPriority(Entity bodyEntity, decimal solverPriority);
+
         // -------------------- Friendship -------------------- //
 
         friend class PhysicsWorld;
@@ -390,6 +399,7 @@ class RigidBodyComponents : public Components {
         friend class SolveFixedJointSystem;
         friend class SolveHingeJointSystem;
         friend class SolveSliderJointSystem;
+        friend class ArticulationSolverSystem;
         friend class DynamicsSystem;
         friend class BallAndSocketJoint;
         friend class FixedJoint;
@@ -868,6 +878,22 @@ RP3D_FORCE_INLINE void RigidBodyComponents::setGravityScale(Entity bodyEntity, d
   mGravityScales[mMapEntityToComponentIndex[bodyEntity]] = gravityScale;
 }
 
+// Return the solver priority of a body component
+RP3D_FORCE_INLINE decimal RigidBodyComponents::getSolverPriority(Entity bodyEntity) const {
+
+   assert(mMapEntityToComponentIndex.containsKey(bodyEntity));
+
+   return mSolverPriorities[mMapEntityToComponentIndex[bodyEntity]];
+}
+
+// Set the solver priority of a body component
+RP3D_FORCE_INLINE void RigidBodyComponents::setSolverPriority(Entity bodyEntity, decimal solverPriority) {
+
+   assert(mMapEntityToComponentIndex.containsKey(bodyEntity));
+
+   mSolverPriorities[mMapEntityToComponentIndex[bodyEntity]] = solverPriority;
+}
+
 }
 
 #endif
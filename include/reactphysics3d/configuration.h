@@ -114,6 +114,16 @@ constexpr decimal PI_TIMES_2 = decimal(6.28318530);
 /// without triggering a large modification of the tree each frame which can be costly
 constexpr decimal DYNAMIC_TREE_FAT_AABB_INFLATE_PERCENTAGE = decimal(0.08);
 
+/// In the convex vs concave middle-phase, the triangles of the concave shape are computed for an AABB
+/// inflated by a constant percentage of the size of the convex shape AABB. Those triangles are cached and
+/// reused in the next frames as long as the convex shape stays inside this larger AABB
+constexpr decimal CONCAVE_PAIR_TRIANGLES_CACHE_AABB_INFLATE_PERCENTAGE = decimal(0.5);
+
+/// An edge shared by two triangles of a triangle mesh is an internal edge if the two triangles form a concave or
+/// a flat surface or a convex surface with an angle (in radians) smaller than this value. The contacts on an internal
+/// edge use the normal of the triangle to avoid the collisions with the internal edges of smooth surfaces
+constexpr decimal TRIANGLE_MESH_INTERNAL_EDGE_MAX_CONVEX_ANGLE = decimal(0.05);
+
 /// Maximum number of contact points in a narrow phase info object
 constexpr uint8 NB_MAX_CONTACT_POINTS_IN_NARROWPHASE_INFO = 16;
 
@@ -129,6 +139,17 @@ constexpr uint16 NB_MAX_CONTACT_POINTS_IN_POTENTIAL_MANIFOLD = 256;
 /// Distance threshold to consider that two contact points in a manifold are the same
 constexpr decimal SAME_CONTACT_POINT_DISTANCE_THRESHOLD = decimal(0.01);
 
+/// Minimum number of vertices of a convex mesh to compute its support points with hill-climbing
+/// on the half-edge structure instead of a linear scan of the vertices
+constexpr uint32 CONVEX_MESH_HILL_CLIMBING_MIN_NB_VERTICES = 32;
+
+/// Alignment (in bytes) of the baked vertices, face planes and edge directions arrays of a polyhedron mesh
+constexpr size_t POLYHEDRON_MESH_BAKED_DATA_ALIGNMENT = 32;
+
+/// Cosine of the maximal angle between the EPA penetration normal and the normal of a face (or of
+/// the disc of a cylinder or cone) to create the contact points of this face (instead of a single point)
+constexpr decimal EPA_FACE_CONTACT_MIN_COS_ANGLE = decimal(0.995);
+
 /// Current version of ReactPhysics3D
 const std::string RP3D_VERSION = std::string("0.9.0");
 
@@ -81,7 +81,7 @@ class ContactPoint {
         // -------------------- Methods -------------------- //
 
         /// Update the contact point with a new one that is similar (very close)
-        void update(const ContactPointInfo* contactInfo);
+        void update(const ContactPointInfo* contactInfo, decimal contactMargin);
 
         /// Return true if the contact point is similar (close enougth) to another given contact point
         bool isSimilarWithContactPoint(const ContactPointInfo* contactPoint) const;
@@ -98,10 +98,10 @@ class ContactPoint {
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        ContactPoint(const ContactPointInfo* contactInfo, decimal persistentContactDistanceThreshold);
+        ContactPoint(const ContactPointInfo* contactInfo, decimal persistentContactDistanceThreshold, decimal contactMargin);
 
         /// Constructor
-        ContactPoint(const ContactPointInfo& contactInfo, decimal persistentContactDistanceThreshold);
+        ContactPoint(const ContactPointInfo& contactInfo, decimal persistentContactDistanceThreshold, decimal contactMargin);
 
         /// Destructor
         ~ContactPoint() = default;
@@ -68,11 +68,16 @@ struct JointInfo {
         /// True if the two bodies of the joint are allowed to collide with each other
         bool isCollisionEnabled;
 
+        /// True if the joint is part of an articulation. The articulated joints that link
+        /// dynamic bodies into a tree (ragdoll, rope, ...) are solved exactly by a direct solver
+        /// instead of the iterative solver. False by default
+        bool isArticulated;
+
         /// Constructor
         JointInfo(JointType constraintType)
                       : body1(nullptr), body2(nullptr), type(constraintType),
                         positionCorrectionTechnique(JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL),
-                        isCollisionEnabled(true) {
+                        isCollisionEnabled(true), isArticulated(false) {
 
         }
 
@@ -80,7 +85,7 @@ struct JointInfo {
         JointInfo(RigidBody* rigidBody1, RigidBody* rigidBody2, JointType constraintType)
                       : body1(rigidBody1), body2(rigidBody2), type(constraintType),
                         positionCorrectionTechnique(JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL),
-                        isCollisionEnabled(true) {
+                        isCollisionEnabled(true), isArticulated(false) {
         }
 
         /// Destructor
@@ -146,6 +151,12 @@ class Joint {
         /// Return true if the collision between the two bodies of the joint is enabled
         bool isCollisionEnabled() const;
 
+        /// Return true if the joint is part of an articulation
+        bool isArticulated() const;
+
+        /// Set whether the joint is part of an articulation
+        void setIsArticulated(bool isArticulated);
+
         /// Return the entity id of the joint
         Entity getEntity() const;
 
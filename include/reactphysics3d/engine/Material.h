@@ -33,6 +33,9 @@
 
 namespace reactphysics3d {
 
+// Declarations
+class Collider;
+
 // Class Material
 /**
  * This class contains the material properties of a collider that will be use for
@@ -54,15 +57,27 @@ class Material {
         /// Density of mass used to compute the mass of the collider
         decimal mMassDensity;
 
+        /// Collider that owns the material (nullptr if the material is not owned by a collider)
+        Collider* mCollider;
+
         // -------------------- Methods -------------------- //
 
         /// Constructor
         Material(decimal frictionCoefficient, decimal bounciness, decimal massDensity = decimal(1.0));
 
+        /// Notify the collider of the material that its friction or bounciness has been modified
+        void notifyColliderMaterialChanged() const;
+
     public :
 
         // -------------------- Methods -------------------- //
 
+        /// Copy-constructor (the copy is not owned by any collider)
+        Material(const Material& material);
+
+        /// Assignment operator (the material keeps its collider)
+        Material& operator=(const Material& material);
+
         /// Return the bounciness
         decimal getBounciness() const;
 
@@ -92,6 +107,7 @@ class Material {
         friend class Collider;
         friend class CollisionBody;
         friend class RigidBody;
+        friend class ColliderComponents;
 };
 
 // Return the bounciness
@@ -111,6 +127,10 @@ RP3D_FORCE_INLINE decimal Material::getBounciness() const {
 RP3D_FORCE_INLINE void Material::setBounciness(decimal bounciness) {
     assert(bounciness >= decimal(0.0) && bounciness <= decimal(1.0));
     mBounciness = bounciness;
+
+    if (mCollider != nullptr) {
+        notifyColliderMaterialChanged();
+    }
 }
 
 // Return the friction coefficient
@@ -130,6 +150,10 @@ RP3D_FORCE_INLINE decimal Material::getFrictionCoefficient() const {
 RP3D_FORCE_INLINE void Material::setFrictionCoefficient(decimal frictionCoefficient) {
     assert(frictionCoefficient >= decimal(0.0));
     mFrictionCoefficientSqrt = std::sqrt(frictionCoefficient);
+
+    if (mCollider != nullptr) {
+        notifyColliderMaterialChanged();
+    }
 }
 
 // Return the square root friction coefficient
@@ -0,0 +1,88 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+
+#ifndef REACTPHYSICS3D_MATERIAL_MIXER_H
+#define REACTPHYSICS3D_MATERIAL_MIXER_H
+
+// Libraries
+#include <reactphysics3d/engine/Material.h>
+
+namespace reactphysics3d {
+
+// Class MaterialMixer
+/**
+ * This class is used to combine the materials of the two colliders of an overlapping pair into
+ * the friction coefficient and the restitution factor used by the contact solver. The mixed values
+ * are computed once when the pair is created (and again when the material of one of its colliders
+ * is modified) and are then cached in the pair. By default, the friction coefficient is the geometric
+ * mean of the two friction coefficients and the restitution factor is the largest of the two bounciness
+ * values. In order to use other mixing rules, you need to create a new class that inherits from this one,
+ * override the methods that you need and register it to the physics world using the
+ * PhysicsWorld::setMaterialMixer() method.
+ */
+class MaterialMixer {
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        MaterialMixer() = default;
+
+        /// Destructor
+        virtual ~MaterialMixer() = default;
+
+        /// Return the friction coefficient of a contact between two colliders
+        /**
+         * @param material1 The material of the first collider
+         * @param material2 The material of the second collider
+         * @return The mixed friction coefficient (positive value)
+         */
+        virtual decimal mixFrictionCoefficients(const Material& material1, const Material& material2) const {
+
+            // Use the geometric mean to compute the mixed friction coefficient
+            return material1.getFrictionCoefficientSqrt() * material2.getFrictionCoefficientSqrt();
+        }
+
+        /// Return the restitution factor of a contact between two colliders
+        /**
+         * @param material1 The material of the first collider
+         * @param material2 The material of the second collider
+         * @return The mixed restitution factor (between 0 and 1)
+         */
+        virtual decimal mixBounciness(const Material& material1, const Material& material2) const {
+
+            const decimal restitution1 = material1.getBounciness();
+            const decimal restitution2 = material2.getBounciness();
+
+            // Return the largest restitution factor
+            return (restitution1 > restitution2) ? restitution1 : restitution2;
+        }
+};
+
+}
+
+#endif
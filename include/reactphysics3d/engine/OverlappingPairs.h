@@ -31,11 +31,14 @@
 #include <reactphysics3d/containers/Map.h>
 #include <reactphysics3d/containers/Pair.h>
 #include <reactphysics3d/containers/Set.h>
+#include <reactphysics3d/containers/Array.h>
+#include <reactphysics3d/collision/shapes/AABB.h>
 #include <reactphysics3d/containers/containers_common.h>
 #include <reactphysics3d/utils/Profiler.h>
 #include <reactphysics3d/components/ColliderComponents.h>
 #include <reactphysics3d/components/CollisionBodyComponents.h>
 #include <reactphysics3d/components/RigidBodyComponents.h>
+#include <reactphysics3d/engine/MaterialMixer.h>
 #include <cstddef>
 
 /// ReactPhysics3D namespace
@@ -76,18 +79,31 @@ struct LastFrameCollisionInfo {
     /// Previous separating axis
     Vector3 gjkSeparatingAxis;
 
+    // ----- GJK and SAT Algorithms -----
+
+    /// Index of the last support vertex of each shape (start of the hill-climbing of convex meshes)
+    uint32 supportVertexIndex1;
+    uint32 supportVertexIndex2;
+
     // SAT Algorithm
     bool satIsAxisFacePolyhedron1;
     bool satIsAxisFacePolyhedron2;
-    uint8 satMinAxisFaceIndex;
-    uint8 satMinEdge1Index;
-    uint8 satMinEdge2Index;
+    uint32 satMinAxisFaceIndex;
+    uint32 satMinEdge1Index;
+    uint32 satMinEdge2Index;
+
+    /// True if the SAT algorithm has found a separating axis in the previous frame
+    bool satHasSeparatingAxis;
+
+    /// Previous SAT separating axis (unit vector from shape 1 to shape 2 in the local-space of shape 2)
+    Vector3 satSeparatingAxis;
 
     /// Constructor
     LastFrameCollisionInfo()
         :isValid(false), isObsolete(false), wasColliding(false), wasUsingGJK(false), gjkSeparatingAxis(Vector3(0, 1, 0)),
+         supportVertexIndex1(0), supportVertexIndex2(0),
          satIsAxisFacePolyhedron1(false), satIsAxisFacePolyhedron2(false), satMinAxisFaceIndex(0),
-         satMinEdge1Index(0), satMinEdge2Index(0) {
+         satMinEdge1Index(0), satMinEdge2Index(0), satHasSeparatingAxis(false), satSeparatingAxis(Vector3(0, 1, 0)) {
 
     }
 };
@@ -98,7 +114,10 @@ struct LastFrameCollisionInfo {
  * during the broad-phase collision detection. A pair is created when
  * the two colliders start to overlap and is destroyed when they do not
  * overlap anymore. Each contains a contact manifold that
- * store all the contact points between the two bodies.
+ * store all the contact points between the two bodies. As for the
+ * components, the pairs where both bodies are sleeping or static are
+ * disabled and stored at the end of the arrays so that they can be
+ * skipped during the collision detection.
  */
 class OverlappingPairs {
 
@@ -135,12 +154,18 @@ class OverlappingPairs {
             /// True if the colliders of the overlapping pair are colliding in the current frame
             bool collidingInCurrentFrame;
 
+            /// Mixed friction coefficient of the materials of the two colliders
+            decimal frictionCoefficient;
+
+            /// Mixed restitution factor of the materials of the two colliders
+            decimal restitutionFactor;
+
             /// Constructor
             OverlappingPair(uint64 pairId, int32 broadPhaseId1, int32 broadPhaseId2, Entity collider1, Entity collider2,
                             NarrowPhaseAlgorithmType narrowPhaseAlgorithmType)
                : pairID(pairId), broadPhaseId1(broadPhaseId1), broadPhaseId2(broadPhaseId2), collider1(collider1) , collider2(collider2),
                  needToTestOverlap(false), narrowPhaseAlgorithmType(narrowPhaseAlgorithmType), collidingInPreviousFrame(false),
-                 collidingInCurrentFrame(false) {
+                 collidingInCurrentFrame(false), frictionCoefficient(0), restitutionFactor(0) {
 
             }
 
@@ -184,12 +209,36 @@ class OverlappingPairs {
                 /// shape Ids of the two collision shapes.
                 Map<uint64, LastFrameCollisionInfo*> lastFrameCollisionInfos;
 
+                /// Vertices of the cached triangles of the concave shape that overlap with the cached triangles AABB
+                Array<Vector3> cachedTrianglesVertices;
+
+                /// Vertices normals of the cached triangles of the concave shape
+                Array<Vector3> cachedTrianglesVerticesNormals;
+
+                /// Shape ids of the cached triangles of the concave shape
+                Array<uint32> cachedTrianglesShapeIds;
+
+                /// Internal edges flags of the cached triangles of the concave shape
+                Array<uint8> cachedTrianglesInternalEdges;
+
+                /// Enlarged AABB (in the local-space of the concave shape) used to compute the cached triangles.
+                /// The triangles only need to be computed again when the convex shape leaves this AABB.
+                AABB cachedTrianglesAABB;
+
+                /// Scale of the concave shape when the triangles have been cached
+                Vector3 cachedTrianglesScale;
+
+                /// True if the cached triangles have been computed
+                bool isTrianglesCacheValid;
+
                 /// Constructor
                 ConcaveOverlappingPair(uint64 pairId, int32 broadPhaseId1, int32 broadPhaseId2, Entity collider1, Entity collider2,
                                 NarrowPhaseAlgorithmType narrowPhaseAlgorithmType,
                                 bool isShape1Convex, MemoryAllocator& poolAllocator, MemoryAllocator& heapAllocator)
                   : OverlappingPair(pairId, broadPhaseId1, broadPhaseId2, collider1, collider2, narrowPhaseAlgorithmType), mPoolAllocator(&poolAllocator),
-                    isShape1Convex(isShape1Convex), lastFrameCollisionInfos(heapAllocator, 16) {
+                    isShape1Convex(isShape1Convex), lastFrameCollisionInfos(heapAllocator, 16), cachedTrianglesVertices(heapAllocator),
+                    cachedTrianglesVerticesNormals(heapAllocator), cachedTrianglesShapeIds(heapAllocator),
+                    cachedTrianglesInternalEdges(heapAllocator), isTrianglesCacheValid(false) {
 
                 }
 
@@ -285,12 +334,25 @@ class OverlappingPairs {
         /// Array of convex vs concave overlapping pairs
         Array<ConcaveOverlappingPair> mConcavePairs;
 
+        /// Index of the first disabled convex pair (pair where both bodies are sleeping or static).
+        /// Disabled pairs are stored at the end of the convex pairs array
+        uint64 mConvexDisabledStartIndex;
+
+        /// Index of the first disabled concave pair (pair where both bodies are sleeping or static).
+        /// Disabled pairs are stored at the end of the concave pairs array
+        uint64 mConcaveDisabledStartIndex;
+
         /// Map a pair id to the internal array index
         Map<uint64, uint64> mMapConvexPairIdToPairIndex;
 
         /// Map a pair id to the internal array index
         Map<uint64, uint64> mMapConcavePairIdToPairIndex;
 
+        /// Ids of the pairs that have been flagged to be tested for overlap during the next broad-phase.
+        /// Only the pairs involving a collider that has moved are added here so that we do not have
+        /// to iterate over all the overlapping pairs to find the ones that might not overlap anymore
+        Array<uint64> mPairsToTestOverlap;
+
         /// Reference to the colliders components
         ColliderComponents& mColliderComponents;
 
@@ -306,6 +368,12 @@ class OverlappingPairs {
         /// Reference to the collision dispatch
         CollisionDispatch& mCollisionDispatch;
 
+        /// Default material mixer
+        MaterialMixer mDefaultMaterialMixer;
+
+        /// Material mixer used to compute the friction and restitution of the pairs
+        MaterialMixer* mMaterialMixer;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
         /// Pointer to the profiler
@@ -315,11 +383,17 @@ class OverlappingPairs {
 
         // -------------------- Methods -------------------- //
 
-        // Move a pair from a source to a destination index in the pairs array
-        void movePairToIndex(uint64 srcIndex, uint64 destIndex);
+        /// Move a pair from a source to a destination index in the pairs array
+        void movePairToIndex(uint64 srcIndex, uint64 destIndex, bool isConvexVsConvex);
 
         /// Swap two pairs in the array
-        void swapPairs(uint64 index1, uint64 index2);
+        void swapPairs(uint64 index1, uint64 index2, bool isConvexVsConvex);
+
+        /// Return true if a given collider belongs to a body that is awake and not static
+        bool isColliderEnabled(Entity colliderEntity) const;
+
+        /// Compute the mixed friction and restitution of a pair from the materials of its colliders
+        void computeMixedMaterial(OverlappingPair& pair, uint32 collider1Index, uint32 collider2Index) const;
 
     public:
 
@@ -361,9 +435,24 @@ class OverlappingPairs {
         /// Set if we need to test a given pair for overlap
         void setNeedToTestOverlap(uint64 pairId, bool needToTestOverlap);
 
+        /// Move a pair to the enabled or disabled pairs according to the state of its bodies
+        void updatePairEnabledState(uint64 pairId);
+
+        /// Return the number of enabled convex vs convex pairs
+        uint64 getNbEnabledConvexPairs() const;
+
+        /// Return the number of enabled convex vs concave pairs
+        uint64 getNbEnabledConcavePairs() const;
+
         /// Return a reference to an overlapping pair
         OverlappingPair* getOverlappingPair(uint64 pairId);
 
+        /// Set the material mixer (nullptr to use the default one) and recompute the mixed materials of all the pairs
+        void setMaterialMixer(MaterialMixer* materialMixer);
+
+        /// Recompute the mixed materials of the pairs of a collider after its material has changed
+        void updateMixedMaterials(uint32 colliderIndex);
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
         /// Set the profiler
@@ -393,13 +482,21 @@ RP3D_FORCE_INLINE void OverlappingPairs::setNeedToTestOverlap(uint64 pairId, boo
 
     assert(mMapConvexPairIdToPairIndex.containsKey(pairId) || mMapConcavePairIdToPairIndex.containsKey(pairId));
 
+    OverlappingPair* pair;
     auto it = mMapConvexPairIdToPairIndex.find(pairId);
     if (it != mMapConvexPairIdToPairIndex.end()) {
-        mConvexPairs[static_cast<uint32>(it->second)].needToTestOverlap = needToTestOverlap;
+        pair = &(mConvexPairs[static_cast<uint32>(it->second)]);
     }
     else {
-        mConcavePairs[static_cast<uint32>(mMapConcavePairIdToPairIndex[pairId])].needToTestOverlap = needToTestOverlap;
+        pair = &(mConcavePairs[static_cast<uint32>(mMapConcavePairIdToPairIndex[pairId])]);
+    }
+
+    // If the pair was not already flagged, add it to the pairs to test during the next broad-phase
+    if (needToTestOverlap && !pair->needToTestOverlap) {
+        mPairsToTestOverlap.add(pairId);
     }
+
+    pair->needToTestOverlap = needToTestOverlap;
 }
 
 // Return a reference to an overlapping pair
@@ -417,6 +514,26 @@ RP3D_FORCE_INLINE OverlappingPairs::OverlappingPair* OverlappingPairs::getOverla
     return nullptr;
 }
 
+// Compute the mixed friction and restitution of a pair from the materials of its colliders
+RP3D_FORCE_INLINE void OverlappingPairs::computeMixedMaterial(OverlappingPair& pair, uint32 collider1Index, uint32 collider2Index) const {
+
+    const Material& material1 = mColliderComponents.mMaterials[collider1Index];
+    const Material& material2 = mColliderComponents.mMaterials[collider2Index];
+
+    pair.frictionCoefficient = mMaterialMixer->mixFrictionCoefficients(material1, material2);
+    pair.restitutionFactor = mMaterialMixer->mixBounciness(material1, material2);
+}
+
+// Return the number of enabled convex vs convex pairs
+RP3D_FORCE_INLINE uint64 OverlappingPairs::getNbEnabledConvexPairs() const {
+    return mConvexDisabledStartIndex;
+}
+
+// Return the number of enabled convex vs concave pairs
+RP3D_FORCE_INLINE uint64 OverlappingPairs::getNbEnabledConcavePairs() const {
+    return mConcaveDisabledStartIndex;
+}
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 // Set the profiler
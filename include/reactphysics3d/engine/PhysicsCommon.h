@@ -32,6 +32,8 @@
 #include <reactphysics3d/collision/shapes/SphereShape.h>
 #include <reactphysics3d/collision/shapes/BoxShape.h>
 #include <reactphysics3d/collision/shapes/CapsuleShape.h>
+#include <reactphysics3d/collision/shapes/CylinderShape.h>
+#include <reactphysics3d/collision/shapes/ConeShape.h>
 #include <reactphysics3d/collision/shapes/HeightFieldShape.h>
 #include <reactphysics3d/collision/shapes/ConvexMeshShape.h>
 #include <reactphysics3d/collision/shapes/ConcaveMeshShape.h>
@@ -68,6 +70,12 @@ class PhysicsCommon {
         /// Set of capsule shapes
         Set<CapsuleShape*> mCapsuleShapes;
 
+        /// Set of cylinder shapes
+        Set<CylinderShape*> mCylinderShapes;
+
+        /// Set of cone shapes
+        Set<ConeShape*> mConeShapes;
+
         /// Set of convex mesh shapes
         Set<ConvexMeshShape*> mConvexMeshShapes;
 
@@ -118,6 +126,12 @@ class PhysicsCommon {
         /// Delete a capsule collision shape
         void deleteCapsuleShape(CapsuleShape* capsuleShape);
 
+        /// Delete a cylinder collision shape
+        void deleteCylinderShape(CylinderShape* cylinderShape);
+
+        /// Delete a cone collision shape
+        void deleteConeShape(ConeShape* coneShape);
+
         /// Delete a convex mesh shape
         void deleteConvexMeshShape(ConvexMeshShape* convexMeshShape);
 
@@ -190,6 +204,18 @@ class PhysicsCommon {
         /// Destroy a capsule collision shape
         void destroyCapsuleShape(CapsuleShape* capsuleShape);
 
+        /// Create and return a cylinder shape
+        CylinderShape* createCylinderShape(decimal radius, decimal height);
+
+        /// Destroy a cylinder collision shape
+        void destroyCylinderShape(CylinderShape* cylinderShape);
+
+        /// Create and return a cone shape
+        ConeShape* createConeShape(decimal radius, decimal height);
+
+        /// Destroy a cone collision shape
+        void destroyConeShape(ConeShape* coneShape);
+
         /// Create and return a convex mesh shape
         ConvexMeshShape* createConvexMeshShape(PolyhedronMesh* polyhedronMesh, const Vector3& scaling = Vector3(1,1,1));
 
@@ -214,6 +240,9 @@ class PhysicsCommon {
         /// Create a polyhedron mesh
         PolyhedronMesh* createPolyhedronMesh(PolygonVertexArray* polygonVertexArray);
 
+        /// Create a polyhedron mesh that is the convex hull of a set of points
+        PolyhedronMesh* createConvexHull(const Vector3* points, uint32 nbPoints, uint32 maxNbVertices = 0);
+
         /// Destroy a polyhedron mesh
         void destroyPolyhedronMesh(PolyhedronMesh* polyhedronMesh);
 
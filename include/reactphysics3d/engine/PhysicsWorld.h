@@ -94,6 +94,15 @@ class PhysicsWorld {
             /// Velocity threshold for contact velocity restitution
             decimal restitutionVelocityThreshold;
 
+            /// Distance (in meters) under which two separated colliders already generate speculative
+            /// contacts. Zero to only generate contacts between penetrating colliders
+            decimal contactMargin;
+
+            /// The penetration between two convex polyhedra with at least this number of edge pairs
+            /// (product of their numbers of edges) is computed with the GJK and EPA algorithms instead of
+            /// the SAT algorithm (zero to always use the SAT algorithm)
+            uint32 convexPolyhedronEPAMinNbEdgePairs;
+
             /// True if the sleeping technique is enabled
             bool isSleepingEnabled;
 
@@ -103,6 +112,25 @@ class PhysicsWorld {
             /// Number of iterations when solving the position constraints of the Sequential Impulse technique
             uint16 defaultPositionSolverNbIterations;
 
+            /// True if the velocity constraints (joints and contacts) are solved island by island (required
+            /// to scale the solver iterations of an island with the solver priorities of its bodies)
+            bool isPerIslandSolverEnabled;
+
+            /// Number of sub-steps of each call to update() (at least one, the collision detection is only done once per update)
+            uint16 defaultNbSubsteps;
+
+            /// The joints of an island with at most this number of bodies are solved by a direct
+            /// solver instead of the iterative solver (zero to disable the direct solver)
+            uint32 directJointSolverMaxNbBodies;
+
+            /// The velocity solver stops iterating (on an island) when the largest impulse change of
+            /// an iteration is smaller than this tolerance (zero to always run all the iterations)
+            decimal velocitySolverTolerance;
+
+            /// The position solver stops iterating (on an island) when the largest position impulse of
+            /// an iteration is smaller than this tolerance (zero to always run all the iterations)
+            decimal positionSolverTolerance;
+
             /// Time (in seconds) that a body must stay still to be considered sleeping
             float defaultTimeBeforeSleep;
 
@@ -127,9 +155,16 @@ class PhysicsWorld {
                 defaultFrictionCoefficient = decimal(0.3);
                 defaultBounciness = decimal(0.5);
                 restitutionVelocityThreshold = decimal(0.5);
+                contactMargin = decimal(0.0);
+                convexPolyhedronEPAMinNbEdgePairs = 0;
                 isSleepingEnabled = true;
                 defaultVelocitySolverNbIterations = 6;
                 defaultPositionSolverNbIterations = 3;
+                isPerIslandSolverEnabled = false;
+                defaultNbSubsteps = 1;
+                directJointSolverMaxNbBodies = 0;
+                velocitySolverTolerance = decimal(0.0);
+                positionSolverTolerance = decimal(0.0);
                 defaultTimeBeforeSleep = 1.0f;
                 defaultSleepLinearVelocity = decimal(0.02);
                 defaultSleepAngularVelocity = decimal(3.0) * (PI_RP3D / decimal(180.0));
@@ -149,9 +184,16 @@ class PhysicsWorld {
                 ss << "defaultFrictionCoefficient=" << defaultFrictionCoefficient << std::endl;
                 ss << "defaultBounciness=" << defaultBounciness << std::endl;
                 ss << "restitutionVelocityThreshold=" << restitutionVelocityThreshold << std::endl;
+                ss << "contactMargin=" << contactMargin << std::endl;
+                ss << "convexPolyhedronEPAMinNbEdgePairs=" << convexPolyhedronEPAMinNbEdgePairs << std::endl;
                 ss << "isSleepingEnabled=" << isSleepingEnabled << std::endl;
                 ss << "defaultVelocitySolverNbIterations=" << defaultVelocitySolverNbIterations << std::endl;
                 ss << "defaultPositionSolverNbIterations=" << defaultPositionSolverNbIterations << std::endl;
+                ss << "isPerIslandSolverEnabled=" << isPerIslandSolverEnabled << std::endl;
+                ss << "defaultNbSubsteps=" << defaultNbSubsteps << std::endl;
+                ss << "directJointSolverMaxNbBodies=" << directJointSolverMaxNbBodies << std::endl;
+                ss << "velocitySolverTolerance=" << velocitySolverTolerance << std::endl;
+                ss << "positionSolverTolerance=" << positionSolverTolerance << std::endl;
                 ss << "defaultTimeBeforeSleep=" << defaultTimeBeforeSleep << std::endl;
                 ss << "defaultSleepLinearVelocity=" << defaultSleepLinearVelocity << std::endl;
                 ss << "defaultSleepAngularVelocity=" << defaultSleepAngularVelocity << std::endl;
@@ -161,6 +203,30 @@ class PhysicsWorld {
             }
         };
 
+        /// Structure SolverStatistics
+        /**
+         * Iterations actually done by the constraint solver during the last call to update().
+         * In the per-island mode, the iterations are counted island by island. Otherwise, the
+         * whole world is counted as a single island. The iterations of all the sub-steps are summed.
+         */
+        struct SolverStatistics {
+
+            /// Number of islands solved
+            uint32 nbIslands = 0;
+
+            /// Total number of velocity solver iterations (sum over the islands)
+            uint32 nbVelocityIterations = 0;
+
+            /// Largest number of velocity solver iterations done for an island in a sub-step
+            uint32 maxNbVelocityIterations = 0;
+
+            /// Total number of position solver iterations (sum over the islands)
+            uint32 nbPositionIterations = 0;
+
+            /// Largest number of position solver iterations done for an island in a sub-step
+            uint32 maxNbPositionIterations = 0;
+        };
+
     protected :
 
         // -------------------- Attributes -------------------- //
@@ -251,6 +317,21 @@ class PhysicsWorld {
         /// Number of iterations for the position solver of the Sequential Impulses technique
         uint16 mNbPositionSolverIterations;
 
+        /// True if the velocity constraints are solved island by island
+        bool mIsPerIslandSolverEnabled;
+
+        /// Number of sub-steps of each call to update()
+        uint16 mNbSubsteps;
+
+        /// Impulse change tolerance used to stop the iterations of the velocity solver
+        decimal mVelocitySolverTolerance;
+
+        /// Position impulse tolerance used to stop the iterations of the position solver
+        decimal mPositionSolverTolerance;
+
+        /// Iterations done by the constraint solver during the last frame
+        SolverStatistics mSolverStatistics;
+
         /// True if the spleeping technique for inactive bodies is enabled
         bool mIsSleepingEnabled;
 
@@ -282,11 +363,17 @@ class PhysicsWorld {
         void setJointDisabled(Entity jointEntity, bool isDisabled);
 
         /// Solve the contacts and constraints
-        void solveContactsAndConstraints(decimal timeStep);
+        void solveContactsAndConstraints(decimal timeStep, bool isFirstSubstep);
 
         /// Solve the position error correction of the constraints
         void solvePositionCorrection();
 
+        /// Return true if the last iteration of the velocity solver has converged
+        bool hasVelocitySolverConverged() const;
+
+        /// Return the number of solver iterations of an island given the number of iterations of the world
+        uint32 computeIslandNbIterations(uint32 islandIndex, uint32 nbIterations) const;
+
         /// Compute the islands of awake bodies.
         void computeIslands();
 
@@ -372,6 +459,45 @@ class PhysicsWorld {
         /// Set the number of iterations for the position constraint solver
         void setNbIterationsPositionSolver(uint32 nbIterations);
 
+        /// Return the number of sub-steps of each call to update()
+        uint16 getNbSubsteps() const;
+
+        /// Set the number of sub-steps of each call to update()
+        void setNbSubsteps(uint16 nbSubsteps);
+
+        /// Return the maximum number of bodies of an island to solve its joints with the direct solver
+        uint32 getDirectJointSolverMaxNbBodies() const;
+
+        /// Set the maximum number of bodies of an island to solve its joints with the direct solver
+        void setDirectJointSolverMaxNbBodies(uint32 maxNbBodies);
+
+        /// Return the impulse change tolerance used to stop the velocity solver iterations
+        decimal getVelocitySolverTolerance() const;
+
+        /// Set the impulse change tolerance used to stop the velocity solver iterations
+        void setVelocitySolverTolerance(decimal tolerance);
+
+        /// Return the position impulse tolerance used to stop the position solver iterations
+        decimal getPositionSolverTolerance() const;
+
+        /// Set the position impulse tolerance used to stop the position solver iterations
+        void setPositionSolverTolerance(decimal tolerance);
+
+        /// Return the iterations done by the constraint solver during the last frame
+        const SolverStatistics& getSolverStatistics() const;
+
+        /// Return the distance under which separated colliders generate speculative contacts
+        decimal getContactMargin() const;
+
+        /// Set the distance under which separated colliders generate speculative contacts
+        void setContactMargin(decimal contactMargin);
+
+        /// Return the number of edge pairs from which the convex polyhedra collide with GJK/EPA instead of SAT
+        uint32 getConvexPolyhedronEPAMinNbEdgePairs() const;
+
+        /// Set the number of edge pairs from which the convex polyhedra collide with GJK/EPA instead of SAT
+        void setConvexPolyhedronEPAMinNbEdgePairs(uint32 minNbEdgePairs);
+
         /// Set the position correction technique used for contacts
         void setContactsPositionCorrectionTechnique(ContactsPositionCorrectionTechnique technique);
 
@@ -408,6 +534,12 @@ class PhysicsWorld {
         /// Enable/Disable the sleeping technique
         void enableSleeping(bool isSleepingEnabled);
 
+        /// Return true if the velocity constraints are solved island by island
+        bool isPerIslandSolverEnabled() const;
+
+        /// Enable/Disable the solving of the velocity constraints island by island
+        void enablePerIslandSolver(bool isPerIslandSolverEnabled);
+
         /// Return the current sleep linear velocity
         decimal getSleepLinearVelocity() const;
 
@@ -429,6 +561,9 @@ class PhysicsWorld {
         /// Set an event listener object to receive events callbacks.
         void setEventListener(EventListener* eventListener);
 
+        /// Set the object used to mix the materials of two colliders in contact
+        void setMaterialMixer(MaterialMixer* materialMixer);
+
         /// Return the number of CollisionBody in the physics world
         uint32 getNbCollisionBodies() const;
 
@@ -625,6 +760,62 @@ RP3D_FORCE_INLINE uint16 PhysicsWorld::getNbIterationsPositionSolver() const {
     return mNbPositionSolverIterations;
 }
 
+// Return the number of sub-steps of each call to update()
+/**
+ * @return The number of sub-steps
+ */
+RP3D_FORCE_INLINE uint16 PhysicsWorld::getNbSubsteps() const {
+    return mNbSubsteps;
+}
+
+// Return the maximum number of bodies of an island to solve its joints with the direct solver
+/**
+ * @return The maximum number of bodies of an island solved by the direct joint solver (zero if disabled)
+ */
+RP3D_FORCE_INLINE uint32 PhysicsWorld::getDirectJointSolverMaxNbBodies() const {
+    return mConstraintSolverSystem.getDirectSolverMaxNbBodies();
+}
+
+// Return the impulse change tolerance used to stop the velocity solver iterations
+/**
+ * @return The impulse change tolerance (zero if the solver always runs all its iterations)
+ */
+RP3D_FORCE_INLINE decimal PhysicsWorld::getVelocitySolverTolerance() const {
+    return mVelocitySolverTolerance;
+}
+
+// Return the position impulse tolerance used to stop the position solver iterations
+/**
+ * @return The position impulse tolerance (zero if the solver always runs all its iterations)
+ */
+RP3D_FORCE_INLINE decimal PhysicsWorld::getPositionSolverTolerance() const {
+    return mPositionSolverTolerance;
+}
+
+// Return the iterations done by the constraint solver during the last frame
+/**
+ * @return The numbers of velocity and position iterations done during the last call to update()
+ */
+RP3D_FORCE_INLINE const PhysicsWorld::SolverStatistics& PhysicsWorld::getSolverStatistics() const {
+    return mSolverStatistics;
+}
+
+// Return the distance under which separated colliders generate speculative contacts
+/**
+ * @return The contact margin (in meters)
+ */
+RP3D_FORCE_INLINE decimal PhysicsWorld::getContactMargin() const {
+    return mConfig.contactMargin;
+}
+
+// Return the number of edge pairs from which the convex polyhedra collide with GJK/EPA instead of SAT
+/**
+ * @return The minimal number of edge pairs (zero if the SAT algorithm is always used)
+ */
+RP3D_FORCE_INLINE uint32 PhysicsWorld::getConvexPolyhedronEPAMinNbEdgePairs() const {
+    return mConfig.convexPolyhedronEPAMinNbEdgePairs;
+}
+
 // Set the position correction technique used for contacts
 /**
  * @param technique Technique used for the position correction (Baumgarte or Split Impulses)
@@ -663,6 +854,14 @@ RP3D_FORCE_INLINE bool PhysicsWorld::isSleepingEnabled() const {
     return mIsSleepingEnabled;
 }
 
+// Return true if the velocity constraints are solved island by island
+/**
+ * @return True if the joints and contacts are solved island by island and false otherwise
+ */
+RP3D_FORCE_INLINE bool PhysicsWorld::isPerIslandSolverEnabled() const {
+    return mIsPerIslandSolverEnabled;
+}
+
 // Return the current sleep linear velocity
 /**
  * @return The sleep linear velocity (in meters per second)
@@ -697,6 +896,19 @@ RP3D_FORCE_INLINE void PhysicsWorld::setEventListener(EventListener* eventListen
     mEventListener = eventListener;
 }
 
+// Set the object used to mix the materials of two colliders in contact
+/// The mixed friction coefficient and restitution factor of a pair of colliders are computed when
+/// the colliders start to overlap and are then cached. The mixed values of the current pairs are
+/// recomputed with the new mixer. If you use "nullptr" as an argument, the default mixer (geometric
+/// mean of the friction coefficients and largest bounciness) is used. The mixer object must not be
+/// destroyed while it is used by the world.
+/**
+ * @param materialMixer Pointer to the material mixer object
+ */
+RP3D_FORCE_INLINE void PhysicsWorld::setMaterialMixer(MaterialMixer* materialMixer) {
+    mCollisionDetection.setMaterialMixer(materialMixer);
+}
+
 // Return the number of CollisionBody in the physics world
 /// Note that even if a RigidBody is also a collision body, this method does not return the rigid bodies
 /**
@@ -402,6 +402,42 @@ RP3D_FORCE_INLINE decimal computePointToPlaneDistance(const Vector3& point, cons
     return planeNormal.dot(point - planePoint);
 }
 
+// Return true if the edge (edgeStart, edgeEnd) of a triangle (edgeStart, edgeEnd, otherVertex) is an internal edge
+// of a triangle mesh. The edge is shared with a neighbor triangle whose vertex not on the edge is "neighborVertex".
+// The edge is internal if the two triangles form a concave or a flat surface or a convex surface with an angle smaller
+// than TRIANGLE_MESH_INTERNAL_EDGE_MAX_CONVEX_ANGLE. A convex shape colliding with such an edge must use the triangle
+// normal as contact normal. Note that this does not depend on the scale of the mesh (if the scale is positive).
+RP3D_FORCE_INLINE bool isTriangleMeshInternalEdge(const Vector3& edgeStart, const Vector3& edgeEnd, const Vector3& otherVertex,
+                                                  const Vector3& neighborVertex) {
+
+    const Vector3 edge = edgeEnd - edgeStart;
+    const decimal edgeLengthSquare = edge.lengthSquare();
+    Vector3 triangleNormal = edge.cross(otherVertex - edgeStart);
+    if (edgeLengthSquare < MACHINE_EPSILON || triangleNormal.lengthSquare() < MACHINE_EPSILON) {
+        return false;
+    }
+    triangleNormal.normalize();
+
+    // Direction from the edge to the neighbor vertex that is orthogonal to the edge
+    const Vector3 edgeToNeighbor = neighborVertex - edgeStart;
+    const Vector3 orthogonalDirection = edgeToNeighbor - (edge.dot(edgeToNeighbor) / edgeLengthSquare) * edge;
+    const decimal orthogonalLength = orthogonalDirection.length();
+    if (orthogonalLength < MACHINE_EPSILON) {
+        return false;
+    }
+
+    // The neighbor triangle must be on the other side of the edge (otherwise the mesh is not valid around this edge)
+    const Vector3 edgeToOther = otherVertex - edgeStart;
+    if (orthogonalDirection.dot(edgeToOther - (edge.dot(edgeToOther) / edgeLengthSquare) * edge) > decimal(0.0)) {
+        return false;
+    }
+
+    // Sine of the angle between the neighbor triangle and the plane of the triangle (negative if the surface is convex)
+    const decimal sinAngle = triangleNormal.dot(orthogonalDirection) / orthogonalLength;
+
+    return sinAngle > -std::sin(TRIANGLE_MESH_INTERNAL_EDGE_MAX_CONVEX_ANGLE);
+}
+
 /// Return true if a number is a power of two
 RP3D_FORCE_INLINE bool isPowerOfTwo(uint64 number) {
    return number != 0 && !(number & (number -1));
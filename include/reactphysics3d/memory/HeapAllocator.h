@@ -110,6 +110,11 @@ class HeapAllocator : public MemoryAllocator {
         /// This variable is used in debug mode to check that the allocate() and release()
         /// methods are called the same number of times
         int mNbTimesAllocateMethodCalled;
+
+        /// Total number of calls to the allocate() method since the creation of the allocator.
+        /// This variable is used in debug mode to check that some parts of the library
+        /// (the contact pipeline for instance) do not allocate heap memory at every frame
+        uint64 mNbTotalAllocations;
 #endif
 
         // -------------------- Methods -------------------- //
@@ -143,8 +148,22 @@ class HeapAllocator : public MemoryAllocator {
 
         /// Release previously allocated memory.
         virtual void release(void* pointer, size_t size) override;
+
+#ifndef NDEBUG
+        /// Return the total number of calls to the allocate() method (debug only)
+        uint64 getNbTotalAllocations() const;
+#endif
 };
 
+#ifndef NDEBUG
+
+// Return the total number of calls to the allocate() method (debug only)
+RP3D_FORCE_INLINE uint64 HeapAllocator::getNbTotalAllocations() const {
+    return mNbTotalAllocations;
+}
+
+#endif
+
 }
 
 #endif
@@ -0,0 +1,451 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef REACTPHYSICS3D_ARTICULATION_SOLVER_SYSTEM_H
+#define REACTPHYSICS3D_ARTICULATION_SOLVER_SYSTEM_H
+
+// Libraries
+#include <reactphysics3d/utils/Profiler.h>
+#include <reactphysics3d/containers/Array.h>
+#include <reactphysics3d/containers/Map.h>
+#include <reactphysics3d/constraint/Joint.h>
+#include <reactphysics3d/components/RigidBodyComponents.h>
+#include <reactphysics3d/components/JointComponents.h>
+#include <reactphysics3d/components/BallAndSocketJointComponents.h>
+#include <reactphysics3d/components/FixedJointComponents.h>
+#include <reactphysics3d/components/HingeJointComponents.h>
+#include <reactphysics3d/components/SliderJointComponents.h>
+
+namespace reactphysics3d {
+
+// Forward declarations
+struct Islands;
+class MemoryAllocator;
+
+// Class ArticulationSolverSystem
+/**
+ * This class solves exactly the joints of the articulations. The articulated joints of an island
+ * that link the dynamic bodies into a tree (a ragdoll, a rope, a chain, ...) form a sparse linear
+ * system. The system is solved directly in linear time in the number of bodies with the algorithm
+ * described in "Linear-Time Dynamics using Lagrange Multipliers" by David Baraff (1996). This is
+ * the maximal coordinates equivalent of the Featherstone algorithm: the tree is factorized once
+ * per step (from the leaves to the root) and each solve only needs two sweeps over the tree.
+ *
+ * Only the equality constraints (the degrees of freedom removed by the joints) are solved by this
+ * system. The limits and motors of the joints, the contacts and the articulated joints that would
+ * close a loop in the tree are still solved by the iterative solvers. The articulations are solved
+ * after the contacts at each iteration of the velocity solver so that the joints are exactly
+ * satisfied at the end of the velocity solver.
+ *
+ * This system can also solve directly all the joints of the small islands (a vehicle, a machine, ...)
+ * where the joints may form loops. For such an island, the matrix A = J * M^-1 * J^T of all the joints
+ * of the island is assembled into a block sparse matrix and factorized with a sparse LDL^T
+ * decomposition. The elimination order and the sparsity of the factor (the symbolic factorization)
+ * only depend on the topology of the island and are reused across the steps while it does not change.
+ */
+class ArticulationSolverSystem {
+
+    private :
+
+        // Structure ArticulationJoint
+        /**
+         * An articulated joint with the Jacobian of its equality constraints
+         */
+        struct ArticulationJoint {
+
+            /// Type of the joint
+            JointType type;
+
+            /// Index of the joint in the joint components
+            uint32 jointComponentIndex;
+
+            /// Index of the joint in the components of its type
+            uint32 componentIndex;
+
+            /// Index of the first body in the rigid body components
+            uint32 body1ComponentIndex;
+
+            /// Index of the second body in the rigid body components
+            uint32 body2ComponentIndex;
+
+            /// Index of the joint node in the tree (INVALID_INDEX if the joint closes a loop)
+            uint32 nodeIndex;
+
+            /// Number of equality constraints (rows) of the joint
+            uint32 nbRows;
+
+            /// Jacobian of the constraints for the first body (nbRows x 6, row major)
+            decimal jacobianBody1[36];
+
+            /// Jacobian of the constraints for the second body (nbRows x 6, row major)
+            decimal jacobianBody2[36];
+
+            /// Bias of the constraints
+            decimal bias[6];
+
+            /// Inverse mass matrix of the first body multiplied by the transposed Jacobian (nbRows x 6, row major)
+            /// (only computed for the joints of the direct islands)
+            decimal inverseMassJacobianBody1[36];
+
+            /// Inverse mass matrix of the second body multiplied by the transposed Jacobian (nbRows x 6, row major)
+            /// (only computed for the joints of the direct islands)
+            decimal inverseMassJacobianBody2[36];
+        };
+
+        // Structure ArticulationNode
+        /**
+         * A node (body or joint) of the tree of an articulation with its blocks of the factorization
+         */
+        struct ArticulationNode {
+
+            /// Index of the parent node (INVALID_INDEX for the root of a tree)
+            uint32 parentIndex;
+
+            /// Number of rows of the node (6 for a body and the number of constraints for a joint)
+            uint32 nbRows;
+
+            /// Index of the body in the rigid body components or index of the joint in the joints array
+            uint32 index;
+
+            /// True if the node is a body and false if it is a joint
+            bool isBody;
+
+            /// Block of the articulation matrix between the node and its parent (nbRows x nbRows of the parent)
+            decimal parentBlock[36];
+
+            /// Diagonal block of the factorized matrix
+            decimal diagonalBlock[36];
+
+            /// Inverse of the diagonal block of the factorized matrix
+            decimal inverseDiagonalBlock[36];
+
+            /// Inverse diagonal block multiplied by the parent block
+            decimal linkBlock[36];
+
+            /// Right-hand side and then solution of the linear system for this node
+            decimal x[6];
+        };
+
+        // Structure DirectIslandAssemblyEntry
+        /**
+         * The coupling between two joints (or a joint with itself) through a body of a direct island
+         */
+        struct DirectIslandAssemblyEntry {
+
+            /// Index in the island of the joint of the rows of the block
+            uint32 rowJoint;
+
+            /// Index in the island of the joint of the columns of the block
+            uint32 columnJoint;
+
+            /// Local index of the body shared by the two joints
+            uint32 body;
+
+            /// Index of the block of the matrix where the coupling is assembled
+            uint32 block;
+        };
+
+        // Structure DirectIsland
+        /**
+         * The factorization of the joints of an island solved by the direct solver. The blocks
+         * of the matrix are indexed by the positions of the joints in the elimination order. The
+         * first blocks are the diagonal blocks and the next ones are the off-diagonal blocks of
+         * the lower triangular factor, column by column.
+         */
+        struct DirectIsland {
+
+            /// Joints of the island when the symbolic factorization has been computed
+            Array<Entity> jointEntities;
+
+            /// Local indices of the two bodies of each joint (INVALID_INDEX for a static or kinematic body)
+            Array<uint32> jointsBodies;
+
+            /// Index of the first joint of the island in the "mJoints" array for the current step
+            uint32 startJointIndex;
+
+            /// Number of joints in the island
+            uint32 nbJoints;
+
+            /// Index in the island of the joint at each position of the elimination order
+            Array<uint32> eliminationOrder;
+
+            /// For each column of the factor, index of its first off-diagonal block in the "rowIndices"
+            /// array (with an additional last item equal to the total number of off-diagonal blocks)
+            Array<uint32> columnsStartIndex;
+
+            /// Row (position in the elimination order) of each off-diagonal block of the factor
+            Array<uint32> rowIndices;
+
+            /// For each column, index of its first item in the "updateBlocks" array
+            /// (with an additional last item equal to the total number of updates)
+            Array<uint32> updatesStartIndex;
+
+            /// Block updated by each pair of off-diagonal blocks of a column during the factorization
+            Array<uint32> updateBlocks;
+
+            /// Couplings of the joints through the bodies to assemble the matrix
+            Array<DirectIslandAssemblyEntry> assemblyEntries;
+
+            /// Blocks of the matrix and then of its factorization (36 values per block)
+            Array<decimal> blocks;
+
+            /// Inverse of the diagonal blocks of the factorization (36 values per block)
+            Array<decimal> inverseDiagonalBlocks;
+
+            /// Tolerance of the pivots of each diagonal block (relative to the assembled block)
+            Array<decimal> pivotTolerances;
+
+            /// Right-hand side and then solution of the linear system (6 values per joint in elimination order)
+            Array<decimal> x;
+
+            /// True if the island has been found in the current step
+            bool isUsed;
+
+            /// Constructor
+            DirectIsland(MemoryAllocator& allocator)
+                : jointEntities(allocator), jointsBodies(allocator), startJointIndex(0), nbJoints(0), eliminationOrder(allocator),
+                  columnsStartIndex(allocator), rowIndices(allocator), updatesStartIndex(allocator), updateBlocks(allocator),
+                  assemblyEntries(allocator), blocks(allocator), inverseDiagonalBlocks(allocator), pivotTolerances(allocator),
+                  x(allocator), isUsed(false) {
+
+            }
+        };
+
+        // -------------------- Constants -------------------- //
+
+        /// Invalid node index
+        static const uint32 INVALID_INDEX;
+
+        // -------------------- Attributes -------------------- //
+
+        /// Memory allocator
+        MemoryAllocator& mAllocator;
+
+        /// Reference to the islands
+        Islands& mIslands;
+
+        /// Reference to the rigid body components
+        RigidBodyComponents& mRigidBodyComponents;
+
+        /// Reference to the joint components
+        JointComponents& mJointComponents;
+
+        /// Reference to the ball-and-socket joint components
+        BallAndSocketJointComponents& mBallAndSocketJointComponents;
+
+        /// Reference to the fixed joint components
+        FixedJointComponents& mFixedJointComponents;
+
+        /// Reference to the hinge joint components
+        HingeJointComponents& mHingeJointComponents;
+
+        /// Reference to the slider joint components
+        SliderJointComponents& mSliderJointComponents;
+
+        /// Articulated joints of the current step
+        Array<ArticulationJoint> mJoints;
+
+        /// Nodes of the trees of the articulations (a parent node is always before its children)
+        Array<ArticulationNode> mNodes;
+
+        /// For each island, index of the first node of the island in the "mNodes" array
+        /// (with an additional last item equal to the total number of nodes)
+        Array<uint32> mIslandsStartNodeIndex;
+
+        /// For each rigid body component, index of its body in the "mBodies" array (INVALID_INDEX if none)
+        Array<uint32> mBodiesIndices;
+
+        /// Rigid body components indices of the bodies of the articulations of the current island
+        Array<uint32> mBodies;
+
+        /// For each body of the current island, index of its node (INVALID_INDEX if not in a tree yet)
+        Array<uint32> mBodiesNodeIndices;
+
+        /// For each body of the current island, index of its first joint in the "mBodiesJoints" array
+        Array<uint32> mBodiesJointsStartIndex;
+
+        /// Indices of the joints of each body of the current island
+        Array<uint32> mBodiesJoints;
+
+        /// Bodies of the current island waiting to be added to a tree
+        Array<uint32> mBodiesToVisit;
+
+        /// Factorizations of the direct islands (the key is the first joint of the island)
+        Map<Entity, DirectIsland*> mDirectIslands;
+
+        /// For each island, its direct island factorization in the current step (nullptr if the
+        /// island is not solved by the direct solver)
+        Array<DirectIsland*> mIslandsDirectIsland;
+
+        /// Off-diagonal blocks of the factor of the current column during the factorization
+        Array<decimal> mColumnBlocks;
+
+        /// Temporary matrix used to build the symbolic factorization of a direct island
+        Array<uint32> mSymbolicMatrix;
+
+        /// Maximum number of bodies of an island to solve all its joints with the direct solver (zero to disable)
+        uint32 mDirectSolverMaxNbBodies;
+
+        /// True if the articulation solver has some articulated joints to solve in the current step
+        bool mHasArticulations;
+
+        /// Largest squared impulse change applied by the solver since the last reset
+        decimal mMaxImpulseChangeSquare;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+        /// Pointer to the profiler
+        Profiler* mProfiler;
+#endif
+
+        // -------------------- Methods -------------------- //
+
+        /// Return true if a body can be a node of an articulation tree
+        bool isArticulationBody(uint32 bodyComponentIndex) const;
+
+        /// Gather the articulated joints of an island and build the trees of the island
+        void buildIslandTrees(uint32 islandIndex);
+
+        /// Add a joint into the array of joints of the current step
+        void addJoint(Entity jointEntity, uint32 jointComponentIndex, uint32 body1ComponentIndex, uint32 body2ComponentIndex);
+
+        /// Gather the joints of an island and return its direct island if it can be solved by the direct solver
+        DirectIsland* buildDirectIsland(uint32 islandIndex);
+
+        /// Compute the elimination order and the sparsity of the factor of a direct island
+        void computeSymbolicFactorization(DirectIsland& island);
+
+        /// Assemble and factorize the matrix of a direct island
+        void factorizeDirectIsland(DirectIsland& island);
+
+        /// Solve the joints of a direct island
+        void solveDirectIsland(DirectIsland& island);
+
+        /// Destroy a direct island
+        void destroyDirectIsland(DirectIsland* island);
+
+        /// Add the bodies and joints reachable from a body of the current island into its tree
+        void buildTree(uint32 rootBodyIndex);
+
+        /// Add a node into a tree and return its index
+        uint32 addNode(uint32 parentIndex, bool isBody, uint32 index);
+
+        /// Compute the Jacobian and bias of the equality constraints of an articulated joint
+        void computeJacobian(ArticulationJoint& joint) const;
+
+        /// Compute the velocity error -(J * v + b) of the constraints of a joint
+        void computeVelocityError(const ArticulationJoint& joint, decimal* error) const;
+
+        /// Factorize the articulation matrix of the nodes in a given range
+        void factorize(uint32 startNodeIndex, uint32 endNodeIndex);
+
+        /// Solve the articulations of the nodes in a given range
+        void solve(uint32 startNodeIndex, uint32 endNodeIndex);
+
+        /// Apply an impulse (the Lagrange multipliers of the constraints) on a joint
+        void applyJointImpulse(const ArticulationJoint& joint, const decimal* lambda);
+
+        /// Set a row of the Jacobian of an articulated joint
+        static void setJacobianRow(ArticulationJoint& joint, uint32 row, const Vector3& linearBody1, const Vector3& angularBody1,
+                                   const Vector3& linearBody2, const Vector3& angularBody2);
+
+        /// Compute the inverse of a small symmetric and definite matrix
+        static void computeSymmetricInverse(const decimal* matrix, uint32 n, decimal* inverse, decimal pivotTolerance = decimal(0.0));
+
+    public :
+
+        // -------------------- Methods -------------------- //
+
+        /// Constructor
+        ArticulationSolverSystem(MemoryAllocator& allocator, Islands& islands, RigidBodyComponents& rigidBodyComponents,
+                                 JointComponents& jointComponents, BallAndSocketJointComponents& ballAndSocketJointComponents,
+                                 FixedJointComponents& fixedJointComponents, HingeJointComponents& hingeJointComponents,
+                                 SliderJointComponents& sliderJointComponents);
+
+        /// Destructor
+        ~ArticulationSolverSystem();
+
+        /// Build and factorize the articulation trees of the islands
+        void initBeforeSolve();
+
+        /// Solve the articulations of all the islands
+        void solveVelocityConstraint();
+
+        /// Solve the articulations of a given island
+        void solveVelocityConstraint(uint32 islandIndex);
+
+        /// Return the maximum number of bodies of an island to solve its joints with the direct solver
+        uint32 getDirectSolverMaxNbBodies() const;
+
+        /// Set the maximum number of bodies of an island to solve its joints with the direct solver
+        void setDirectSolverMaxNbBodies(uint32 maxNbBodies);
+
+        /// Reset the largest impulse change applied by the solver
+        void resetMaxImpulseChange();
+
+        /// Return the largest squared impulse change applied by the solver since the last reset
+        decimal getMaxImpulseChangeSquare() const;
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+        /// Set the profiler
+        void setProfiler(Profiler* profiler);
+
+#endif
+
+};
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+// Set the profiler
+RP3D_FORCE_INLINE void ArticulationSolverSystem::setProfiler(Profiler* profiler) {
+    mProfiler = profiler;
+}
+
+#endif
+
+// Return the maximum number of bodies of an island to solve its joints with the direct solver
+RP3D_FORCE_INLINE uint32 ArticulationSolverSystem::getDirectSolverMaxNbBodies() const {
+    return mDirectSolverMaxNbBodies;
+}
+
+// Set the maximum number of bodies of an island to solve its joints with the direct solver
+RP3D_FORCE_INLINE void ArticulationSolverSystem::setDirectSolverMaxNbBodies(uint32 maxNbBodies) {
+    mDirectSolverMaxNbBodies = maxNbBodies;
+}
+
+// Reset the largest impulse change applied by the solver
+RP3D_FORCE_INLINE void ArticulationSolverSystem::resetMaxImpulseChange() {
+    mMaxImpulseChangeSquare = decimal(0.0);
+}
+
+// Return the largest squared impulse change applied by the solver since the last reset
+RP3D_FORCE_INLINE decimal ArticulationSolverSystem::getMaxImpulseChangeSquare() const {
+    return mMaxImpulseChangeSquare;
+}
+
+}
+
+#endif
@@ -30,6 +30,7 @@
 #include <reactphysics3d/collision/broadphase/DynamicAABBTree.h>
 #include <reactphysics3d/containers/LinkedList.h>
 #include <reactphysics3d/containers/Set.h>
+#include <reactphysics3d/containers/Map.h>
 #include <reactphysics3d/components/ColliderComponents.h>
 #include <reactphysics3d/components/TransformComponents.h>
 #include <reactphysics3d/components/RigidBodyComponents.h>
@@ -45,6 +46,71 @@ class CollisionBody;
 class Collider;
 class MemoryManager;
 class Profiler;
+struct CompoundBroadPhase;
+
+// Structure BroadPhaseProxy
+/**
+ * A proxy of the broad-phase. The proxy of a collider is a leaf of the dynamic AABB tree of
+ * the world or a leaf of the local tree of its compound body. The proxy of a compound body
+ * is a leaf of the dynamic AABB tree of the world. The broad-phase ID of a proxy is the ID of
+ * its node in the tree of the world (a node ID is reserved in the tree of the world for the
+ * colliders of the compound bodies).
+ */
+struct BroadPhaseProxy {
+
+    /// ID of the node of the proxy in its dynamic AABB tree
+    int32 nodeId;
+
+    /// Pointer to the collider of the proxy (null for the proxy of a compound body)
+    Collider* collider;
+
+    /// Pointer to the compound body of the proxy (null for a collider of a non-compound body)
+    CompoundBroadPhase* compound;
+
+    /// Constructor
+    BroadPhaseProxy(int32 nodeId, Collider* collider, CompoundBroadPhase* compound)
+        : nodeId(nodeId), collider(collider), compound(compound) {
+
+    }
+};
+
+// Structure CompoundBroadPhase
+/**
+ * Broad-phase data of a compound body. The AABBs of the colliders of the body are stored
+ * in a dynamic AABB tree in the local-space of the body. Therefore, this tree does not need
+ * to be updated when the body moves. The body has a single proxy in the dynamic AABB tree of
+ * the world with the AABB of the local tree.
+ */
+struct CompoundBroadPhase {
+
+    /// Dynamic AABB tree with the local-space AABBs of the colliders of the body
+    DynamicAABBTree tree;
+
+    /// Entity of the body
+    Entity bodyEntity;
+
+    /// Broad-phase ID of the proxy of the body in the dynamic AABB tree of the world
+    int32 proxyId;
+
+    /// Broad-phase IDs of the colliders of the body
+    Array<int32> colliderProxies;
+
+    /// True if the local tree has changed since the last update of the proxy of the body
+    bool hasTreeChanged;
+
+    /// True if the proxy of the body needs to be updated
+    bool isUpdateNeeded;
+
+    /// True if the overlapping pairs of the colliders have been flagged to be tested for overlap in this frame
+    bool havePairsBeenFlagged;
+
+    /// Constructor
+    CompoundBroadPhase(MemoryAllocator& allocator, Entity bodyEntity)
+        : tree(allocator, DYNAMIC_TREE_FAT_AABB_INFLATE_PERCENTAGE), bodyEntity(bodyEntity), proxyId(-1),
+          colliderProxies(allocator), hasTreeChanged(false), isUpdateNeeded(false), havePairsBeenFlagged(false) {
+
+    }
+};
 
 // class AABBOverlapCallback
 class AABBOverlapCallback : public DynamicAABBTreeOverlapCallback {
@@ -73,19 +139,29 @@ class BroadPhaseRaycastCallback : public DynamicAABBTreeRaycastCallback {
 
     private :
 
+        const BroadPhaseSystem& mBroadPhaseSystem;
+
         const DynamicAABBTree& mDynamicAABBTree;
 
+        /// Transform from the space of the tree to world-space (null for the tree of the world)
+        const Transform* mTreeToWorldTransform;
+
         unsigned short mRaycastWithCategoryMaskBits;
 
         RaycastTest& mRaycastTest;
 
+        /// Smallest hit fraction returned for the shapes of the tree (negative if none)
+        decimal mSmallestHitFraction;
+
     public:
 
         // Constructor
-        BroadPhaseRaycastCallback(const DynamicAABBTree& dynamicAABBTree, unsigned short raycastWithCategoryMaskBits,
+        BroadPhaseRaycastCallback(const BroadPhaseSystem& broadPhaseSystem, const DynamicAABBTree& dynamicAABBTree,
+                                  const Transform* treeToWorldTransform, unsigned short raycastWithCategoryMaskBits,
                                   RaycastTest& raycastTest)
-            : mDynamicAABBTree(dynamicAABBTree), mRaycastWithCategoryMaskBits(raycastWithCategoryMaskBits),
-              mRaycastTest(raycastTest) {
+            : mBroadPhaseSystem(broadPhaseSystem), mDynamicAABBTree(dynamicAABBTree), mTreeToWorldTransform(treeToWorldTransform),
+              mRaycastWithCategoryMaskBits(raycastWithCategoryMaskBits), mRaycastTest(raycastTest),
+              mSmallestHitFraction(decimal(-1.0)) {
 
         }
 
@@ -95,6 +171,11 @@ class BroadPhaseRaycastCallback : public DynamicAABBTreeRaycastCallback {
         // Called for a broad-phase shape that has to be tested for raycast
         virtual decimal raycastBroadPhaseShape(int32 nodeId, const Ray& ray) override;
 
+        // Return the smallest hit fraction returned for the shapes of the tree (negative if none)
+        decimal getSmallestHitFraction() const {
+            return mSmallestHitFraction;
+        }
+
 };
 
 // Class BroadPhaseSystem
@@ -114,6 +195,28 @@ class BroadPhaseSystem {
         /// Dynamic AABB tree
         DynamicAABBTree mDynamicAABBTree;
 
+        /// Broad-phase proxies (the index of a proxy is its broad-phase ID)
+        Array<BroadPhaseProxy> mProxies;
+
+        /// Map a compound body entity to its broad-phase data
+        Map<Entity, CompoundBroadPhase*> mCompounds;
+
+        /// Pairs of proxies of the world tree with at least one compound body whose AABBs are overlapping
+        /// (the colliders pairs of those proxies are computed in each frame with the local trees)
+        Map<uint64, Pair<int32, int32>> mCompoundPairs;
+
+        /// Array with the compound bodies whose proxy needs to be updated
+        Array<CompoundBroadPhase*> mCompoundsToUpdate;
+
+        /// Array with the compound bodies whose overlapping pairs have been flagged to be tested for overlap
+        Array<CompoundBroadPhase*> mFlaggedCompounds;
+
+        /// Array with the nodes of the world tree that are overlapping in the current frame
+        Array<Pair<int32, int32>> mOverlappingTreeNodes;
+
+        /// Array with the nodes of a local tree overlapping with an AABB
+        Array<int32> mOverlappingLocalNodes;
+
         /// Reference to the colliders components
         ColliderComponents& mCollidersComponents;
 
@@ -123,11 +226,15 @@ class BroadPhaseSystem {
         /// Reference to the rigid body components
         RigidBodyComponents& mRigidBodyComponents;
 
-        /// Set with the broad-phase IDs of all collision shapes that have moved (or have been
-        /// created) during the last simulation step. Those are the shapes that need to be tested
+        /// Set with the broad-phase IDs of all the proxies of the world tree that have moved (or have
+        /// been created) during the last simulation step. Those are the proxies that need to be tested
         /// for overlapping in the next simulation step.
         Set<int> mMovedShapes;
 
+        /// Array with the world tree node IDs of the proxies to test for overlapping in the current
+        /// frame. This array is only cleared (not released) between two frames.
+        Array<int> mShapesToTest;
+
         /// Reference to the collision detection object
         CollisionDetectionSystem& mCollisionDetection;
 
@@ -144,7 +251,37 @@ class BroadPhaseSystem {
                                     bool forceReInsert);
 
         /// Update the broad-phase state of some colliders components
-        void updateCollidersComponents(uint32 startIndex, uint32 nbItems);
+        void updateCollidersComponents(uint32 startIndex, uint32 nbItems, bool updateCompoundLocalAABBs);
+
+        /// Set the broad-phase proxy with a given broad-phase ID
+        void setProxy(int32 proxyId, int32 nodeId, Collider* collider, CompoundBroadPhase* compound);
+
+        /// Release a broad-phase proxy
+        void releaseProxy(int32 proxyId);
+
+        /// Return the broad-phase ID of the proxy of the world tree for a given proxy
+        int32 getWorldProxyId(int32 proxyId) const;
+
+        /// Return the broad-phase ID stored in a node of the local tree of a compound body
+        static int32 getLocalNodeProxyId(const DynamicAABBTree& localTree, int32 nodeId);
+
+        /// Return the world-space AABB of the local tree of a compound body
+        AABB computeCompoundAABB(const CompoundBroadPhase* compound) const;
+
+        /// Update the proxies of the compound bodies in the dynamic AABB tree of the world
+        void updateCompounds();
+
+        /// Remove all the compound pairs involving a given proxy of the world tree
+        void removeCompoundPairs(int32 proxyId);
+
+        /// Flag the overlapping pairs of the colliders of a compound body to be tested for overlap
+        void flagCompoundPairs(CompoundBroadPhase* compound);
+
+        /// Return true if the proxy of the world tree is active (not sleeping and not static)
+        bool isWorldProxyEnabled(int32 proxyId) const;
+
+        /// Compute the colliders pairs of a pair of world tree proxies with at least one compound body
+        void computeCompoundPairOverlappingColliders(int32 proxy1Id, int32 proxy2Id, Array<Pair<int32, int32>>& overlappingColliders);
 
     public :
 
@@ -155,7 +292,7 @@ class BroadPhaseSystem {
                          TransformComponents& transformComponents, RigidBodyComponents& rigidBodyComponents);
 
         /// Destructor
-        ~BroadPhaseSystem() = default;
+        ~BroadPhaseSystem();
 
         /// Deleted copy-constructor
         BroadPhaseSystem(const BroadPhaseSystem& algorithm) = delete;
@@ -192,8 +329,8 @@ class BroadPhaseSystem {
         /// Return true if the two broad-phase collision shapes are overlapping
         bool testOverlappingShapes(int32 shape1BroadPhaseId, int32 shape2BroadPhaseId) const;
 
-        /// Return the fat AABB of a given broad-phase shape
-        const AABB& getFatAABB(int broadPhaseId) const;
+        /// Return the world-space fat AABB of a given broad-phase shape
+        AABB getFatAABB(int broadPhaseId) const;
 
         /// Ray casting method
         void raycast(const Ray& ray, RaycastTest& raycastTest, unsigned short raycastWithCategoryMaskBits) const;
@@ -201,6 +338,10 @@ class BroadPhaseSystem {
         /// Tests if an AABB overlaps with any collider in the world
         bool testAABBOverlap(const AABB& aabb) const;
 
+        // -------------------- Friendship -------------------- //
+
+        friend class BroadPhaseRaycastCallback;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Set the profiler
@@ -210,9 +351,16 @@ class BroadPhaseSystem {
 
 };
 
-// Return the fat AABB of a given broad-phase shape
-RP3D_FORCE_INLINE const AABB& BroadPhaseSystem::getFatAABB(int broadPhaseId) const  {
-    return mDynamicAABBTree.getFatAABB(broadPhaseId);
+// Return the broad-phase ID stored in a node of the local tree of a compound body
+RP3D_FORCE_INLINE int32 BroadPhaseSystem::getLocalNodeProxyId(const DynamicAABBTree& localTree, int32 nodeId) {
+    return localTree.getNodeDataInt(nodeId)[0];
+}
+
+// Return the broad-phase ID of the proxy of the world tree for a given proxy
+/// This is the proxy itself or the proxy of the compound body of a collider
+RP3D_FORCE_INLINE int32 BroadPhaseSystem::getWorldProxyId(int32 proxyId) const {
+    const BroadPhaseProxy& proxy = mProxies[proxyId];
+    return (proxy.compound != nullptr && proxy.collider != nullptr) ? proxy.compound->proxyId : proxyId;
 }
 
 // Remove a collider from the array of colliders that have moved in the last simulation step
@@ -225,12 +373,7 @@ RP3D_FORCE_INLINE void BroadPhaseSystem::removeMovedCollider(int broadPhaseID) {
 
 // Return the collider corresponding to the broad-phase node id in parameter
 RP3D_FORCE_INLINE Collider* BroadPhaseSystem::getColliderForBroadPhaseId(int broadPhaseId) const {
-    return static_cast<Collider*>(mDynamicAABBTree.getNodeDataPointer(broadPhaseId));
-}
-
-RP3D_FORCE_INLINE bool BroadPhaseSystem::testAABBOverlap(const AABB& aabb) const
-{
-  return mDynamicAABBTree.reportAnyShapeOverlappingWithAABB(aabb);
+    return mProxies[broadPhaseId].collider;
 }
 
 #ifdef IS_RP3D_PROFILING_ENABLED
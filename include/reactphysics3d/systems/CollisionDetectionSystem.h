@@ -35,6 +35,7 @@
 #include <reactphysics3d/collision/ContactManifoldInfo.h>
 #include <reactphysics3d/collision/ContactManifold.h>
 #include <reactphysics3d/collision/ContactPair.h>
+#include <reactphysics3d/collision/CollisionCallback.h>
 #include <reactphysics3d/engine/OverlappingPairs.h>
 #include <reactphysics3d/engine/OverlappingPairs.h>
 #include <reactphysics3d/collision/narrowphase/NarrowPhaseInput.h>
@@ -136,6 +137,10 @@ class CollisionDetectionSystem {
         /// (either mMapPairIdToContactPairIndex1 or mMapPairIdToContactPairIndex2)
         Map<uint64, uint> mPreviousMapPairIdToContactPairIndex;
 
+        /// Map of overlappingPairId to the index of contact pair of the current frame. This map
+        /// is only cleared (not released) between two frames to avoid heap allocations
+        Map<uint64, uint> mMapPairIdToContactPairIndex;
+
         /// First array with the contact manifolds
         Array<ContactManifold> mContactManifolds1;
 
@@ -163,6 +168,22 @@ class CollisionDetectionSystem {
         /// Array with the indices of all the contact pairs that have at least one CollisionBody
         Array<uint32> mCollisionBodyContactPairsIndices;
 
+        /// Flat array with the data of the reported contact pairs
+        Array<CollisionCallback::FlatContactPair> mFlatContactPairs;
+
+        /// Flat array with the data of the reported contact manifolds
+        Array<CollisionCallback::FlatContactManifold> mFlatContactManifolds;
+
+        /// Flat array with the data of the reported contact points
+        Array<CollisionCallback::FlatContactPoint> mFlatContactPoints;
+
+        /// Indices of the current contact pairs to report to the event listener. The pairs where one of the colliders
+        /// reports its contacts are added during the narrow-phase and are then filtered with the impulse thresholds
+        Array<uint64> mContactPairsToReport;
+
+        /// Indices of the lost contact pairs to report to the event listener
+        Array<uint64> mLostContactPairsToReport;
+
         /// Number of potential contact manifolds in the previous frame
         uint32 mNbPreviousPotentialContactManifolds;
 
@@ -172,6 +193,9 @@ class CollisionDetectionSystem {
         /// Reference to the half-edge structure of the triangle polyhedron
         HalfEdgeStructure& mTriangleHalfEdgeStructure;
 
+        /// Entities of the colliders whose material might have been modified since the last frame
+        Array<Entity> mCollidersWithChangedMaterial;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
     /// Pointer to the profiler
@@ -184,6 +208,9 @@ class CollisionDetectionSystem {
         /// Compute the broad-phase collision detection
         void computeBroadPhase();
 
+        /// Recompute the mixed materials of the overlapping pairs of the colliders whose material has changed
+        void updateChangedMaterials();
+
         /// Compute the middle-phase collision detection
         void computeMiddlePhase(NarrowPhaseInput& narrowPhaseInput, bool needToReportContacts);
 
@@ -221,7 +248,7 @@ class CollisionDetectionSystem {
 
         /// Compute the concave vs convex middle-phase algorithm for a given pair of bodies
         void computeConvexVsConcaveMiddlePhase(OverlappingPairs::ConcaveOverlappingPair& overlappingPair, MemoryAllocator& allocator,
-                                               NarrowPhaseInput& narrowPhaseInput, bool reportContacts);
+                                               NarrowPhaseInput& narrowPhaseInput, bool reportContacts, decimal contactMargin);
 
         /// Swap the previous and current contacts arrays
         void swapPreviousAndCurrentContacts();
@@ -230,11 +257,13 @@ class CollisionDetectionSystem {
         void processPotentialContacts(NarrowPhaseInfoBatch& narrowPhaseInfoBatch,
                                       bool updateLastFrameInfo, Array<ContactPointInfo>& potentialContactPoints,
                                       Array<ContactManifoldInfo>& potentialContactManifolds,
-                                      Map<uint64, uint>& mapPairIdToContactPairIndex, Array<ContactPair>* contactPairs);
+                                      Map<uint64, uint>& mapPairIdToContactPairIndex, Array<ContactPair>* contactPairs,
+                                      Array<uint64>* contactPairsToReport);
 
         /// Process the potential contacts after narrow-phase collision detection
         void processAllPotentialContacts(NarrowPhaseInput& narrowPhaseInput, bool updateLastFrameInfo, Array<ContactPointInfo>& potentialContactPoints,
-                                         Array<ContactManifoldInfo>& potentialContactManifolds, Array<ContactPair>* contactPairs);
+                                         Array<ContactManifoldInfo>& potentialContactManifolds, Array<ContactPair>* contactPairs,
+                                         Array<uint64>* contactPairsToReport);
 
         /// Reduce the potential contact manifolds and contact points of the overlapping pair contacts
         void reducePotentialContactManifolds(Array<ContactPair>* contactPairs, Array<ContactManifoldInfo>& potentialContactManifolds,
@@ -267,7 +296,14 @@ class CollisionDetectionSystem {
 
         /// Report contacts
         void reportContacts(CollisionCallback& callback, Array<ContactPair>* contactPairs,
-                            Array<ContactManifold>* manifolds, Array<ContactPoint>* contactPoints, Array<ContactPair>& lostContactPairs);
+                            Array<ContactManifold>* manifolds, Array<ContactPoint>* contactPoints, Array<ContactPair>& lostContactPairs,
+                            bool onlyReportedPairs);
+
+        /// Fill-in the flat arrays of contacts data that are reported to the user
+        void computeFlatContacts(const CollisionCallback::CallbackData& callbackData);
+
+        /// Select the contact pairs of the current frame that need to be reported to the event listener
+        void computeContactPairsToReport();
 
         /// Report all triggers
         void reportTriggers(EventListener& eventListener, Array<ContactPair>* contactPairs, Array<ContactPair>& lostContactPairs);
@@ -339,6 +375,12 @@ class CollisionDetectionSystem {
         /// Notify that the overlapping pairs where a given collider is involved need to be tested for overlap
         void notifyOverlappingPairsToTestOverlap(Collider* collider);
 
+        /// Notify that the material of a collider might have been modified
+        void notifyColliderMaterialChanged(Entity colliderEntity);
+
+        /// Set the material mixer used to compute the friction and restitution of the contacts
+        void setMaterialMixer(MaterialMixer* materialMixer);
+
         /// Report contacts and triggers
         void reportContactsAndTriggers();
 
@@ -398,6 +440,7 @@ class CollisionDetectionSystem {
         friend class ConvexMeshShape;
         friend class RigidBody;
         friend class DebugRenderer;
+        friend class CollisionCallback::CallbackData;
 };
 
 // Return a reference to the collision dispatch configuration
@@ -434,6 +477,23 @@ RP3D_FORCE_INLINE void CollisionDetectionSystem::askForBroadPhaseCollisionCheck(
     }
 }
 
+// Notify that the material of a collider might have been modified
+/// The mixed materials of the overlapping pairs of the collider are recomputed during the next
+/// broad-phase. This is called by Collider::setMaterial() and by the setters of the material of a collider
+RP3D_FORCE_INLINE void CollisionDetectionSystem::notifyColliderMaterialChanged(Entity colliderEntity) {
+
+    const uint32 colliderIndex = mCollidersComponents.getEntityIndex(colliderEntity);
+    if (!mCollidersComponents.mHasMaterialChanged[colliderIndex]) {
+        mCollidersComponents.mHasMaterialChanged[colliderIndex] = true;
+        mCollidersWithChangedMaterial.add(colliderEntity);
+    }
+}
+
+// Set the material mixer used to compute the friction and restitution of the contacts
+RP3D_FORCE_INLINE void CollisionDetectionSystem::setMaterialMixer(MaterialMixer* materialMixer) {
+    mOverlappingPairs.setMaterialMixer(materialMixer);
+}
+
 // Return a pointer to the world
 RP3D_FORCE_INLINE PhysicsWorld* CollisionDetectionSystem::getWorld() {
     return mWorld;
@@ -33,6 +33,7 @@
 #include <reactphysics3d/systems/SolveFixedJointSystem.h>
 #include <reactphysics3d/systems/SolveHingeJointSystem.h>
 #include <reactphysics3d/systems/SolveSliderJointSystem.h>
+#include <reactphysics3d/systems/ArticulationSolverSystem.h>
 
 namespace reactphysics3d {
 
@@ -40,6 +41,7 @@ namespace reactphysics3d {
 class Joint;
 class Island;
 struct Islands;
+class MemoryManager;
 class Profiler;
 class RigidBodyComponents;
 class JointComponents;
@@ -147,6 +149,42 @@ class ConstraintSolverSystem {
 
     private :
 
+        // Structure IslandsJoints
+        /**
+         * Joints of a given type ordered island by island. This is used to solve
+         * the joints of each island with the kernel of their type.
+         */
+        struct IslandsJoints {
+
+            /// Indices of the joints in the components of their type (ordered by island)
+            Array<uint32> componentIndices;
+
+            /// For each island, index of the first joint of the island in the "componentIndices" array
+            /// (with an additional last item equal to the total number of joints)
+            Array<uint32> islandsStartIndex;
+
+            /// Constructor
+            IslandsJoints(MemoryAllocator& allocator) : componentIndices(allocator), islandsStartIndex(allocator) {
+
+            }
+
+            /// Remove all the joints
+            void clear() {
+                componentIndices.clear();
+                islandsStartIndex.clear();
+            }
+
+            /// Return a pointer to the component indices of the joints of an island
+            const uint32* getIslandJoints(uint32 islandIndex) const {
+                return &(componentIndices[islandsStartIndex[islandIndex]]);
+            }
+
+            /// Return the number of joints in an island
+            uint32 getNbIslandJoints(uint32 islandIndex) const {
+                return islandsStartIndex[islandIndex + 1] - islandsStartIndex[islandIndex];
+            }
+        };
+
         // -------------------- Attributes -------------------- //
 
         /// Current time step
@@ -173,18 +211,71 @@ class ConstraintSolverSystem {
         /// Solver for the SliderJoint constraints
         SolveSliderJointSystem mSolveSliderJointSystem;
 
+        /// Direct solver for the joints of the articulations and of the small islands
+        ArticulationSolverSystem mArticulationSolverSystem;
+
+        /// Reference to the joint components
+        JointComponents& mJointComponents;
+
+        /// Reference to the ball-and-socket joint components
+        BallAndSocketJointComponents& mBallAndSocketJointComponents;
+
+        /// Reference to the fixed joint components
+        FixedJointComponents& mFixedJointComponents;
+
+        /// Reference to the hinge joint components
+        HingeJointComponents& mHingeJointComponents;
+
+        /// Reference to the slider joint components
+        SliderJointComponents& mSliderJointComponents;
+
+        /// Ball-and-socket joints ordered by island
+        IslandsJoints mIslandsBallAndSocketJoints;
+
+        /// Fixed joints ordered by island
+        IslandsJoints mIslandsFixedJoints;
+
+        /// Hinge joints ordered by island
+        IslandsJoints mIslandsHingeJoints;
+
+        /// Slider joints ordered by island
+        IslandsJoints mIslandsSliderJoints;
+
+        /// True if a joint has a position error larger than the slop after the integration of the positions
+        bool mHasPositionErrors;
+
+        /// For each island, true if one of its joints has a position error larger than the slop
+        Array<bool> mIslandsHavePositionError;
+
+        /// Ball-and-socket joints of the islands with a position error
+        Array<uint32> mPositionErrorBallAndSocketJoints;
+
+        /// Fixed joints of the islands with a position error
+        Array<uint32> mPositionErrorFixedJoints;
+
+        /// Hinge joints of the islands with a position error
+        Array<uint32> mPositionErrorHingeJoints;
+
+        /// Slider joints of the islands with a position error
+        Array<uint32> mPositionErrorSliderJoints;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Pointer to the profiler
 		Profiler* mProfiler;
 #endif
 
+        // -------------------- Methods -------------------- //
+
+        /// Reset the largest impulse change applied by the joint solvers
+        void resetMaxImpulseChange();
+
     public :
 
         // -------------------- Methods -------------------- //
 
         /// Constructor
-        ConstraintSolverSystem(PhysicsWorld& world, Islands& islands, RigidBodyComponents& rigidBodyComponents,
+        ConstraintSolverSystem(MemoryManager& memoryManager, PhysicsWorld& world, Islands& islands, RigidBodyComponents& rigidBodyComponents,
                                TransformComponents& transformComponents,
                                JointComponents& jointComponents,
                                BallAndSocketJointComponents& ballAndSocketJointComponents,
@@ -200,9 +291,48 @@ class ConstraintSolverSystem {
         /// Solve the constraints
         void solveVelocityConstraints();
 
+        /// Order the joints of each type island by island
+        void orderJointsByIsland();
+
+        /// Solve the constraints of a given island
+        void solveVelocityConstraints(uint32 islandIndex);
+
+        /// Solve the joints of the articulations
+        void solveArticulations();
+
+        /// Solve the joints of the articulations of a given island
+        void solveArticulations(uint32 islandIndex);
+
+        /// Check which joints have a position error larger than the slop after the integration of the positions
+        void computePositionErrors();
+
+        /// Find the islands with a joint that has a position error larger than the slop
+        void findPositionErrorIslands();
+
+        /// Return true if a joint has a position error larger than the slop after the integration of the positions
+        bool hasPositionErrors() const;
+
+        /// Return true if a joint of a given island has a position error larger than the slop
+        bool hasIslandPositionError(uint32 islandIndex) const;
+
         /// Solve the position constraints
         void solvePositionConstraints();
 
+        /// Solve the position constraints of a given island
+        void solvePositionConstraints(uint32 islandIndex);
+
+        /// Return the number of joints in a given island
+        uint32 getNbIslandJoints(uint32 islandIndex) const;
+
+        /// Return the largest impulse change applied to a joint during the last solver iteration
+        decimal getMaxImpulseChange() const;
+
+        /// Return the maximum number of bodies of an island to solve its joints with the direct solver
+        uint32 getDirectSolverMaxNbBodies() const;
+
+        /// Set the maximum number of bodies of an island to solve its joints with the direct solver
+        void setDirectSolverMaxNbBodies(uint32 maxNbBodies);
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Set the profiler
@@ -215,6 +345,27 @@ class ConstraintSolverSystem {
         friend class HingeJoint;
 };
 
+// Return true if a joint has a position error larger than the slop after the integration of the positions
+RP3D_FORCE_INLINE bool ConstraintSolverSystem::hasPositionErrors() const {
+    return mHasPositionErrors;
+}
+
+// Return true if a joint of a given island has a position error larger than the slop
+/// This must be called after the islands with a position error have been found
+RP3D_FORCE_INLINE bool ConstraintSolverSystem::hasIslandPositionError(uint32 islandIndex) const {
+    return mIslandsHavePositionError[islandIndex];
+}
+
+// Return the maximum number of bodies of an island to solve its joints with the direct solver
+RP3D_FORCE_INLINE uint32 ConstraintSolverSystem::getDirectSolverMaxNbBodies() const {
+    return mArticulationSolverSystem.getDirectSolverMaxNbBodies();
+}
+
+// Set the maximum number of bodies of an island to solve its joints with the direct solver
+RP3D_FORCE_INLINE void ConstraintSolverSystem::setDirectSolverMaxNbBodies(uint32 maxNbBodies) {
+    mArticulationSolverSystem.setDirectSolverMaxNbBodies(maxNbBodies);
+}
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 // Set the profiler
@@ -224,6 +375,7 @@ RP3D_FORCE_INLINE void ConstraintSolverSystem::setProfiler(Profiler* profiler) {
     mSolveFixedJointSystem.setProfiler(profiler);
     mSolveHingeJointSystem.setProfiler(profiler);
     mSolveSliderJointSystem.setProfiler(profiler);
+    mArticulationSolverSystem.setProfiler(profiler);
 }
 
 #endif
@@ -147,7 +147,7 @@ class ContactSolverSystem {
             /// Penetration depth
             decimal penetrationDepth;
 
-            /// Velocity restitution bias
+            /// Velocity restitution bias (separation velocity bias for a contact reused in a sub-step)
             decimal restitutionBias;
 
             /// Accumulated normal impulse
@@ -315,6 +315,14 @@ class ContactSolverSystem {
         /// Reference to the islands
         Islands& mIslands;
 
+        /// For each island, index of its first contact manifold in the array of contact constraints
+        /// (with an additional last item equal to the total number of contact constraints)
+        Array<uint32> mIslandsContactManifoldsStartIndex;
+
+        /// For each island, index of its first contact point in the array of contact points
+        /// (with an additional last item equal to the total number of contact points)
+        Array<uint32> mIslandsContactPointsStartIndex;
+
         /// Pointer to the array of contact manifolds from narrow-phase
         Array<ContactManifold>* mAllContactManifolds;
 
@@ -333,6 +341,13 @@ class ContactSolverSystem {
         /// True if the split impulse position correction is active
         bool mIsSplitImpulseActive;
 
+        /// True if the penetration depths of the contacts must be recomputed from the current
+        /// positions of the bodies (when the contacts are reused for another sub-step)
+        bool mUpdatePenetrationDepths;
+
+        /// Largest impulse change applied to a contact during the last call to solve() or solveIsland()
+        decimal mMaxImpulseChange;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 		/// Pointer to the profiler
@@ -342,12 +357,6 @@ class ContactSolverSystem {
 
         // -------------------- Methods -------------------- //
 
-        /// Compute the collision restitution factor from the restitution factor of each collider
-        decimal computeMixedRestitutionFactor(const Material& material1, const Material& material2) const;
-
-        /// Compute the mixed friction coefficient from the friction coefficient of each collider
-        decimal computeMixedFrictionCoefficient(const Material &material1, const Material &material2) const;
-
         /// Compute the two unit orthogonal vectors "t1" and "t2" that span the tangential friction
         /// plane for a contact manifold. The two vectors have to be
         /// such that : t1 x t2 = contactNormal.
@@ -357,6 +366,9 @@ class ContactSolverSystem {
         /// Warm start the solver.
         void warmStart();
 
+        /// Solve a range of contact manifolds
+        void solveContactConstraints(uint32 startIndex, uint32 endIndex, uint32 contactPointsStartIndex);
+
    public:
 
         // -------------------- Methods -------------------- //
@@ -369,7 +381,8 @@ class ContactSolverSystem {
         ~ContactSolverSystem() = default;
 
         /// Initialize the contact constraints
-        void init(Array<ContactManifold>* contactManifolds, Array<ContactPoint>* contactPoints, decimal timeStep);
+        void init(Array<ContactManifold>* contactManifolds, Array<ContactPoint>* contactPoints, decimal timeStep,
+                  bool updatePenetrationDepths);
 
         /// Initialize the constraint solver for a given island
         void initializeForIsland(uint32 islandIndex);
@@ -381,12 +394,18 @@ class ContactSolverSystem {
         /// Solve the contacts
         void solve();
 
+        /// Solve the contacts of a given island
+        void solveIsland(uint32 islandIndex);
+
         /// Release allocated memory
         void reset();
 
         /// Return true if the split impulses position correction technique is used for contacts
         bool isSplitImpulseActive() const;
 
+        /// Return the largest impulse change applied to a contact during the last solver iteration
+        decimal getMaxImpulseChange() const;
+
         /// Activate or Deactivate the split impulses for contacts
         void setIsSplitImpulseActive(bool isActive);
 
@@ -403,28 +422,16 @@ RP3D_FORCE_INLINE bool ContactSolverSystem::isSplitImpulseActive() const {
     return mIsSplitImpulseActive;
 }
 
+// Return the largest impulse change applied to a contact during the last solver iteration
+RP3D_FORCE_INLINE decimal ContactSolverSystem::getMaxImpulseChange() const {
+    return mMaxImpulseChange;
+}
+
 // Activate or Deactivate the split impulses for contacts
 RP3D_FORCE_INLINE void ContactSolverSystem::setIsSplitImpulseActive(bool isActive) {
     mIsSplitImpulseActive = isActive;
 }
 
-// Compute the collision restitution factor from the restitution factor of each collider
-RP3D_FORCE_INLINE decimal ContactSolverSystem::computeMixedRestitutionFactor(const Material& material1, const Material& material2) const {
-
-    const decimal restitution1 = material1.getBounciness();
-    const decimal restitution2 = material2.getBounciness();
-
-    // Return the largest restitution factor
-    return (restitution1 > restitution2) ? restitution1 : restitution2;
-}
-
-// Compute the mixed friction coefficient from the friction coefficient of each collider
-RP3D_FORCE_INLINE decimal ContactSolverSystem::computeMixedFrictionCoefficient(const Material& material1, const Material& material2) const {
-
-    // Use the geometric mean to compute the mixed friction coefficient
-    return material1.getFrictionCoefficientSqrt() * material2.getFrictionCoefficientSqrt();
-}
-
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 // Set the profiler
@@ -50,6 +50,12 @@ class SolveFixedJointSystem {
         // Beta value for the bias factor of position correction
         static const decimal BETA;
 
+        // Position error (in meters) of a joint below which it is considered at rest and its position correction is skipped
+        static const decimal POSITION_SLOP;
+
+        // Rotation error (in radians) of a joint below which it is considered at rest and its position correction is skipped
+        static const decimal ROTATION_SLOP;
+
         // -------------------- Attributes -------------------- //
 
         /// Physics world
@@ -73,12 +79,26 @@ class SolveFixedJointSystem {
         /// True if warm starting of the solver is active
         bool mIsWarmStartingActive;
 
+        /// Largest squared impulse change applied by the solver since the last reset
+        decimal mMaxImpulseChangeSquare;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
         /// Pointer to the profiler
         Profiler* mProfiler;
 #endif
 
+        // -------------------- Methods -------------------- //
+
+        /// Solve the velocity constraint of a single joint
+        void solveVelocityConstraintForJoint(uint32 index);
+
+        /// Solve the position constraint of a single joint
+        void solvePositionConstraintForJoint(uint32 index);
+
+        /// Update the largest impulse change with the impulse change of a constraint
+        void updateMaxImpulseChange(decimal impulseChangeSquare);
+
     public :
 
         // -------------------- Methods -------------------- //
@@ -99,9 +119,24 @@ class SolveFixedJointSystem {
         /// Solve the velocity constraint
         void solveVelocityConstraint();
 
+        /// Solve the velocity constraint of a batch of joints
+        void solveVelocityConstraint(const uint32* jointComponentIndices, uint32 nbJoints);
+
         /// Solve the position constraint (for position error correction)
         void solvePositionConstraint();
 
+        /// Solve the position constraint of a batch of joints
+        void solvePositionConstraint(const uint32* jointComponentIndices, uint32 nbJoints);
+
+        /// Check which joints have a position error larger than the slop
+        void computePositionErrors();
+
+        /// Reset the largest impulse change applied by the solver
+        void resetMaxImpulseChange();
+
+        /// Return the largest squared impulse change applied by the solver since the last reset
+        decimal getMaxImpulseChangeSquare() const;
+
         /// Set the time step
         void setTimeStep(decimal timeStep);
 
@@ -137,6 +172,21 @@ RP3D_FORCE_INLINE void SolveFixedJointSystem::setIsWarmStartingActive(bool isWar
     mIsWarmStartingActive = isWarmStartingActive;
 }
 
+// Update the largest impulse change with the impulse change of a constraint
+RP3D_FORCE_INLINE void SolveFixedJointSystem::updateMaxImpulseChange(decimal impulseChangeSquare) {
+    mMaxImpulseChangeSquare = std::max(mMaxImpulseChangeSquare, impulseChangeSquare);
+}
+
+// Reset the largest impulse change applied by the solver
+RP3D_FORCE_INLINE void SolveFixedJointSystem::resetMaxImpulseChange() {
+    mMaxImpulseChangeSquare = decimal(0.0);
+}
+
+// Return the largest squared impulse change applied by the solver since the last reset
+RP3D_FORCE_INLINE decimal SolveFixedJointSystem::getMaxImpulseChangeSquare() const {
+    return mMaxImpulseChangeSquare;
+}
+
 
 }
 
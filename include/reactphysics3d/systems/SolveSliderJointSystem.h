@@ -50,6 +50,12 @@ class SolveSliderJointSystem {
         // Beta value for the bias factor of position correction
         static const decimal BETA;
 
+        // Position error (in meters) of a joint below which it is considered at rest and its position correction is skipped
+        static const decimal POSITION_SLOP;
+
+        // Rotation error (in radians) of a joint below which it is considered at rest and its position correction is skipped
+        static const decimal ROTATION_SLOP;
+
         // -------------------- Attributes -------------------- //
 
         /// Physics world
@@ -73,6 +79,9 @@ class SolveSliderJointSystem {
         /// True if warm starting of the solver is active
         bool mIsWarmStartingActive;
 
+        /// Largest squared impulse change applied by the solver since the last reset
+        decimal mMaxImpulseChangeSquare;
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
         /// Pointer to the profiler
@@ -81,6 +90,15 @@ class SolveSliderJointSystem {
 
         // -------------------- Methods -------------------- //
 
+        /// Solve the velocity constraint of a single joint
+        void solveVelocityConstraintForJoint(uint32 index);
+
+        /// Solve the position constraint of a single joint
+        void solvePositionConstraintForJoint(uint32 index);
+
+        /// Update the largest impulse change with the impulse change of a constraint
+        void updateMaxImpulseChange(decimal impulseChangeSquare);
+
     public :
 
         // -------------------- Methods -------------------- //
@@ -103,9 +121,24 @@ class SolveSliderJointSystem {
         /// Solve the velocity constraint
         void solveVelocityConstraint();
 
+        /// Solve the velocity constraint of a batch of joints
+        void solveVelocityConstraint(const uint32* jointComponentIndices, uint32 nbJoints);
+
         /// Solve the position constraint (for position error correction)
         void solvePositionConstraint();
 
+        /// Solve the position constraint of a batch of joints
+        void solvePositionConstraint(const uint32* jointComponentIndices, uint32 nbJoints);
+
+        /// Check which joints have a position error larger than the slop
+        void computePositionErrors();
+
+        /// Reset the largest impulse change applied by the solver
+        void resetMaxImpulseChange();
+
+        /// Return the largest squared impulse change applied by the solver since the last reset
+        decimal getMaxImpulseChangeSquare() const;
+
         /// Set the time step
         void setTimeStep(decimal timeStep);
 
@@ -141,6 +174,21 @@ RP3D_FORCE_INLINE void SolveSliderJointSystem::setIsWarmStartingActive(bool isWa
     mIsWarmStartingActive = isWarmStartingActive;
 }
 
+// Update the largest impulse change with the impulse change of a constraint
+RP3D_FORCE_INLINE void SolveSliderJointSystem::updateMaxImpulseChange(decimal impulseChangeSquare) {
+    mMaxImpulseChangeSquare = std::max(mMaxImpulseChangeSquare, impulseChangeSquare);
+}
+
+// Reset the largest impulse change applied by the solver
+RP3D_FORCE_INLINE void SolveSliderJointSystem::resetMaxImpulseChange() {
+    mMaxImpulseChangeSquare = decimal(0.0);
+}
+
+// Return the largest squared impulse change applied by the solver since the last reset
+RP3D_FORCE_INLINE decimal SolveSliderJointSystem::getMaxImpulseChangeSquare() const {
+    return mMaxImpulseChangeSquare;
+}
+
 }
 
 #endif
@@ -191,6 +191,10 @@ class DebugRenderer : public EventListener {
 		/// Draw a capsule
 		void drawCapsule(const Transform& transform, decimal radius, decimal height, uint32 color);
 
+		/// Draw a truncated cone along the local y axis (used for the cylinders and the cones)
+		void drawTruncatedCone(const Transform& transform, decimal bottomRadius, decimal topRadius, decimal bottomY,
+							   decimal topY, uint32 color);
+
 		/// Draw a convex mesh
 		void drawConvexMesh(const Transform& transform, const ConvexMeshShape* convexMesh, uint32 color);
 
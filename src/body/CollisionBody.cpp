@@ -414,6 +414,61 @@ bool CollisionBody::isActive() const {
     return mWorld.mCollisionBodyComponents.getIsActive(mEntity);
 }
 
+// Return true if the colliders of the body are stored in a local tree of the broad-phase
+/**
+ * @return True if the body is a compound body
+ */
+bool CollisionBody::isCompound() const {
+    return mWorld.mCollisionBodyComponents.getIsCompound(mEntity);
+}
+
+// Set whether or not the colliders of the body are stored in a local tree of the broad-phase
+/// The colliders of a compound body are stored in a dynamic AABB tree in the local-space of
+/// the body and the body is represented by a single proxy in the broad-phase of the world. This
+/// avoids updating the broad-phase state of each collider when the body moves and it is useful
+/// for bodies with many colliders. The colliders of the body are removed from the broad-phase
+/// and added again when this state changes, so it should be set when the body is created.
+/**
+ * @param isCompound True if the colliders of the body must be stored in a local tree of the broad-phase
+ */
+void CollisionBody::setIsCompound(bool isCompound) {
+
+    // If the state does not change
+    if (mWorld.mCollisionBodyComponents.getIsCompound(mEntity) == isCompound) return;
+
+    // Remove the colliders from the broad-phase
+    const Array<Entity>& colliderEntities = mWorld.mCollisionBodyComponents.getColliders(mEntity);
+    Array<Collider*> collidersToAdd(mWorld.mMemoryManager.getHeapAllocator(), colliderEntities.size());
+    for (uint32 i=0; i < colliderEntities.size(); i++) {
+
+        Collider* collider = mWorld.mCollidersComponents.getCollider(colliderEntities[i]);
+
+        if (collider->getBroadPhaseId() != -1) {
+            mWorld.mCollisionDetection.removeCollider(collider);
+            collidersToAdd.add(collider);
+        }
+    }
+
+    mWorld.mCollisionBodyComponents.setIsCompound(mEntity, isCompound);
+
+    // Add the colliders into the broad-phase again
+    const Transform& transform = mWorld.mTransformComponents.getTransform(mEntity);
+    for (uint32 i=0; i < collidersToAdd.size(); i++) {
+
+        Collider* collider = collidersToAdd[i];
+
+        // Compute the world-space AABB of the collider
+        AABB aabb;
+        collider->getCollisionShape()->computeAABB(aabb, transform * mWorld.mCollidersComponents.getLocalToBodyTransform(collider->getEntity()));
+
+        mWorld.mCollisionDetection.addCollider(collider, aabb);
+    }
+
+    RP3D_LOG(mWorld.mConfig.worldName, Logger::Level::Information, Logger::Category::Body,
+             "Body " + std::to_string(mEntity.id) + ": Set isCompound=" +
+             (isCompound ? "true" : "false"),  __FILE__, __LINE__);
+}
+
 // Return a pointer to the user data attached to this body
 /**
  * @return A pointer to the user data you have attached to the body
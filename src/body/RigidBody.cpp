@@ -1016,12 +1016,9 @@ void RigidBody::setIsSleeping(bool isSleeping) {
 
     mWorld.mRigidBodyComponents.setIsSleeping(mEntity, isSleeping);
 
-    // Notify all the components
+    // Notify all the components (this also enables or disables the overlapping pairs of the body)
     mWorld.setBodyDisabled(mEntity, isSleeping);
 
-    // Update the currently overlapping pairs
-    resetOverlappingPairs();
-
     if (isSleeping) {
 
         mWorld.mRigidBodyComponents.setLinearVelocity(mEntity, Vector3::zero());
@@ -1029,6 +1026,12 @@ void RigidBody::setIsSleeping(bool isSleeping) {
         mWorld.mRigidBodyComponents.setExternalForce(mEntity, Vector3::zero());
         mWorld.mRigidBodyComponents.setExternalTorque(mEntity, Vector3::zero());
     }
+    else {
+
+        // The overlapping pairs with the static bodies (or other sleeping bodies) are not created while the body
+        // is sleeping. Therefore, we ask the broad-phase to compute the new overlapping pairs of the body
+        askForBroadPhaseCollisionCheck();
+    }
 
     RP3D_LOG(mWorld.mConfig.worldName, Logger::Level::Information, Logger::Category::Body,
          "Body " + std::to_string(mEntity.id) + ": Set isSleeping=" +
@@ -1111,6 +1114,40 @@ void RigidBody::setGravityScale(decimal gravityScale)
   mWorld.mRigidBodyComponents.setGravityScale(mEntity, gravityScale);
 }
 
+// Return the solver priority of the body
+/**
+ * @return The solver priority of the body (in range [0; 1])
+ */
+decimal RigidBody::getSolverPriority() const {
+    return mWorld.mRigidBodyComponents.getSolverPriority(mEntity);
+}
+
+// Set the solver priority of the body
+/// When the per-island solver is enabled, the number of velocity and position solver iterations
+/// of an island is scaled by the largest solver priority of its dynamic bodies (with at least
+/// one iteration). Lowering the priority of the far-away or unimportant bodies (depending on the
+/// distance to the camera for instance) concentrates the solver time where accuracy matters.
+/// The priority is ignored when the per-island solver is disabled.
+/**
+ * @param solverPriority The solver priority of the body (in range [0; 1]). The default value is one.
+ */
+void RigidBody::setSolverPriority(decimal solverPriority) {
+    assert(solverPriority >= decimal(0.0) && solverPriority <= decimal(1.0));
+
+    if (solverPriority >= decimal(0.0) && solverPriority <= decimal(1.0)) {
+
+        mWorld.mRigidBodyComponents.setSolverPriority(mEntity, solverPriority);
+
+        RP3D_LOG(mWorld.mConfig.worldName, Logger::Level::Information, Logger::Category::Body,
+                 "Body " + std::to_string(mEntity.id) + ": Set solverPriority=" + std::to_string(solverPriority),  __FILE__, __LINE__);
+    }
+    else {
+
+        RP3D_LOG(mWorld.mConfig.worldName, Logger::Level::Error, Logger::Category::Body,
+                 "Error when setting the solver priority of body " + std::to_string(mEntity.id) + ": solver priority must be in range [0; 1]",  __FILE__, __LINE__);
+    }
+}
+
 
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -252,7 +252,51 @@ void Collider::setIsTrigger(bool isTrigger) const {
    mBody->mWorld.mCollidersComponents.setIsTrigger(mEntity, isTrigger);
 }
 
+// Return true if the contacts of the collider are reported to the event listener
+/**
+ * @return True if the contacts of this collider are reported to the event listener of the world
+ */
+bool Collider::getReportContacts() const {
+   return mBody->mWorld.mCollidersComponents.getReportContacts(mEntity);
+}
+
+// Set whether the contacts of the collider are reported to the event listener
+/// A contact pair is reported to the event listener of the world if at least one of its
+/// two colliders reports its contacts. If you are only interested in the contacts of a
+/// few colliders, you can disable the reporting of all the other colliders so that the
+/// cost of reporting the contacts only depends on the number of interesting contact pairs.
+/// This does not affect the contacts reported by the PhysicsWorld::testCollision() methods.
+/**
+ * @param reportContacts True if the contacts of this collider must be reported to the event listener
+ */
+void Collider::setReportContacts(bool reportContacts) const {
+   mBody->mWorld.mCollidersComponents.setReportContacts(mEntity, reportContacts);
+}
+
+// Return the minimum penetration impulse for a persisting contact to be reported
+/**
+ * @return The contact report impulse threshold of the collider
+ */
+decimal Collider::getContactReportImpulseThreshold() const {
+   return mBody->mWorld.mCollidersComponents.getContactReportImpulseThreshold(mEntity);
+}
+
+// Set the minimum penetration impulse for a persisting contact to be reported
+/// A contact pair that was already in contact in the previous frame (ContactStay event) is only
+/// reported for this collider if the sum of the penetration impulses applied at its contact
+/// points during the previous simulation step is at least this threshold. The ContactStart and
+/// ContactExit events are always reported. The default threshold is zero.
+/**
+ * @param impulseThreshold The contact report impulse threshold (in Newton second)
+ */
+void Collider::setContactReportImpulseThreshold(decimal impulseThreshold) const {
+   assert(impulseThreshold >= decimal(0.0));
+   mBody->mWorld.mCollidersComponents.setContactReportImpulseThreshold(mEntity, impulseThreshold);
+}
+
 // Return a reference to the material properties of the collider
+/// The material can be modified through the returned reference until the next
+/// update of the world. After that, the reference must be retrieved again
 /**
  * @return A reference to the material of the body
  */
@@ -260,6 +304,11 @@ Material& Collider::getMaterial() {
     return mBody->mWorld.mCollidersComponents.getMaterial(mEntity);
 }
 
+// Notify the collider that the friction or the bounciness of its material has been modified
+void Collider::notifyMaterialChanged() {
+    mBody->mWorld.mCollisionDetection.notifyColliderMaterialChanged(mEntity);
+}
+
 #ifdef IS_RP3D_PROFILING_ENABLED
 
 
@@ -77,10 +77,23 @@ CollisionCallback::ContactPair::EventType CollisionCallback::ContactPair::getEve
 
 // Constructor
 CollisionCallback::CallbackData::CallbackData(Array<reactphysics3d::ContactPair>* contactPairs, Array<ContactManifold>* manifolds,
-                                              Array<reactphysics3d::ContactPoint>* contactPoints, Array<reactphysics3d::ContactPair>& lostContactPairs, PhysicsWorld& world)
+                                              Array<reactphysics3d::ContactPoint>* contactPoints, Array<reactphysics3d::ContactPair>& lostContactPairs,
+                                              const Array<uint64>* contactPairsToReport, const Array<uint64>* lostContactPairsToReport,
+                                              PhysicsWorld& world)
                       :mContactPairs(contactPairs), mContactManifolds(manifolds), mContactPoints(contactPoints), mLostContactPairs(lostContactPairs),
-                       mContactPairsIndices(world.mMemoryManager.getHeapAllocator(), contactPairs->size()), mLostContactPairsIndices(world.mMemoryManager.getHeapAllocator(), lostContactPairs.size()),
-                       mWorld(world) {
+                       mContactPairsIndices(world.mMemoryManager.getSingleFrameAllocator(), contactPairs->size()), mLostContactPairsIndices(world.mMemoryManager.getSingleFrameAllocator(), lostContactPairs.size()),
+                       mWorld(world), mFlatContactPairs(nullptr), mFlatContactManifolds(nullptr), mFlatContactPoints(nullptr) {
+
+    // If the contact pairs to report have already been selected (contact events filtered by the colliders)
+    if (contactPairsToReport != nullptr) {
+
+        assert(lostContactPairsToReport != nullptr);
+
+        mContactPairsIndices.addRange(*contactPairsToReport);
+        mLostContactPairsIndices.addRange(*lostContactPairsToReport);
+
+        return;
+    }
 
     // Filter the contact pairs to only keep the contact events (not the overlap/trigger events)
     const uint64 nbContactPairs = mContactPairs->size();
@@ -131,3 +144,51 @@ CollisionCallback::ContactPair CollisionCallback::CallbackData::getContactPair(u
         return CollisionCallback::ContactPair(mLostContactPairs[mLostContactPairsIndices[index - mContactPairsIndices.size()]], mContactPoints, mWorld, true);
     }
 }
+
+// Return the flat array with the data of the contact pairs
+/**
+ * @return A reference to the array of contact pairs data
+ */
+const Array<CollisionCallback::FlatContactPair>& CollisionCallback::CallbackData::getFlatContactPairs() const {
+
+    if (mFlatContactPairs == nullptr) computeFlatContacts();
+
+    return *mFlatContactPairs;
+}
+
+// Return the flat array with the data of the contact manifolds
+/**
+ * @return A reference to the array of contact manifolds data
+ */
+const Array<CollisionCallback::FlatContactManifold>& CollisionCallback::CallbackData::getFlatContactManifolds() const {
+
+    if (mFlatContactManifolds == nullptr) computeFlatContacts();
+
+    return *mFlatContactManifolds;
+}
+
+// Return the flat array with the data of the contact points
+/**
+ * @return A reference to the array of contact points data
+ */
+const Array<CollisionCallback::FlatContactPoint>& CollisionCallback::CallbackData::getFlatContactPoints() const {
+
+    if (mFlatContactPoints == nullptr) computeFlatContacts();
+
+    return *mFlatContactPoints;
+}
+
+// Compute the flat view of the contacts
+/// The flat arrays are filled-in by the collision detection the first time they are requested
+/// so that the listeners that do not use them do not pay for their computation
+void CollisionCallback::CallbackData::computeFlatContacts() const {
+
+    assert(mFlatContactPairs == nullptr);
+
+    CollisionDetectionSystem& collisionDetection = mWorld.mCollisionDetection;
+    collisionDetection.computeFlatContacts(*this);
+
+    mFlatContactPairs = &collisionDetection.mFlatContactPairs;
+    mFlatContactManifolds = &collisionDetection.mFlatContactManifolds;
+    mFlatContactPoints = &collisionDetection.mFlatContactPoints;
+}
@@ -32,9 +32,11 @@ using namespace reactphysics3d;
 
 // Constructor
 ContactManifold::ContactManifold(Entity bodyEntity1, Entity bodyEntity2, Entity colliderEntity1, Entity colliderEntity2,
-                                 uint32 contactPointsIndex, uint8 nbContactPoints)
+                                 uint32 contactPointsIndex, uint8 nbContactPoints, decimal frictionCoefficient,
+                                 decimal restitutionFactor)
                 :contactPointsIndex(contactPointsIndex), bodyEntity1(bodyEntity1), bodyEntity2(bodyEntity2),
                  colliderEntity1(colliderEntity1), colliderEntity2(colliderEntity2), nbContactPoints(nbContactPoints), frictionImpulse1(0), frictionImpulse2(0),
-                 frictionTwistImpulse(0), isAlreadyInIsland(false) {
+                 frictionTwistImpulse(0), isAlreadyInIsland(false), frictionCoefficient(frictionCoefficient),
+                 restitutionFactor(restitutionFactor) {
 
 }
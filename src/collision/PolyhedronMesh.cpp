@@ -30,6 +30,7 @@
 #include <reactphysics3d/utils/DefaultLogger.h>
 #include <reactphysics3d/engine/PhysicsCommon.h>
 #include <cstdlib>
+#include <algorithm>
 
 using namespace reactphysics3d;
 
@@ -41,7 +42,10 @@ using namespace reactphysics3d;
  */
 PolyhedronMesh::PolyhedronMesh(PolygonVertexArray* polygonVertexArray, MemoryAllocator& allocator)
                : mMemoryAllocator(allocator), mHalfEdgeStructure(allocator, polygonVertexArray->getNbFaces(), polygonVertexArray->getNbVertices(),
-                                    (polygonVertexArray->getNbFaces() + polygonVertexArray->getNbVertices() - 2) * 2), mFacesNormals(nullptr) {
+                                    (polygonVertexArray->getNbFaces() + polygonVertexArray->getNbVertices() - 2) * 2),
+                 mBakedDataBuffer(nullptr), mBakedDataBufferSize(0), mVerticesX(nullptr), mVerticesY(nullptr), mVerticesZ(nullptr),
+                 mFacesNormalsX(nullptr), mFacesNormalsY(nullptr), mFacesNormalsZ(nullptr), mFacesPlaneOffsets(nullptr),
+                 mEdgesDirectionsX(nullptr), mEdgesDirectionsY(nullptr), mEdgesDirectionsZ(nullptr) {
 
    mPolygonVertexArray = polygonVertexArray;
 }
@@ -49,13 +53,8 @@ PolyhedronMesh::PolyhedronMesh(PolygonVertexArray* polygonVertexArray, MemoryAll
 // Destructor
 PolyhedronMesh::~PolyhedronMesh() {
 
-    if (mFacesNormals != nullptr) {
-
-        for (uint32 f=0; f < mHalfEdgeStructure.getNbFaces(); f++) {
-            mFacesNormals[f].~Vector3();
-        }
-
-        mMemoryAllocator.release(mFacesNormals, mHalfEdgeStructure.getNbFaces() * sizeof(Vector3));
+    if (mBakedDataBuffer != nullptr) {
+        mMemoryAllocator.release(mBakedDataBuffer, mBakedDataBufferSize);
     }
 }
 
@@ -69,8 +68,11 @@ PolyhedronMesh* PolyhedronMesh::create(PolygonVertexArray* polygonVertexArray, M
 
     if (isValid) {
 
-        // Compute the faces normals
-        mesh->computeFacesNormals();
+        // Bake the vertices and edge directions of the mesh
+        mesh->bakeVerticesAndEdges();
+
+        // Compute the faces normals and plane offsets
+        mesh->computeFacesPlanes();
 
         // Compute the centroid
         mesh->computeCentroid();
@@ -132,19 +134,17 @@ bool PolyhedronMesh::createHalfEdgeStructure() {
     // Initialize the half-edge structure
     mHalfEdgeStructure.init();
 
-    // Create the face normals array
-    mFacesNormals = new (mMemoryAllocator.allocate(mHalfEdgeStructure.getNbFaces() * sizeof(Vector3))) Vector3[mHalfEdgeStructure.getNbFaces()];
-
     return true;
 }
 
-/// Return a vertex
+// Read a vertex from the user polygon vertex array
+/// This method is only used to bake the vertices when the mesh is created. Afterwards, the
+/// vertices are read from the baked arrays with getVertex().
 /**
- * @param index Index of a given vertex in the mesh
- * @return The coordinates of a given vertex in the mesh
+ * @param index Index of a given vertex in the half-edge structure
+ * @return The coordinates of the vertex
  */
-Vector3 PolyhedronMesh::getVertex(uint32 index) const {
-    assert(index < getNbVertices());
+Vector3 PolyhedronMesh::readVertex(uint32 index) const {
 
     // Get the vertex index in the array with all vertices
     uint32 vertexIndex = mHalfEdgeStructure.getVertex(index).vertexPointIndex;
@@ -173,8 +173,79 @@ Vector3 PolyhedronMesh::getVertex(uint32 index) const {
     return vertex;
 }
 
-// Compute the faces normals
-void PolyhedronMesh::computeFacesNormals() {
+// Return the number of values of a baked array
+/// The number of values is rounded up so that the next array in the buffer stays aligned
+uint32 PolyhedronMesh::computeNbBakedValues(uint32 nbValues) {
+
+    const uint32 nbValuesPerAlignment = static_cast<uint32>(POLYHEDRON_MESH_BAKED_DATA_ALIGNMENT / sizeof(decimal));
+    return ((nbValues + nbValuesPerAlignment - 1) / nbValuesPerAlignment) * nbValuesPerAlignment;
+}
+
+// Allocate the baked data arrays and copy the vertices and edge directions in them
+/// The vertices, face planes and half-edge directions are stored in decimal precision in
+/// structure of arrays (one aligned array per coordinate) inside a single buffer. This way, the
+/// narrow-phase does not have to decode the user vertex array (stride and float/double type) and
+/// its inner loops can stream over contiguous arrays.
+void PolyhedronMesh::bakeVerticesAndEdges() {
+
+    const uint32 nbVertices = mHalfEdgeStructure.getNbVertices();
+    const uint32 nbFaces = mHalfEdgeStructure.getNbFaces();
+    const uint32 nbHalfEdges = mHalfEdgeStructure.getNbHalfEdges();
+
+    const uint32 nbBakedVertices = computeNbBakedValues(nbVertices);
+    const uint32 nbBakedFaces = computeNbBakedValues(nbFaces);
+    const uint32 nbBakedHalfEdges = computeNbBakedValues(nbHalfEdges);
+    const size_t nbBakedValues = 3 * nbBakedVertices + 4 * nbBakedFaces + 3 * nbBakedHalfEdges;
+
+    // Allocate the buffer (with some extra space to align its start)
+    mBakedDataBufferSize = nbBakedValues * sizeof(decimal) + POLYHEDRON_MESH_BAKED_DATA_ALIGNMENT;
+    mBakedDataBuffer = mMemoryAllocator.allocate(mBakedDataBufferSize);
+    assert(mBakedDataBuffer != nullptr);
+
+    const uintptr_t bufferAddress = reinterpret_cast<uintptr_t>(mBakedDataBuffer);
+    const uintptr_t alignedAddress = (bufferAddress + POLYHEDRON_MESH_BAKED_DATA_ALIGNMENT - 1) & ~(uintptr_t(POLYHEDRON_MESH_BAKED_DATA_ALIGNMENT) - 1);
+    decimal* values = reinterpret_cast<decimal*>(alignedAddress);
+
+    // The padding values at the end of the arrays are set to zero
+    std::fill(values, values + nbBakedValues, decimal(0.0));
+
+    mVerticesX = values;
+    mVerticesY = mVerticesX + nbBakedVertices;
+    mVerticesZ = mVerticesY + nbBakedVertices;
+    mFacesNormalsX = mVerticesZ + nbBakedVertices;
+    mFacesNormalsY = mFacesNormalsX + nbBakedFaces;
+    mFacesNormalsZ = mFacesNormalsY + nbBakedFaces;
+    mFacesPlaneOffsets = mFacesNormalsZ + nbBakedFaces;
+    mEdgesDirectionsX = mFacesPlaneOffsets + nbBakedFaces;
+    mEdgesDirectionsY = mEdgesDirectionsX + nbBakedHalfEdges;
+    mEdgesDirectionsZ = mEdgesDirectionsY + nbBakedHalfEdges;
+
+    // For each vertex
+    for (uint32 v=0; v < nbVertices; v++) {
+
+        const Vector3 vertex = readVertex(v);
+        mVerticesX[v] = vertex.x;
+        mVerticesY[v] = vertex.y;
+        mVerticesZ[v] = vertex.z;
+    }
+
+    // For each half-edge
+    for (uint32 e=0; e < nbHalfEdges; e++) {
+
+        const HalfEdgeStructure::Edge& edge = mHalfEdgeStructure.getHalfEdge(e);
+
+        // The twin half-edge starts at the end vertex of the half-edge
+        const uint32 endVertexIndex = mHalfEdgeStructure.getHalfEdge(edge.twinEdgeIndex).vertexIndex;
+
+        const Vector3 direction = getVertex(endVertexIndex) - getVertex(edge.vertexIndex);
+        mEdgesDirectionsX[e] = direction.x;
+        mEdgesDirectionsY[e] = direction.y;
+        mEdgesDirectionsZ[e] = direction.z;
+    }
+}
+
+// Compute the faces normals and plane offsets
+void PolyhedronMesh::computeFacesPlanes() {
 
     // For each face
     const uint32 nbFaces = mHalfEdgeStructure.getNbFaces();
@@ -183,10 +254,16 @@ void PolyhedronMesh::computeFacesNormals() {
 
         assert(face.faceVertices.size() >= 3);
 
-        const Vector3 vec1 = getVertex(face.faceVertices[1]) - getVertex(face.faceVertices[0]);
-        const Vector3 vec2 = getVertex(face.faceVertices[2]) - getVertex(face.faceVertices[0]);
-        mFacesNormals[f] = vec1.cross(vec2);
-        mFacesNormals[f].normalize();
+        const Vector3 faceVertex = getVertex(face.faceVertices[0]);
+        const Vector3 vec1 = getVertex(face.faceVertices[1]) - faceVertex;
+        const Vector3 vec2 = getVertex(face.faceVertices[2]) - faceVertex;
+        Vector3 faceNormal = vec1.cross(vec2);
+        faceNormal.normalize();
+
+        mFacesNormalsX[f] = faceNormal.x;
+        mFacesNormalsY[f] = faceNormal.y;
+        mFacesNormalsZ[f] = faceNormal.z;
+        mFacesPlaneOffsets[f] = faceNormal.dot(faceVertex);
     }
 }
 
@@ -237,12 +314,9 @@ decimal PolyhedronMesh::getVolume() const {
     // For each face of the polyhedron
     for (uint32 f=0; f < getNbFaces(); f++) {
 
-        const HalfEdgeStructure::Face& face = mHalfEdgeStructure.getFace(f);
         const decimal faceArea = getFaceArea(f);
-        const Vector3 faceNormal = mFacesNormals[f];
-        const Vector3 faceVertex = getVertex(face.faceVertices[0]);
 
-        sum += faceVertex.dot(faceNormal) * faceArea;
+        sum += mFacesPlaneOffsets[f] * faceArea;
     }
 
     return std::abs(sum) / decimal(3.0);
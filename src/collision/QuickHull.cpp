@@ -0,0 +1,521 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/QuickHull.h>
+#include <reactphysics3d/memory/MemoryAllocator.h>
+#include <cassert>
+
+using namespace reactphysics3d;
+
+// Index used for a point that is not outside of any face of the hull
+static constexpr uint32 QUICKHULL_NO_FACE = static_cast<uint32>(-1);
+
+// Constructor
+QuickHull::QuickHull(MemoryAllocator& allocator)
+          : mAllocator(allocator), mPoints(nullptr), mNbPoints(0), mTolerance(0), mFaces(allocator),
+            mMapEdgeToFace(allocator), mPointsFaces(allocator), mPointsDistances(allocator) {
+
+}
+
+// Compute the convex hull of a set of points
+/// This method returns false if the convex hull cannot be computed because the points are
+/// degenerate (less than four points or all the points are coincident, collinear or coplanar).
+/**
+ * @param points Array with the input points
+ * @param nbPoints Number of input points
+ * @param maxNbVertices Maximum number of vertices of the hull (zero for no limit)
+ * @param outVertices Output array with the vertices of the hull
+ * @param outIndices Output array with the vertex indices of each face of the hull
+ * @param outFaces Output array with the polygon faces of the hull
+ * @return True if the convex hull has been computed
+ */
+bool QuickHull::computeConvexHull(const Vector3* points, uint32 nbPoints, uint32 maxNbVertices, Array<Vector3>& outVertices,
+                                  Array<uint32>& outIndices, Array<PolygonVertexArray::PolygonFace>& outFaces) {
+
+    mPoints = points;
+    mNbPoints = nbPoints;
+    mFaces.clear();
+    mMapEdgeToFace.clear();
+    mPointsFaces.clear();
+    mPointsDistances.clear();
+
+    if (nbPoints < 4) {
+        return false;
+    }
+
+    // Compute the distance tolerance relative to the extent of the points
+    Vector3 maxAbsCoordinates(0, 0, 0);
+    for (uint32 i=0; i < nbPoints; i++) {
+        maxAbsCoordinates = Vector3::max(maxAbsCoordinates, mPoints[i].getAbsoluteVector());
+    }
+    mTolerance = decimal(3.0) * MACHINE_EPSILON * (maxAbsCoordinates.x + maxAbsCoordinates.y + maxAbsCoordinates.z);
+
+    // Create the initial tetrahedron
+    if (!createInitialTetrahedron()) {
+        return false;
+    }
+
+    // Assign each point to the face of the tetrahedron it is the furthest outside of
+    Array<uint32> tetrahedronFaces(mAllocator, 4);
+    for (uint32 f=0; f < 4; f++) {
+        tetrahedronFaces.add(f);
+    }
+    mPointsFaces.reserve(nbPoints);
+    mPointsDistances.reserve(nbPoints);
+    for (uint32 i=0; i < nbPoints; i++) {
+        mPointsFaces.add(QUICKHULL_NO_FACE);
+        mPointsDistances.add(decimal(0.0));
+        assignPointToFace(i, tetrahedronFaces);
+    }
+
+    uint32 nbHullVertices = 4;
+
+    // While the maximum number of vertices is not reached
+    while (maxNbVertices == 0 || nbHullVertices < maxNbVertices) {
+
+        // Find the point that is the furthest outside of the hull
+        uint32 furthestPoint = QUICKHULL_NO_FACE;
+        decimal maxDistance = decimal(0.0);
+        for (uint32 i=0; i < nbPoints; i++) {
+            if (mPointsFaces[i] != QUICKHULL_NO_FACE && mPointsDistances[i] > maxDistance) {
+                maxDistance = mPointsDistances[i];
+                furthestPoint = i;
+            }
+        }
+
+        // If all the points are inside the hull, the hull is complete
+        if (furthestPoint == QUICKHULL_NO_FACE) {
+            break;
+        }
+
+        addPointToHull(furthestPoint);
+        nbHullVertices++;
+    }
+
+    // Merge the coplanar triangles and compute the output faces
+    computeHullPolygons(outVertices, outIndices, outFaces);
+
+    return true;
+}
+
+// Create the initial tetrahedron of the hull and return false if the points are degenerate
+bool QuickHull::createInitialTetrahedron() {
+
+    // Find the extreme points along each axis
+    uint32 extremePoints[6] = {0, 0, 0, 0, 0, 0};
+    for (uint32 i=1; i < mNbPoints; i++) {
+        for (int axis=0; axis < 3; axis++) {
+            if (mPoints[i][axis] < mPoints[extremePoints[2 * axis]][axis]) extremePoints[2 * axis] = i;
+            if (mPoints[i][axis] > mPoints[extremePoints[2 * axis + 1]][axis]) extremePoints[2 * axis + 1] = i;
+        }
+    }
+
+    // The first two vertices are the pair of extreme points that are the most distant
+    uint32 v1 = 0, v2 = 0;
+    decimal maxSquareDistance = decimal(0.0);
+    for (int i=0; i < 6; i++) {
+        for (int j=i+1; j < 6; j++) {
+            const decimal squareDistance = (mPoints[extremePoints[j]] - mPoints[extremePoints[i]]).lengthSquare();
+            if (squareDistance > maxSquareDistance) {
+                maxSquareDistance = squareDistance;
+                v1 = extremePoints[i];
+                v2 = extremePoints[j];
+            }
+        }
+    }
+    if (maxSquareDistance <= mTolerance * mTolerance) {
+        return false;
+    }
+
+    // The third vertex is the point that is the furthest from the line of the first two vertices
+    const Vector3 lineDirection = (mPoints[v2] - mPoints[v1]).getUnit();
+    uint32 v3 = 0;
+    decimal maxDistance = decimal(0.0);
+    for (uint32 i=0; i < mNbPoints; i++) {
+        const decimal distance = lineDirection.cross(mPoints[i] - mPoints[v1]).length();
+        if (distance > maxDistance) {
+            maxDistance = distance;
+            v3 = i;
+        }
+    }
+    if (maxDistance <= mTolerance) {
+        return false;
+    }
+
+    // The fourth vertex is the point that is the furthest from the plane of the first three vertices
+    const Vector3 planeNormal = (mPoints[v2] - mPoints[v1]).cross(mPoints[v3] - mPoints[v1]).getUnit();
+    uint32 v4 = 0;
+    maxDistance = decimal(0.0);
+    decimal signedDistance = decimal(0.0);
+    for (uint32 i=0; i < mNbPoints; i++) {
+        const decimal distance = planeNormal.dot(mPoints[i] - mPoints[v1]);
+        if (std::abs(distance) > maxDistance) {
+            maxDistance = std::abs(distance);
+            signedDistance = distance;
+            v4 = i;
+        }
+    }
+    if (maxDistance <= mTolerance) {
+        return false;
+    }
+
+    // Make sure that the triangle (v1, v3, v2) is facing away from the fourth vertex
+    if (signedDistance < decimal(0.0)) {
+        std::swap(v2, v3);
+    }
+
+    addFace(v1, v3, v2);
+    addFace(v1, v2, v4);
+    addFace(v2, v3, v4);
+    addFace(v3, v1, v4);
+
+    return true;
+}
+
+// Add a triangle face to the hull and return its index
+/// The vertices must be in counter-clockwise order around the outward normal of the face
+uint32 QuickHull::addFace(uint32 vertex1, uint32 vertex2, uint32 vertex3) {
+
+    const uint32 faceIndex = static_cast<uint32>(mFaces.size());
+
+    HullFace face;
+    face.vertices[0] = vertex1;
+    face.vertices[1] = vertex2;
+    face.vertices[2] = vertex3;
+    face.normal = (mPoints[vertex2] - mPoints[vertex1]).cross(mPoints[vertex3] - mPoints[vertex1]);
+    if (face.normal.lengthSquare() > MACHINE_EPSILON * MACHINE_EPSILON) {
+        face.normal.normalize();
+    }
+    face.planeOffset = face.normal.dot(mPoints[vertex1]);
+    face.isAlive = true;
+    mFaces.add(face);
+
+    // Register the edges of the face
+    for (uint32 i=0; i < 3; i++) {
+        mMapEdgeToFace.add(Pair<uint64, uint32>(getEdgeKey(face.vertices[i], face.vertices[(i + 1) % 3]), faceIndex));
+    }
+
+    return faceIndex;
+}
+
+// Remove a face from the hull
+void QuickHull::removeFace(uint32 faceIndex) {
+
+    HullFace& face = mFaces[faceIndex];
+    for (uint32 i=0; i < 3; i++) {
+        mMapEdgeToFace.remove(getEdgeKey(face.vertices[i], face.vertices[(i + 1) % 3]));
+    }
+    face.isAlive = false;
+}
+
+// Assign a point to the face (among some candidate faces) it is the furthest outside of
+void QuickHull::assignPointToFace(uint32 pointIndex, const Array<uint32>& candidateFaces) {
+
+    mPointsFaces[pointIndex] = QUICKHULL_NO_FACE;
+    mPointsDistances[pointIndex] = mTolerance;
+
+    for (uint32 i=0; i < candidateFaces.size(); i++) {
+        const HullFace& face = mFaces[candidateFaces[i]];
+        const decimal distance = face.normal.dot(mPoints[pointIndex]) - face.planeOffset;
+        if (distance > mPointsDistances[pointIndex]) {
+            mPointsDistances[pointIndex] = distance;
+            mPointsFaces[pointIndex] = candidateFaces[i];
+        }
+    }
+}
+
+// Add a point to the hull
+/// The faces of the hull that are visible from the point are removed and new faces are
+/// created between the point and the horizon edges of the visible region.
+void QuickHull::addPointToHull(uint32 pointIndex) {
+
+    const Vector3& point = mPoints[pointIndex];
+
+    // Visibility state of each face (0: not tested, 1: visible, 2: not visible)
+    Array<uint8> facesStates(mAllocator, mFaces.size());
+    for (uint32 f=0; f < mFaces.size(); f++) {
+        facesStates.add(0);
+    }
+
+    // Find the visible faces and the horizon edges with a flood fill from the face of the point
+    Array<uint32> visibleFaces(mAllocator);
+    Array<uint32> horizonEdges(mAllocator);
+    Array<uint32> stack(mAllocator);
+    stack.add(mPointsFaces[pointIndex]);
+    facesStates[mPointsFaces[pointIndex]] = 1;
+    while (stack.size() > 0) {
+
+        const uint32 faceIndex = stack[stack.size() - 1];
+        stack.removeAt(stack.size() - 1);
+        visibleFaces.add(faceIndex);
+
+        for (uint32 i=0; i < 3; i++) {
+
+            const uint32 edgeStart = mFaces[faceIndex].vertices[i];
+            const uint32 edgeEnd = mFaces[faceIndex].vertices[(i + 1) % 3];
+
+            // Get the neighbor face through the twin edge
+            auto it = mMapEdgeToFace.find(getEdgeKey(edgeEnd, edgeStart));
+            assert(it != mMapEdgeToFace.end());
+            const uint32 neighborFace = it->second;
+
+            if (facesStates[neighborFace] == 0) {
+                const decimal distance = mFaces[neighborFace].normal.dot(point) - mFaces[neighborFace].planeOffset;
+                facesStates[neighborFace] = distance > mTolerance ? 1 : 2;
+                if (facesStates[neighborFace] == 1) {
+                    stack.add(neighborFace);
+                }
+            }
+
+            if (facesStates[neighborFace] == 2) {
+                horizonEdges.add(edgeStart);
+                horizonEdges.add(edgeEnd);
+            }
+        }
+    }
+
+    // Find the points that are outside of the visible faces (they need to be reassigned)
+    Array<uint32> orphanPoints(mAllocator);
+    mPointsFaces[pointIndex] = QUICKHULL_NO_FACE;
+    for (uint32 i=0; i < mNbPoints; i++) {
+        if (mPointsFaces[i] != QUICKHULL_NO_FACE && facesStates[mPointsFaces[i]] == 1) {
+            orphanPoints.add(i);
+        }
+    }
+
+    // Remove the visible faces
+    for (uint32 i=0; i < visibleFaces.size(); i++) {
+        removeFace(visibleFaces[i]);
+    }
+
+    // Create the new faces between the horizon edges and the point
+    Array<uint32> newFaces(mAllocator, horizonEdges.size() / 2);
+    for (uint32 i=0; i < horizonEdges.size(); i += 2) {
+        newFaces.add(addFace(horizonEdges[i], horizonEdges[i + 1], pointIndex));
+    }
+
+    // Assign the orphan points to the new faces
+    for (uint32 i=0; i < orphanPoints.size(); i++) {
+        assignPointToFace(orphanPoints[i], newFaces);
+    }
+}
+
+// Return true if a face is coplanar with a reference face
+/// The normals of the faces must be almost parallel and the vertices of the face must be
+/// on the plane of the reference face (up to the distance tolerance).
+bool QuickHull::isFaceCoplanar(uint32 faceIndex, uint32 referenceFaceIndex) const {
+
+    const HullFace& face = mFaces[faceIndex];
+    const HullFace& referenceFace = mFaces[referenceFaceIndex];
+
+    if (face.normal.dot(referenceFace.normal) < QUICKHULL_COPLANAR_FACES_MIN_COS_ANGLE) {
+        return false;
+    }
+
+    for (uint32 i=0; i < 3; i++) {
+        if (std::abs(referenceFace.normal.dot(mPoints[face.vertices[i]]) - referenceFace.planeOffset) > mTolerance) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Merge the coplanar triangles of the hull into polygons and return the faces of the hull
+void QuickHull::computeHullPolygons(Array<Vector3>& outVertices, Array<uint32>& outIndices,
+                                    Array<PolygonVertexArray::PolygonFace>& outFaces) {
+
+    // Group the adjacent faces that are coplanar with the first face of the group
+    Array<uint32> facesGroups(mAllocator, mFaces.size());
+    for (uint32 f=0; f < mFaces.size(); f++) {
+        facesGroups.add(QUICKHULL_NO_FACE);
+    }
+    Array<Array<uint32>> polygons(mAllocator);
+    Array<uint32> groupFaces(mAllocator);
+    Array<uint32> stack(mAllocator);
+    uint32 nbGroups = 0;
+    for (uint32 f=0; f < mFaces.size(); f++) {
+
+        if (!mFaces[f].isAlive || facesGroups[f] != QUICKHULL_NO_FACE) continue;
+
+        const uint32 group = nbGroups++;
+        groupFaces.clear();
+        stack.add(f);
+        facesGroups[f] = group;
+        while (stack.size() > 0) {
+
+            const uint32 faceIndex = stack[stack.size() - 1];
+            stack.removeAt(stack.size() - 1);
+            groupFaces.add(faceIndex);
+
+            for (uint32 i=0; i < 3; i++) {
+                const uint32 edgeStart = mFaces[faceIndex].vertices[i];
+                const uint32 edgeEnd = mFaces[faceIndex].vertices[(i + 1) % 3];
+                const uint32 neighborFace = mMapEdgeToFace[getEdgeKey(edgeEnd, edgeStart)];
+                if (facesGroups[neighborFace] == QUICKHULL_NO_FACE && isFaceCoplanar(neighborFace, f)) {
+                    facesGroups[neighborFace] = group;
+                    stack.add(neighborFace);
+                }
+            }
+        }
+
+        // Compute the polygon of the group (or keep the triangles if the boundary of the group is not a simple polygon)
+        Array<uint32> polygon(mAllocator);
+        if (groupFaces.size() > 1 && computeGroupPolygon(groupFaces, facesGroups, group, polygon)) {
+            polygons.add(polygon);
+        }
+        else {
+            for (uint32 i=0; i < groupFaces.size(); i++) {
+                Array<uint32> triangle(mAllocator, 3);
+                for (uint32 j=0; j < 3; j++) {
+                    triangle.add(mFaces[groupFaces[i]].vertices[j]);
+                }
+                polygons.add(triangle);
+            }
+        }
+    }
+
+    // Compute the number of polygons that contain each point
+    Array<uint32> nbVertexPolygons(mAllocator, mNbPoints);
+    for (uint32 i=0; i < mNbPoints; i++) {
+        nbVertexPolygons.add(0);
+    }
+    for (uint32 p=0; p < polygons.size(); p++) {
+        for (uint32 v=0; v < polygons[p].size(); v++) {
+            nbVertexPolygons[polygons[p][v]]++;
+        }
+    }
+
+    // Remove the vertices that are only shared by two polygons (they are on the edge between the
+    // two polygons after merging) unless a polygon would have less than three vertices
+    bool canRemoveVertices = true;
+    for (uint32 p=0; p < polygons.size(); p++) {
+        uint32 nbRemainingVertices = 0;
+        for (uint32 v=0; v < polygons[p].size(); v++) {
+            if (nbVertexPolygons[polygons[p][v]] > 2) nbRemainingVertices++;
+        }
+        if (nbRemainingVertices < 3) {
+            canRemoveVertices = false;
+            break;
+        }
+    }
+    if (canRemoveVertices) {
+        for (uint32 p=0; p < polygons.size(); p++) {
+            for (uint32 v=0; v < polygons[p].size(); ) {
+                if (nbVertexPolygons[polygons[p][v]] == 2) {
+                    polygons[p].removeAt(v);
+                }
+                else {
+                    v++;
+                }
+            }
+        }
+    }
+
+    // Compute the output vertices, indices and faces
+    Array<uint32> mapPointToVertex(mAllocator, mNbPoints);
+    for (uint32 i=0; i < mNbPoints; i++) {
+        mapPointToVertex.add(QUICKHULL_NO_FACE);
+    }
+    for (uint32 p=0; p < polygons.size(); p++) {
+
+        const Array<uint32>& polygon = polygons[p];
+        const uint32 nbVertices = static_cast<uint32>(polygon.size());
+
+        // Start the polygon at the vertex where the first three vertices form the largest triangle
+        // because the normal of the face is computed using its first three vertices
+        uint32 startVertex = 0;
+        decimal maxArea = decimal(-1.0);
+        for (uint32 v=0; v < nbVertices; v++) {
+            const Vector3& point = mPoints[polygon[v]];
+            const decimal area = (mPoints[polygon[(v + 1) % nbVertices]] - point).cross(mPoints[polygon[(v + 2) % nbVertices]] - point).lengthSquare();
+            if (area > maxArea) {
+                maxArea = area;
+                startVertex = v;
+            }
+        }
+
+        PolygonVertexArray::PolygonFace face;
+        face.nbVertices = nbVertices;
+        face.indexBase = static_cast<uint32>(outIndices.size());
+        outFaces.add(face);
+
+        for (uint32 v=0; v < nbVertices; v++) {
+            const uint32 pointIndex = polygon[(startVertex + v) % nbVertices];
+            if (mapPointToVertex[pointIndex] == QUICKHULL_NO_FACE) {
+                mapPointToVertex[pointIndex] = static_cast<uint32>(outVertices.size());
+                outVertices.add(mPoints[pointIndex]);
+            }
+            outIndices.add(mapPointToVertex[pointIndex]);
+        }
+    }
+}
+
+// Compute the polygon made of a group of triangles and return false if it is not a simple polygon
+/// The boundary edges of the group are the edges whose twin edge belongs to a face of another
+/// group. The polygon is the loop of those boundary edges.
+bool QuickHull::computeGroupPolygon(const Array<uint32>& groupFaces, const Array<uint32>& facesGroups, uint32 group,
+                                    Array<uint32>& outPolygon) const {
+
+    // Map each start vertex of a boundary edge to its end vertex
+    Map<uint32, uint32> nextVertex(mAllocator);
+    uint32 firstVertex = QUICKHULL_NO_FACE;
+    for (uint32 i=0; i < groupFaces.size(); i++) {
+        const HullFace& face = mFaces[groupFaces[i]];
+        for (uint32 j=0; j < 3; j++) {
+            const uint32 edgeStart = face.vertices[j];
+            const uint32 edgeEnd = face.vertices[(j + 1) % 3];
+            const uint32 neighborFace = mMapEdgeToFace[getEdgeKey(edgeEnd, edgeStart)];
+            if (facesGroups[neighborFace] != group) {
+
+                // If a vertex is the start of two boundary edges, the boundary is not a simple polygon
+                if (nextVertex.containsKey(edgeStart)) {
+                    return false;
+                }
+                nextVertex.add(Pair<uint32, uint32>(edgeStart, edgeEnd));
+                firstVertex = edgeStart;
+            }
+        }
+    }
+
+    if (firstVertex == QUICKHULL_NO_FACE) {
+        return false;
+    }
+
+    // Walk along the boundary edges
+    uint32 vertex = firstVertex;
+    do {
+        outPolygon.add(vertex);
+        auto it = nextVertex.find(vertex);
+        if (it == nextVertex.end() || outPolygon.size() > nextVertex.size()) {
+            return false;
+        }
+        vertex = it->second;
+    } while (vertex != firstVertex);
+
+    // The boundary must be a single loop
+    return outPolygon.size() == nextVertex.size();
+}
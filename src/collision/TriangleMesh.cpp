@@ -25,11 +25,15 @@
 
 // Libraries
 #include <reactphysics3d/collision/TriangleMesh.h>
+#include <reactphysics3d/collision/TriangleVertexArray.h>
+#include <reactphysics3d/containers/Map.h>
+#include <reactphysics3d/mathematics/mathematics_functions.h>
 
 using namespace reactphysics3d;
 
 // Constructor
-TriangleMesh::TriangleMesh(MemoryAllocator& allocator) : mTriangleArrays(allocator) {
+TriangleMesh::TriangleMesh(MemoryAllocator& allocator)
+             : mAllocator(allocator), mTriangleArrays(allocator), mTrianglesInternalEdges(allocator) {
 
 }
 
@@ -37,3 +41,92 @@ TriangleMesh::TriangleMesh(MemoryAllocator& allocator) : mTriangleArrays(allocat
 TriangleMesh::~TriangleMesh() {
 
 }
+
+// Add a subpart of the mesh
+/**
+ * @param triangleVertexArray Pointer to the TriangleVertexArray to add into the mesh
+ */
+void TriangleMesh::addSubpart(TriangleVertexArray* triangleVertexArray) {
+
+    mTriangleArrays.add(triangleVertexArray);
+
+    computeInternalEdges(triangleVertexArray);
+}
+
+// Compute the adjacency of the triangles of a subpart and the internal edges flags of its triangles
+/// Two triangles are adjacent if they share an edge with the same two vertex indices in opposite
+/// directions. An edge that is not shared (border of the mesh) or that is shared by more than two
+/// triangles is never an internal edge.
+void TriangleMesh::computeInternalEdges(const TriangleVertexArray* triangleVertexArray) {
+
+    const uint32 nbTriangles = triangleVertexArray->getNbTriangles();
+    const uint32 firstTriangleIndex = static_cast<uint32>(mTrianglesInternalEdges.size());
+
+    // Map a directed edge (start and end vertex indices) to the half-edge (triangle index * 3 + edge index) of the
+    // triangle with this edge. A value of -1 means that several triangles have the same directed edge.
+    Map<uint64, int64> mapEdgeToHalfEdge(mAllocator, 3 * nbTriangles);
+
+    for (uint32 t=0; t < nbTriangles; t++) {
+
+        uint32 verticesIndices[3];
+        triangleVertexArray->getTriangleVerticesIndices(t, verticesIndices);
+
+        for (uint32 e=0; e < 3; e++) {
+
+            const uint64 edgeKey = (static_cast<uint64>(verticesIndices[e]) << 32) | verticesIndices[(e + 1) % 3];
+
+            auto it = mapEdgeToHalfEdge.find(edgeKey);
+            if (it == mapEdgeToHalfEdge.end()) {
+                mapEdgeToHalfEdge.add(Pair<uint64, int64>(edgeKey, static_cast<int64>(t) * 3 + e));
+            }
+            else {
+                it->second = -1;
+            }
+        }
+
+        mTrianglesInternalEdges.add(0);
+    }
+
+    // For each triangle of the subpart
+    for (uint32 t=0; t < nbTriangles; t++) {
+
+        uint32 verticesIndices[3];
+        triangleVertexArray->getTriangleVerticesIndices(t, verticesIndices);
+
+        Vector3 vertices[3];
+        triangleVertexArray->getTriangleVertices(t, vertices);
+
+        uint8 internalEdges = 0;
+
+        // For each edge of the triangle
+        for (uint32 e=0; e < 3; e++) {
+
+            // Skip the edge if several triangles have the same directed edge
+            const uint64 edgeKey = (static_cast<uint64>(verticesIndices[e]) << 32) | verticesIndices[(e + 1) % 3];
+            if (mapEdgeToHalfEdge[edgeKey] < 0) {
+                continue;
+            }
+
+            // Find the neighbor triangle with the twin edge
+            const uint64 twinEdgeKey = (static_cast<uint64>(verticesIndices[(e + 1) % 3]) << 32) | verticesIndices[e];
+            auto it = mapEdgeToHalfEdge.find(twinEdgeKey);
+            if (it == mapEdgeToHalfEdge.end() || it->second < 0) {
+                continue;
+            }
+
+            const uint32 neighborTriangle = static_cast<uint32>(it->second / 3);
+            const uint32 neighborEdge = static_cast<uint32>(it->second % 3);
+
+            // Vertex of the neighbor triangle that is not on the shared edge
+            Vector3 neighborVertices[3];
+            triangleVertexArray->getTriangleVertices(neighborTriangle, neighborVertices);
+            const Vector3& neighborVertex = neighborVertices[(neighborEdge + 2) % 3];
+
+            if (isTriangleMeshInternalEdge(vertices[e], vertices[(e + 1) % 3], vertices[(e + 2) % 3], neighborVertex)) {
+                internalEdges |= static_cast<uint8>(1 << e);
+            }
+        }
+
+        mTrianglesInternalEdges[firstTriangleIndex + t] = internalEdges;
+    }
+}
@@ -177,6 +177,26 @@ void DynamicAABBTree::removeObject(int32 nodeID) {
     releaseNode(nodeID);
 }
 
+// Reserve the ID of a node that is not inserted into the tree
+/// The ID is unique among the IDs of the nodes of the tree. It can be used to identify an
+/// object that is stored outside of the tree with the same IDs as the objects of the tree.
+int32 DynamicAABBTree::reserveNodeID() {
+
+    int32 nodeID = allocateNode();
+    assert(nodeID >= 0);
+
+    return nodeID;
+}
+
+// Release the ID of a node reserved with reserveNodeID()
+void DynamicAABBTree::releaseReservedNodeID(int32 nodeID) {
+
+    assert(nodeID >= 0 && nodeID < mNbAllocatedNodes);
+    assert(mNodes[nodeID].parentID == TreeNode::NULL_TREE_NODE && nodeID != mRootNodeID);
+
+    releaseNode(nodeID);
+}
+
 // Update the dynamic tree after an object has moved.
 /// If the new AABB of the object that has moved is still inside its fat AABB, then
 /// nothing is done. Otherwise, the corresponding node is removed and reinserted into the tree.
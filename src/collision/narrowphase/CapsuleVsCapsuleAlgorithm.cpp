@@ -75,13 +75,16 @@ bool CapsuleVsCapsuleAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseI
         // Compute the sum of the radius of the two capsules (virtual spheres)
         const decimal sumRadius = capsule1Radius + capsule2Radius;
 
+        // Distance under which the separated capsules generate speculative contacts
+        const decimal contactMargin = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].contactMargin;
+
         // If the two capsules are parallel (we create two contact points)
         bool areCapsuleInnerSegmentsParralel = areParallelVectors(seg1, seg2);
         if (areCapsuleInnerSegmentsParralel) {
 
             // If the distance between the two segments is larger than the sum of the capsules radius (we do not have overlapping)
             const decimal segmentsPerpendicularDistance = computePointToLineDistance(capsule1SegA, capsule1SegB, capsule2SegA);
-            if (segmentsPerpendicularDistance >= sumRadius) {
+            if (segmentsPerpendicularDistance >= sumRadius + contactMargin) {
 
                 // The capsule are parallel but their inner segment distance is larger than the sum of the capsules radius.
                 // Therefore, we do not have overlap. If the inner segments overlap, we do not report any collision.
@@ -173,8 +176,8 @@ bool CapsuleVsCapsuleAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseI
         Vector3 closestPointsSeg1ToSeg2 = (closestPointCapsule2Seg - closestPointCapsule1Seg);
         const decimal closestPointsDistanceSquare = closestPointsSeg1ToSeg2.lengthSquare();
 
-        // If the collision shapes overlap
-        if (closestPointsDistanceSquare < sumRadius * sumRadius) {
+        // If the collision shapes overlap (or are closer than the contact margin)
+        if (closestPointsDistanceSquare < (sumRadius + contactMargin) * (sumRadius + contactMargin)) {
 
             if (narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].reportContacts) {
 
@@ -38,6 +38,7 @@ CollisionDispatch::CollisionDispatch(MemoryAllocator& allocator) : mAllocator(al
     mSphereVsConvexPolyhedronAlgorithm = new (allocator.allocate(sizeof(SphereVsConvexPolyhedronAlgorithm))) SphereVsConvexPolyhedronAlgorithm();
     mCapsuleVsConvexPolyhedronAlgorithm = new (allocator.allocate(sizeof(CapsuleVsConvexPolyhedronAlgorithm))) CapsuleVsConvexPolyhedronAlgorithm();
     mConvexPolyhedronVsConvexPolyhedronAlgorithm = new (allocator.allocate(sizeof(ConvexPolyhedronVsConvexPolyhedronAlgorithm))) ConvexPolyhedronVsConvexPolyhedronAlgorithm();
+    mGenericConvexVsConvexAlgorithm = new (allocator.allocate(sizeof(GenericConvexVsConvexAlgorithm))) GenericConvexVsConvexAlgorithm();
 
     // Fill in the collision matrix
     fillInCollisionMatrix();
@@ -65,6 +66,9 @@ CollisionDispatch::~CollisionDispatch() {
     if (mIsConvexPolyhedronVsConvexPolyhedronDefault) {
         mAllocator.release(mConvexPolyhedronVsConvexPolyhedronAlgorithm, sizeof(ConvexPolyhedronVsConvexPolyhedronAlgorithm));
     }
+    if (mIsGenericConvexVsConvexDefault) {
+        mAllocator.release(mGenericConvexVsConvexAlgorithm, sizeof(GenericConvexVsConvexAlgorithm));
+    }
 }
 
 // Select and return the narrow-phase collision detection algorithm to
@@ -102,6 +106,11 @@ NarrowPhaseAlgorithmType CollisionDispatch::selectAlgorithm(int type1, int type2
         shape2Type == CollisionShapeType::CONVEX_POLYHEDRON) {
         return NarrowPhaseAlgorithmType::ConvexPolyhedronVsConvexPolyhedron;
     }
+    // Generic Convex vs Convex algorithm
+    if ((shape1Type == CollisionShapeType::GENERIC_CONVEX || shape2Type == CollisionShapeType::GENERIC_CONVEX) &&
+        shape1Type != CollisionShapeType::CONCAVE_SHAPE && shape2Type != CollisionShapeType::CONCAVE_SHAPE) {
+        return NarrowPhaseAlgorithmType::GenericConvexVsConvex;
+    }
 
     return NarrowPhaseAlgorithmType::None;
 }
@@ -184,6 +193,19 @@ void CollisionDispatch::setConvexPolyhedronVsConvexPolyhedronAlgorithm(ConvexPol
     fillInCollisionMatrix();
 }
 
+// Set the Generic Convex vs Convex narrow-phase collision detection algorithm
+void CollisionDispatch::setGenericConvexVsConvexAlgorithm(GenericConvexVsConvexAlgorithm* algorithm) {
+
+    if (mIsGenericConvexVsConvexDefault) {
+        mAllocator.release(mGenericConvexVsConvexAlgorithm, sizeof(GenericConvexVsConvexAlgorithm));
+        mIsGenericConvexVsConvexDefault = false;
+    }
+
+    mGenericConvexVsConvexAlgorithm = algorithm;
+
+    fillInCollisionMatrix();
+}
+
 
 // Fill-in the collision detection matrix
 void CollisionDispatch::fillInCollisionMatrix() {
@@ -23,11 +23,16 @@
 *                                                                               *
 ********************************************************************************/
 
+
 // Libraries
 #include <reactphysics3d/collision/narrowphase/ConvexPolyhedronVsConvexPolyhedronAlgorithm.h>
 #include <reactphysics3d/collision/narrowphase/GJK/GJKAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/EPA/EPAAlgorithm.h>
 #include <reactphysics3d/collision/narrowphase/SAT/SATAlgorithm.h>
 #include <reactphysics3d/collision/narrowphase/NarrowPhaseInfoBatch.h>
+#include <reactphysics3d/collision/shapes/ConvexPolyhedronShape.h>
+#include <reactphysics3d/collision/ContactPointInfo.h>
+#include <cassert>
 
 // We want to use the ReactPhysics3D namespace
 using namespace reactphysics3d;
@@ -35,9 +40,13 @@ using namespace reactphysics3d;
 // Compute the narrow-phase collision detection between two convex polyhedra
 // This technique is based on the "Robust Contact Creation for Physics Simulations" presentation
 // by Dirk Gregorius.
+/// The pairs of polyhedra with at least "epaMinNbEdgePairs" pairs of edges use the GJK and EPA
+/// algorithms instead of the SAT algorithm. The contiguous items of the batch that use the same
+/// algorithm are processed together.
 bool ConvexPolyhedronVsConvexPolyhedronAlgorithm::testCollision(NarrowPhaseInfoBatch &narrowPhaseInfoBatch,
                                                                 uint32 batchStartIndex, uint32 batchNbItems,
-                                                                bool clipWithPreviousAxisIfStillColliding, MemoryAllocator& memoryAllocator) {
+                                                                bool clipWithPreviousAxisIfStillColliding, uint32 epaMinNbEdgePairs,
+                                                                MemoryAllocator& memoryAllocator) {
 
     // Run the SAT algorithm to find the separating axis and compute contact point
     SATAlgorithm satAlgorithm(clipWithPreviousAxisIfStillColliding, memoryAllocator);
@@ -49,16 +58,218 @@ bool ConvexPolyhedronVsConvexPolyhedronAlgorithm::testCollision(NarrowPhaseInfoB
 
 #endif
 
-    bool isCollisionFound = satAlgorithm.testCollisionConvexPolyhedronVsConvexPolyhedron(narrowPhaseInfoBatch, batchStartIndex, batchNbItems);
+    bool isCollisionFound = false;
+
+    const uint32 batchEndIndex = batchStartIndex + batchNbItems;
+    uint32 runStartIndex = batchStartIndex;
+    while (runStartIndex < batchEndIndex) {
+
+        // Find the items that use the same algorithm as the first item of the run
+        const bool isRunUsingEPA = isUsingGJKAndEPA(narrowPhaseInfoBatch, runStartIndex, epaMinNbEdgePairs);
+        uint32 runEndIndex = runStartIndex + 1;
+        while (runEndIndex < batchEndIndex && isUsingGJKAndEPA(narrowPhaseInfoBatch, runEndIndex, epaMinNbEdgePairs) == isRunUsingEPA) {
+            runEndIndex++;
+        }
+
+        if (isRunUsingEPA) {
+            isCollisionFound |= testCollisionWithGJKAndEPA(narrowPhaseInfoBatch, runStartIndex, runEndIndex - runStartIndex,
+                                                           satAlgorithm, memoryAllocator);
+        }
+        else {
+
+            isCollisionFound |= satAlgorithm.testCollisionConvexPolyhedronVsConvexPolyhedron(narrowPhaseInfoBatch, runStartIndex,
+                                                                                             runEndIndex - runStartIndex);
+
+            for (uint32 batchIndex = runStartIndex; batchIndex < runEndIndex; batchIndex++) {
+
+                // Get the last frame collision info
+                LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].lastFrameCollisionInfo;
+
+                lastFrameCollisionInfo->wasUsingSAT = true;
+                lastFrameCollisionInfo->wasUsingGJK = false;
+            }
+        }
+
+        runStartIndex = runEndIndex;
+    }
+
+    return isCollisionFound;
+}
+
+// Return true if the collision between two convex polyhedra is computed with the GJK and EPA algorithms
+bool ConvexPolyhedronVsConvexPolyhedronAlgorithm::isUsingGJKAndEPA(const NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex,
+                                                                   uint32 epaMinNbEdgePairs) const {
+
+    if (epaMinNbEdgePairs == 0) {
+        return false;
+    }
+
+    const CollisionShape* shape1 = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1;
+    const CollisionShape* shape2 = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2;
+
+    // The triangles of a concave mesh need the smooth mesh contacts computed by the SAT algorithm
+    if (shape1->getName() == CollisionShapeName::TRIANGLE || shape2->getName() == CollisionShapeName::TRIANGLE) {
+        return false;
+    }
+
+    const ConvexPolyhedronShape* polyhedron1 = static_cast<const ConvexPolyhedronShape*>(shape1);
+    const ConvexPolyhedronShape* polyhedron2 = static_cast<const ConvexPolyhedronShape*>(shape2);
+
+    // Number of pairs of edges (each edge is made of two half-edges)
+    const uint64 nbEdgePairs = static_cast<uint64>(polyhedron1->getNbHalfEdges() / 2) * (polyhedron2->getNbHalfEdges() / 2);
+
+    return nbEdgePairs >= epaMinNbEdgePairs;
+}
+
+// Compute the narrow-phase collision detection between two convex polyhedra with GJK and EPA
+/// The GJK algorithm finds the separated pairs (or the distance between the pairs within the contact
+/// margin). For the interpenetrating pairs, the EPA algorithm starts from the final GJK simplex to compute
+/// the penetration normal and depth. If EPA fails (degenerate polytope), we fall back to the SAT algorithm.
+bool ConvexPolyhedronVsConvexPolyhedronAlgorithm::testCollisionWithGJKAndEPA(NarrowPhaseInfoBatch& narrowPhaseInfoBatch,
+                                                                             uint32 batchStartIndex, uint32 batchNbItems,
+                                                                             SATAlgorithm& satAlgorithm, MemoryAllocator& memoryAllocator) {
+
+    bool isCollisionFound = false;
+
+    GJKAlgorithm gjkAlgorithm;
+    EPAAlgorithm epaAlgorithm(memoryAllocator);
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+
+	gjkAlgorithm.setProfiler(mProfiler);
+	epaAlgorithm.setProfiler(mProfiler);
+
+#endif
+
+    // Run the GJK algorithm
+    Array<GJKAlgorithm::GJKResult> gjkResults(memoryAllocator, batchNbItems);
+    Array<GJKAlgorithm::GJKSimplex> gjkSimplices(memoryAllocator, batchNbItems);
+    gjkAlgorithm.testCollision(narrowPhaseInfoBatch, batchStartIndex, batchNbItems, gjkResults, &gjkSimplices);
+    assert(gjkResults.size() == batchNbItems);
 
     for (uint32 batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
 
         // Get the last frame collision info
         LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].lastFrameCollisionInfo;
 
-        lastFrameCollisionInfo->wasUsingSAT = true;
-        lastFrameCollisionInfo->wasUsingGJK = false;
+        lastFrameCollisionInfo->wasUsingGJK = true;
+        lastFrameCollisionInfo->wasUsingSAT = false;
+
+        const GJKAlgorithm::GJKResult gjkResult = gjkResults[batchIndex - batchStartIndex];
+
+        // If the shapes are only within the contact margin (speculative contact)
+        if (gjkResult == GJKAlgorithm::GJKResult::COLLIDE_IN_MARGIN) {
+
+            // If we need to report contacts
+            if (narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].reportContacts) {
+
+                // Replace the contact point computed by GJK by the contact points of the closest faces
+                assert(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].nbContactPoints > 0);
+                const ContactPointInfo contactPoint = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].contactPoints[0];
+                narrowPhaseInfoBatch.resetContactPoints(batchIndex);
+
+                const Transform& shape1ToWorld = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform;
+                const Transform& shape2ToWorld = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform;
+                const Vector3 normalShape1 = shape1ToWorld.getOrientation().getInverse() * contactPoint.normal;
+                const Vector3 contactPointShape2 = (shape1ToWorld.getInverse() * shape2ToWorld) * contactPoint.localPoint2;
+
+                computeContactPoints(narrowPhaseInfoBatch, batchIndex, satAlgorithm, normalShape1, contactPoint.penetrationDepth,
+                                     contactPoint.localPoint1, contactPointShape2);
+            }
+
+            narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].isColliding = true;
+            isCollisionFound = true;
+            continue;
+        }
+
+        // If the shapes are interpenetrating
+        if (gjkResult == GJKAlgorithm::GJKResult::INTERPENETRATE) {
+
+            const ConvexShape* shape1 = static_cast<const ConvexShape*>(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1);
+            const ConvexShape* shape2 = static_cast<const ConvexShape*>(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2);
+            const Transform shape2ToShape1 = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform.getInverse() *
+                                             narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform;
+
+            // Compute the penetration depth with the EPA algorithm
+            Vector3 normalShape1;
+            decimal penetrationDepth;
+            Vector3 contactPointShape1;
+            Vector3 contactPointShape2;
+            const bool isEPASuccessful = epaAlgorithm.computePenetrationDepthAndContactPoints(gjkSimplices[batchIndex - batchStartIndex],
+                                             shape1, shape2, shape2ToShape1,
+                                             lastFrameCollisionInfo->supportVertexIndex1, lastFrameCollisionInfo->supportVertexIndex2,
+                                             normalShape1, penetrationDepth, contactPointShape1, contactPointShape2);
+
+            if (isEPASuccessful && penetrationDepth > decimal(0.0)) {
+
+                // If we need to report contacts
+                if (narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].reportContacts) {
+                    computeContactPoints(narrowPhaseInfoBatch, batchIndex, satAlgorithm, normalShape1, penetrationDepth,
+                                         contactPointShape1, contactPointShape2);
+                }
+
+                narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].isColliding = true;
+                isCollisionFound = true;
+            }
+            else {
+
+                // Run the SAT algorithm to find the separating axis and compute contact point
+                isCollisionFound |= satAlgorithm.testCollisionConvexPolyhedronVsConvexPolyhedron(narrowPhaseInfoBatch, batchIndex, 1);
+
+                lastFrameCollisionInfo->wasUsingGJK = false;
+                lastFrameCollisionInfo->wasUsingSAT = true;
+            }
+        }
     }
 
     return isCollisionFound;
 }
+
+// Compute the contact points between two convex polyhedra from a penetration normal
+/// If the face of one of the polyhedra is almost orthogonal to the penetration normal, the
+/// contact points are computed by clipping the most anti-parallel face of the other polyhedron
+/// against this face (as with the SAT algorithm). Otherwise, or if the clipping does not produce any
+/// point, we create a single contact point from the given closest points.
+/**
+ * @param normalShape1 Penetration normal (from shape 1 to shape 2 in the local-space of shape 1)
+ * @param penetrationDepth Penetration depth (negative if the shapes are separated)
+ * @param contactPointShape1 Contact point on shape 1 (in the local-space of shape 1)
+ * @param contactPointShape2 Contact point on shape 2 (in the local-space of shape 1)
+ */
+void ConvexPolyhedronVsConvexPolyhedronAlgorithm::computeContactPoints(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex,
+                                                                       SATAlgorithm& satAlgorithm, const Vector3& normalShape1,
+                                                                       decimal penetrationDepth, const Vector3& contactPointShape1,
+                                                                       const Vector3& contactPointShape2) const {
+
+    const ConvexPolyhedronShape* polyhedron1 = static_cast<const ConvexPolyhedronShape*>(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1);
+    const ConvexPolyhedronShape* polyhedron2 = static_cast<const ConvexPolyhedronShape*>(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2);
+
+    const Transform& shape1ToWorld = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform;
+    const Transform polyhedron1ToPolyhedron2 = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform.getInverse() * shape1ToWorld;
+    const Transform polyhedron2ToPolyhedron1 = polyhedron1ToPolyhedron2.getInverse();
+
+    const Vector3 normalShape2 = polyhedron1ToPolyhedron2.getOrientation() * normalShape1;
+
+    // Find the face of each polyhedron that is the most aligned with the penetration normal
+    const uint32 faceIndex1 = polyhedron1->findMostAntiParallelFace(-normalShape1);
+    const uint32 faceIndex2 = polyhedron2->findMostAntiParallelFace(normalShape2);
+    const decimal cosAngleFace1 = polyhedron1->getFaceNormal(faceIndex1).dot(normalShape1);
+    const decimal cosAngleFace2 = -polyhedron2->getFaceNormal(faceIndex2).dot(normalShape2);
+
+    const bool isReferenceFacePolyhedron1 = cosAngleFace1 >= cosAngleFace2;
+    const decimal referenceCosAngle = isReferenceFacePolyhedron1 ? cosAngleFace1 : cosAngleFace2;
+
+    // Clip the incident face against the reference face
+    if (referenceCosAngle >= EPA_FACE_CONTACT_MIN_COS_ANGLE &&
+        satAlgorithm.computePolyhedronVsPolyhedronFaceContactPoints(isReferenceFacePolyhedron1, polyhedron1, polyhedron2,
+                                                                     polyhedron1ToPolyhedron2, polyhedron2ToPolyhedron1,
+                                                                     isReferenceFacePolyhedron1 ? faceIndex1 : faceIndex2,
+                                                                     narrowPhaseInfoBatch, batchIndex)) {
+        return;
+    }
+
+    // Create a single contact point
+    narrowPhaseInfoBatch.addContactPoint(batchIndex, shape1ToWorld.getOrientation() * normalShape1, penetrationDepth,
+                                         contactPointShape1, polyhedron1ToPolyhedron2 * contactPointShape2);
+}
@@ -0,0 +1,358 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/EPA/EPAAlgorithm.h>
+#include <reactphysics3d/collision/shapes/ConvexShape.h>
+#include <reactphysics3d/mathematics/mathematics_functions.h>
+#include <reactphysics3d/memory/MemoryAllocator.h>
+#include <reactphysics3d/utils/Profiler.h>
+#include <cassert>
+
+// We want to use the ReactPhysics3D namespace
+using namespace reactphysics3d;
+
+// Constructor
+EPAAlgorithm::EPAAlgorithm(MemoryAllocator& memoryAllocator)
+             : mPoints(memoryAllocator, EPA_MAX_NB_VERTICES), mSuppPointsA(memoryAllocator, EPA_MAX_NB_VERTICES),
+               mSuppPointsB(memoryAllocator, EPA_MAX_NB_VERTICES), mFaces(memoryAllocator, 2 * EPA_MAX_NB_VERTICES),
+               mHorizonEdges(memoryAllocator, 64) {
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+        mProfiler = nullptr;
+#endif
+
+}
+
+// Compute the penetration depth and contact points between two interpenetrating convex shapes
+/// The polytope is initialized with the final simplex of the GJK algorithm (completed to a
+/// tetrahedron if necessary) and is expanded towards the boundary of the Minkowski difference
+/// A-B until the face closest to the origin cannot be pushed further. This method returns false
+/// if the polytope degenerates (for instance when the shapes are only touching), in which
+/// case the caller should fall back to another algorithm.
+/**
+ * @param simplex Final simplex of the GJK algorithm (that contains the origin)
+ * @param shape1 Pointer to the first shape
+ * @param shape2 Pointer to the second shape
+ * @param shape2ToShape1 Transform from the local-space of shape 2 to the local-space of shape 1
+ * @param supportVertexIndex1 Support vertex index used to start the hill-climbing on shape 1
+ * @param supportVertexIndex2 Support vertex index used to start the hill-climbing on shape 2
+ * @param outNormal Penetration normal (from shape 1 to shape 2 in the local-space of shape 1)
+ * @param outPenetrationDepth Penetration depth
+ * @param outContactPointShape1 Contact point on shape 1 (in the local-space of shape 1)
+ * @param outContactPointShape2 Contact point on shape 2 (in the local-space of shape 1)
+ * @return True if the penetration depth has been computed
+ */
+bool EPAAlgorithm::computePenetrationDepthAndContactPoints(const GJKAlgorithm::GJKSimplex& simplex, const ConvexShape* shape1,
+                                                           const ConvexShape* shape2, const Transform& shape2ToShape1,
+                                                           uint32& supportVertexIndex1, uint32& supportVertexIndex2,
+                                                           Vector3& outNormal, decimal& outPenetrationDepth,
+                                                           Vector3& outContactPointShape1, Vector3& outContactPointShape2) {
+
+    RP3D_PROFILE("EPAAlgorithm::computePenetrationDepthAndContactPoints()", mProfiler);
+
+    mPoints.clear();
+    mSuppPointsA.clear();
+    mSuppPointsB.clear();
+    mFaces.clear();
+
+    // Create the initial polytope
+    if (!createInitialTetrahedron(simplex, shape1, shape2, shape2ToShape1, supportVertexIndex1, supportVertexIndex2)) {
+        return false;
+    }
+
+    for (uint32 iteration = 0; iteration < EPA_MAX_NB_ITERATIONS; iteration++) {
+
+        // Find the face of the polytope that is closest to the origin
+        const uint32 closestFaceIndex = findClosestFace();
+
+        // If we cannot add more points to the polytope, we keep the current closest face
+        if (mPoints.size() >= EPA_MAX_NB_VERTICES) {
+            break;
+        }
+
+        const Vector3 closestFaceNormal = mFaces[closestFaceIndex].normal;
+        const decimal closestFaceDistance = mFaces[closestFaceIndex].distance;
+
+        // Compute the support point of the Minkowski difference in the direction of the face normal
+        Vector3 suppPointA;
+        Vector3 suppPointB;
+        computeSupportPoint(shape1, shape2, shape2ToShape1, closestFaceNormal, supportVertexIndex1, supportVertexIndex2,
+                            suppPointA, suppPointB);
+        const Vector3 point = suppPointA - suppPointB;
+
+        // If the support point is not further than the face, the face is on the boundary
+        // of the Minkowski difference and we have found the penetration depth
+        const decimal tolerance = EPA_ABSOLUTE_TOLERANCE + EPA_RELATIVE_TOLERANCE * closestFaceDistance;
+        if (point.dot(closestFaceNormal) - closestFaceDistance <= tolerance) {
+            break;
+        }
+
+        const uint32 newPointIndex = addPoint(suppPointA, suppPointB);
+
+        // Remove the faces of the polytope that are visible from the new point and
+        // compute the horizon (boundary of the removed faces)
+        mHorizonEdges.clear();
+        for (uint32 i=0; i < mFaces.size(); ) {
+
+            const PolytopeFace& face = mFaces[i];
+            if (face.normal.dot(point - mPoints[face.vertices[0]]) > decimal(0.0)) {
+
+                addHorizonEdge(face.vertices[0], face.vertices[1]);
+                addHorizonEdge(face.vertices[1], face.vertices[2]);
+                addHorizonEdge(face.vertices[2], face.vertices[0]);
+
+                mFaces.removeAtAndReplaceByLast(i);
+            }
+            else {
+                i++;
+            }
+        }
+
+        // Connect each edge of the horizon to the new point
+        for (uint32 i=0; i < mHorizonEdges.size(); i++) {
+            if (!addFace(mHorizonEdges[i].vertex1, mHorizonEdges[i].vertex2, newPointIndex)) {
+                return false;
+            }
+        }
+
+        if (mFaces.size() == 0) {
+            return false;
+        }
+    }
+
+    const PolytopeFace& closestFace = mFaces[findClosestFace()];
+
+    // Compute the point of the closest face that is closest to the origin
+    const Vector3 closestPoint = closestFace.normal * closestFace.distance;
+
+    // Compute the contact points on both shapes from the barycentric coordinates of this point
+    decimal u, v, w;
+    computeBarycentricCoordinatesInTriangle(mPoints[closestFace.vertices[0]], mPoints[closestFace.vertices[1]],
+                                            mPoints[closestFace.vertices[2]], closestPoint, u, v, w);
+
+    outContactPointShape1 = u * mSuppPointsA[closestFace.vertices[0]] + v * mSuppPointsA[closestFace.vertices[1]] +
+                            w * mSuppPointsA[closestFace.vertices[2]];
+    outContactPointShape2 = u * mSuppPointsB[closestFace.vertices[0]] + v * mSuppPointsB[closestFace.vertices[1]] +
+                            w * mSuppPointsB[closestFace.vertices[2]];
+    outNormal = closestFace.normal;
+    outPenetrationDepth = closestFace.distance;
+
+    return true;
+}
+
+// Compute the support point of the Minkowski difference A-B in a given direction
+/// The support points of both shapes are returned in the local-space of shape 1. The shapes
+/// are enlarged by their margin (radius of a sphere or a capsule). The direction must be a
+/// unit vector.
+void EPAAlgorithm::computeSupportPoint(const ConvexShape* shape1, const ConvexShape* shape2, const Transform& shape2ToShape1,
+                                       const Vector3& direction, uint32& supportVertexIndex1, uint32& supportVertexIndex2,
+                                       Vector3& outSuppPointA, Vector3& outSuppPointB) const {
+
+    outSuppPointA = shape1->getLocalSupportPointWithoutMarginFromVertex(direction, supportVertexIndex1) +
+                    direction * shape1->getMargin();
+    outSuppPointB = shape2ToShape1 * shape2->getLocalSupportPointWithoutMarginFromVertex(
+                        shape2ToShape1.getOrientation().getInverse() * (-direction), supportVertexIndex2) -
+                    direction * shape2->getMargin();
+}
+
+// Add a point of the Minkowski difference A-B to the polytope and return its index
+uint32 EPAAlgorithm::addPoint(const Vector3& suppPointA, const Vector3& suppPointB) {
+
+    mPoints.add(suppPointA - suppPointB);
+    mSuppPointsA.add(suppPointA);
+    mSuppPointsB.add(suppPointB);
+
+    return static_cast<uint32>(mPoints.size() - 1);
+}
+
+// Create the initial tetrahedron of the polytope from the GJK simplex
+/// The GJK simplex can have less than four points (when the origin lies on a face, an edge or
+/// a vertex of the simplex). In this case, new support points are added in directions that
+/// increase the dimension of the simplex. This method returns false if the tetrahedron is
+/// degenerate or if it does not contain the origin.
+bool EPAAlgorithm::createInitialTetrahedron(const GJKAlgorithm::GJKSimplex& simplex, const ConvexShape* shape1,
+                                            const ConvexShape* shape2, const Transform& shape2ToShape1,
+                                            uint32& supportVertexIndex1, uint32& supportVertexIndex2) {
+
+    if (simplex.nbPoints <= 0) {
+        return false;
+    }
+
+    for (int i=0; i < simplex.nbPoints; i++) {
+        addPoint(simplex.suppPointsA[i], simplex.suppPointsB[i]);
+    }
+
+    Vector3 suppPointA;
+    Vector3 suppPointB;
+
+    // If the simplex is a single point, add a point in one of the main axis directions
+    if (mPoints.size() == 1) {
+
+        const Vector3 axes[6] = {Vector3(1, 0, 0), Vector3(-1, 0, 0), Vector3(0, 1, 0),
+                                 Vector3(0, -1, 0), Vector3(0, 0, 1), Vector3(0, 0, -1)};
+        for (uint32 i=0; i < 6; i++) {
+
+            computeSupportPoint(shape1, shape2, shape2ToShape1, axes[i], supportVertexIndex1, supportVertexIndex2,
+                                suppPointA, suppPointB);
+            if ((suppPointA - suppPointB - mPoints[0]).lengthSquare() > MACHINE_EPSILON) {
+                addPoint(suppPointA, suppPointB);
+                break;
+            }
+        }
+    }
+
+    // If the simplex is a segment, add a point in a direction orthogonal to the segment
+    if (mPoints.size() == 2) {
+
+        const Vector3 segment = mPoints[1] - mPoints[0];
+        const Vector3 orthogonal1 = segment.getOneUnitOrthogonalVector();
+        const Vector3 orthogonal2 = segment.cross(orthogonal1).getUnit();
+        const Vector3 directions[4] = {orthogonal1, -orthogonal1, orthogonal2, -orthogonal2};
+        for (uint32 i=0; i < 4; i++) {
+
+            computeSupportPoint(shape1, shape2, shape2ToShape1, directions[i], supportVertexIndex1, supportVertexIndex2,
+                                suppPointA, suppPointB);
+            if (directions[i].dot(suppPointA - suppPointB - mPoints[0]) > EPA_ABSOLUTE_TOLERANCE) {
+                addPoint(suppPointA, suppPointB);
+                break;
+            }
+        }
+    }
+
+    // If the simplex is a triangle, add a point in the direction of one of the triangle normals
+    if (mPoints.size() == 3) {
+
+        const Vector3 normal = (mPoints[1] - mPoints[0]).cross(mPoints[2] - mPoints[0]);
+        if (normal.lengthSquare() > MACHINE_EPSILON) {
+
+            const Vector3 unitNormal = normal.getUnit();
+            const Vector3 directions[2] = {unitNormal, -unitNormal};
+            for (uint32 i=0; i < 2; i++) {
+
+                computeSupportPoint(shape1, shape2, shape2ToShape1, directions[i], supportVertexIndex1, supportVertexIndex2,
+                                    suppPointA, suppPointB);
+                if (directions[i].dot(suppPointA - suppPointB - mPoints[0]) > EPA_ABSOLUTE_TOLERANCE) {
+                    addPoint(suppPointA, suppPointB);
+                    break;
+                }
+            }
+        }
+    }
+
+    if (mPoints.size() != 4) {
+        return false;
+    }
+
+    // Reject a flat tetrahedron
+    const decimal volume = (mPoints[1] - mPoints[0]).cross(mPoints[2] - mPoints[0]).dot(mPoints[3] - mPoints[0]);
+    if (std::abs(volume) <= MACHINE_EPSILON) {
+        return false;
+    }
+
+    // Create the four faces of the tetrahedron with an outward orientation
+    const uint32 faces[4][4] = {{0, 1, 2, 3}, {0, 3, 1, 2}, {1, 3, 2, 0}, {2, 3, 0, 1}};
+    for (uint32 i=0; i < 4; i++) {
+
+        uint32 v1 = faces[i][0];
+        uint32 v2 = faces[i][1];
+        uint32 v3 = faces[i][2];
+        const Vector3& oppositePoint = mPoints[faces[i][3]];
+
+        // Make sure that the opposite vertex is behind the face
+        const Vector3 faceNormal = (mPoints[v2] - mPoints[v1]).cross(mPoints[v3] - mPoints[v1]);
+        if (faceNormal.dot(oppositePoint - mPoints[v1]) > decimal(0.0)) {
+            std::swap(v2, v3);
+        }
+
+        if (!addFace(v1, v2, v3)) {
+            return false;
+        }
+
+        // The origin must be inside the tetrahedron
+        if (mFaces[mFaces.size() - 1].distance < -EPA_ABSOLUTE_TOLERANCE) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Add a face to the polytope
+/// This method returns false if the face is degenerate.
+bool EPAAlgorithm::addFace(uint32 vertex1, uint32 vertex2, uint32 vertex3) {
+
+    Vector3 normal = (mPoints[vertex2] - mPoints[vertex1]).cross(mPoints[vertex3] - mPoints[vertex1]);
+    const decimal normalLength = normal.length();
+    if (normalLength < MACHINE_EPSILON) {
+        return false;
+    }
+    normal /= normalLength;
+
+    PolytopeFace face;
+    face.vertices[0] = vertex1;
+    face.vertices[1] = vertex2;
+    face.vertices[2] = vertex3;
+    face.normal = normal;
+    face.distance = normal.dot(mPoints[vertex1]);
+    mFaces.add(face);
+
+    return true;
+}
+
+// Return the index of the face of the polytope that is closest to the origin
+uint32 EPAAlgorithm::findClosestFace() const {
+
+    assert(mFaces.size() > 0);
+
+    uint32 closestFaceIndex = 0;
+    for (uint32 i=1; i < mFaces.size(); i++) {
+        if (mFaces[i].distance < mFaces[closestFaceIndex].distance) {
+            closestFaceIndex = i;
+        }
+    }
+
+    return closestFaceIndex;
+}
+
+// Add an edge of a removed face to the horizon
+/// An edge that is shared by two removed faces is not on the horizon. Because the faces are
+/// oriented consistently, the second face contains the reversed edge, in which case the edge
+/// is removed from the horizon.
+void EPAAlgorithm::addHorizonEdge(uint32 vertex1, uint32 vertex2) {
+
+    for (uint32 i=0; i < mHorizonEdges.size(); i++) {
+        if (mHorizonEdges[i].vertex1 == vertex2 && mHorizonEdges[i].vertex2 == vertex1) {
+            mHorizonEdges.removeAtAndReplaceByLast(i);
+            return;
+        }
+    }
+
+    PolytopeEdge edge;
+    edge.vertex1 = vertex1;
+    edge.vertex2 = vertex2;
+    mHorizonEdges.add(edge);
+}
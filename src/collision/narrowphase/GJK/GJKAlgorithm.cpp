@@ -42,16 +42,27 @@ using namespace reactphysics3d;
 /// This method implements the Hybrid Technique for computing the penetration depth by
 /// running the GJK algorithm on original objects (without margin). If the shapes intersect
 /// only in the margins, the method compute the penetration depth and contact points
-/// (of enlarged objects). If the original objects (without margin) intersect, we
-/// call the computePenetrationDepthForEnlargedObjects() method that run the GJK
-/// algorithm on the enlarged object to obtain a simplex polytope that contains the
-/// origin, they we give that simplex polytope to the EPA algorithm which will compute
-/// the correct penetration depth and contact points between the enlarged objects.
+/// (of enlarged objects). If the original objects (without margin) intersect, the result
+/// is INTERPENETRATE and the caller has to compute the penetration depth with another
+/// algorithm (SAT or EPA). In this case, if an array of simplices is given, the final
+/// simplex of the GJK algorithm (that contains the origin) is stored in it so that the
+/// EPA algorithm can start from it.
+/**
+ * @param gjkResults Array where the result of each item of the batch is added
+ * @param interpenetrationSimplices If not null, the final simplex of each item of the batch (only
+ *                                  valid for the items with the INTERPENETRATE result)
+ */
 void GJKAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex,
-                                 uint32 batchNbItems, Array<GJKResult>& gjkResults) {
+                                 uint32 batchNbItems, Array<GJKResult>& gjkResults,
+                                 Array<GJKSimplex>* interpenetrationSimplices) {
 
     RP3D_PROFILE("GJKAlgorithm::testCollision()", mProfiler);
-    
+
+    if (interpenetrationSimplices != nullptr) {
+        interpenetrationSimplices->clear();
+        interpenetrationSimplices->addWithoutInit(batchNbItems);
+    }
+
     // For each item in the batch
     for (uint32 batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
 
@@ -84,9 +95,13 @@ void GJKAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uin
         Quaternion rotateToBody2 = transform2.getOrientation().getInverse() * transform1.getOrientation();
 
         // Initialize the margin (sum of margins of both objects)
+        // (this margin is zero between two convex polyhedra)
         decimal margin = shape1->getMargin() + shape2->getMargin();
-        decimal marginSquare = margin * margin;
-        assert(margin > decimal(0.0));
+        assert(margin >= decimal(0.0));
+
+        // Distance under which the separated shapes generate a speculative contact
+        const decimal contactMargin = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].contactMargin;
+        const decimal marginSquare = (margin + contactMargin) * (margin + contactMargin);
 
         // Create a simplex set
         VoronoiSimplex simplex;
@@ -111,9 +126,10 @@ void GJKAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uin
 
         do {
 
-            // Compute the support points for original objects (without margins) A and B
-            suppA = shape1->getLocalSupportPointWithoutMargin(-v);
-            suppB = body2Tobody1 * shape2->getLocalSupportPointWithoutMargin(rotateToBody2 * v);
+            // Compute the support points for original objects (without margins) A and B (starting
+            // from the support vertices of the previous iteration or of the previous frame)
+            suppA = shape1->getLocalSupportPointWithoutMarginFromVertex(-v, lastFrameCollisionInfo->supportVertexIndex1);
+            suppB = body2Tobody1 * shape2->getLocalSupportPointWithoutMarginFromVertex(rotateToBody2 * v, lastFrameCollisionInfo->supportVertexIndex2);
 
             // Compute the support point for the Minkowski difference A-B
             w = suppA - suppB;
@@ -127,7 +143,7 @@ void GJKAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uin
                 lastFrameCollisionInfo->gjkSeparatingAxis = v;
 
                 // No intersection, we return
-                assert(gjkResults.size() == batchIndex);
+                assert(gjkResults.size() == batchIndex - batchStartIndex);
                 gjkResults.add(GJKResult::SEPARATED);
                 noIntersection = true;
                 break;
@@ -200,16 +216,16 @@ void GJKAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uin
             Vector3 normal = transform1.getOrientation() * (-v.getUnit());
             decimal penetrationDepth = margin - dist;
 
-            // If the penetration depth is negative (due too numerical errors), there is no contact
-            if (penetrationDepth <= decimal(0.0)) {
-                assert(gjkResults.size() == batchIndex);
+            // If the shapes are further apart than the contact margin, there is no contact
+            if (penetrationDepth <= -contactMargin) {
+                assert(gjkResults.size() == batchIndex - batchStartIndex);
                 gjkResults.add(GJKResult::SEPARATED);
                 continue;
             }
 
             // Do not generate a contact point with zero normal length
             if (normal.lengthSquare() < MACHINE_EPSILON) {
-                assert(gjkResults.size() == batchIndex);
+                assert(gjkResults.size() == batchIndex - batchStartIndex);
                 gjkResults.add(GJKResult::SEPARATED);
                 continue;
             }
@@ -225,13 +241,20 @@ void GJKAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uin
                 narrowPhaseInfoBatch.addContactPoint(batchIndex, normal, penetrationDepth, pA, pB);
             }
 
-            assert(gjkResults.size() == batchIndex);
+            assert(gjkResults.size() == batchIndex - batchStartIndex);
             gjkResults.add(GJKResult::COLLIDE_IN_MARGIN);
 
             continue;
         }
 
-        assert(gjkResults.size() == batchIndex);
+        // Store the simplex that contains the origin
+        if (interpenetrationSimplices != nullptr) {
+            GJKSimplex& interpenetrationSimplex = (*interpenetrationSimplices)[batchIndex - batchStartIndex];
+            interpenetrationSimplex.nbPoints = simplex.getSimplex(interpenetrationSimplex.suppPointsA, interpenetrationSimplex.suppPointsB,
+                                                                  interpenetrationSimplex.points);
+        }
+
+        assert(gjkResults.size() == batchIndex - batchStartIndex);
         gjkResults.add(GJKResult::INTERPENETRATE);
     }
 }
@@ -0,0 +1,351 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+
+// Libraries
+#include <reactphysics3d/collision/narrowphase/GenericConvexVsConvexAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/GJK/GJKAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/EPA/EPAAlgorithm.h>
+#include <reactphysics3d/collision/narrowphase/NarrowPhaseInfoBatch.h>
+#include <reactphysics3d/collision/shapes/CylinderShape.h>
+#include <reactphysics3d/collision/shapes/ConeShape.h>
+#include <reactphysics3d/collision/shapes/TriangleShape.h>
+
+// We want to use the ReactPhysics3D namespace
+using namespace reactphysics3d;
+
+// Compute the narrow-phase collision detection between a generic convex shape and a convex shape
+/// The GJK algorithm finds the separated pairs (or the distance between the pairs within the contact
+/// margin). For the interpenetrating pairs, the EPA algorithm starts from the final GJK simplex to compute
+/// the penetration normal and depth.
+bool GenericConvexVsConvexAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchStartIndex, uint32 batchNbItems,
+                                                   MemoryAllocator& memoryAllocator) {
+
+    bool isCollisionFound = false;
+
+    GJKAlgorithm gjkAlgorithm;
+    EPAAlgorithm epaAlgorithm(memoryAllocator);
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+
+	gjkAlgorithm.setProfiler(mProfiler);
+	epaAlgorithm.setProfiler(mProfiler);
+
+#endif
+
+    // Run the GJK algorithm
+    Array<GJKAlgorithm::GJKResult> gjkResults(memoryAllocator, batchNbItems);
+    Array<GJKAlgorithm::GJKSimplex> gjkSimplices(memoryAllocator, batchNbItems);
+    gjkAlgorithm.testCollision(narrowPhaseInfoBatch, batchStartIndex, batchNbItems, gjkResults, &gjkSimplices);
+    assert(gjkResults.size() == batchNbItems);
+
+    // For each item in the batch
+    for (uint32 batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
+
+        assert(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1->getType() == CollisionShapeType::GENERIC_CONVEX ||
+               narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2->getType() == CollisionShapeType::GENERIC_CONVEX);
+
+        // Get the last frame collision info
+        LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].lastFrameCollisionInfo;
+
+        lastFrameCollisionInfo->wasUsingGJK = true;
+        lastFrameCollisionInfo->wasUsingSAT = false;
+
+        const Transform& shape1ToWorld = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform;
+        const Transform& shape2ToWorld = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform;
+
+        const GJKAlgorithm::GJKResult gjkResult = gjkResults[batchIndex - batchStartIndex];
+
+        // If the shapes are only within the contact margin (shallow penetration)
+        if (gjkResult == GJKAlgorithm::GJKResult::COLLIDE_IN_MARGIN) {
+
+            // If we need to report contacts
+            if (narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].reportContacts) {
+
+                assert(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].nbContactPoints > 0);
+                const Vector3 normalShape1 = shape1ToWorld.getOrientation().getInverse() *
+                                             narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].contactPoints[0].normal;
+
+                computeDiscContactPoints(narrowPhaseInfoBatch, batchIndex, normalShape1);
+            }
+
+            narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].isColliding = true;
+            isCollisionFound = true;
+            continue;
+        }
+
+        // If the shapes are interpenetrating
+        if (gjkResult == GJKAlgorithm::GJKResult::INTERPENETRATE) {
+
+            const CollisionShape* collisionShape1 = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1;
+            const CollisionShape* collisionShape2 = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2;
+            const Transform shape2ToShape1 = shape1ToWorld.getInverse() * shape2ToWorld;
+
+            // Compute the penetration depth with the EPA algorithm
+            Vector3 normalShape1;
+            decimal penetrationDepth;
+            Vector3 contactPointShape1;
+            Vector3 contactPointShape2;
+            const bool isEPASuccessful = epaAlgorithm.computePenetrationDepthAndContactPoints(gjkSimplices[batchIndex - batchStartIndex],
+                                             static_cast<const ConvexShape*>(collisionShape1),
+                                             static_cast<const ConvexShape*>(collisionShape2), shape2ToShape1,
+                                             lastFrameCollisionInfo->supportVertexIndex1, lastFrameCollisionInfo->supportVertexIndex2,
+                                             normalShape1, penetrationDepth, contactPointShape1, contactPointShape2);
+
+            // If EPA fails (degenerate polytope) the shapes are only touching
+            if (!isEPASuccessful || penetrationDepth <= decimal(0.0)) {
+                continue;
+            }
+
+            // If we need to report contacts
+            if (narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].reportContacts) {
+
+                Vector3 normalWorld = shape1ToWorld.getOrientation() * normalShape1;
+                contactPointShape2 = shape2ToShape1.getInverse() * contactPointShape2;
+
+                // Compute smooth triangle mesh contact if one of the two collision shapes is a triangle
+                TriangleShape::computeSmoothTriangleMeshContact(collisionShape1, collisionShape2, contactPointShape1, contactPointShape2,
+                                                                shape1ToWorld, shape2ToWorld, penetrationDepth, normalWorld);
+
+                // Add a new contact point
+                narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth, contactPointShape1, contactPointShape2);
+
+                computeDiscContactPoints(narrowPhaseInfoBatch, batchIndex, shape1ToWorld.getOrientation().getInverse() * normalWorld);
+            }
+
+            narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].isColliding = true;
+            isCollisionFound = true;
+        }
+    }
+
+    return isCollisionFound;
+}
+
+// Replace the contact point of a colliding pair by the contact points of a resting disc (if any)
+/// A single contact point is not enough for a cylinder or a cone to rest on its flat disc. Therefore,
+/// if the penetration normal is aligned with the axis of the disc and with a flat face of the other
+/// shape, we replace the contact point by the points of the rim of the disc that are over this face.
+/**
+ * @param normalShape1 Penetration normal (from shape 1 to shape 2 in the local-space of shape 1)
+ */
+void GenericConvexVsConvexAlgorithm::computeDiscContactPoints(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex,
+                                                              const Vector3& normalShape1) const {
+
+    assert(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].nbContactPoints == 1);
+
+    const ContactPointInfo contactPoint = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].contactPoints[0];
+    narrowPhaseInfoBatch.resetContactPoints(batchIndex);
+
+    uint32 nbDiscContactPoints = addDiscContactPoints(narrowPhaseInfoBatch, batchIndex, true, normalShape1);
+    nbDiscContactPoints += addDiscContactPoints(narrowPhaseInfoBatch, batchIndex, false, normalShape1);
+
+    // If there is no resting disc, we keep the initial contact point
+    if (nbDiscContactPoints == 0) {
+        narrowPhaseInfoBatch.addContactPoint(batchIndex, contactPoint.normal, contactPoint.penetrationDepth,
+                                             contactPoint.localPoint1, contactPoint.localPoint2);
+    }
+}
+
+// Add the contact points on the rim of the disc of one shape resting on a flat face of the other shape
+/// The flat face of the other shape is either a face of a convex polyhedron or the disc of another
+/// cylinder or cone. We use four points of the rim of the disc and keep the ones that are above the face
+/// and within the contact margin.
+/**
+ * @param isDiscOnShape1 True if we use the disc of the first shape of the pair
+ * @param normalShape1 Penetration normal (from shape 1 to shape 2 in the local-space of shape 1)
+ * @return The number of contact points that have been added
+ */
+uint32 GenericConvexVsConvexAlgorithm::addDiscContactPoints(NarrowPhaseInfoBatch& narrowPhaseInfoBatch, uint32 batchIndex,
+                                                            bool isDiscOnShape1, const Vector3& normalShape1) const {
+
+    const CollisionShape* discShape = isDiscOnShape1 ? narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1 :
+                                                       narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2;
+    const CollisionShape* faceShape = isDiscOnShape1 ? narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape2 :
+                                                       narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1;
+
+    const Transform& shape1ToWorld = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape1ToWorldTransform;
+    const Transform& shape2ToWorld = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].shape2ToWorldTransform;
+    const Transform& faceShapeToWorld = isDiscOnShape1 ? shape2ToWorld : shape1ToWorld;
+    const Transform discShapeToFaceShape = isDiscOnShape1 ? shape2ToWorld.getInverse() * shape1ToWorld :
+                                                            shape1ToWorld.getInverse() * shape2ToWorld;
+
+    // Direction from the disc shape toward the face shape (in the local-space of the disc shape)
+    const Vector3 normalShape2 = (shape2ToWorld.getOrientation().getInverse() * shape1ToWorld.getOrientation()) * normalShape1;
+    const Vector3 discDirection = isDiscOnShape1 ? normalShape1 : -normalShape2;
+
+    // Get the disc of the disc shape that is facing the other shape
+    Vector3 discCenter;
+    decimal discRadius;
+    Vector3 discNormal;
+    if (!getContactDisc(discShape, discDirection, discCenter, discRadius, discNormal)) {
+        return 0;
+    }
+
+    // Disc normal in the local-space of the face shape
+    const Vector3 discNormalFaceShape = discShapeToFaceShape.getOrientation() * discNormal;
+
+    // Get the flat face of the other shape that is facing the disc
+    Vector3 faceNormal;
+    Vector3 facePoint;
+    uint32 faceIndex = 0;
+    decimal faceDiscRadius = decimal(0.0);
+    const ConvexPolyhedronShape* polyhedron = nullptr;
+    if (faceShape->getType() == CollisionShapeType::CONVEX_POLYHEDRON) {
+
+        polyhedron = static_cast<const ConvexPolyhedronShape*>(faceShape);
+        faceIndex = polyhedron->findMostAntiParallelFace(discNormalFaceShape);
+        faceNormal = polyhedron->getFaceNormal(faceIndex);
+        if (-faceNormal.dot(discNormalFaceShape) < EPA_FACE_CONTACT_MIN_COS_ANGLE) {
+            return 0;
+        }
+        facePoint = polyhedron->getVertexPosition(polyhedron->getFace(faceIndex).faceVertices[0]);
+    }
+    else if (!getContactDisc(faceShape, -discNormalFaceShape, facePoint, faceDiscRadius, faceNormal)) {
+        return 0;
+    }
+
+    // Normal of the contact points (from shape 1 to shape 2 in world-space)
+    const Vector3 faceNormalWorld = faceShapeToWorld.getOrientation() * faceNormal;
+    const Vector3 normalWorld = isDiscOnShape1 ? -faceNormalWorld : faceNormalWorld;
+
+    const decimal contactMargin = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].contactMargin;
+
+    // The discs of the cylinders and cones are orthogonal to the local y axis
+    const Vector3 rimOffsets[4] = {Vector3(discRadius, 0, 0), Vector3(0, 0, discRadius),
+                                   Vector3(-discRadius, 0, 0), Vector3(0, 0, -discRadius)};
+
+    uint32 nbContactPoints = 0;
+
+    // For each point of the rim of the disc
+    for (uint32 i = 0; i < 4; i++) {
+
+        const Vector3 rimPointDiscShape = discCenter + rimOffsets[i];
+        const Vector3 rimPointFaceShape = discShapeToFaceShape * rimPointDiscShape;
+
+        // Penetration depth of the rim point below the face
+        const decimal penetrationDepth = faceNormal.dot(facePoint - rimPointFaceShape);
+        if (penetrationDepth <= -contactMargin) {
+            continue;
+        }
+
+        // Project the rim point onto the face
+        const Vector3 projectedPointFaceShape = rimPointFaceShape + faceNormal * penetrationDepth;
+
+        // Discard the point if it is not over the face (or within the contact margin of the border of the other disc)
+        if (polyhedron != nullptr) {
+            if (!isPointInsideFace(polyhedron, faceIndex, faceNormal, projectedPointFaceShape)) {
+                continue;
+            }
+        }
+        else if ((projectedPointFaceShape - facePoint).lengthSquare() > (faceDiscRadius + contactMargin) * (faceDiscRadius + contactMargin)) {
+            continue;
+        }
+
+        if (isDiscOnShape1) {
+            narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth, rimPointDiscShape, projectedPointFaceShape);
+        }
+        else {
+            narrowPhaseInfoBatch.addContactPoint(batchIndex, normalWorld, penetrationDepth, projectedPointFaceShape, rimPointDiscShape);
+        }
+
+        nbContactPoints++;
+    }
+
+    return nbContactPoints;
+}
+
+// Return the flat disc of a generic convex shape whose normal is aligned with a given direction
+/**
+ * @param shape The collision shape
+ * @param direction A unit direction (in the local-space of the shape)
+ * @param outDiscCenter Center of the disc (in the local-space of the shape)
+ * @param outDiscRadius Radius of the disc
+ * @param outDiscNormal Outward normal of the disc (in the local-space of the shape)
+ * @return True if the shape has a flat disc aligned with the direction
+ */
+bool GenericConvexVsConvexAlgorithm::getContactDisc(const CollisionShape* shape, const Vector3& direction, Vector3& outDiscCenter,
+                                                    decimal& outDiscRadius, Vector3& outDiscNormal) const {
+
+    if (shape->getName() == CollisionShapeName::CYLINDER) {
+
+        const CylinderShape* cylinder = static_cast<const CylinderShape*>(shape);
+
+        // The top and bottom discs of the cylinder
+        if (std::abs(direction.y) < EPA_FACE_CONTACT_MIN_COS_ANGLE) {
+            return false;
+        }
+
+        const decimal sign = direction.y > decimal(0.0) ? decimal(1.0) : decimal(-1.0);
+        outDiscCenter = Vector3(0, sign * cylinder->getHeight() * decimal(0.5), 0);
+        outDiscRadius = cylinder->getRadius();
+        outDiscNormal = Vector3(0, sign, 0);
+
+        return true;
+    }
+
+    if (shape->getName() == CollisionShapeName::CONE) {
+
+        const ConeShape* cone = static_cast<const ConeShape*>(shape);
+
+        // The base disc of the cone
+        if (-direction.y < EPA_FACE_CONTACT_MIN_COS_ANGLE) {
+            return false;
+        }
+
+        outDiscCenter = Vector3(0, cone->getBaseY(), 0);
+        outDiscRadius = cone->getRadius();
+        outDiscNormal = Vector3(0, -1, 0);
+
+        return true;
+    }
+
+    return false;
+}
+
+// Return true if a point on the plane of a face of a polyhedron is inside this face
+/**
+ * @param faceNormal Outward normal of the face (in the local-space of the polyhedron)
+ * @param point A point on the plane of the face (in the local-space of the polyhedron)
+ */
+bool GenericConvexVsConvexAlgorithm::isPointInsideFace(const ConvexPolyhedronShape* polyhedron, uint32 faceIndex,
+                                                       const Vector3& faceNormal, const Vector3& point) const {
+
+    const HalfEdgeStructure::Face& face = polyhedron->getFace(faceIndex);
+    const uint32 nbFaceVertices = static_cast<uint32>(face.faceVertices.size());
+
+    // The vertices of the face are in counter-clockwise order around the outward normal
+    for (uint32 i = 0; i < nbFaceVertices; i++) {
+
+        const Vector3 edgeStart = polyhedron->getVertexPosition(face.faceVertices[i]);
+        const Vector3 edgeEnd = polyhedron->getVertexPosition(face.faceVertices[(i + 1) % nbFaceVertices]);
+
+        if ((edgeEnd - edgeStart).cross(point - edgeStart).dot(faceNormal) < -MACHINE_EPSILON) {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -25,18 +25,59 @@
 
 // Libraries
 #include <reactphysics3d/collision/narrowphase/NarrowPhaseInput.h>
+#include <reactphysics3d/collision/shapes/TriangleShape.h>
 
 using namespace reactphysics3d;
 
 /// Constructor
-NarrowPhaseInput::NarrowPhaseInput(MemoryAllocator& allocator, OverlappingPairs& overlappingPairs)
+NarrowPhaseInput::NarrowPhaseInput(MemoryAllocator& allocator, MemoryAllocator& triangleShapesAllocator, OverlappingPairs& overlappingPairs)
     :mSphereVsSphereBatch(overlappingPairs, allocator), mSphereVsCapsuleBatch(overlappingPairs, allocator),
      mCapsuleVsCapsuleBatch(overlappingPairs, allocator), mSphereVsConvexPolyhedronBatch(overlappingPairs, allocator),
      mCapsuleVsConvexPolyhedronBatch(overlappingPairs, allocator),
-     mConvexPolyhedronVsConvexPolyhedronBatch(overlappingPairs, allocator) {
+     mConvexPolyhedronVsConvexPolyhedronBatch(overlappingPairs, allocator),
+     mGenericConvexVsConvexBatch(overlappingPairs, allocator), mTriangleShapesAllocator(triangleShapesAllocator),
+     mTriangleShapes(triangleShapesAllocator), mNbUsedTriangleShapes(0) {
 
 }
 
+// Destructor
+NarrowPhaseInput::~NarrowPhaseInput() {
+
+    // Destroy the triangle shapes
+    for (uint32 i=0; i < mTriangleShapes.size(); i++) {
+        mTriangleShapes[i]->~TriangleShape();
+        mTriangleShapesAllocator.release(mTriangleShapes[i], sizeof(TriangleShape));
+    }
+}
+
+// Return a triangle shape set with a given triangle of a concave shape
+/// The triangle shapes are only constructed the first time they are needed and then reused
+/// for the triangles to test in the next frames. The returned shape is valid until the input
+/// is cleared.
+TriangleShape* NarrowPhaseInput::getTriangleShape(const Vector3* vertices, const Vector3* verticesNormals, uint32 shapeId,
+                                                  uint8 internalEdges, HalfEdgeStructure& triangleHalfEdgeStructure) {
+
+    // If all the triangle shapes are used, create a new one
+    if (mNbUsedTriangleShapes == mTriangleShapes.size()) {
+
+        TriangleShape* triangleShape = new (mTriangleShapesAllocator.allocate(sizeof(TriangleShape)))
+                                       TriangleShape(vertices, verticesNormals, shapeId, internalEdges, triangleHalfEdgeStructure,
+                                                     mTriangleShapesAllocator);
+        mTriangleShapes.add(triangleShape);
+        mNbUsedTriangleShapes++;
+
+        return triangleShape;
+    }
+
+    TriangleShape* triangleShape = mTriangleShapes[mNbUsedTriangleShapes];
+    mNbUsedTriangleShapes++;
+
+    assert(&(triangleShape->mTriangleHalfEdgeStructure) == &triangleHalfEdgeStructure);
+    triangleShape->setTriangle(vertices, verticesNormals, shapeId, internalEdges);
+
+    return triangleShape;
+}
+
 /// Reserve memory for the containers with cached capacity
 void NarrowPhaseInput::reserveMemory() {
 
@@ -46,6 +87,7 @@ void NarrowPhaseInput::reserveMemory() {
     mSphereVsConvexPolyhedronBatch.reserveMemory();
     mCapsuleVsConvexPolyhedronBatch.reserveMemory();
     mConvexPolyhedronVsConvexPolyhedronBatch.reserveMemory();
+    mGenericConvexVsConvexBatch.reserveMemory();
 }
 
 // Clear
@@ -57,4 +99,8 @@ void NarrowPhaseInput::clear() {
     mSphereVsConvexPolyhedronBatch.clear();
     mCapsuleVsConvexPolyhedronBatch.clear();
     mConvexPolyhedronVsConvexPolyhedronBatch.clear();
+    mGenericConvexVsConvexBatch.clear();
+
+    // The triangle shapes can be reused by the next tests
+    mNbUsedTriangleShapes = 0;
 }
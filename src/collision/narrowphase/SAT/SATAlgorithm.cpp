@@ -484,6 +484,10 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
 
     bool isCollisionFound = false;
 
+    // Face normals of polyhedron 2 and their side with respect to the Gauss map arc of an edge of polyhedron 1
+    Array<Vector3> polyhedron2FacesNormals(mMemoryAllocator);
+    Array<decimal> polyhedron2FacesSides(mMemoryAllocator);
+
     for (uint32 batchIndex = batchStartIndex; batchIndex < batchStartIndex + batchNbItems; batchIndex++) {
 
         assert(narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].collisionShape1->getType() == CollisionShapeType::CONVEX_POLYHEDRON);
@@ -509,6 +513,9 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
 
         LastFrameCollisionInfo* lastFrameCollisionInfo = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].lastFrameCollisionInfo;
 
+        // Distance under which the separated polyhedra generate speculative contacts
+        const decimal contactMargin = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].contactMargin;
+
         // If the last frame collision info is valid and was also using SAT algorithm
         if (lastFrameCollisionInfo->isValid && lastFrameCollisionInfo->wasUsingSAT) {
 
@@ -516,22 +523,45 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
             // axis. If it is the case, we directly report the collision without executing the whole SAT algorithm again. If
             // the shapes are still separated along this axis, we directly exit with no collision.
 
+            // If the shapes were separated in the previous frame, we first check if they are still separated along the
+            // cached separating axis. This only requires two support points (found by hill-climbing from the previous
+            // support vertices for a large convex mesh) and is still valid when the two features that gave this axis
+            // do not build a Minkowski face anymore.
+            if (!lastFrameCollisionInfo->wasColliding && lastFrameCollisionInfo->satHasSeparatingAxis) {
+
+                const decimal penetrationDepth = computePenetrationDepthAlongAxis(polyhedron1, polyhedron2, polyhedron2ToPolyhedron1, polyhedron1ToPolyhedron2,
+                                                                                  lastFrameCollisionInfo->satSeparatingAxis,
+                                                                                  lastFrameCollisionInfo->supportVertexIndex1,
+                                                                                  lastFrameCollisionInfo->supportVertexIndex2);
+
+                // If the previous separating axis is still a separating axis in this frame
+                if (penetrationDepth <= -contactMargin) {
+
+                    // Return no collision without running the whole SAT algorithm
+                    continue;
+                }
+            }
+
             // If the previous separating axis (or axis with minimum penetration depth)
             // was a face normal of polyhedron 1
             if (lastFrameCollisionInfo->satIsAxisFacePolyhedron1) {
 
                 const decimal penetrationDepth = testSingleFaceDirectionPolyhedronVsPolyhedron(polyhedron1, polyhedron2, polyhedron1ToPolyhedron2,
-                                                     lastFrameCollisionInfo->satMinAxisFaceIndex);
+                                                     lastFrameCollisionInfo->satMinAxisFaceIndex, lastFrameCollisionInfo->supportVertexIndex2);
 
                 // If the previous axis was a separating axis and is still a separating axis in this frame
-                if (!lastFrameCollisionInfo->wasColliding && penetrationDepth <= decimal(0.0)) {
+                if (!lastFrameCollisionInfo->wasColliding && penetrationDepth <= -contactMargin) {
+
+                    lastFrameCollisionInfo->satHasSeparatingAxis = true;
+                    lastFrameCollisionInfo->satSeparatingAxis = polyhedron1ToPolyhedron2.getOrientation() *
+                                                                polyhedron1->getFaceNormal(lastFrameCollisionInfo->satMinAxisFaceIndex);
 
                     // Return no collision without running the whole SAT algorithm
                     continue;
                 }
 
                 // The two shapes were overlapping in the previous frame and still seem to overlap in this one
-                if (lastFrameCollisionInfo->wasColliding && mClipWithPreviousAxisIfStillColliding && penetrationDepth > decimal(0.0)) {
+                if (lastFrameCollisionInfo->wasColliding && mClipWithPreviousAxisIfStillColliding && penetrationDepth > -contactMargin) {
 
                     minPenetrationDepth = penetrationDepth;
                     minFaceIndex = lastFrameCollisionInfo->satMinAxisFaceIndex;
@@ -561,17 +591,20 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
                                        // was a face normal of polyhedron 2
 
                 decimal penetrationDepth = testSingleFaceDirectionPolyhedronVsPolyhedron(polyhedron2, polyhedron1, polyhedron2ToPolyhedron1,
-                                                     lastFrameCollisionInfo->satMinAxisFaceIndex);
+                                                     lastFrameCollisionInfo->satMinAxisFaceIndex, lastFrameCollisionInfo->supportVertexIndex1);
 
                 // If the previous axis was a separating axis and is still a separating axis in this frame
-                if (!lastFrameCollisionInfo->wasColliding && penetrationDepth <= decimal(0.0)) {
+                if (!lastFrameCollisionInfo->wasColliding && penetrationDepth <= -contactMargin) {
+
+                    lastFrameCollisionInfo->satHasSeparatingAxis = true;
+                    lastFrameCollisionInfo->satSeparatingAxis = -polyhedron2->getFaceNormal(lastFrameCollisionInfo->satMinAxisFaceIndex);
 
                     // Return no collision without running the whole SAT algorithm
                     continue;
                 }
 
                 // The two shapes were overlapping in the previous frame and still seem to overlap in this one
-                if (lastFrameCollisionInfo->wasColliding && mClipWithPreviousAxisIfStillColliding && penetrationDepth > decimal(0.0)) {
+                if (lastFrameCollisionInfo->wasColliding && mClipWithPreviousAxisIfStillColliding && penetrationDepth > -contactMargin) {
 
                     minPenetrationDepth = penetrationDepth;
                     minFaceIndex = lastFrameCollisionInfo->satMinAxisFaceIndex;
@@ -603,15 +636,15 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
                 const HalfEdgeStructure::Edge& edge2 = polyhedron2->getHalfEdge(lastFrameCollisionInfo->satMinEdge2Index);
 
                 const Vector3 edge1A = polyhedron1ToPolyhedron2 * polyhedron1->getVertexPosition(edge1.vertexIndex);
-                const Vector3 edge1B = polyhedron1ToPolyhedron2 * polyhedron1->getVertexPosition(polyhedron1->getHalfEdge(edge1.nextEdgeIndex).vertexIndex);
-                const Vector3 edge1Direction = edge1B - edge1A;
+                const Vector3 edge1Direction = polyhedron1ToPolyhedron2.getOrientation() * polyhedron1->getEdgeDirection(lastFrameCollisionInfo->satMinEdge1Index);
+                const Vector3 edge1B = edge1A + edge1Direction;
                 const Vector3 edge2A = polyhedron2->getVertexPosition(edge2.vertexIndex);
-                const Vector3 edge2B = polyhedron2->getVertexPosition(polyhedron2->getHalfEdge(edge2.nextEdgeIndex).vertexIndex);
-                const Vector3 edge2Direction = edge2B - edge2A;
+                const Vector3 edge2Direction = polyhedron2->getEdgeDirection(lastFrameCollisionInfo->satMinEdge2Index);
+                const Vector3 edge2B = edge2A + edge2Direction;
 
                 // If the two edges build a minkowski face (and the cross product is
                 // therefore a candidate for separating axis
-                if (testEdgesBuildMinkowskiFace(polyhedron1, edge1, polyhedron2, edge2, polyhedron1ToPolyhedron2)) {
+                if (testEdgesBuildMinkowskiFace(polyhedron1, edge1, edge1Direction, polyhedron2, edge2, edge2Direction, polyhedron1ToPolyhedron2)) {
 
                     Vector3 separatingAxisPolyhedron2Space;
 
@@ -622,14 +655,17 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
 
                     // If the shapes were not overlapping in the previous frame and are still not
                     // overlapping in the current one
-                    if (!lastFrameCollisionInfo->wasColliding && penetrationDepth <= decimal(0.0)) {
+                    if (!lastFrameCollisionInfo->wasColliding && penetrationDepth <= -contactMargin) {
+
+                        lastFrameCollisionInfo->satHasSeparatingAxis = true;
+                        lastFrameCollisionInfo->satSeparatingAxis = separatingAxisPolyhedron2Space;
 
                         // We have found a separating axis without running the whole SAT algorithm
                         continue;
                     }
 
                     // If the shapes were overlapping on the previous axis and still seem to overlap in this frame
-                    if (lastFrameCollisionInfo->wasColliding && mClipWithPreviousAxisIfStillColliding && penetrationDepth > decimal(0.0) &&
+                    if (lastFrameCollisionInfo->wasColliding && mClipWithPreviousAxisIfStillColliding && penetrationDepth > -contactMargin &&
                         penetrationDepth < DECIMAL_LARGEST) {
 
                         // Compute the closest points between the two edges (in the local-space of poylhedron 2)
@@ -686,15 +722,19 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
 
         minPenetrationDepth = DECIMAL_LARGEST;
         isMinPenetrationFaceNormal = false;
+        lastFrameCollisionInfo->satHasSeparatingAxis = false;
 
         // Test all the face normals of the polyhedron 1 for separating axis
         uint32 faceIndex1;
-        decimal penetrationDepth1 = testFacesDirectionPolyhedronVsPolyhedron(polyhedron1, polyhedron2, polyhedron1ToPolyhedron2, faceIndex1);
-        if (penetrationDepth1 <= decimal(0.0)) {
+        decimal penetrationDepth1 = testFacesDirectionPolyhedronVsPolyhedron(polyhedron1, polyhedron2, polyhedron1ToPolyhedron2, contactMargin, faceIndex1,
+                                                                             lastFrameCollisionInfo->supportVertexIndex2);
+        if (penetrationDepth1 <= -contactMargin) {
 
             lastFrameCollisionInfo->satIsAxisFacePolyhedron1 = true;
             lastFrameCollisionInfo->satIsAxisFacePolyhedron2 = false;
             lastFrameCollisionInfo->satMinAxisFaceIndex = faceIndex1;
+            lastFrameCollisionInfo->satHasSeparatingAxis = true;
+            lastFrameCollisionInfo->satSeparatingAxis = polyhedron1ToPolyhedron2.getOrientation() * polyhedron1->getFaceNormal(faceIndex1);
 
             // We have found a separating axis
             continue;
@@ -702,12 +742,15 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
 
         // Test all the face normals of the polyhedron 2 for separating axis
         uint32 faceIndex2;
-        decimal penetrationDepth2 = testFacesDirectionPolyhedronVsPolyhedron(polyhedron2, polyhedron1, polyhedron2ToPolyhedron1, faceIndex2);
-        if (penetrationDepth2 <= decimal(0.0)) {
+        decimal penetrationDepth2 = testFacesDirectionPolyhedronVsPolyhedron(polyhedron2, polyhedron1, polyhedron2ToPolyhedron1, contactMargin, faceIndex2,
+                                                                             lastFrameCollisionInfo->supportVertexIndex1);
+        if (penetrationDepth2 <= -contactMargin) {
 
             lastFrameCollisionInfo->satIsAxisFacePolyhedron1 = false;
             lastFrameCollisionInfo->satIsAxisFacePolyhedron2 = true;
             lastFrameCollisionInfo->satMinAxisFaceIndex = faceIndex2;
+            lastFrameCollisionInfo->satHasSeparatingAxis = true;
+            lastFrameCollisionInfo->satSeparatingAxis = -polyhedron2->getFaceNormal(faceIndex2);
 
             // We have found a separating axis
             continue;
@@ -741,42 +784,90 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
 
         bool separatingAxisFound = false;
 
+        // Each edge of a polyhedron is an arc on the Gauss map (unit sphere) between the normals of its two adjacent faces.
+        // Two edges can only build a face of the Minkowski difference (and therefore a candidate separating axis) if their
+        // arcs intersect. For each edge of polyhedron 1, we compute on which side of the great circle of its arc each face
+        // normal of polyhedron 2 lies. This way, the edges of polyhedron 2 whose arc does not cross this great circle are
+        // culled with two lookups and an edge of polyhedron 1 whose great circle has all the normals on the same side is
+        // skipped without testing any edge of polyhedron 2.
+        const uint32 nbFacesPolyhedron2 = polyhedron2->getNbFaces();
+        polyhedron2FacesNormals.clear();
+        polyhedron2FacesSides.clear();
+        polyhedron2FacesNormals.addWithoutInit(nbFacesPolyhedron2);
+        polyhedron2FacesSides.addWithoutInit(nbFacesPolyhedron2);
+        for (uint32 f=0; f < nbFacesPolyhedron2; f++) {
+            polyhedron2FacesNormals[f] = polyhedron2->getFaceNormal(f);
+        }
+
+        const Vector3 polyhedron1Centroid = polyhedron1ToPolyhedron2 * polyhedron1->getCentroid();
+
         // Test the cross products of edges of polyhedron 1 with edges of polyhedron 2 for separating axis
         for (uint32 i=0; i < polyhedron1->getNbHalfEdges(); i += 2) {
 
             // Get an edge of polyhedron 1
             const HalfEdgeStructure::Edge& edge1 = polyhedron1->getHalfEdge(i);
 
+            const Vector3 edge1Direction = polyhedron1ToPolyhedron2.getOrientation() * polyhedron1->getEdgeDirection(i);
+
+            // Compute the arc of the edge of polyhedron 1 on the Gauss map (in the local-space of polyhedron 2)
+            const Vector3 a = polyhedron1ToPolyhedron2.getOrientation() * polyhedron1->getFaceNormal(edge1.faceIndex);
+            const Vector3 b = polyhedron1ToPolyhedron2.getOrientation() * polyhedron1->getFaceNormal(polyhedron1->getHalfEdge(edge1.twinEdgeIndex).faceIndex);
+            const Vector3 bCrossA = -edge1Direction;
+
+            // Compute the side of the face normals of polyhedron 2 with respect to the great circle of the arc
+            decimal minSide = DECIMAL_LARGEST;
+            decimal maxSide = DECIMAL_SMALLEST;
+            for (uint32 f=0; f < nbFacesPolyhedron2; f++) {
+                const decimal side = polyhedron2FacesNormals[f].dot(bCrossA);
+                polyhedron2FacesSides[f] = side;
+                minSide = std::min(minSide, side);
+                maxSide = std::max(maxSide, side);
+            }
+
+            // If no arc of polyhedron 2 crosses the great circle, no edge of polyhedron 2 builds a Minkowski face with this edge
+            if (minSide >= decimal(0.0) || maxSide <= decimal(0.0)) {
+                continue;
+            }
+
             const Vector3 edge1A = polyhedron1ToPolyhedron2 * polyhedron1->getVertexPosition(edge1.vertexIndex);
-            const Vector3 edge1B = polyhedron1ToPolyhedron2 * polyhedron1->getVertexPosition(polyhedron1->getHalfEdge(edge1.nextEdgeIndex).vertexIndex);
-            const Vector3 edge1Direction = edge1B - edge1A;
+            const Vector3 edge1B = edge1A + edge1Direction;
 
             for (uint32 j=0; j < polyhedron2->getNbHalfEdges(); j += 2) {
 
                 // Get an edge of polyhedron 2
                 const HalfEdgeStructure::Edge& edge2 = polyhedron2->getHalfEdge(j);
+                const uint32 twinFaceIndex2 = polyhedron2->getHalfEdge(edge2.twinEdgeIndex).faceIndex;
 
-                const Vector3 edge2A = polyhedron2->getVertexPosition(edge2.vertexIndex);
-                const Vector3 edge2B = polyhedron2->getVertexPosition(polyhedron2->getHalfEdge(edge2.nextEdgeIndex).vertexIndex);
-                const Vector3 edge2Direction = edge2B - edge2A;
+                // If the arc of the edge of polyhedron 2 does not cross the great circle of the arc of edge 1
+                if (polyhedron2FacesSides[edge2.faceIndex] * polyhedron2FacesSides[twinFaceIndex2] >= decimal(0.0)) {
+                    continue;
+                }
+
+                const Vector3 edge2Direction = polyhedron2->getEdgeDirection(j);
 
                 // If the two edges build a minkowski face (and the cross product is
                 // therefore a candidate for separating axis
-                if (testEdgesBuildMinkowskiFace(polyhedron1, edge1, polyhedron2, edge2, polyhedron1ToPolyhedron2)) {
+                // Note that we negate the normals of the second polyhedron because we are looking at the
+                // Gauss map of the minkowski difference of the polyhedrons
+                if (testGaussMapArcsIntersect(a, b, -polyhedron2FacesNormals[edge2.faceIndex], -polyhedron2FacesNormals[twinFaceIndex2],
+                                              bCrossA, -edge2Direction)) {
+
+                    const Vector3 edge2A = polyhedron2->getVertexPosition(edge2.vertexIndex);
 
                     Vector3 separatingAxisPolyhedron2Space;
 
                     // Compute the penetration depth
-                    const Vector3 polyhedron1Centroid = polyhedron1ToPolyhedron2 * polyhedron1->getCentroid();
                     decimal penetrationDepth = computeDistanceBetweenEdges(edge1A, edge2A, polyhedron1Centroid, polyhedron2->getCentroid(),
                                edge1Direction, edge2Direction, isShape1Triangle, separatingAxisPolyhedron2Space);
 
-                    if (penetrationDepth <= decimal(0.0)) {
+                    if (penetrationDepth <= -contactMargin) {
 
                         lastFrameCollisionInfo->satIsAxisFacePolyhedron1 = false;
                         lastFrameCollisionInfo->satIsAxisFacePolyhedron2 = false;
                         lastFrameCollisionInfo->satMinEdge1Index = i;
                         lastFrameCollisionInfo->satMinEdge2Index = j;
+                        lastFrameCollisionInfo->satHasSeparatingAxis = true;
+                        lastFrameCollisionInfo->satSeparatingAxis = separatingAxisPolyhedron2Space;
 
                         // We have found a separating axis
                         separatingAxisFound = true;
@@ -801,7 +892,7 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
                         separatingEdge1A = edge1A;
                         separatingEdge1B = edge1B;
                         separatingEdge2A = edge2A;
-                        separatingEdge2B = edge2B;
+                        separatingEdge2B = edge2A + edge2Direction;
                         minEdgeVsEdgeSeparatingAxisPolyhedron2Space = separatingAxisPolyhedron2Space;
                     }
                 }
@@ -819,7 +910,7 @@ bool SATAlgorithm::testCollisionConvexPolyhedronVsConvexPolyhedron(NarrowPhaseIn
         // Here we know the shapes are overlapping on a given minimum separating axis.
         // Now, we will clip the shapes along this axis to find the contact points
 
-        assert(minPenetrationDepth > decimal(0.0));
+        assert(minPenetrationDepth > -contactMargin);
 
         // If the minimum separating axis is a face normal
         if (isMinPenetrationFaceNormal) {
@@ -894,6 +985,9 @@ bool SATAlgorithm::computePolyhedronVsPolyhedronFaceContactPoints(bool isMinPene
 
     RP3D_PROFILE("SATAlgorithm::computePolyhedronVsPolyhedronFaceContactPoints", mProfiler);
 
+    // Distance under which the clipped points generate speculative contacts
+    const decimal contactMargin = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].contactMargin;
+
     const ConvexPolyhedronShape* referencePolyhedron;
     const ConvexPolyhedronShape* incidentPolyhedron;
     const Transform& referenceToIncidentTransform = isMinPenetrationFaceNormalPolyhedron1 ? polyhedron1ToPolyhedron2 : polyhedron2ToPolyhedron1;
@@ -999,7 +1093,7 @@ bool SATAlgorithm::computePolyhedronVsPolyhedronFaceContactPoints(bool isMinPene
         decimal penetrationDepth = (referenceFaceVertex - clippedPolygonVertices[i]).dot(axisReferenceSpace);
 
         // If the clip point is below the reference face
-        if (penetrationDepth > decimal(0.0)) {
+        if (penetrationDepth > -contactMargin) {
 
             contactPointsFound = true;
 
@@ -1084,7 +1178,7 @@ decimal SATAlgorithm::computeDistanceBetweenEdges(const Vector3& edge1A, const V
 decimal SATAlgorithm::testSingleFaceDirectionPolyhedronVsPolyhedron(const ConvexPolyhedronShape* polyhedron1,
                                                                     const ConvexPolyhedronShape* polyhedron2,
                                                                     const Transform& polyhedron1ToPolyhedron2,
-                                                                    uint32 faceIndex) const {
+                                                                    uint32 faceIndex, uint32& supportVertexIndex) const {
 
     RP3D_PROFILE("SATAlgorithm::testSingleFaceDirectionPolyhedronVsPolyhedron", mProfiler);
 
@@ -1096,8 +1190,9 @@ decimal SATAlgorithm::testSingleFaceDirectionPolyhedronVsPolyhedron(const Convex
     // Convert the face normal into the local-space of polyhedron 2
     const Vector3 faceNormalPolyhedron2Space = polyhedron1ToPolyhedron2.getOrientation() * faceNormal;
 
-    // Get the support point of polyhedron 2 in the inverse direction of face normal
-    const Vector3 supportPoint = polyhedron2->getLocalSupportPointWithoutMargin(-faceNormalPolyhedron2Space);
+    // Get the support point of polyhedron 2 in the inverse direction of face normal (starting
+    // from the support vertex of the previous query)
+    const Vector3 supportPoint = polyhedron2->getLocalSupportPointWithoutMarginFromVertex(-faceNormalPolyhedron2Space, supportVertexIndex);
 
     // Compute the penetration depth
     const Vector3 faceVertex = polyhedron1ToPolyhedron2 * polyhedron1->getVertexPosition(face.faceVertices[0]);
@@ -1110,7 +1205,8 @@ decimal SATAlgorithm::testSingleFaceDirectionPolyhedronVsPolyhedron(const Convex
 decimal SATAlgorithm::testFacesDirectionPolyhedronVsPolyhedron(const ConvexPolyhedronShape* polyhedron1,
                                                                const ConvexPolyhedronShape* polyhedron2,
                                                                const Transform& polyhedron1ToPolyhedron2,
-                                                               uint& minFaceIndex) const {
+                                                               decimal contactMargin, uint& minFaceIndex,
+                                                               uint32& supportVertexIndex) const {
 
     RP3D_PROFILE("SATAlgorithm::testFacesDirectionPolyhedronVsPolyhedron", mProfiler);
 
@@ -1120,10 +1216,10 @@ decimal SATAlgorithm::testFacesDirectionPolyhedronVsPolyhedron(const ConvexPolyh
     for (uint32 f = 0; f < polyhedron1->getNbFaces(); f++) {
 
         decimal penetrationDepth = testSingleFaceDirectionPolyhedronVsPolyhedron(polyhedron1, polyhedron2,
-                                                                                 polyhedron1ToPolyhedron2, f);
+                                                                                 polyhedron1ToPolyhedron2, f, supportVertexIndex);
 
-        // If the penetration depth is negative, we have found a separating axis
-        if (penetrationDepth <= decimal(0.0)) {
+        // If the separation is larger than the contact margin, we have found a separating axis
+        if (penetrationDepth <= -contactMargin) {
             minFaceIndex = f;
             return penetrationDepth;
         }
@@ -1139,9 +1235,34 @@ decimal SATAlgorithm::testFacesDirectionPolyhedronVsPolyhedron(const ConvexPolyh
 }
 
 
+// Compute the penetration depth between two polyhedrons along a given axis
+/// The penetration depth is negative if the polyhedrons are separated along the axis
+/**
+ * @param axisPolyhedron2Space Unit axis going from polyhedron 1 to polyhedron 2 (in the local-space of polyhedron 2)
+ * @param supportVertexIndex1 Index of the vertex of polyhedron 1 to start the support point search from (set to the new support vertex)
+ * @param supportVertexIndex2 Index of the vertex of polyhedron 2 to start the support point search from (set to the new support vertex)
+ * @return The penetration depth along the axis
+ */
+decimal SATAlgorithm::computePenetrationDepthAlongAxis(const ConvexPolyhedronShape* polyhedron1, const ConvexPolyhedronShape* polyhedron2,
+                                                       const Transform& polyhedron2ToPolyhedron1, const Transform& polyhedron1ToPolyhedron2,
+                                                       const Vector3& axisPolyhedron2Space, uint32& supportVertexIndex1,
+                                                       uint32& supportVertexIndex2) const {
+
+    RP3D_PROFILE("SATAlgorithm::computePenetrationDepthAlongAxis", mProfiler);
+
+    const Vector3 axisPolyhedron1Space = polyhedron2ToPolyhedron1.getOrientation() * axisPolyhedron2Space;
+
+    // Support point of polyhedron 1 along the axis and support point of polyhedron 2 in the opposite direction
+    const Vector3 supportPoint1 = polyhedron1ToPolyhedron2 * polyhedron1->getLocalSupportPointWithoutMarginFromVertex(axisPolyhedron1Space, supportVertexIndex1);
+    const Vector3 supportPoint2 = polyhedron2->getLocalSupportPointWithoutMarginFromVertex(-axisPolyhedron2Space, supportVertexIndex2);
+
+    return (supportPoint1 - supportPoint2).dot(axisPolyhedron2Space);
+}
+
 // Return true if two edges of two polyhedrons build a minkowski face (and can therefore be a separating axis)
 bool SATAlgorithm::testEdgesBuildMinkowskiFace(const ConvexPolyhedronShape* polyhedron1, const HalfEdgeStructure::Edge& edge1,
-                                               const ConvexPolyhedronShape* polyhedron2, const HalfEdgeStructure::Edge& edge2,
+                                               const Vector3& edge1Direction, const ConvexPolyhedronShape* polyhedron2,
+                                               const HalfEdgeStructure::Edge& edge2, const Vector3& edge2Direction,
                                                const Transform& polyhedron1ToPolyhedron2) const {
 
     RP3D_PROFILE("SATAlgorithm::testEdgesBuildMinkowskiFace", mProfiler);
@@ -1152,15 +1273,11 @@ bool SATAlgorithm::testEdgesBuildMinkowskiFace(const ConvexPolyhedronShape* poly
     const Vector3 c = polyhedron2->getFaceNormal(edge2.faceIndex);
     const Vector3 d = polyhedron2->getFaceNormal(polyhedron2->getHalfEdge(edge2.twinEdgeIndex).faceIndex);
 
-    // Compute b.cross(a) using the edge direction
-    const Vector3 edge1Vertex1 = polyhedron1->getVertexPosition(edge1.vertexIndex);
-    const Vector3 edge1Vertex2 = polyhedron1->getVertexPosition(polyhedron1->getHalfEdge(edge1.twinEdgeIndex).vertexIndex);
-    const Vector3 bCrossA = polyhedron1ToPolyhedron2.getOrientation() * (edge1Vertex1 - edge1Vertex2);
+    // Compute b.cross(a) using the edge direction (from the end vertex to the start vertex of edge 1)
+    const Vector3 bCrossA = -edge1Direction;
 
-    // Compute d.cross(c) using the edge direction
-    const Vector3 edge2Vertex1 = polyhedron2->getVertexPosition(edge2.vertexIndex);
-    const Vector3 edge2Vertex2 = polyhedron2->getVertexPosition(polyhedron2->getHalfEdge(edge2.twinEdgeIndex).vertexIndex);
-    const Vector3 dCrossC = edge2Vertex1 - edge2Vertex2;
+    // Compute d.cross(c) using the edge direction (from the end vertex to the start vertex of edge 2)
+    const Vector3 dCrossC = -edge2Direction;
 
     // Test if the two arcs of the Gauss Map intersect (therefore forming a minkowski face)
     // Note that we negate the normals of the second polyhedron because we are looking at the
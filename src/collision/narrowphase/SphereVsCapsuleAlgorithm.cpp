@@ -77,8 +77,11 @@ bool SphereVsCapsuleAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseIn
         // Compute the sum of the radius of the sphere and the capsule (virtual sphere)
         decimal sumRadius = sphereRadius + capsuleRadius;
 
-        // If the collision shapes overlap
-        if (sphereSegmentDistanceSquare < sumRadius * sumRadius) {
+        // Distance under which the separated shapes generate a speculative contact
+        const decimal contactMargin = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].contactMargin;
+
+        // If the collision shapes overlap (or are closer than the contact margin)
+        if (sphereSegmentDistanceSquare < (sumRadius + contactMargin) * (sumRadius + contactMargin)) {
 
             decimal penetrationDepth;
             Vector3 normalWorld;
@@ -130,7 +133,7 @@ bool SphereVsCapsuleAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseIn
                     contactPointCapsuleLocal = sphereCenter - normalCapsuleSpace * capsuleRadius;
                 }
 
-                if (penetrationDepth <= decimal(0.0)) {
+                if (penetrationDepth <= -contactMargin) {
 
                     // No collision
                     continue;
@@ -58,8 +58,11 @@ bool SphereVsSphereAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInf
         // Compute the sum of the radius
         const decimal sumRadiuses = sphere1Radius + sphere2Radius;
 
-        // Compute the product of the sum of the radius
-        const decimal sumRadiusesProducts = sumRadiuses * sumRadiuses;
+        // Distance under which the separated spheres generate a speculative contact
+        const decimal contactMargin = narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].contactMargin;
+
+        // Compute the product of the sum of the radius (enlarged by the contact margin)
+        const decimal sumRadiusesProducts = (sumRadiuses + contactMargin) * (sumRadiuses + contactMargin);
 
         // If the sphere collision shapes intersect
         if (squaredDistanceBetweenCenters < sumRadiusesProducts) {
@@ -68,7 +71,7 @@ bool SphereVsSphereAlgorithm::testCollision(NarrowPhaseInfoBatch& narrowPhaseInf
 
             // Make sure the penetration depth is not zero (even if the previous condition test was true the penetration depth can still be
             // zero because of precision issue of the computation at the previous line)
-            if (penetrationDepth > 0) {
+            if (penetrationDepth > -contactMargin) {
 
                 // If we need to report contacts
                 if (narrowPhaseInfoBatch.narrowPhaseInfos[batchIndex].reportContacts) {
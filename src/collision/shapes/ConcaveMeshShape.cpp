@@ -129,6 +129,7 @@ uint32 ConcaveMeshShape::getNbTriangles(uint32 subPart) const
 // Compute all the triangles of the mesh that are overlapping with the AABB in parameter
 void ConcaveMeshShape::computeOverlappingTriangles(const AABB& localAABB, Array<Vector3>& triangleVertices,
                                                    Array<Vector3>& triangleVerticesNormals, Array<uint32>& shapeIds,
+                                                   Array<uint8>& trianglesInternalEdges,
                                                    MemoryAllocator& allocator) const {
 
     RP3D_PROFILE("ConcaveMeshShape::computeOverlappingTriangles()", mProfiler);
@@ -163,7 +164,11 @@ void ConcaveMeshShape::computeOverlappingTriangles(const AABB& localAABB, Array<
         getTriangleVerticesNormals(data[0], data[1], &(triangleVerticesNormals[i * 3]));
 
         // Compute the triangle shape ID
-        shapeIds.add(computeTriangleShapeId(data[0], data[1]));
+        const uint32 shapeId = computeTriangleShapeId(data[0], data[1]);
+        shapeIds.add(shapeId);
+
+        // Get the internal edges of the triangle (the shape ID is the index of the triangle in the mesh)
+        trianglesInternalEdges.add(mTriangleMesh->getTriangleInternalEdges(shapeId));
     }
 }
 
@@ -247,7 +252,7 @@ void ConcaveMeshRaycastCallback::raycastTriangles() {
         mConcaveMeshShape.getTriangleVerticesNormals(data[0], data[1], verticesNormals);
 
         // Create a triangle collision shape
-        TriangleShape triangleShape(trianglePoints, verticesNormals, mConcaveMeshShape.computeTriangleShapeId(data[0], data[1]), mConcaveMeshShape.mTriangleHalfEdgeStructure, mAllocator);
+        TriangleShape triangleShape(trianglePoints, verticesNormals, mConcaveMeshShape.computeTriangleShapeId(data[0], data[1]), 0, mConcaveMeshShape.mTriangleHalfEdgeStructure, mAllocator);
         triangleShape.setRaycastTestType(mConcaveMeshShape.getRaycastTestType());
 		
 #ifdef IS_RP3D_PROFILING_ENABLED
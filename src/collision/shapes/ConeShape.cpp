@@ -0,0 +1,183 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/shapes/ConeShape.h>
+#include <reactphysics3d/collision/Collider.h>
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/collision/RaycastInfo.h>
+#include <cassert>
+
+using namespace reactphysics3d;
+
+// Constructor
+/**
+ * @param radius The radius of the base of the cone (in meters)
+ * @param height The height of the cone (in meters)
+ */
+ConeShape::ConeShape(decimal radius, decimal height, MemoryAllocator& allocator)
+          : ConvexShape(CollisionShapeName::CONE, CollisionShapeType::GENERIC_CONVEX, allocator),
+            mRadius(radius), mHeight(height) {
+
+    assert(radius > decimal(0.0));
+    assert(height > decimal(0.0));
+}
+
+// Return the local inertia tensor of the cone (around its center of mass)
+/**
+ * @param mass Mass to use to compute the inertia tensor of the collision shape
+ */
+Vector3 ConeShape::getLocalInertiaTensor(decimal mass) const {
+
+    const decimal radiusSquare = mRadius * mRadius;
+    const decimal IxxAndzz = mass * (decimal(3.0 / 20.0) * radiusSquare + decimal(3.0 / 80.0) * mHeight * mHeight);
+    const decimal Iyy = decimal(0.3) * mass * radiusSquare;
+    return Vector3(IxxAndzz, Iyy, IxxAndzz);
+}
+
+// Return true if a point is inside the collision shape
+bool ConeShape::testPointInside(const Vector3& localPoint, Collider* /*collider*/) const {
+
+    const decimal apexY = getApexY();
+    if (localPoint.y >= apexY || localPoint.y <= getBaseY()) return false;
+
+    // Radius of the cone at the height of the point
+    const decimal radius = mRadius * (apexY - localPoint.y) / mHeight;
+
+    return (localPoint.x * localPoint.x + localPoint.z * localPoint.z) < radius * radius;
+}
+
+// Raycast method with feedback information
+/// The cone is the intersection of the slab between its base and its apex and of an infinite
+/// cone. We compute the interval of the ray inside each of them. The hit point is the entry
+/// point of the intersection of both intervals.
+bool ConeShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, Collider* collider, MemoryAllocator& /*allocator*/) const {
+
+    const Vector3 n = ray.point2 - ray.point1;
+    const Vector3& p = ray.point1;
+    const decimal apexY = getApexY();
+    const decimal baseY = getBaseY();
+
+    decimal tEnter = -DECIMAL_LARGEST;
+    decimal tExit = DECIMAL_LARGEST;
+    Vector3 hitNormal;
+
+    // Interval of the ray between the base and the apex of the cone
+    if (std::abs(n.y) < MACHINE_EPSILON) {
+
+        // If the ray is parallel to the base and outside of the slab, there is no hit
+        if (p.y <= baseY || p.y >= apexY) return false;
+    }
+    else {
+
+        decimal t1 = (baseY - p.y) / n.y;
+        decimal t2 = (apexY - p.y) / n.y;
+        hitNormal.setAllValues(0, -1, 0);
+        if (t1 > t2) {
+            std::swap(t1, t2);
+            hitNormal.setAllValues(0, 1, 0);
+        }
+        tEnter = t1;
+        tExit = t2;
+    }
+
+    // The infinite cone with the same apex is the set of points with f(x) = x^2 + z^2 - k^2 * (apexY - y)^2 <= 0
+    // (with k = radius / height). Along the ray, f(t) = a * t^2 + 2 * b * t + c.
+    const decimal k = mRadius / mHeight;
+    const decimal kSquare = k * k;
+    const decimal q = apexY - p.y;
+    const decimal a = n.x * n.x + n.z * n.z - kSquare * n.y * n.y;
+    const decimal b = p.x * n.x + p.z * n.z + kSquare * q * n.y;
+    const decimal c = p.x * p.x + p.z * p.z - kSquare * q * q;
+
+    // Interval of the ray inside the lower nappe of the infinite cone
+    decimal coneEnter;
+    decimal coneExit;
+    if (std::abs(a) < MACHINE_EPSILON) {
+
+        // The ray is parallel to a line of the cone surface and crosses it once
+        if (std::abs(b) < MACHINE_EPSILON) return false;
+        const decimal t = -c / (decimal(2.0) * b);
+        coneEnter = b < decimal(0.0) ? t : -DECIMAL_LARGEST;
+        coneExit = b < decimal(0.0) ? DECIMAL_LARGEST : t;
+    }
+    else {
+
+        const decimal discriminant = b * b - a * c;
+        if (discriminant < decimal(0.0)) {
+
+            // The ray is either always outside or always inside of the double cone
+            if (a > decimal(0.0)) return false;
+            coneEnter = -DECIMAL_LARGEST;
+            coneExit = DECIMAL_LARGEST;
+        }
+        else {
+
+            const decimal sqrtDiscriminant = std::sqrt(discriminant);
+            decimal t1 = (-b - sqrtDiscriminant) / a;
+            decimal t2 = (-b + sqrtDiscriminant) / a;
+            if (t1 > t2) std::swap(t1, t2);
+
+            if (a > decimal(0.0)) {
+
+                // The ray crosses a single nappe. There is no hit if it is the upper nappe
+                if (apexY - (p.y + t1 * n.y) < decimal(0.0)) return false;
+                coneEnter = t1;
+                coneExit = t2;
+            }
+            else {
+
+                // The ray crosses both nappes. We keep the part of the ray inside the lower nappe
+                if (apexY - (p.y + t1 * n.y) >= decimal(0.0)) {
+                    coneEnter = -DECIMAL_LARGEST;
+                    coneExit = t1;
+                }
+                else {
+                    coneEnter = t2;
+                    coneExit = DECIMAL_LARGEST;
+                }
+            }
+        }
+    }
+
+    if (coneEnter > tEnter) {
+        tEnter = coneEnter;
+        const Vector3 hitPoint = p + coneEnter * n;
+        hitNormal.setAllValues(hitPoint.x, kSquare * (apexY - hitPoint.y), hitPoint.z);
+    }
+    tExit = std::min(tExit, coneExit);
+
+    // If the intervals do not overlap, if the origin of the ray is inside the cone or if
+    // the hit is beyond the maximum raycasting distance, there is no hit
+    if (tEnter > tExit || tEnter < decimal(0.0) || tEnter > ray.maxFraction) return false;
+
+    raycastInfo.body = collider->getBody();
+    raycastInfo.collider = collider;
+    raycastInfo.hitFraction = tEnter;
+    raycastInfo.worldPoint = p + tEnter * n;
+    raycastInfo.worldNormal = hitNormal.getUnit();
+
+    return true;
+}
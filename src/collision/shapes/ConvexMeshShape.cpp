@@ -48,35 +48,98 @@ ConvexMeshShape::ConvexMeshShape(PolyhedronMesh* polyhedronMesh, MemoryAllocator
 }
 
 // Return a local support point in a given direction without the object margin.
-/// If the edges information is not used for collision detection, this method will go through
-/// the whole vertices array and pick up the vertex with the largest dot product in the support
-/// direction. This is an O(n) process with "n" being the number of vertices in the mesh.
-/// However, if the edges information is used, we can cache the previous support vertex and use
-/// it as a start in a hill-climbing (local search) process to find the new support vertex which
-/// will be in most of the cases very close to the previous one. Using hill-climbing, this method
-/// runs in almost constant time.
+/// The search starts from the first vertex of the mesh. The collision algorithms use
+/// getLocalSupportPointWithoutMarginFromVertex() instead to start from the previous support vertex.
 Vector3 ConvexMeshShape::getLocalSupportPointWithoutMargin(const Vector3& direction) const {
 
-    decimal maxDotProduct = DECIMAL_SMALLEST;
-    uint32 indexMaxDotProduct = 0;
+    uint32 supportVertexIndex = 0;
+    return getLocalSupportPointWithoutMarginFromVertex(direction, supportVertexIndex);
+}
 
-    // For each vertex of the mesh
-    for (uint32 i=0; i<mPolyhedronMesh->getNbVertices(); i++) {
+// Return a local support point without the object margin starting the search from a given vertex
+/// For a small mesh, this method goes through the whole vertices array and picks up the vertex
+/// with the largest dot product in the support direction. For a larger mesh, this O(n) scan is
+/// replaced by a hill-climbing (local search) on the half-edge structure: starting from the given
+/// vertex, we move to a neighbor vertex as long as it has a larger dot product. Because the mesh is
+/// convex, the local maximum is the support vertex. The collision algorithms start from the support
+/// vertex of the previous query (or of the previous frame) which is in most cases very close to the
+/// new one and therefore this method runs in almost constant time.
+/**
+ * @param direction The support direction
+ * @param supportVertexIndex Index of the vertex to start the search from (set to the index of the support vertex)
+ * @return The support point
+ */
+Vector3 ConvexMeshShape::getLocalSupportPointWithoutMarginFromVertex(const Vector3& direction, uint32& supportVertexIndex) const {
+
+    const uint32 nbVertices = mPolyhedronMesh->getNbVertices();
+
+    // The support vertex of the scaled mesh is the vertex of the unscaled mesh in the scaled direction
+    const Vector3 scaledDirection = direction * mScale;
+
+    if (nbVertices < CONVEX_MESH_HILL_CLIMBING_MIN_NB_VERTICES) {
 
-        // Compute the dot product of the current vertex
-        decimal dotProduct = direction.dot(mPolyhedronMesh->getVertex(i));
+        decimal maxDotProduct = DECIMAL_SMALLEST;
+        uint32 indexMaxDotProduct = 0;
 
-        // If the current dot product is larger than the maximum one
-        if (dotProduct > maxDotProduct) {
-            indexMaxDotProduct = i;
-            maxDotProduct = dotProduct;
+        // Stream over the baked coordinates arrays of the vertices
+        const decimal* verticesX = mPolyhedronMesh->mVerticesX;
+        const decimal* verticesY = mPolyhedronMesh->mVerticesY;
+        const decimal* verticesZ = mPolyhedronMesh->mVerticesZ;
+
+        // For each vertex of the mesh
+        for (uint32 i=0; i < nbVertices; i++) {
+
+            // Compute the dot product of the current vertex
+            const decimal dotProduct = scaledDirection.x * verticesX[i] + scaledDirection.y * verticesY[i] + scaledDirection.z * verticesZ[i];
+
+            // If the current dot product is larger than the maximum one
+            if (dotProduct > maxDotProduct) {
+                indexMaxDotProduct = i;
+                maxDotProduct = dotProduct;
+            }
         }
+
+        supportVertexIndex = indexMaxDotProduct;
     }
+    else {
+
+        const HalfEdgeStructure& halfEdgeStructure = mPolyhedronMesh->getHalfEdgeStructure();
+
+        uint32 currentVertexIndex = supportVertexIndex < nbVertices ? supportVertexIndex : 0;
+        decimal maxDotProduct = scaledDirection.dot(mPolyhedronMesh->getVertex(currentVertexIndex));
 
-    assert(maxDotProduct >= decimal(0.0));
+        bool hasFoundLargerDotProduct = true;
+        while (hasFoundLargerDotProduct) {
+
+            hasFoundLargerDotProduct = false;
+
+            // For each half-edge going out of the current vertex
+            const uint32 firstEdgeIndex = halfEdgeStructure.getVertex(currentVertexIndex).edgeIndex;
+            uint32 edgeIndex = firstEdgeIndex;
+            do {
+
+                const HalfEdgeStructure::Edge& twinEdge = halfEdgeStructure.getHalfEdge(halfEdgeStructure.getHalfEdge(edgeIndex).twinEdgeIndex);
+
+                // The twin edge starts at the neighbor vertex
+                const decimal dotProduct = scaledDirection.dot(mPolyhedronMesh->getVertex(twinEdge.vertexIndex));
+                if (dotProduct > maxDotProduct) {
+                    maxDotProduct = dotProduct;
+                    currentVertexIndex = twinEdge.vertexIndex;
+                    hasFoundLargerDotProduct = true;
+                    break;
+                }
+
+                // Go to the next half-edge going out of the current vertex
+                edgeIndex = twinEdge.nextEdgeIndex;
+
+            } while (edgeIndex != firstEdgeIndex);
+        }
+
+        supportVertexIndex = currentVertexIndex;
+    }
 
     // Return the vertex with the largest dot product in the support direction
-    return mPolyhedronMesh->getVertex(indexMaxDotProduct) * mScale;
+    return mPolyhedronMesh->getVertex(supportVertexIndex) * mScale;
 }
 
 // Recompute the bounds of the mesh
@@ -85,17 +148,21 @@ void ConvexMeshShape::recalculateBounds() {
     mMinBounds = mPolyhedronMesh->getVertex(0);
     mMaxBounds = mPolyhedronMesh->getVertex(0);
 
+    const decimal* verticesX = mPolyhedronMesh->mVerticesX;
+    const decimal* verticesY = mPolyhedronMesh->mVerticesY;
+    const decimal* verticesZ = mPolyhedronMesh->mVerticesZ;
+
     // For each vertex of the mesh
     for (uint32 i=1; i<mPolyhedronMesh->getNbVertices(); i++) {
 
-        if (mPolyhedronMesh->getVertex(i).x > mMaxBounds.x) mMaxBounds.x = mPolyhedronMesh->getVertex(i).x;
-        if (mPolyhedronMesh->getVertex(i).x < mMinBounds.x) mMinBounds.x = mPolyhedronMesh->getVertex(i).x;
+        mMaxBounds.x = std::max(mMaxBounds.x, verticesX[i]);
+        mMinBounds.x = std::min(mMinBounds.x, verticesX[i]);
 
-        if (mPolyhedronMesh->getVertex(i).y > mMaxBounds.y) mMaxBounds.y = mPolyhedronMesh->getVertex(i).y;
-        if (mPolyhedronMesh->getVertex(i).y < mMinBounds.y) mMinBounds.y = mPolyhedronMesh->getVertex(i).y;
+        mMaxBounds.y = std::max(mMaxBounds.y, verticesY[i]);
+        mMinBounds.y = std::min(mMinBounds.y, verticesY[i]);
 
-        if (mPolyhedronMesh->getVertex(i).z > mMaxBounds.z) mMaxBounds.z = mPolyhedronMesh->getVertex(i).z;
-        if (mPolyhedronMesh->getVertex(i).z < mMinBounds.z) mMinBounds.z = mPolyhedronMesh->getVertex(i).z;
+        mMaxBounds.z = std::max(mMaxBounds.z, verticesZ[i]);
+        mMinBounds.z = std::min(mMinBounds.z, verticesZ[i]);
     }
 
     // Apply the local scaling factor
@@ -116,17 +183,12 @@ bool ConvexMeshShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, Collider
     Vector3 currentFaceNormal;
     bool isIntersectionFound = false;
 
-    const HalfEdgeStructure& halfEdgeStructure = mPolyhedronMesh->getHalfEdgeStructure();
-
     // For each face of the convex mesh
     for (uint32 f=0; f < mPolyhedronMesh->getNbFaces(); f++) {
 
-        const HalfEdgeStructure::Face& face = halfEdgeStructure.getFace(f);
         const Vector3 faceNormal = mPolyhedronMesh->getFaceNormal(f);
-        const HalfEdgeStructure::Vertex& faceVertex = halfEdgeStructure.getVertex(face.faceVertices[0]);
-        const Vector3 facePoint = mPolyhedronMesh->getVertex(faceVertex.vertexPointIndex);
         decimal denom = faceNormal.dot(direction);
-        decimal planeD = faceNormal.dot(facePoint);
+        decimal planeD = mPolyhedronMesh->getFacePlaneOffset(f);
         decimal dist = planeD -  faceNormal.dot(ray.point1);
 
         // If ray is parallel to the face
@@ -186,18 +248,13 @@ bool ConvexMeshShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, Collider
 // Return true if a point is inside the collision shape
 bool ConvexMeshShape::testPointInside(const Vector3& localPoint, Collider* /*collider*/) const {
 
-    const HalfEdgeStructure& halfEdgeStructure = mPolyhedronMesh->getHalfEdgeStructure();
-
     // For each face plane of the convex mesh
     for (uint32 f=0; f < mPolyhedronMesh->getNbFaces(); f++) {
 
-        const HalfEdgeStructure::Face& face = halfEdgeStructure.getFace(f);
         const Vector3 faceNormal = mPolyhedronMesh->getFaceNormal(f);
-        const HalfEdgeStructure::Vertex& faceVertex = halfEdgeStructure.getVertex(face.faceVertices[0]);
-        const Vector3 facePoint = mPolyhedronMesh->getVertex(faceVertex.vertexPointIndex);
 
         // If the point is out of the face plane, it is outside of the convex mesh
-        if (computePointToPlaneDistance(localPoint, faceNormal, facePoint) > decimal(0.0)) return false;
+        if (faceNormal.dot(localPoint) - mPolyhedronMesh->getFacePlaneOffset(f) > decimal(0.0)) return false;
     }
 
     return true;
@@ -35,3 +35,15 @@ ConvexPolyhedronShape::ConvexPolyhedronShape(CollisionShapeName name, MemoryAllo
             : ConvexShape(name, CollisionShapeType::CONVEX_POLYHEDRON, allocator) {
 
 }
+
+// Return the direction (end vertex minus start vertex) of a given half-edge
+/// The twin half-edge starts at the end vertex of the half-edge
+/**
+ * @param edgeIndex Index of a given half-edge of the polyhedron
+ * @return The vector from the start vertex to the end vertex of the half-edge
+ */
+Vector3 ConvexPolyhedronShape::getEdgeDirection(uint32 edgeIndex) const {
+
+    const HalfEdgeStructure::Edge& edge = getHalfEdge(edgeIndex);
+    return getVertexPosition(getHalfEdge(edge.twinEdgeIndex).vertexIndex) - getVertexPosition(edge.vertexIndex);
+}
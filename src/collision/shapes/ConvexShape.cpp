@@ -54,3 +54,14 @@ Vector3 ConvexShape::getLocalSupportPointWithMargin(const Vector3& direction) co
 
     return supportPoint;
 }
+
+// Return a local support point without the object margin starting the search from a given vertex
+/// The shapes without vertices ignore the index of the vertex to start from
+/**
+ * @param direction The support direction
+ * @param supportVertexIndex Index of the vertex to start the search from (set to the index of the support vertex)
+ * @return The support point
+ */
+Vector3 ConvexShape::getLocalSupportPointWithoutMarginFromVertex(const Vector3& direction, uint32& /*supportVertexIndex*/) const {
+    return getLocalSupportPointWithoutMargin(direction);
+}
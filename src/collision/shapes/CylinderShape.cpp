@@ -0,0 +1,135 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/collision/shapes/CylinderShape.h>
+#include <reactphysics3d/collision/Collider.h>
+#include <reactphysics3d/configuration.h>
+#include <reactphysics3d/collision/RaycastInfo.h>
+#include <cassert>
+
+using namespace reactphysics3d;
+
+// Constructor
+/**
+ * @param radius The radius of the cylinder (in meters)
+ * @param height The height of the cylinder (in meters)
+ */
+CylinderShape::CylinderShape(decimal radius, decimal height, MemoryAllocator& allocator)
+              : ConvexShape(CollisionShapeName::CYLINDER, CollisionShapeType::GENERIC_CONVEX, allocator),
+                mRadius(radius), mHalfHeight(height * decimal(0.5)) {
+
+    assert(radius > decimal(0.0));
+    assert(height > decimal(0.0));
+}
+
+// Return the local inertia tensor of the cylinder
+/**
+ * @param mass Mass to use to compute the inertia tensor of the collision shape
+ */
+Vector3 CylinderShape::getLocalInertiaTensor(decimal mass) const {
+
+    const decimal height = mHalfHeight + mHalfHeight;
+    const decimal radiusSquare = mRadius * mRadius;
+    const decimal IxxAndzz = mass * (decimal(3.0) * radiusSquare + height * height) / decimal(12.0);
+    const decimal Iyy = decimal(0.5) * mass * radiusSquare;
+    return Vector3(IxxAndzz, Iyy, IxxAndzz);
+}
+
+// Return true if a point is inside the collision shape
+bool CylinderShape::testPointInside(const Vector3& localPoint, Collider* /*collider*/) const {
+
+    return localPoint.y < mHalfHeight && localPoint.y > -mHalfHeight &&
+           (localPoint.x * localPoint.x + localPoint.z * localPoint.z) < mRadius * mRadius;
+}
+
+// Raycast method with feedback information
+/// The cylinder is the intersection of the slab between the two discs and of an infinite
+/// cylinder. We compute the interval of the ray inside each of them. The hit point is the
+/// entry point of the intersection of both intervals.
+bool CylinderShape::raycast(const Ray& ray, RaycastInfo& raycastInfo, Collider* collider, MemoryAllocator& /*allocator*/) const {
+
+    const Vector3 n = ray.point2 - ray.point1;
+    const Vector3& p = ray.point1;
+
+    decimal tEnter = -DECIMAL_LARGEST;
+    decimal tExit = DECIMAL_LARGEST;
+    Vector3 hitNormal;
+
+    // Interval of the ray between the two discs of the cylinder
+    if (std::abs(n.y) < MACHINE_EPSILON) {
+
+        // If the ray is parallel to the discs and outside of the slab, there is no hit
+        if (std::abs(p.y) >= mHalfHeight) return false;
+    }
+    else {
+
+        decimal t1 = (-mHalfHeight - p.y) / n.y;
+        decimal t2 = (mHalfHeight - p.y) / n.y;
+        hitNormal.setAllValues(0, -1, 0);
+        if (t1 > t2) {
+            std::swap(t1, t2);
+            hitNormal.setAllValues(0, 1, 0);
+        }
+        tEnter = t1;
+        tExit = t2;
+    }
+
+    // Interval of the ray inside the infinite cylinder
+    const decimal a = n.x * n.x + n.z * n.z;
+    const decimal b = p.x * n.x + p.z * n.z;
+    const decimal c = p.x * p.x + p.z * p.z - mRadius * mRadius;
+    if (a < MACHINE_EPSILON) {
+
+        // If the ray is parallel to the axis and outside of the cylinder, there is no hit
+        if (c >= decimal(0.0)) return false;
+    }
+    else {
+
+        const decimal discriminant = b * b - a * c;
+        if (discriminant < decimal(0.0)) return false;
+
+        const decimal sqrtDiscriminant = std::sqrt(discriminant);
+        const decimal t1 = (-b - sqrtDiscriminant) / a;
+        const decimal t2 = (-b + sqrtDiscriminant) / a;
+        if (t1 > tEnter) {
+            tEnter = t1;
+            hitNormal.setAllValues(p.x + t1 * n.x, 0, p.z + t1 * n.z);
+        }
+        tExit = std::min(tExit, t2);
+    }
+
+    // If the intervals do not overlap, if the origin of the ray is inside the cylinder or if
+    // the hit is beyond the maximum raycasting distance, there is no hit
+    if (tEnter > tExit || tEnter < decimal(0.0) || tEnter > ray.maxFraction) return false;
+
+    raycastInfo.body = collider->getBody();
+    raycastInfo.collider = collider;
+    raycastInfo.hitFraction = tEnter;
+    raycastInfo.worldPoint = p + tEnter * n;
+    raycastInfo.worldNormal = hitNormal.getUnit();
+
+    return true;
+}
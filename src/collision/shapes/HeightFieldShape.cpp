@@ -49,7 +49,8 @@ HeightFieldShape::HeightFieldShape(int nbGridColumns, int nbGridRows, decimal mi
                  : ConcaveShape(CollisionShapeName::HEIGHTFIELD, allocator, scaling), mNbColumns(nbGridColumns), mNbRows(nbGridRows),
                    mWidth(static_cast<decimal>(nbGridColumns - 1)), mLength(static_cast<decimal>(nbGridRows - 1)), mMinHeight(minHeight),
                    mMaxHeight(maxHeight), mUpAxis(upAxis), mIntegerHeightScale(integerHeightScale),
-                   mHeightDataType(dataType), mTriangleHalfEdgeStructure(triangleHalfEdgeStructure) {
+                   mHeightDataType(dataType), mTriangleHalfEdgeStructure(triangleHalfEdgeStructure),
+                   mTrianglesInternalEdges(allocator) {
 
     assert(nbGridColumns >= 2);
     assert(nbGridRows >= 2);
@@ -76,6 +77,58 @@ HeightFieldShape::HeightFieldShape(int nbGridColumns, int nbGridRows, decimal mi
         mAABB.setMin(Vector3(-mWidth * decimal(0.5), -mLength * decimal(0.5), -halfHeight));
         mAABB.setMax(Vector3(mWidth * decimal(0.5), mLength * decimal(0.5), halfHeight));
     }
+
+    computeInternalEdges();
+}
+
+// Compute the internal edges flags of all the triangles of the height field
+/// Each quad (i, j) of the grid is made of the triangles (p1, p2, p3) and (p3, p2, p4) with
+/// p1=(i, j), p2=(i, j+1), p3=(i+1, j) and p4=(i+1, j+1). The neighbor triangle of each edge
+/// is found directly in the grid.
+void HeightFieldShape::computeInternalEdges() {
+
+    const int nbCellsI = mNbColumns - 1;
+    const int nbCellsJ = mNbRows - 1;
+
+    mTrianglesInternalEdges.reserve(static_cast<uint64>(nbCellsI) * nbCellsJ * 2);
+
+    // The triangles are added in the order of their shape IDs
+    for (int j = 0; j < nbCellsJ; j++) {
+        for (int i = 0; i < nbCellsI; i++) {
+
+            const Vector3 p1 = getVertexAt(i, j);
+            const Vector3 p2 = getVertexAt(i, j + 1);
+            const Vector3 p3 = getVertexAt(i + 1, j);
+            const Vector3 p4 = getVertexAt(i + 1, j + 1);
+
+            // First triangle (p1, p2, p3)
+            uint8 internalEdges = 0;
+            if (i > 0 && isTriangleMeshInternalEdge(p1, p2, p3, getVertexAt(i - 1, j + 1))) {
+                internalEdges |= 1;
+            }
+            if (isTriangleMeshInternalEdge(p2, p3, p1, p4)) {
+                internalEdges |= 2;
+            }
+            if (j > 0 && isTriangleMeshInternalEdge(p3, p1, p2, getVertexAt(i + 1, j - 1))) {
+                internalEdges |= 4;
+            }
+            assert(static_cast<uint32>(mTrianglesInternalEdges.size()) == computeTriangleShapeId(i, j, 0));
+            mTrianglesInternalEdges.add(internalEdges);
+
+            // Second triangle (p3, p2, p4)
+            internalEdges = 0;
+            if (isTriangleMeshInternalEdge(p3, p2, p4, p1)) {
+                internalEdges |= 1;
+            }
+            if (j + 2 < mNbRows && isTriangleMeshInternalEdge(p2, p4, p3, getVertexAt(i, j + 2))) {
+                internalEdges |= 2;
+            }
+            if (i + 2 < mNbColumns && isTriangleMeshInternalEdge(p4, p3, p2, getVertexAt(i + 2, j))) {
+                internalEdges |= 4;
+            }
+            mTrianglesInternalEdges.add(internalEdges);
+        }
+    }
 }
 
 // Return the local bounds of the shape in x, y and z directions.
@@ -95,6 +148,7 @@ void HeightFieldShape::getLocalBounds(Vector3& min, Vector3& max) const {
 // and then for each rectangle in the sub-grid we generate two triangles that we use to test collision.
 void HeightFieldShape::computeOverlappingTriangles(const AABB& localAABB, Array<Vector3>& triangleVertices,
                                                    Array<Vector3>& triangleVerticesNormals, Array<uint32>& shapeIds,
+                                                   Array<uint8>& trianglesInternalEdges,
                                                    MemoryAllocator& /*allocator*/) const {
 
     RP3D_PROFILE("HeightFieldShape::computeOverlappingTriangles()", mProfiler);
@@ -167,6 +221,7 @@ void HeightFieldShape::computeOverlappingTriangles(const AABB& localAABB, Array<
 
            // Compute the shape ID
            shapeIds.add(computeTriangleShapeId(i, j, 0));
+           trianglesInternalEdges.add(mTrianglesInternalEdges[computeTriangleShapeId(i, j, 0)]);
 
            // Generate the second triangle for the current grid rectangle
            triangleVertices.add(p3);
@@ -189,6 +244,7 @@ void HeightFieldShape::computeOverlappingTriangles(const AABB& localAABB, Array<
 
            // Compute the shape ID
            shapeIds.add(computeTriangleShapeId(i, j, 1));
+           trianglesInternalEdges.add(mTrianglesInternalEdges[computeTriangleShapeId(i, j, 1)]);
        }
    }
 }
@@ -37,24 +37,11 @@ using namespace reactphysics3d;
 
 
 // Constructor
-TriangleShape::TriangleShape(const Vector3* vertices, const Vector3* verticesNormals, uint32 shapeId, HalfEdgeStructure& triangleHalfEdgeStructure, MemoryAllocator& allocator)
+TriangleShape::TriangleShape(const Vector3* vertices, const Vector3* verticesNormals, uint32 shapeId, uint8 internalEdges,
+                             HalfEdgeStructure& triangleHalfEdgeStructure, MemoryAllocator& allocator)
     : ConvexPolyhedronShape(CollisionShapeName::TRIANGLE, allocator), mTriangleHalfEdgeStructure(triangleHalfEdgeStructure) {
 
-    mPoints[0] = vertices[0];
-    mPoints[1] = vertices[1];
-    mPoints[2] = vertices[2];
-
-    // Compute the triangle normal
-    mNormal = (vertices[1] - vertices[0]).cross(vertices[2] - vertices[0]);
-    mNormal.normalize();
-
-    mVerticesNormals[0] = verticesNormals[0];
-    mVerticesNormals[1] = verticesNormals[1];
-    mVerticesNormals[2] = verticesNormals[2];
-
-    mRaycastTestType = TriangleRaycastSide::FRONT;
-
-    mId = shapeId;
+    setTriangle(vertices, verticesNormals, shapeId, internalEdges);
 }
 
 // Constructor for raycasting
@@ -73,6 +60,32 @@ TriangleShape::TriangleShape(const Vector3* vertices, uint32 shapeId, HalfEdgeSt
     mVerticesNormals[1] = mNormal;
     mVerticesNormals[2] = mNormal;
 
+    mInternalEdges = 0;
+
+    mRaycastTestType = TriangleRaycastSide::FRONT;
+
+    mId = shapeId;
+}
+
+// Set the vertices, the vertices normals, the internal edges flags and the id of the triangle
+/// This is used to reuse a triangle shape for another triangle of a concave shape
+/// instead of constructing a new one
+void TriangleShape::setTriangle(const Vector3* vertices, const Vector3* verticesNormals, uint32 shapeId, uint8 internalEdges) {
+
+    mPoints[0] = vertices[0];
+    mPoints[1] = vertices[1];
+    mPoints[2] = vertices[2];
+
+    // Compute the triangle normal
+    mNormal = (vertices[1] - vertices[0]).cross(vertices[2] - vertices[0]);
+    mNormal.normalize();
+
+    mVerticesNormals[0] = verticesNormals[0];
+    mVerticesNormals[1] = verticesNormals[1];
+    mVerticesNormals[2] = verticesNormals[2];
+
+    mInternalEdges = internalEdges;
+
     mRaycastTestType = TriangleRaycastSide::FRONT;
 
     mId = shapeId;
@@ -38,7 +38,8 @@ BallAndSocketJointComponents::BallAndSocketJointComponents(MemoryAllocator& allo
                                 sizeof(Vector3) + sizeof(Vector3) + sizeof(Vector3) +
                                 sizeof(Matrix3x3) + sizeof(Matrix3x3) + sizeof(Vector3) +
                                 sizeof(Matrix3x3) + sizeof(Vector3) + sizeof(bool) + sizeof(decimal) +
-                                sizeof(decimal) + sizeof(decimal) + sizeof(decimal) + sizeof(bool) + sizeof(Vector3)) {
+                                sizeof(decimal) + sizeof(decimal) + sizeof(decimal) + sizeof(bool) + sizeof(Vector3) +
+                                sizeof(decimal) + sizeof(decimal) + sizeof(uint32) + sizeof(uint32) + sizeof(uint32)) {
 
     // Allocate memory for the components data
     allocate(INIT_NB_ALLOCATED_COMPONENTS);
@@ -65,7 +66,12 @@ void BallAndSocketJointComponents::allocate(uint32 nbComponentsToAllocate) {
     Vector3* newR2World = reinterpret_cast<Vector3*>(newR1World + nbComponentsToAllocate);
     Matrix3x3* newI1 = reinterpret_cast<Matrix3x3*>(newR2World + nbComponentsToAllocate);
     Matrix3x3* newI2 = reinterpret_cast<Matrix3x3*>(newI1 + nbComponentsToAllocate);
-    Vector3* newBiasVector = reinterpret_cast<Vector3*>(newI2 + nbComponentsToAllocate);
+    decimal* newInverseMassBody1 = reinterpret_cast<decimal*>(newI2 + nbComponentsToAllocate);
+    decimal* newInverseMassBody2 = reinterpret_cast<decimal*>(newInverseMassBody1 + nbComponentsToAllocate);
+    uint32* newJointComponentIndices = reinterpret_cast<uint32*>(newInverseMassBody2 + nbComponentsToAllocate);
+    uint32* newBody1ComponentIndices = reinterpret_cast<uint32*>(newJointComponentIndices + nbComponentsToAllocate);
+    uint32* newBody2ComponentIndices = reinterpret_cast<uint32*>(newBody1ComponentIndices + nbComponentsToAllocate);
+    Vector3* newBiasVector = reinterpret_cast<Vector3*>(newBody2ComponentIndices + nbComponentsToAllocate);
     Matrix3x3* newInverseMassMatrix = reinterpret_cast<Matrix3x3*>(newBiasVector + nbComponentsToAllocate);
     Vector3* newImpulse = reinterpret_cast<Vector3*>(newInverseMassMatrix + nbComponentsToAllocate);
     bool* newIsConeLimitEnabled = reinterpret_cast<bool*>(newImpulse + nbComponentsToAllocate);
@@ -88,6 +94,11 @@ void BallAndSocketJointComponents::allocate(uint32 nbComponentsToAllocate) {
         memcpy(newR2World, mR2World, mNbComponents * sizeof(Vector3));
         memcpy(newI1, mI1, mNbComponents * sizeof(Matrix3x3));
         memcpy(newI2, mI2, mNbComponents * sizeof(Matrix3x3));
+        memcpy(newInverseMassBody1, mInverseMassBody1, mNbComponents * sizeof(decimal));
+        memcpy(newInverseMassBody2, mInverseMassBody2, mNbComponents * sizeof(decimal));
+        memcpy(newJointComponentIndices, mJointComponentIndices, mNbComponents * sizeof(uint32));
+        memcpy(newBody1ComponentIndices, mBody1ComponentIndices, mNbComponents * sizeof(uint32));
+        memcpy(newBody2ComponentIndices, mBody2ComponentIndices, mNbComponents * sizeof(uint32));
         memcpy(newBiasVector, mBiasVector, mNbComponents * sizeof(Vector3));
         memcpy(newInverseMassMatrix, mInverseMassMatrix, mNbComponents * sizeof(Matrix3x3));
         memcpy(newImpulse, mImpulse, mNbComponents * sizeof(Vector3));
@@ -113,6 +124,11 @@ void BallAndSocketJointComponents::allocate(uint32 nbComponentsToAllocate) {
     mR2World = newR2World;
     mI1 = newI1;
     mI2 = newI2;
+    mInverseMassBody1 = newInverseMassBody1;
+    mInverseMassBody2 = newInverseMassBody2;
+    mJointComponentIndices = newJointComponentIndices;
+    mBody1ComponentIndices = newBody1ComponentIndices;
+    mBody2ComponentIndices = newBody2ComponentIndices;
     mBiasVector = newBiasVector;
     mInverseMassMatrix = newInverseMassMatrix;
     mImpulse = newImpulse;
@@ -140,6 +156,11 @@ void BallAndSocketJointComponents::addComponent(Entity jointEntity, bool isSleep
     new (mR2World + index) Vector3(0, 0, 0);
     new (mI1 + index) Matrix3x3();
     new (mI2 + index) Matrix3x3();
+    mInverseMassBody1[index] = decimal(0.0);
+    mInverseMassBody2[index] = decimal(0.0);
+    mJointComponentIndices[index] = 0;
+    mBody1ComponentIndices[index] = 0;
+    mBody2ComponentIndices[index] = 0;
     new (mBiasVector + index) Vector3(0, 0, 0);
     new (mInverseMassMatrix + index) Matrix3x3();
     new (mImpulse + index) Vector3(0, 0, 0);
@@ -175,6 +196,11 @@ void BallAndSocketJointComponents::moveComponentToIndex(uint32 srcIndex, uint32
     new (mR2World + destIndex) Vector3(mR2World[srcIndex]);
     new (mI1 + destIndex) Matrix3x3(mI1[srcIndex]);
     new (mI2 + destIndex) Matrix3x3(mI2[srcIndex]);
+    mInverseMassBody1[destIndex] = mInverseMassBody1[srcIndex];
+    mInverseMassBody2[destIndex] = mInverseMassBody2[srcIndex];
+    mJointComponentIndices[destIndex] = mJointComponentIndices[srcIndex];
+    mBody1ComponentIndices[destIndex] = mBody1ComponentIndices[srcIndex];
+    mBody2ComponentIndices[destIndex] = mBody2ComponentIndices[srcIndex];
     new (mBiasVector + destIndex) Vector3(mBiasVector[srcIndex]);
     new (mInverseMassMatrix + destIndex) Matrix3x3(mInverseMassMatrix[srcIndex]);
     new (mImpulse + destIndex) Vector3(mImpulse[srcIndex]);
@@ -209,6 +235,11 @@ void BallAndSocketJointComponents::swapComponents(uint32 index1, uint32 index2)
     Vector3 r2World1(mR2World[index1]);
     Matrix3x3 i11(mI1[index1]);
     Matrix3x3 i21(mI2[index1]);
+    decimal inverseMassBody11 = mInverseMassBody1[index1];
+    decimal inverseMassBody21 = mInverseMassBody2[index1];
+    uint32 jointComponentIndex1 = mJointComponentIndices[index1];
+    uint32 body1ComponentIndex1 = mBody1ComponentIndices[index1];
+    uint32 body2ComponentIndex1 = mBody2ComponentIndices[index1];
     Vector3 biasVector1(mBiasVector[index1]);
     Matrix3x3 inverseMassMatrix1(mInverseMassMatrix[index1]);
     Vector3 impulse1(mImpulse[index1]);
@@ -234,6 +265,11 @@ void BallAndSocketJointComponents::swapComponents(uint32 index1, uint32 index2)
     new (mR2World + index2) Vector3(r2World1);
     new (mI1 + index2) Matrix3x3(i11);
     new (mI2 + index2) Matrix3x3(i21);
+    mInverseMassBody1[index2] = inverseMassBody11;
+    mInverseMassBody2[index2] = inverseMassBody21;
+    mJointComponentIndices[index2] = jointComponentIndex1;
+    mBody1ComponentIndices[index2] = body1ComponentIndex1;
+    mBody2ComponentIndices[index2] = body2ComponentIndex1;
     new (mBiasVector + index2) Vector3(biasVector1);
     new (mInverseMassMatrix + index2) Matrix3x3(inverseMassMatrix1);
     new (mImpulse + index2) Vector3(impulse1);
@@ -37,8 +37,8 @@ using namespace reactphysics3d;
 ColliderComponents::ColliderComponents(MemoryAllocator& allocator)
                     :Components(allocator, sizeof(Entity) + sizeof(Entity) + sizeof(Collider*) + sizeof(int32) +
                 sizeof(Transform) + sizeof(CollisionShape*) + sizeof(unsigned short) +
-                sizeof(unsigned short) + sizeof(Transform) + sizeof(Array<uint64>) + sizeof(bool) +
-                sizeof(bool) + sizeof(Material)) {
+                sizeof(unsigned short) + sizeof(Transform) + sizeof(Array<uint64>) + sizeof(decimal) + sizeof(bool) +
+                sizeof(bool) + sizeof(bool) + sizeof(Material) + sizeof(bool)) {
 
     // Allocate memory for the components data
     allocate(INIT_NB_ALLOCATED_COMPONENTS);
@@ -67,9 +67,12 @@ void ColliderComponents::allocate(uint32 nbComponentsToAllocate) {
     unsigned short* newCollideWithMaskBits = reinterpret_cast<unsigned short*>(newCollisionCategoryBits + nbComponentsToAllocate);
     Transform* newLocalToWorldTransforms = reinterpret_cast<Transform*>(newCollideWithMaskBits + nbComponentsToAllocate);
     Array<uint64>* newOverlappingPairs = reinterpret_cast<Array<uint64>*>(newLocalToWorldTransforms + nbComponentsToAllocate);
-    bool* hasCollisionShapeChangedSize = reinterpret_cast<bool*>(newOverlappingPairs + nbComponentsToAllocate);
+    decimal* contactReportImpulseThresholds = reinterpret_cast<decimal*>(newOverlappingPairs + nbComponentsToAllocate);
+    bool* hasCollisionShapeChangedSize = reinterpret_cast<bool*>(contactReportImpulseThresholds + nbComponentsToAllocate);
     bool* isTrigger = reinterpret_cast<bool*>(hasCollisionShapeChangedSize + nbComponentsToAllocate);
-    Material* materials = reinterpret_cast<Material*>(isTrigger + nbComponentsToAllocate);
+    bool* reportContacts = reinterpret_cast<bool*>(isTrigger + nbComponentsToAllocate);
+    Material* materials = reinterpret_cast<Material*>(reportContacts + nbComponentsToAllocate);
+    bool* hasMaterialChanged = reinterpret_cast<bool*>(materials + nbComponentsToAllocate);
 
     // If there was already components before
     if (mNbComponents > 0) {
@@ -85,9 +88,12 @@ void ColliderComponents::allocate(uint32 nbComponentsToAllocate) {
         memcpy(newCollideWithMaskBits, mCollideWithMaskBits, mNbComponents * sizeof(unsigned short));
         memcpy(newLocalToWorldTransforms, mLocalToWorldTransforms, mNbComponents * sizeof(Transform));
         memcpy(newOverlappingPairs, mOverlappingPairs, mNbComponents * sizeof(Array<uint64>));
+        memcpy(contactReportImpulseThresholds, mContactReportImpulseThresholds, mNbComponents * sizeof(decimal));
         memcpy(hasCollisionShapeChangedSize, mHasCollisionShapeChangedSize, mNbComponents * sizeof(bool));
         memcpy(isTrigger, mIsTrigger, mNbComponents * sizeof(bool));
+        memcpy(reportContacts, mReportContacts, mNbComponents * sizeof(bool));
         memcpy(materials, mMaterials, mNbComponents * sizeof(Material));
+        memcpy(hasMaterialChanged, mHasMaterialChanged, mNbComponents * sizeof(bool));
 
         // Deallocate previous memory
         mMemoryAllocator.release(mBuffer, mNbAllocatedComponents * mComponentDataSize);
@@ -105,9 +111,12 @@ void ColliderComponents::allocate(uint32 nbComponentsToAllocate) {
     mCollideWithMaskBits = newCollideWithMaskBits;
     mLocalToWorldTransforms = newLocalToWorldTransforms;
     mOverlappingPairs = newOverlappingPairs;
+    mContactReportImpulseThresholds = contactReportImpulseThresholds;
     mHasCollisionShapeChangedSize = hasCollisionShapeChangedSize;
     mIsTrigger = isTrigger;
+    mReportContacts = reportContacts;
     mMaterials = materials;
+    mHasMaterialChanged = hasMaterialChanged;
 
     mNbAllocatedComponents = nbComponentsToAllocate;
 }
@@ -129,9 +138,13 @@ void ColliderComponents::addComponent(Entity colliderEntity, bool isSleeping, co
     new (mCollideWithMaskBits + index) unsigned short(component.collideWithMaskBits);
     new (mLocalToWorldTransforms + index) Transform(component.localToWorldTransform);
     new (mOverlappingPairs + index) Array<uint64>(mMemoryAllocator);
+    mContactReportImpulseThresholds[index] = decimal(0.0);
     mHasCollisionShapeChangedSize[index] = false;
     mIsTrigger[index] = false;
-    mMaterials[index] = component.material;
+    mReportContacts[index] = true;
+    new (mMaterials + index) Material(component.material);
+    mMaterials[index].mCollider = component.collider;
+    mHasMaterialChanged[index] = false;
 
     // Map the entity with the new component lookup index
     mMapEntityToComponentIndex.add(Pair<Entity, uint32>(colliderEntity, index));
@@ -158,9 +171,13 @@ void ColliderComponents::moveComponentToIndex(uint32 srcIndex, uint32 destIndex)
     new (mCollideWithMaskBits + destIndex) unsigned short(mCollideWithMaskBits[srcIndex]);
     new (mLocalToWorldTransforms + destIndex) Transform(mLocalToWorldTransforms[srcIndex]);
     new (mOverlappingPairs + destIndex) Array<uint64>(mOverlappingPairs[srcIndex]);
+    mContactReportImpulseThresholds[destIndex] = mContactReportImpulseThresholds[srcIndex];
     mHasCollisionShapeChangedSize[destIndex] = mHasCollisionShapeChangedSize[srcIndex];
     mIsTrigger[destIndex] = mIsTrigger[srcIndex];
-    mMaterials[destIndex] = mMaterials[srcIndex];
+    mReportContacts[destIndex] = mReportContacts[srcIndex];
+    new (mMaterials + destIndex) Material(mMaterials[srcIndex]);
+    mMaterials[destIndex].mCollider = mColliders[destIndex];
+    mHasMaterialChanged[destIndex] = mHasMaterialChanged[srcIndex];
 
     // Destroy the source component
     destroyComponent(srcIndex);
@@ -187,9 +204,12 @@ void ColliderComponents::swapComponents(uint32 index1, uint32 index2) {
     unsigned short collideWithMaskBits1 = mCollideWithMaskBits[index1];
     Transform localToWorldTransform1 = mLocalToWorldTransforms[index1];
     Array<uint64> overlappingPairs = mOverlappingPairs[index1];
+    decimal contactReportImpulseThreshold = mContactReportImpulseThresholds[index1];
     bool hasCollisionShapeChangedSize = mHasCollisionShapeChangedSize[index1];
     bool isTrigger = mIsTrigger[index1];
+    bool reportContacts = mReportContacts[index1];
     Material material = mMaterials[index1];
+    bool hasMaterialChanged = mHasMaterialChanged[index1];
 
     // Destroy component 1
     destroyComponent(index1);
@@ -207,9 +227,13 @@ void ColliderComponents::swapComponents(uint32 index1, uint32 index2) {
     new (mCollideWithMaskBits + index2) unsigned short(collideWithMaskBits1);
     new (mLocalToWorldTransforms + index2) Transform(localToWorldTransform1);
     new (mOverlappingPairs + index2) Array<uint64>(overlappingPairs);
+    mContactReportImpulseThresholds[index2] = contactReportImpulseThreshold;
     mHasCollisionShapeChangedSize[index2] = hasCollisionShapeChangedSize;
     mIsTrigger[index2] = isTrigger;
-    mMaterials[index2] = material;
+    mReportContacts[index2] = reportContacts;
+    new (mMaterials + index2) Material(material);
+    mMaterials[index2].mCollider = collider1;
+    mHasMaterialChanged[index2] = hasMaterialChanged;
 
     // Update the entity to component index mapping
     mMapEntityToComponentIndex.add(Pair<Entity, uint32>(colliderEntity1, index2));
@@ -35,7 +35,7 @@ using namespace reactphysics3d;
 // Constructor
 CollisionBodyComponents::CollisionBodyComponents(MemoryAllocator& allocator)
                     :Components(allocator, sizeof(Entity) + sizeof(CollisionBody*) + sizeof(Array<Entity>) +
-                                sizeof(bool) + sizeof(void*)) {
+                                sizeof(bool) + sizeof(bool) + sizeof(void*)) {
 
     // Allocate memory for the components data
     allocate(INIT_NB_ALLOCATED_COMPONENTS);
@@ -58,7 +58,8 @@ void CollisionBodyComponents::allocate(uint32 nbComponentsToAllocate) {
     CollisionBody** newBodies = reinterpret_cast<CollisionBody**>(newBodiesEntities + nbComponentsToAllocate);
     Array<Entity>* newColliders = reinterpret_cast<Array<Entity>*>(newBodies + nbComponentsToAllocate);
     bool* newIsActive = reinterpret_cast<bool*>(newColliders + nbComponentsToAllocate);
-    void** newUserData = reinterpret_cast<void**>(newIsActive + nbComponentsToAllocate);
+    bool* newIsCompound = reinterpret_cast<bool*>(newIsActive + nbComponentsToAllocate);
+    void** newUserData = reinterpret_cast<void**>(newIsCompound + nbComponentsToAllocate);
 
     // If there was already components before
     if (mNbComponents > 0) {
@@ -68,6 +69,7 @@ void CollisionBodyComponents::allocate(uint32 nbComponentsToAllocate) {
         memcpy(newBodies, mBodies, mNbComponents * sizeof(CollisionBody*));
         memcpy(newColliders, mColliders, mNbComponents * sizeof(Array<Entity>));
         memcpy(newIsActive, mIsActive, mNbComponents * sizeof(bool));
+        memcpy(newIsCompound, mIsCompound, mNbComponents * sizeof(bool));
         memcpy(newUserData, mUserData, mNbComponents * sizeof(void*));
 
         // Deallocate previous memory
@@ -79,6 +81,7 @@ void CollisionBodyComponents::allocate(uint32 nbComponentsToAllocate) {
     mBodies = newBodies;
     mColliders = newColliders;
     mIsActive = newIsActive;
+    mIsCompound = newIsCompound;
     mUserData = newUserData;
     mNbAllocatedComponents = nbComponentsToAllocate;
 }
@@ -94,6 +97,7 @@ void CollisionBodyComponents::addComponent(Entity bodyEntity, bool isSleeping, c
     mBodies[index] = component.body;
     new (mColliders + index) Array<Entity>(mMemoryAllocator);
     mIsActive[index] = true;
+    mIsCompound[index] = false;
     mUserData[index] = nullptr;
 
     // Map the entity with the new component lookup index
@@ -116,6 +120,7 @@ void CollisionBodyComponents::moveComponentToIndex(uint32 srcIndex, uint32 destI
     mBodies[destIndex] = mBodies[srcIndex];
     new (mColliders + destIndex) Array<Entity>(mColliders[srcIndex]);
     mIsActive[destIndex] = mIsActive[srcIndex];
+    mIsCompound[destIndex] = mIsCompound[srcIndex];
     mUserData[destIndex] = mUserData[srcIndex];
 
     // Destroy the source component
@@ -137,6 +142,7 @@ void CollisionBodyComponents::swapComponents(uint32 index1, uint32 index2) {
     CollisionBody* body1 = mBodies[index1];
     Array<Entity> colliders1(mColliders[index1]);
     bool isActive1 = mIsActive[index1];
+    bool isCompound1 = mIsCompound[index1];
     void* userData1 = mUserData[index1];
 
     // Destroy component 1
@@ -149,6 +155,7 @@ void CollisionBodyComponents::swapComponents(uint32 index1, uint32 index2) {
     new (mColliders + index2) Array<Entity>(colliders1);
     mBodies[index2] = body1;
     mIsActive[index2] = isActive1;
+    mIsCompound[index2] = isCompound1;
     mUserData[index2] = userData1;
 
     // Update the entity to component index mapping
@@ -38,7 +38,8 @@ FixedJointComponents::FixedJointComponents(MemoryAllocator& allocator)
                                 sizeof(Vector3) + sizeof(Vector3) + sizeof(Vector3) +
                                 sizeof(Matrix3x3) + sizeof(Matrix3x3) + sizeof(Vector3) +
                                 sizeof(Vector3) + sizeof(Matrix3x3) + sizeof(Matrix3x3) +
-                                sizeof(Vector3) + sizeof(Vector3) + sizeof(Quaternion)) {
+                                sizeof(Vector3) + sizeof(Vector3) + sizeof(Quaternion) +
+                                sizeof(decimal) + sizeof(decimal) + sizeof(uint32) + sizeof(uint32) + sizeof(uint32)) {
 
     // Allocate memory for the components data
     allocate(INIT_NB_ALLOCATED_COMPONENTS);
@@ -65,7 +66,12 @@ void FixedJointComponents::allocate(uint32 nbComponentsToAllocate) {
     Vector3* newR2World = reinterpret_cast<Vector3*>(newR1World + nbComponentsToAllocate);
     Matrix3x3* newI1 = reinterpret_cast<Matrix3x3*>(newR2World + nbComponentsToAllocate);
     Matrix3x3* newI2 = reinterpret_cast<Matrix3x3*>(newI1 + nbComponentsToAllocate);
-    Vector3* newImpulseTranslation = reinterpret_cast<Vector3*>(newI2 + nbComponentsToAllocate);
+    decimal* newInverseMassBody1 = reinterpret_cast<decimal*>(newI2 + nbComponentsToAllocate);
+    decimal* newInverseMassBody2 = reinterpret_cast<decimal*>(newInverseMassBody1 + nbComponentsToAllocate);
+    uint32* newJointComponentIndices = reinterpret_cast<uint32*>(newInverseMassBody2 + nbComponentsToAllocate);
+    uint32* newBody1ComponentIndices = reinterpret_cast<uint32*>(newJointComponentIndices + nbComponentsToAllocate);
+    uint32* newBody2ComponentIndices = reinterpret_cast<uint32*>(newBody1ComponentIndices + nbComponentsToAllocate);
+    Vector3* newImpulseTranslation = reinterpret_cast<Vector3*>(newBody2ComponentIndices + nbComponentsToAllocate);
     Vector3* newImpulseRotation = reinterpret_cast<Vector3*>(newImpulseTranslation + nbComponentsToAllocate);
     Matrix3x3* newInverseMassMatrixTranslation = reinterpret_cast<Matrix3x3*>(newImpulseRotation + nbComponentsToAllocate);
     Matrix3x3* newInverseMassMatrixRotation = reinterpret_cast<Matrix3x3*>(newInverseMassMatrixTranslation + nbComponentsToAllocate);
@@ -85,6 +91,11 @@ void FixedJointComponents::allocate(uint32 nbComponentsToAllocate) {
         memcpy(newR2World, mR2World, mNbComponents * sizeof(Vector3));
         memcpy(newI1, mI1, mNbComponents * sizeof(Matrix3x3));
         memcpy(newI2, mI2, mNbComponents * sizeof(Matrix3x3));
+        memcpy(newInverseMassBody1, mInverseMassBody1, mNbComponents * sizeof(decimal));
+        memcpy(newInverseMassBody2, mInverseMassBody2, mNbComponents * sizeof(decimal));
+        memcpy(newJointComponentIndices, mJointComponentIndices, mNbComponents * sizeof(uint32));
+        memcpy(newBody1ComponentIndices, mBody1ComponentIndices, mNbComponents * sizeof(uint32));
+        memcpy(newBody2ComponentIndices, mBody2ComponentIndices, mNbComponents * sizeof(uint32));
         memcpy(newImpulseTranslation, mImpulseTranslation, mNbComponents * sizeof(Vector3));
         memcpy(newImpulseRotation, mImpulseRotation, mNbComponents * sizeof(Vector3));
         memcpy(newInverseMassMatrixTranslation, mInverseMassMatrixTranslation, mNbComponents * sizeof(Matrix3x3));
@@ -107,6 +118,11 @@ void FixedJointComponents::allocate(uint32 nbComponentsToAllocate) {
     mR2World = newR2World;
     mI1 = newI1;
     mI2 = newI2;
+    mInverseMassBody1 = newInverseMassBody1;
+    mInverseMassBody2 = newInverseMassBody2;
+    mJointComponentIndices = newJointComponentIndices;
+    mBody1ComponentIndices = newBody1ComponentIndices;
+    mBody2ComponentIndices = newBody2ComponentIndices;
     mImpulseTranslation = newImpulseTranslation;
     mImpulseRotation = newImpulseRotation;
     mInverseMassMatrixTranslation = newInverseMassMatrixTranslation;
@@ -131,6 +147,11 @@ void FixedJointComponents::addComponent(Entity jointEntity, bool isSleeping, con
     new (mR2World + index) Vector3(0, 0, 0);
     new (mI1 + index) Matrix3x3();
     new (mI2 + index) Matrix3x3();
+    mInverseMassBody1[index] = decimal(0.0);
+    mInverseMassBody2[index] = decimal(0.0);
+    mJointComponentIndices[index] = 0;
+    mBody1ComponentIndices[index] = 0;
+    mBody2ComponentIndices[index] = 0;
     new (mImpulseTranslation + index) Vector3(0, 0, 0);
     new (mImpulseRotation + index) Vector3(0, 0, 0);
     new (mInverseMassMatrixTranslation + index) Matrix3x3();
@@ -163,6 +184,11 @@ void FixedJointComponents::moveComponentToIndex(uint32 srcIndex, uint32 destInde
     new (mR2World + destIndex) Vector3(mR2World[srcIndex]);
     new (mI1 + destIndex) Matrix3x3(mI1[srcIndex]);
     new (mI2 + destIndex) Matrix3x3(mI2[srcIndex]);
+    mInverseMassBody1[destIndex] = mInverseMassBody1[srcIndex];
+    mInverseMassBody2[destIndex] = mInverseMassBody2[srcIndex];
+    mJointComponentIndices[destIndex] = mJointComponentIndices[srcIndex];
+    mBody1ComponentIndices[destIndex] = mBody1ComponentIndices[srcIndex];
+    mBody2ComponentIndices[destIndex] = mBody2ComponentIndices[srcIndex];
     new (mImpulseTranslation + destIndex) Vector3(mImpulseTranslation[srcIndex]);
     new (mImpulseRotation + destIndex) Vector3(mImpulseRotation[srcIndex]);
     new (mInverseMassMatrixTranslation + destIndex) Matrix3x3(mInverseMassMatrixTranslation[srcIndex]);
@@ -194,6 +220,11 @@ void FixedJointComponents::swapComponents(uint32 index1, uint32 index2) {
     Vector3 r2World1(mR2World[index1]);
     Matrix3x3 i11(mI1[index1]);
     Matrix3x3 i21(mI2[index1]);
+    decimal inverseMassBody11 = mInverseMassBody1[index1];
+    decimal inverseMassBody21 = mInverseMassBody2[index1];
+    uint32 jointComponentIndex1 = mJointComponentIndices[index1];
+    uint32 body1ComponentIndex1 = mBody1ComponentIndices[index1];
+    uint32 body2ComponentIndex1 = mBody2ComponentIndices[index1];
     Vector3 impulseTranslation1(mImpulseTranslation[index1]);
     Vector3 impulseRotation1(mImpulseRotation[index1]);
     Matrix3x3 inverseMassMatrixTranslation1(mInverseMassMatrixTranslation[index1]);
@@ -216,6 +247,11 @@ void FixedJointComponents::swapComponents(uint32 index1, uint32 index2) {
     new (mR2World + index2) Vector3(r2World1);
     new (mI1 + index2) Matrix3x3(i11);
     new (mI2 + index2) Matrix3x3(i21);
+    mInverseMassBody1[index2] = inverseMassBody11;
+    mInverseMassBody2[index2] = inverseMassBody21;
+    mJointComponentIndices[index2] = jointComponentIndex1;
+    mBody1ComponentIndices[index2] = body1ComponentIndex1;
+    mBody2ComponentIndices[index2] = body2ComponentIndex1;
     new (mImpulseTranslation + index2) Vector3(impulseTranslation1);
     new (mImpulseRotation + index2) Vector3(impulseRotation1);
     new (mInverseMassMatrixTranslation + index2) Matrix3x3(inverseMassMatrixTranslation1);
@@ -43,7 +43,8 @@ HingeJointComponents::HingeJointComponents(MemoryAllocator& allocator)
                                 sizeof(Vector3) + sizeof(decimal) + sizeof(decimal) + sizeof(decimal) +
                                 sizeof(decimal) + sizeof(decimal) + sizeof(decimal) + sizeof(decimal) +
                                 sizeof(bool) + sizeof(bool) + sizeof(decimal) + sizeof(decimal) +
-                                sizeof(bool) + sizeof(bool) + sizeof(decimal) + sizeof(decimal)) {
+                                sizeof(bool) + sizeof(bool) + sizeof(decimal) + sizeof(decimal) +
+                                sizeof(decimal) + sizeof(decimal) + sizeof(uint32) + sizeof(uint32) + sizeof(uint32)) {
 
     // Allocate memory for the components data
     allocate(INIT_NB_ALLOCATED_COMPONENTS);
@@ -70,7 +71,12 @@ void HingeJointComponents::allocate(uint32 nbComponentsToAllocate) {
     Vector3* newR2World = reinterpret_cast<Vector3*>(newR1World + nbComponentsToAllocate);
     Matrix3x3* newI1 = reinterpret_cast<Matrix3x3*>(newR2World + nbComponentsToAllocate);
     Matrix3x3* newI2 = reinterpret_cast<Matrix3x3*>(newI1 + nbComponentsToAllocate);
-    Vector3* newImpulseTranslation = reinterpret_cast<Vector3*>(newI2 + nbComponentsToAllocate);
+    decimal* newInverseMassBody1 = reinterpret_cast<decimal*>(newI2 + nbComponentsToAllocate);
+    decimal* newInverseMassBody2 = reinterpret_cast<decimal*>(newInverseMassBody1 + nbComponentsToAllocate);
+    uint32* newJointComponentIndices = reinterpret_cast<uint32*>(newInverseMassBody2 + nbComponentsToAllocate);
+    uint32* newBody1ComponentIndices = reinterpret_cast<uint32*>(newJointComponentIndices + nbComponentsToAllocate);
+    uint32* newBody2ComponentIndices = reinterpret_cast<uint32*>(newBody1ComponentIndices + nbComponentsToAllocate);
+    Vector3* newImpulseTranslation = reinterpret_cast<Vector3*>(newBody2ComponentIndices + nbComponentsToAllocate);
     Vector2* newImpulseRotation = reinterpret_cast<Vector2*>(newImpulseTranslation + nbComponentsToAllocate);
     Matrix3x3* newInverseMassMatrixTranslation = reinterpret_cast<Matrix3x3*>(newImpulseRotation + nbComponentsToAllocate);
     Matrix2x2* newInverseMassMatrixRotation = reinterpret_cast<Matrix2x2*>(newInverseMassMatrixTranslation + nbComponentsToAllocate);
@@ -110,6 +116,11 @@ void HingeJointComponents::allocate(uint32 nbComponentsToAllocate) {
         memcpy(newR2World, mR2World, mNbComponents * sizeof(Vector3));
         memcpy(newI1, mI1, mNbComponents * sizeof(Matrix3x3));
         memcpy(newI2, mI2, mNbComponents * sizeof(Matrix3x3));
+        memcpy(newInverseMassBody1, mInverseMassBody1, mNbComponents * sizeof(decimal));
+        memcpy(newInverseMassBody2, mInverseMassBody2, mNbComponents * sizeof(decimal));
+        memcpy(newJointComponentIndices, mJointComponentIndices, mNbComponents * sizeof(uint32));
+        memcpy(newBody1ComponentIndices, mBody1ComponentIndices, mNbComponents * sizeof(uint32));
+        memcpy(newBody2ComponentIndices, mBody2ComponentIndices, mNbComponents * sizeof(uint32));
         memcpy(newImpulseTranslation, mImpulseTranslation, mNbComponents * sizeof(Vector3));
         memcpy(newImpulseRotation, mImpulseRotation, mNbComponents * sizeof(Vector2));
         memcpy(newInverseMassMatrixTranslation, mInverseMassMatrixTranslation, mNbComponents * sizeof(Matrix3x3));
@@ -152,6 +163,11 @@ void HingeJointComponents::allocate(uint32 nbComponentsToAllocate) {
     mR2World = newR2World;
     mI1 = newI1;
     mI2 = newI2;
+    mInverseMassBody1 = newInverseMassBody1;
+    mInverseMassBody2 = newInverseMassBody2;
+    mJointComponentIndices = newJointComponentIndices;
+    mBody1ComponentIndices = newBody1ComponentIndices;
+    mBody2ComponentIndices = newBody2ComponentIndices;
     mImpulseTranslation = newImpulseTranslation;
     mImpulseRotation = newImpulseRotation;
     mInverseMassMatrixTranslation = newInverseMassMatrixTranslation;
@@ -196,6 +212,11 @@ void HingeJointComponents::addComponent(Entity jointEntity, bool isSleeping, con
     new (mR2World + index) Vector3(0, 0, 0);
     new (mI1 + index) Matrix3x3();
     new (mI2 + index) Matrix3x3();
+    mInverseMassBody1[index] = decimal(0.0);
+    mInverseMassBody2[index] = decimal(0.0);
+    mJointComponentIndices[index] = 0;
+    mBody1ComponentIndices[index] = 0;
+    mBody2ComponentIndices[index] = 0;
     new (mImpulseTranslation + index) Vector3(0, 0, 0);
     new (mImpulseRotation + index) Vector2(0, 0);
     new (mInverseMassMatrixTranslation + index) Matrix3x3();
@@ -248,6 +269,11 @@ void HingeJointComponents::moveComponentToIndex(uint32 srcIndex, uint32 destInde
     new (mR2World + destIndex) Vector3(mR2World[srcIndex]);
     new (mI1 + destIndex) Matrix3x3(mI1[srcIndex]);
     new (mI2 + destIndex) Matrix3x3(mI2[srcIndex]);
+    mInverseMassBody1[destIndex] = mInverseMassBody1[srcIndex];
+    mInverseMassBody2[destIndex] = mInverseMassBody2[srcIndex];
+    mJointComponentIndices[destIndex] = mJointComponentIndices[srcIndex];
+    mBody1ComponentIndices[destIndex] = mBody1ComponentIndices[srcIndex];
+    mBody2ComponentIndices[destIndex] = mBody2ComponentIndices[srcIndex];
     new (mImpulseTranslation + destIndex) Vector3(mImpulseTranslation[srcIndex]);
     new (mImpulseRotation + destIndex) Vector2(mImpulseRotation[srcIndex]);
     new (mInverseMassMatrixTranslation + destIndex) Matrix3x3(mInverseMassMatrixTranslation[srcIndex]);
@@ -299,6 +325,11 @@ void HingeJointComponents::swapComponents(uint32 index1, uint32 index2) {
     Vector3 r2World1(mR2World[index1]);
     Matrix3x3 i11(mI1[index1]);
     Matrix3x3 i21(mI2[index1]);
+    decimal inverseMassBody11 = mInverseMassBody1[index1];
+    decimal inverseMassBody21 = mInverseMassBody2[index1];
+    uint32 jointComponentIndex1 = mJointComponentIndices[index1];
+    uint32 body1ComponentIndex1 = mBody1ComponentIndices[index1];
+    uint32 body2ComponentIndex1 = mBody2ComponentIndices[index1];
     Vector3 impulseTranslation1(mImpulseTranslation[index1]);
     Vector2 impulseRotation1(mImpulseRotation[index1]);
     Matrix3x3 inverseMassMatrixTranslation1(mInverseMassMatrixTranslation[index1]);
@@ -341,6 +372,11 @@ void HingeJointComponents::swapComponents(uint32 index1, uint32 index2) {
     new (mR2World + index2) Vector3(r2World1);
     new (mI1 + index2) Matrix3x3(i11);
     new (mI2 + index2) Matrix3x3(i21);
+    mInverseMassBody1[index2] = inverseMassBody11;
+    mInverseMassBody2[index2] = inverseMassBody21;
+    mJointComponentIndices[index2] = jointComponentIndex1;
+    mBody1ComponentIndices[index2] = body1ComponentIndex1;
+    mBody2ComponentIndices[index2] = body2ComponentIndex1;
     new (mImpulseTranslation + index2) Vector3(impulseTranslation1);
     new (mImpulseRotation + index2) Vector2(impulseRotation1);
     new (mInverseMassMatrixTranslation + index2) Matrix3x3(inverseMassMatrixTranslation1);
@@ -35,7 +35,7 @@ using namespace reactphysics3d;
 JointComponents::JointComponents(MemoryAllocator& allocator)
                     :Components(allocator, sizeof(Entity) + sizeof(Entity) + sizeof(Entity) + sizeof(Joint*) +
                                 sizeof(JointType) + sizeof(JointsPositionCorrectionTechnique) + sizeof(bool) +
-                                sizeof(bool)) {
+                                sizeof(bool) + sizeof(bool) + sizeof(bool) + sizeof(bool)) {
 
     // Allocate memory for the components data
     allocate(INIT_NB_ALLOCATED_COMPONENTS);
@@ -62,6 +62,9 @@ void JointComponents::allocate(uint32 nbComponentsToAllocate) {
     JointsPositionCorrectionTechnique* newPositionCorrectionTechniques = reinterpret_cast<JointsPositionCorrectionTechnique*>(newTypes + nbComponentsToAllocate);
     bool* newIsCollisionEnabled = reinterpret_cast<bool*>(newPositionCorrectionTechniques + nbComponentsToAllocate);
     bool* newIsAlreadyInIsland = reinterpret_cast<bool*>(newIsCollisionEnabled + nbComponentsToAllocate);
+    bool* newIsArticulated = reinterpret_cast<bool*>(newIsAlreadyInIsland + nbComponentsToAllocate);
+    bool* newIsSolvedDirectly = reinterpret_cast<bool*>(newIsArticulated + nbComponentsToAllocate);
+    bool* newHasPositionError = reinterpret_cast<bool*>(newIsSolvedDirectly + nbComponentsToAllocate);
 
     // If there was already components before
     if (mNbComponents > 0) {
@@ -75,6 +78,9 @@ void JointComponents::allocate(uint32 nbComponentsToAllocate) {
         memcpy(newPositionCorrectionTechniques, mPositionCorrectionTechniques, mNbComponents * sizeof(JointsPositionCorrectionTechnique));
         memcpy(newIsCollisionEnabled, mIsCollisionEnabled, mNbComponents * sizeof(bool));
         memcpy(newIsAlreadyInIsland, mIsAlreadyInIsland, mNbComponents * sizeof(bool));
+        memcpy(newIsArticulated, mIsArticulated, mNbComponents * sizeof(bool));
+        memcpy(newIsSolvedDirectly, mIsSolvedDirectly, mNbComponents * sizeof(bool));
+        memcpy(newHasPositionError, mHasPositionError, mNbComponents * sizeof(bool));
 
         // Deallocate previous memory
         mMemoryAllocator.release(mBuffer, mNbAllocatedComponents * mComponentDataSize);
@@ -90,6 +96,9 @@ void JointComponents::allocate(uint32 nbComponentsToAllocate) {
     mPositionCorrectionTechniques = newPositionCorrectionTechniques;
     mIsCollisionEnabled = newIsCollisionEnabled;
     mIsAlreadyInIsland = newIsAlreadyInIsland;
+    mIsArticulated = newIsArticulated;
+    mIsSolvedDirectly = newIsSolvedDirectly;
+    mHasPositionError = newHasPositionError;
 }
 
 // Add a component
@@ -107,6 +116,9 @@ void JointComponents::addComponent(Entity jointEntity, bool isSleeping, const Jo
     new (mPositionCorrectionTechniques + index) JointsPositionCorrectionTechnique(component.positionCorrectionTechnique);
     mIsCollisionEnabled[index] = component.isCollisionEnabled;
     mIsAlreadyInIsland[index] = false;
+    mIsArticulated[index] = component.isArticulated;
+    mIsSolvedDirectly[index] = false;
+    mHasPositionError[index] = false;
 
     // Map the entity with the new component lookup index
     mMapEntityToComponentIndex.add(Pair<Entity, uint32>(jointEntity, index));
@@ -132,6 +144,9 @@ void JointComponents::moveComponentToIndex(uint32 srcIndex, uint32 destIndex) {
     new (mPositionCorrectionTechniques + destIndex) JointsPositionCorrectionTechnique(mPositionCorrectionTechniques[srcIndex]);
     mIsCollisionEnabled[destIndex] = mIsCollisionEnabled[srcIndex];
     mIsAlreadyInIsland[destIndex] = mIsAlreadyInIsland[srcIndex];
+    mIsArticulated[destIndex] = mIsArticulated[srcIndex];
+    mIsSolvedDirectly[destIndex] = mIsSolvedDirectly[srcIndex];
+    mHasPositionError[destIndex] = mHasPositionError[srcIndex];
 
     // Destroy the source component
     destroyComponent(srcIndex);
@@ -156,6 +171,9 @@ void JointComponents::swapComponents(uint32 index1, uint32 index2) {
     JointsPositionCorrectionTechnique positionCorrectionTechnique1(mPositionCorrectionTechniques[index1]);
     bool isCollisionEnabled1 = mIsCollisionEnabled[index1];
     bool isAlreadyInIsland = mIsAlreadyInIsland[index1];
+    bool isArticulated1 = mIsArticulated[index1];
+    bool isSolvedDirectly1 = mIsSolvedDirectly[index1];
+    bool hasPositionError1 = mHasPositionError[index1];
 
     // Destroy component 1
     destroyComponent(index1);
@@ -171,6 +189,9 @@ void JointComponents::swapComponents(uint32 index1, uint32 index2) {
     new (mPositionCorrectionTechniques + index2) JointsPositionCorrectionTechnique(positionCorrectionTechnique1);
     mIsCollisionEnabled[index2] = isCollisionEnabled1;
     mIsAlreadyInIsland[index2] = isAlreadyInIsland;
+    mIsArticulated[index2] = isArticulated1;
+    mIsSolvedDirectly[index2] = isSolvedDirectly1;
+    mHasPositionError[index2] = hasPositionError1;
 
     // Update the entity to component index mapping
     mMapEntityToComponentIndex.add(Pair<Entity, uint32>(jointEntity1, index2));
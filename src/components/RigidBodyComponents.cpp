@@ -44,7 +44,7 @@ RigidBodyComponents::RigidBodyComponents(MemoryAllocator& allocator)
                                 sizeof(Vector3) + sizeof(Vector3) + sizeof(Vector3) +
                                 sizeof(Quaternion) + sizeof(Vector3) + sizeof(Vector3) +
                                 sizeof(bool) + sizeof(bool) + sizeof(Array<Entity>) + sizeof(Array<uint>) +
-                                sizeof(Vector3) + sizeof(Vector3) + sizeof(decimal)) {
+                                sizeof(Vector3) + sizeof(Vector3) + sizeof(decimal) + sizeof(decimal)) {
 
     // Allocate memory for the components data
     allocate(INIT_NB_ALLOCATED_COMPONENTS);
@@ -95,6 +95,7 @@ void RigidBodyComponents::allocate(uint32 nbComponentsToAllocate) {
     Vector3* newLinearLockAxisFactors = reinterpret_cast<Vector3*>(newContactPairs + nbComponentsToAllocate);
     Vector3* newAngularLockAxisFactors = reinterpret_cast<Vector3*>(newLinearLockAxisFactors + nbComponentsToAllocate);
     decimal* newGravityScales = reinterpret_cast<decimal*>(newAngularLockAxisFactors + nbComponentsToAllocate);
+    decimal* newSolverPriorities = reinterpret_cast<decimal*>(newGravityScales + nbComponentsToAllocate);
 
     // If there was already components before
     if (mNbComponents > 0) {
@@ -132,6 +133,7 @@ void RigidBodyComponents::allocate(uint32 nbComponentsToAllocate) {
         memcpy(newLinearLockAxisFactors, mLinearLockAxisFactors, mNbComponents * sizeof(Vector3));
         memcpy(newAngularLockAxisFactors, mAngularLockAxisFactors, mNbComponents * sizeof(Vector3));
         memcpy(newGravityScales, mGravityScales, mNbComponents * sizeof(decimal));
+        memcpy(newSolverPriorities, mSolverPriorities, mNbComponents * sizeof(decimal));
 
         // Deallocate previous memory
         mMemoryAllocator.release(mBuffer, mNbAllocatedComponents * mComponentDataSize);
@@ -171,6 +173,7 @@ void RigidBodyComponents::allocate(uint32 nbComponentsToAllocate) {
     mLinearLockAxisFactors = newLinearLockAxisFactors;
     mAngularLockAxisFactors = newAngularLockAxisFactors;
     mGravityScales = newGravityScales;
+    mSolverPriorities = newSolverPriorities;
 }
 
 // Add a component
@@ -212,6 +215,7 @@ void RigidBodyComponents::addComponent(Entity bodyEntity, bool isSleeping, const
     new (mLinearLockAxisFactors + index) Vector3(1, 1, 1);
     new (mAngularLockAxisFactors + index) Vector3(1, 1, 1);
     mGravityScales[index] = component.bodyType == BodyType::DYNAMIC ? decimal(1.0) : decimal(0);
+    mSolverPriorities[index] = decimal(1.0);
 
     // Map the entity with the new component lookup index
     mMapEntityToComponentIndex.add(Pair<Entity, uint32>(bodyEntity, index));
@@ -261,6 +265,7 @@ void RigidBodyComponents::moveComponentToIndex(uint32 srcIndex, uint32 destIndex
     new (mLinearLockAxisFactors + destIndex) Vector3(mLinearLockAxisFactors[srcIndex]);
     new (mAngularLockAxisFactors + destIndex) Vector3(mAngularLockAxisFactors[srcIndex]);
     mGravityScales[destIndex] = mGravityScales[srcIndex];
+    mSolverPriorities[destIndex] = mSolverPriorities[srcIndex];
 
     // Destroy the source component
     destroyComponent(srcIndex);
@@ -309,6 +314,7 @@ void RigidBodyComponents::swapComponents(uint32 index1, uint32 index2) {
     Vector3 linearLockAxisFactor1(mLinearLockAxisFactors[index1]);
     Vector3 angularLockAxisFactor1(mAngularLockAxisFactors[index1]);
     decimal gravityScale1(mGravityScales[index1]);
+    decimal solverPriority1 = mSolverPriorities[index1];
 
     // Destroy component 1
     destroyComponent(index1);
@@ -348,6 +354,7 @@ void RigidBodyComponents::swapComponents(uint32 index1, uint32 index2) {
     new (mLinearLockAxisFactors + index2) Vector3(linearLockAxisFactor1);
     new (mAngularLockAxisFactors + index2) Vector3(angularLockAxisFactor1);
     mGravityScales[index2] = gravityScale1;
+    mSolverPriorities[index2] = solverPriority1;
 
     // Update the entity to component index mapping
     mMapEntityToComponentIndex.add(Pair<Entity, uint32>(entity1, index2));
@@ -31,7 +31,7 @@ using namespace reactphysics3d;
 using namespace std;
 
 // Constructor
-ContactPoint::ContactPoint(const ContactPointInfo* contactInfo, decimal persistentContactDistanceThreshold)
+ContactPoint::ContactPoint(const ContactPointInfo* contactInfo, decimal persistentContactDistanceThreshold, decimal contactMargin)
              : mNormal(contactInfo->normal),
                mPenetrationDepth(contactInfo->penetrationDepth),
                mLocalPointOnShape1(contactInfo->localPoint1),
@@ -39,14 +39,15 @@ ContactPoint::ContactPoint(const ContactPointInfo* contactInfo, decimal persiste
                mIsRestingContact(false), mIsObsolete(false),
                mPersistentContactDistanceThreshold(persistentContactDistanceThreshold) {
 
-    assert(mPenetrationDepth > decimal(0.0));
+    // The penetration depth is negative for a speculative contact (separated by less than the contact margin)
+    assert(mPenetrationDepth > -contactMargin);
     assert(mNormal.lengthSquare() > decimal(0.8));
 
     mIsObsolete = false;
 }
 
 // Constructor
-ContactPoint::ContactPoint(const ContactPointInfo& contactInfo, decimal persistentContactDistanceThreshold)
+ContactPoint::ContactPoint(const ContactPointInfo& contactInfo, decimal persistentContactDistanceThreshold, decimal contactMargin)
              : mNormal(contactInfo.normal),
                mPenetrationDepth(contactInfo.penetrationDepth),
                mLocalPointOnShape1(contactInfo.localPoint1),
@@ -54,7 +55,8 @@ ContactPoint::ContactPoint(const ContactPointInfo& contactInfo, decimal persiste
                mIsRestingContact(false), mPenetrationImpulse(0), mIsObsolete(false),
                mPersistentContactDistanceThreshold(persistentContactDistanceThreshold) {
 
-    assert(mPenetrationDepth > decimal(0.0));
+    // The penetration depth is negative for a speculative contact (separated by less than the contact margin)
+    assert(mPenetrationDepth > -contactMargin);
     assert(mNormal.lengthSquare() > decimal(0.8));
 
     mIsObsolete = false;
@@ -62,10 +64,10 @@ ContactPoint::ContactPoint(const ContactPointInfo& contactInfo, decimal persiste
 
 // Update the contact point with a new one that is similar (very close)
 /// The idea is to keep the cache impulse (for warm starting the contact solver)
-void ContactPoint::update(const ContactPointInfo* contactInfo) {
+void ContactPoint::update(const ContactPointInfo* contactInfo, decimal contactMargin) {
 
     assert(isSimilarWithContactPoint(contactInfo));
-    assert(contactInfo->penetrationDepth > decimal(0.0));
+    assert(contactInfo->penetrationDepth > -contactMargin);
 
     mNormal = contactInfo->normal;
     mPenetrationDepth = contactInfo->penetrationDepth;
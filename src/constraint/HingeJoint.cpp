@@ -266,7 +266,7 @@ decimal HingeJoint::getAngle() const {
     const Quaternion& orientationBody2 = mWorld.mTransformComponents.getTransform(body2Entity).getOrientation();
 
     // Compute the current angle around the hinge axis
-    return mWorld.mConstraintSolverSystem.mSolveHingeJointSystem.computeCurrentHingeAngle(mEntity, orientationBody1, orientationBody2);
+    return mWorld.mConstraintSolverSystem.mSolveHingeJointSystem.computeCurrentHingeAngle(mWorld.mHingeJointsComponents.getEntityIndex(mEntity), orientationBody1, orientationBody2);
 }
 
 // Return the force (in Newtons) on body 2 required to satisfy the joint constraint in world-space
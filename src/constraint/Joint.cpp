@@ -70,6 +70,30 @@ bool Joint::isCollisionEnabled() const {
     return mWorld.mJointsComponents.getIsCollisionEnabled(mEntity);
 }
 
+// Return true if the joint is part of an articulation
+/**
+ * @return True if the joint is solved with the other joints of its articulation
+ *              and false otherwise
+ */
+bool Joint::isArticulated() const {
+    return mWorld.mJointsComponents.getIsArticulated(mEntity);
+}
+
+// Set whether the joint is part of an articulation
+/// The articulated joints of an island that link the dynamic bodies into a tree are
+/// solved exactly with a direct solver in linear time. The articulated joints that would
+/// close a loop are still solved by the iterative solver.
+/**
+ * @param isArticulated True if the joint is part of an articulation
+ */
+void Joint::setIsArticulated(bool isArticulated) {
+
+    mWorld.mJointsComponents.setIsArticulated(mEntity, isArticulated);
+
+    // Wake up the two bodies of the joint
+    awakeBodies();
+}
+
 // Awake the two bodies of the joint
 void Joint::awakeBodies() const {
 
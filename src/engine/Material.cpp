@@ -25,11 +25,50 @@
 
 // Libraries
 #include <reactphysics3d/engine/Material.h>
+#include <reactphysics3d/collision/Collider.h>
 
 using namespace reactphysics3d;
 
 // Constructor
 Material::Material(decimal frictionCoefficient, decimal bounciness, decimal massDensity)
-         : mFrictionCoefficientSqrt(std::sqrt(frictionCoefficient)), mBounciness(bounciness), mMassDensity(massDensity) {
+         : mFrictionCoefficientSqrt(std::sqrt(frictionCoefficient)), mBounciness(bounciness), mMassDensity(massDensity),
+           mCollider(nullptr) {
 
 }
+
+// Copy-constructor
+/// The copy is a standalone material that is not owned by any collider. Therefore,
+/// modifying it will not modify the material of the collider of the copied material.
+Material::Material(const Material& material)
+         : mFrictionCoefficientSqrt(material.mFrictionCoefficientSqrt), mBounciness(material.mBounciness),
+           mMassDensity(material.mMassDensity), mCollider(nullptr) {
+
+}
+
+// Assignment operator
+/// The material keeps its collider (if any) and this collider is notified that its
+/// friction and bounciness might have been modified
+Material& Material::operator=(const Material& material) {
+
+    if (this != &material) {
+
+        mFrictionCoefficientSqrt = material.mFrictionCoefficientSqrt;
+        mBounciness = material.mBounciness;
+        mMassDensity = material.mMassDensity;
+
+        if (mCollider != nullptr) {
+            notifyColliderMaterialChanged();
+        }
+    }
+
+    return *this;
+}
+
+// Notify the collider of the material that its friction or bounciness has been modified
+/// The mixed materials of the overlapping pairs of the collider will be recomputed
+void Material::notifyColliderMaterialChanged() const {
+
+    assert(mCollider != nullptr);
+
+    mCollider->notifyMaterialChanged();
+}
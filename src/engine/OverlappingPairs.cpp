@@ -38,9 +38,10 @@ using namespace reactphysics3d;
 OverlappingPairs::OverlappingPairs(MemoryManager& memoryManager, ColliderComponents& colliderComponents,
                                    CollisionBodyComponents& collisionBodyComponents, RigidBodyComponents& rigidBodyComponents, Set<bodypair> &noCollisionPairs, CollisionDispatch &collisionDispatch)
                 : mPoolAllocator(memoryManager.getPoolAllocator()), mHeapAllocator(memoryManager.getHeapAllocator()), mConvexPairs(memoryManager.getHeapAllocator()),
-                  mConcavePairs(memoryManager.getHeapAllocator()), mMapConvexPairIdToPairIndex(memoryManager.getHeapAllocator()), mMapConcavePairIdToPairIndex(memoryManager.getHeapAllocator()),
-                  mColliderComponents(colliderComponents), mCollisionBodyComponents(collisionBodyComponents),
-                  mRigidBodyComponents(rigidBodyComponents), mNoCollisionPairs(noCollisionPairs), mCollisionDispatch(collisionDispatch) {
+                  mConcavePairs(memoryManager.getHeapAllocator()), mConvexDisabledStartIndex(0), mConcaveDisabledStartIndex(0), mMapConvexPairIdToPairIndex(memoryManager.getHeapAllocator()), mMapConcavePairIdToPairIndex(memoryManager.getHeapAllocator()),
+                  mPairsToTestOverlap(memoryManager.getHeapAllocator()), mColliderComponents(colliderComponents), mCollisionBodyComponents(collisionBodyComponents),
+                  mRigidBodyComponents(rigidBodyComponents), mNoCollisionPairs(noCollisionPairs), mCollisionDispatch(collisionDispatch),
+                  mMaterialMixer(&mDefaultMaterialMixer) {
     
 }
 
@@ -79,11 +80,19 @@ void OverlappingPairs::removePair(uint64 pairIndex, bool isConvexVsConvex) {
 
     RP3D_PROFILE("OverlappingPairs::removePair()", mProfiler);
 
+    // We want to keep the arrays tightly packed. Therefore, when a pair is removed,
+    // we replace it with the last element of the array. But we need to make sure that enabled
+    // and disabled pairs stay grouped together.
+
+    uint64 nbPairs;
+    uint64* disabledStartIndex;
+
     if (isConvexVsConvex) {
 
-        const uint64 nbConvexPairs = mConvexPairs.size();
+        nbPairs = mConvexPairs.size();
+        disabledStartIndex = &mConvexDisabledStartIndex;
 
-        assert(pairIndex < nbConvexPairs);
+        assert(pairIndex < nbPairs);
 
         // Remove the involved overlapping pair from the two colliders
         assert(mColliderComponents.getOverlappingPairs(mConvexPairs[pairIndex].collider1).find(mConvexPairs[pairIndex].pairID) != mColliderComponents.getOverlappingPairs(mConvexPairs[pairIndex].collider1).end());
@@ -93,22 +102,13 @@ void OverlappingPairs::removePair(uint64 pairIndex, bool isConvexVsConvex) {
 
         assert(mMapConvexPairIdToPairIndex[mConvexPairs[pairIndex].pairID] == pairIndex);
         mMapConvexPairIdToPairIndex.remove(mConvexPairs[pairIndex].pairID);
-
-        // Change the mapping between the pairId and the index in the convex pairs array if we swap the last item with the one to remove
-        if (mConvexPairs.size() > 1 && pairIndex < (nbConvexPairs - 1)) {
-
-            mMapConvexPairIdToPairIndex[mConvexPairs[nbConvexPairs - 1].pairID] = pairIndex;
-        }
-
-        // We want to keep the arrays tightly packed. Therefore, when a pair is removed,
-        // we replace it with the last element of the array.
-        mConvexPairs.removeAtAndReplaceByLast(pairIndex);
     }
     else {
 
-        const uint64 nbConcavePairs = mConcavePairs.size();
+        nbPairs = mConcavePairs.size();
+        disabledStartIndex = &mConcaveDisabledStartIndex;
 
-        assert(pairIndex < nbConcavePairs);
+        assert(pairIndex < nbPairs);
 
         // Remove the involved overlapping pair to the two colliders
         assert(mColliderComponents.getOverlappingPairs(mConcavePairs[pairIndex].collider1).find(mConcavePairs[pairIndex].pairID) != mColliderComponents.getOverlappingPairs(mConcavePairs[pairIndex].collider1).end());
@@ -121,17 +121,156 @@ void OverlappingPairs::removePair(uint64 pairIndex, bool isConvexVsConvex) {
 
         // Destroy all the LastFrameCollisionInfo objects
         mConcavePairs[pairIndex].destroyLastFrameCollisionInfos();
+    }
+
+    // If the pair to remove is disabled
+    if (pairIndex >= *disabledStartIndex) {
+
+        // If the pair is not the last one
+        if (pairIndex != nbPairs - 1) {
+
+            // We replace it by the last disabled pair
+            movePairToIndex(nbPairs - 1, pairIndex, isConvexVsConvex);
+        }
+    }
+    else {   // If the pair to remove is enabled
+
+        // If it not the last enabled pair
+        if (pairIndex != *disabledStartIndex - 1) {
+
+            // We replace it by the last enabled pair
+            movePairToIndex(*disabledStartIndex - 1, pairIndex, isConvexVsConvex);
+        }
+
+        // If there are disabled pairs at the end
+        if (*disabledStartIndex != nbPairs) {
+
+            // We replace the last enabled pair by the last disabled pair
+            movePairToIndex(nbPairs - 1, *disabledStartIndex - 1, isConvexVsConvex);
+        }
+
+        (*disabledStartIndex)--;
+    }
+
+    // Destroy the last pair of the array (it has been moved or it is the removed one)
+    if (isConvexVsConvex) {
+        mConvexPairs.removeAt(nbPairs - 1);
+    }
+    else {
+        mConcavePairs.removeAt(nbPairs - 1);
+    }
+
+    assert(mConvexDisabledStartIndex <= mConvexPairs.size());
+    assert(mConcaveDisabledStartIndex <= mConcavePairs.size());
+}
+
+// Move a pair from a source to a destination index in the pairs array
+// The destination slot is overwritten and the source slot still needs to be removed or overwritten
+void OverlappingPairs::movePairToIndex(uint64 srcIndex, uint64 destIndex, bool isConvexVsConvex) {
+
+    assert(srcIndex != destIndex);
+
+    if (isConvexVsConvex) {
+
+        mConvexPairs[destIndex] = mConvexPairs[srcIndex];
+        mMapConvexPairIdToPairIndex[mConvexPairs[destIndex].pairID] = destIndex;
+    }
+    else {
+
+        mConcavePairs[destIndex] = mConcavePairs[srcIndex];
+        mMapConcavePairIdToPairIndex[mConcavePairs[destIndex].pairID] = destIndex;
+    }
+}
+
+// Swap two pairs in the array
+void OverlappingPairs::swapPairs(uint64 index1, uint64 index2, bool isConvexVsConvex) {
+
+    assert(index1 != index2);
+
+    if (isConvexVsConvex) {
+
+        const ConvexOverlappingPair pair1 = mConvexPairs[index1];
+        mConvexPairs[index1] = mConvexPairs[index2];
+        mConvexPairs[index2] = pair1;
+
+        mMapConvexPairIdToPairIndex[mConvexPairs[index1].pairID] = index1;
+        mMapConvexPairIdToPairIndex[mConvexPairs[index2].pairID] = index2;
+    }
+    else {
+
+        const ConcaveOverlappingPair pair1 = mConcavePairs[index1];
+        mConcavePairs[index1] = mConcavePairs[index2];
+        mConcavePairs[index2] = pair1;
+
+        mMapConcavePairIdToPairIndex[mConcavePairs[index1].pairID] = index1;
+        mMapConcavePairIdToPairIndex[mConcavePairs[index2].pairID] = index2;
+    }
+}
+
+// Return true if a given collider belongs to a body that is awake and not static
+bool OverlappingPairs::isColliderEnabled(Entity colliderEntity) const {
+
+    // If the collider is disabled, its body is sleeping
+    if (mColliderComponents.getIsEntityDisabled(colliderEntity)) return false;
+
+    const Entity bodyEntity = mColliderComponents.getBody(colliderEntity);
+
+    return !mRigidBodyComponents.hasComponent(bodyEntity) || mRigidBodyComponents.getBodyType(bodyEntity) != BodyType::STATIC;
+}
+
+// Move a pair to the enabled or disabled pairs according to the state of its bodies.
+// A pair is disabled when none of its two bodies is awake and non-static. Disabled pairs are
+// kept (with their temporal coherence data) but skipped during the collision detection.
+void OverlappingPairs::updatePairEnabledState(uint64 pairId) {
+
+    const bool isEnabled = isColliderEnabled(getOverlappingPair(pairId)->collider1) ||
+                           isColliderEnabled(getOverlappingPair(pairId)->collider2);
+
+    uint64 pairIndex;
+    uint64* disabledStartIndex;
+    bool isConvexVsConvex;
+
+    auto it = mMapConvexPairIdToPairIndex.find(pairId);
+    if (it != mMapConvexPairIdToPairIndex.end()) {
+        pairIndex = it->second;
+        disabledStartIndex = &mConvexDisabledStartIndex;
+        isConvexVsConvex = true;
+    }
+    else {
+        pairIndex = mMapConcavePairIdToPairIndex[pairId];
+        disabledStartIndex = &mConcaveDisabledStartIndex;
+        isConvexVsConvex = false;
+    }
+
+    // If the pair was disabled and is not disabled anymore
+    if (isEnabled && pairIndex >= *disabledStartIndex) {
+
+        // If the disabled pair is not the first disabled pair
+        if (pairIndex != *disabledStartIndex) {
+
+            // Swap the first disabled pair with the one we need to enable
+            swapPairs(pairIndex, *disabledStartIndex, isConvexVsConvex);
+        }
+
+        (*disabledStartIndex)++;
+    }
+    // If the pair was enabled and must now be disabled
+    else if (!isEnabled && pairIndex < *disabledStartIndex) {
 
-        // Change the mapping between the pairId and the index in the convex pairs array if we swap the last item with the one to remove
-        if (mConcavePairs.size() > 1 && pairIndex < (nbConcavePairs - 1)) {
+        assert(*disabledStartIndex > 0);
 
-            mMapConcavePairIdToPairIndex[mConcavePairs[nbConcavePairs - 1].pairID] = pairIndex;
+        // If the enabled pair is not the last enabled pair
+        if (pairIndex != *disabledStartIndex - 1) {
+
+            // Swap the last enabled pair with the one we need to disable
+            swapPairs(pairIndex, *disabledStartIndex - 1, isConvexVsConvex);
         }
 
-        // We want to keep the arrays tightly packed. Therefore, when a pair is removed,
-        // we replace it with the last element of the array.
-        mConcavePairs.removeAtAndReplaceByLast(pairIndex);
+        (*disabledStartIndex)--;
     }
+
+    assert(mConvexDisabledStartIndex <= mConvexPairs.size());
+    assert(mConcaveDisabledStartIndex <= mConcavePairs.size());
 }
 
 // Add an overlapping pair
@@ -150,6 +289,9 @@ uint64 OverlappingPairs::addPair(uint32 collider1Index, uint32 collider2Index, b
     const uint32 broadPhase1Id = static_cast<uint32>(mColliderComponents.mBroadPhaseIds[collider1Index]);
     const uint32 broadPhase2Id = static_cast<uint32>(mColliderComponents.mBroadPhaseIds[collider2Index]);
 
+    // A new pair always has at least one awake and non-static body
+    assert(isColliderEnabled(collider1Entity) || isColliderEnabled(collider2Entity));
+
     // Compute a unique id for the overlapping pair
     const uint64 pairId = pairNumbers(std::max(broadPhase1Id, broadPhase2Id), std::min(broadPhase1Id, broadPhase2Id));
 
@@ -164,6 +306,13 @@ uint64 OverlappingPairs::addPair(uint32 collider1Index, uint32 collider2Index, b
 
         // Create and add a new convex pair
         mConvexPairs.emplace(pairId, broadPhase1Id, broadPhase2Id, collider1Entity, collider2Entity, algorithmType);
+        computeMixedMaterial(mConvexPairs[mConvexPairs.size() - 1], collider1Index, collider2Index);
+
+        // The new pair is enabled. If there already are disabled pairs, we move it before them
+        if (mConvexDisabledStartIndex != mConvexPairs.size() - 1) {
+            swapPairs(mConvexPairs.size() - 1, mConvexDisabledStartIndex, true);
+        }
+        mConvexDisabledStartIndex++;
     }
     else {
 
@@ -178,6 +327,13 @@ uint64 OverlappingPairs::addPair(uint32 collider1Index, uint32 collider2Index, b
         // Create and add a new concave pair
         mConcavePairs.emplace(pairId, broadPhase1Id, broadPhase2Id, collider1Entity, collider2Entity, algorithmType,
                               isShape1Convex, mPoolAllocator, mHeapAllocator);
+        computeMixedMaterial(mConcavePairs[mConcavePairs.size() - 1], collider1Index, collider2Index);
+
+        // The new pair is enabled. If there already are disabled pairs, we move it before them
+        if (mConcaveDisabledStartIndex != mConcavePairs.size() - 1) {
+            swapPairs(mConcavePairs.size() - 1, mConcaveDisabledStartIndex, false);
+        }
+        mConcaveDisabledStartIndex++;
     }
 
     // Add the involved overlapping pair to the two colliders
@@ -194,29 +350,57 @@ void OverlappingPairs::clearObsoleteLastFrameCollisionInfos() {
 
     RP3D_PROFILE("OverlappingPairs::clearObsoleteLastFrameCollisionInfos()", mProfiler);
 
-    // For each concave overlapping pair
-    const uint64 nbConcavePairs = mConcavePairs.size();
-    for (uint64 i=0; i < nbConcavePairs; i++) {
+    // For each enabled concave overlapping pair (the collision infos of disabled pairs are kept for when they wake up)
+    for (uint64 i=0; i < mConcaveDisabledStartIndex; i++) {
 
         mConcavePairs[i].clearObsoleteLastFrameInfos();
     }
 }
 
+// Set the material mixer and recompute the mixed materials of all the pairs
+/// The previous mixer is not used anymore after this call. If the parameter is nullptr, the
+/// default mixer is used
+void OverlappingPairs::setMaterialMixer(MaterialMixer* materialMixer) {
+
+    mMaterialMixer = materialMixer != nullptr ? materialMixer : &mDefaultMaterialMixer;
+
+    for (uint64 i=0; i < mConvexPairs.size(); i++) {
+        computeMixedMaterial(mConvexPairs[i], mColliderComponents.getEntityIndex(mConvexPairs[i].collider1),
+                             mColliderComponents.getEntityIndex(mConvexPairs[i].collider2));
+    }
+    for (uint64 i=0; i < mConcavePairs.size(); i++) {
+        computeMixedMaterial(mConcavePairs[i], mColliderComponents.getEntityIndex(mConcavePairs[i].collider1),
+                             mColliderComponents.getEntityIndex(mConcavePairs[i].collider2));
+    }
+}
+
+// Recompute the mixed materials of the pairs of a collider after its material has changed
+void OverlappingPairs::updateMixedMaterials(uint32 colliderIndex) {
+
+    const Array<uint64>& pairs = mColliderComponents.mOverlappingPairs[colliderIndex];
+    for (uint64 i=0; i < pairs.size(); i++) {
+
+        OverlappingPair* pair = getOverlappingPair(pairs[i]);
+        assert(pair != nullptr);
+
+        computeMixedMaterial(*pair, mColliderComponents.getEntityIndex(pair->collider1),
+                             mColliderComponents.getEntityIndex(pair->collider2));
+    }
+}
+
 // Set the collidingInPreviousFrame value with the collidinginCurrentFrame value for each pair
 void OverlappingPairs::updateCollidingInPreviousFrame() {
 
     RP3D_PROFILE("OverlappingPairs::updateCollidingInPreviousFrame()", mProfiler);
 
-    // For each convex overlapping pair
-    const uint64 nbConvexPairs = mConvexPairs.size();
-    for (uint64 i=0; i < nbConvexPairs; i++) {
+    // For each enabled convex overlapping pair
+    for (uint64 i=0; i < mConvexDisabledStartIndex; i++) {
 
         mConvexPairs[i].collidingInPreviousFrame = mConvexPairs[i].collidingInCurrentFrame;
     }
 
-    // For each concave overlapping pair
-    const uint64 nbConcavePairs = mConcavePairs.size();
-    for (uint64 i=0; i < nbConcavePairs; i++) {
+    // For each enabled concave overlapping pair
+    for (uint64 i=0; i < mConcaveDisabledStartIndex; i++) {
 
         mConcavePairs[i].collidingInPreviousFrame = mConcavePairs[i].collidingInCurrentFrame;
     }
@@ -25,6 +25,7 @@
 
 // Libraries
 #include <reactphysics3d/engine/PhysicsCommon.h>
+#include <reactphysics3d/collision/QuickHull.h>
 
 using namespace reactphysics3d;
 
@@ -39,6 +40,7 @@ PhysicsCommon::PhysicsCommon(MemoryAllocator* baseMemoryAllocator)
               : mMemoryManager(baseMemoryAllocator),
                 mPhysicsWorlds(mMemoryManager.getHeapAllocator()), mSphereShapes(mMemoryManager.getHeapAllocator()),
                 mBoxShapes(mMemoryManager.getHeapAllocator()), mCapsuleShapes(mMemoryManager.getHeapAllocator()),
+                mCylinderShapes(mMemoryManager.getHeapAllocator()), mConeShapes(mMemoryManager.getHeapAllocator()),
                 mConvexMeshShapes(mMemoryManager.getHeapAllocator()), mConcaveMeshShapes(mMemoryManager.getHeapAllocator()),
                 mHeightFieldShapes(mMemoryManager.getHeapAllocator()), mPolyhedronMeshes(mMemoryManager.getHeapAllocator()),
                 mTriangleMeshes(mMemoryManager.getHeapAllocator()),
@@ -154,6 +156,18 @@ void PhysicsCommon::release() {
     }
     mCapsuleShapes.clear();
 
+    // Destroy the cylinder shapes
+    for (auto it = mCylinderShapes.begin(); it != mCylinderShapes.end(); ++it) {
+        deleteCylinderShape(*it);
+    }
+    mCylinderShapes.clear();
+
+    // Destroy the cone shapes
+    for (auto it = mConeShapes.begin(); it != mConeShapes.end(); ++it) {
+        deleteConeShape(*it);
+    }
+    mConeShapes.clear();
+
     // Destroy the convex mesh shapes
     for (auto it = mConvexMeshShapes.begin(); it != mConvexMeshShapes.end(); ++it) {
         deleteConvexMeshShape(*it);
@@ -412,6 +426,122 @@ void PhysicsCommon::deleteCapsuleShape(CapsuleShape* capsuleShape) {
    mMemoryManager.release(MemoryManager::AllocationType::Pool, capsuleShape, sizeof(CapsuleShape));
 }
 
+// Create and return a cylinder shape
+/**
+ * @param radius The radius of the cylinder shape
+ * @param height The height of the cylinder shape (along the local y axis)
+ * @return A pointer to the created cylinder shape
+ */
+CylinderShape* PhysicsCommon::createCylinderShape(decimal radius, decimal height) {
+
+    if (radius <= decimal(0.0)) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when creating a CylinderShape: radius must be a positive value",  __FILE__, __LINE__);
+    }
+
+    if (height <= decimal(0.0)) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when creating a CylinderShape: height must be a positive value",  __FILE__, __LINE__);
+    }
+
+    CylinderShape* shape = new (mMemoryManager.allocate(MemoryManager::AllocationType::Pool, sizeof(CylinderShape))) CylinderShape(radius, height, mMemoryManager.getHeapAllocator());
+
+    mCylinderShapes.add(shape);
+
+    return shape;
+}
+
+// Destroy a cylinder collision shape
+/**
+ * @param cylinderShape A pointer to the cylinder shape to destroy
+ */
+void PhysicsCommon::destroyCylinderShape(CylinderShape* cylinderShape) {
+
+    deleteCylinderShape(cylinderShape);
+
+    mCylinderShapes.remove(cylinderShape);
+}
+
+// Delete a cylinder collision shape
+/**
+ * @param cylinderShape A pointer to the cylinder shape to destroy
+ */
+void PhysicsCommon::deleteCylinderShape(CylinderShape* cylinderShape) {
+
+    // If the shape is still part of some colliders
+    if (cylinderShape->mColliders.size() > 0) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when destroying the CylinderShape because it is still used by some colliders",  __FILE__, __LINE__);
+    }
+
+   // Call the destructor of the shape
+   cylinderShape->~CylinderShape();
+
+   // Release allocated memory
+   mMemoryManager.release(MemoryManager::AllocationType::Pool, cylinderShape, sizeof(CylinderShape));
+}
+
+// Create and return a cone shape
+/**
+ * @param radius The radius of the base of the cone shape
+ * @param height The height of the cone shape (from the base to the apex along the local y axis)
+ * @return A pointer to the created cone shape
+ */
+ConeShape* PhysicsCommon::createConeShape(decimal radius, decimal height) {
+
+    if (radius <= decimal(0.0)) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when creating a ConeShape: radius must be a positive value",  __FILE__, __LINE__);
+    }
+
+    if (height <= decimal(0.0)) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when creating a ConeShape: height must be a positive value",  __FILE__, __LINE__);
+    }
+
+    ConeShape* shape = new (mMemoryManager.allocate(MemoryManager::AllocationType::Pool, sizeof(ConeShape))) ConeShape(radius, height, mMemoryManager.getHeapAllocator());
+
+    mConeShapes.add(shape);
+
+    return shape;
+}
+
+// Destroy a cone collision shape
+/**
+ * @param coneShape A pointer to the cone shape to destroy
+ */
+void PhysicsCommon::destroyConeShape(ConeShape* coneShape) {
+
+    deleteConeShape(coneShape);
+
+    mConeShapes.remove(coneShape);
+}
+
+// Delete a cone collision shape
+/**
+ * @param coneShape A pointer to the cone shape to destroy
+ */
+void PhysicsCommon::deleteConeShape(ConeShape* coneShape) {
+
+    // If the shape is still part of some colliders
+    if (coneShape->mColliders.size() > 0) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when destroying the ConeShape because it is still used by some colliders",  __FILE__, __LINE__);
+    }
+
+   // Call the destructor of the shape
+   coneShape->~ConeShape();
+
+   // Release allocated memory
+   mMemoryManager.release(MemoryManager::AllocationType::Pool, coneShape, sizeof(ConeShape));
+}
+
 // Create and return a convex mesh shape
 /**
  * @param polyhedronMesh A pointer to the polyhedron mesh used to create the convex shape
@@ -579,6 +709,50 @@ PolyhedronMesh* PhysicsCommon::createPolyhedronMesh(PolygonVertexArray* polygonV
     return mesh;
 }
 
+// Create a polyhedron mesh that is the convex hull of a set of points
+/// The hull is computed with the Quickhull algorithm and the adjacent coplanar triangles of the
+/// hull are merged into polygon faces. If a maximum number of vertices is given, the hull is only
+/// made of the most extreme points and is therefore inside the exact convex hull of the points.
+/**
+ * @param points Array with the points
+ * @param nbPoints Number of points in the array
+ * @param maxNbVertices Maximum number of vertices of the hull (zero for no limit)
+ * @return A pointer to the created polyhedron mesh or nullptr if the points are degenerate
+ */
+PolyhedronMesh* PhysicsCommon::createConvexHull(const Vector3* points, uint32 nbPoints, uint32 maxNbVertices) {
+
+    MemoryAllocator& allocator = mMemoryManager.getHeapAllocator();
+
+    // Compute the convex hull of the points
+    Array<Vector3> vertices(allocator);
+    Array<uint32> indices(allocator);
+    Array<PolygonVertexArray::PolygonFace> faces(allocator);
+    QuickHull quickHull(allocator);
+    if (!quickHull.computeConvexHull(points, nbPoints, maxNbVertices, vertices, indices, faces)) {
+
+        RP3D_LOG("PhysicsCommon", Logger::Level::Error, Logger::Category::PhysicCommon,
+                 "Error when creating a convex hull: the points are coincident, collinear or coplanar",  __FILE__, __LINE__);
+
+        return nullptr;
+    }
+
+    const PolygonVertexArray::VertexDataType vertexDataType = sizeof(decimal) == sizeof(float) ?
+                                                                  PolygonVertexArray::VertexDataType::VERTEX_FLOAT_TYPE :
+                                                                  PolygonVertexArray::VertexDataType::VERTEX_DOUBLE_TYPE;
+    PolygonVertexArray polygonVertexArray(static_cast<uint32>(vertices.size()), &(vertices[0]), sizeof(Vector3),
+                                          &(indices[0]), sizeof(uint32), static_cast<uint32>(faces.size()), &(faces[0]),
+                                          vertexDataType, PolygonVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+
+    PolyhedronMesh* mesh = createPolyhedronMesh(&polygonVertexArray);
+
+    // The vertices of the mesh have been baked and the temporary polygon vertex array cannot be used anymore
+    if (mesh != nullptr) {
+        mesh->mPolygonVertexArray = nullptr;
+    }
+
+    return mesh;
+}
+
 // Destroy a polyhedron mesh
 /**
  * @param polyhedronMesh A pointer to the polyhedron mesh to destroy
@@ -67,12 +67,14 @@ PhysicsWorld::PhysicsWorld(MemoryManager& memoryManager, PhysicsCommon& physicsC
                 mName(worldSettings.worldName),  mIslands(mMemoryManager.getSingleFrameAllocator()), mProcessContactPairsOrderIslands(mMemoryManager.getSingleFrameAllocator()),
                 mContactSolverSystem(mMemoryManager, *this, mIslands, mCollisionBodyComponents, mRigidBodyComponents,
                                mCollidersComponents, mConfig.restitutionVelocityThreshold),
-                mConstraintSolverSystem(*this, mIslands, mRigidBodyComponents, mTransformComponents, mJointsComponents,
+                mConstraintSolverSystem(mMemoryManager, *this, mIslands, mRigidBodyComponents, mTransformComponents, mJointsComponents,
                                         mBallAndSocketJointsComponents, mFixedJointsComponents, mHingeJointsComponents,
                                         mSliderJointsComponents),
                 mDynamicsSystem(*this, mCollisionBodyComponents, mRigidBodyComponents, mTransformComponents, mCollidersComponents, mIsGravityEnabled, mConfig.gravity),
                 mNbVelocitySolverIterations(mConfig.defaultVelocitySolverNbIterations),
-                mNbPositionSolverIterations(mConfig.defaultPositionSolverNbIterations), 
+                mNbPositionSolverIterations(mConfig.defaultPositionSolverNbIterations),
+                mIsPerIslandSolverEnabled(mConfig.isPerIslandSolverEnabled), mNbSubsteps(mConfig.defaultNbSubsteps),
+                mVelocitySolverTolerance(mConfig.velocitySolverTolerance), mPositionSolverTolerance(mConfig.positionSolverTolerance),
                 mIsSleepingEnabled(mConfig.isSleepingEnabled), mRigidBodies(mMemoryManager.getPoolAllocator()),
                 mIsGravityEnabled(true), mSleepLinearVelocity(mConfig.defaultSleepLinearVelocity),
                 mSleepAngularVelocity(mConfig.defaultSleepAngularVelocity), mTimeBeforeSleep(mConfig.defaultTimeBeforeSleep) {
@@ -104,6 +106,11 @@ PhysicsWorld::PhysicsWorld(MemoryManager& memoryManager, PhysicsCommon& physicsC
 
 #endif
 
+    // The world needs at least one sub-step per update to integrate the bodies
+    assert(mConfig.defaultNbSubsteps > 0);
+
+    mConstraintSolverSystem.setDirectSolverMaxNbBodies(mConfig.directJointSolverMaxNbBodies);
+
     mNbWorlds++;
 
     RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::World,
@@ -252,6 +259,14 @@ void PhysicsWorld::setBodyDisabled(Entity bodyEntity, bool isDisabled) {
     for (uint32 i=0; i < nbColliderEntities; i++) {
 
         mCollidersComponents.setIsEntityDisabled(collidersEntities[i], isDisabled);
+
+        // Enable or disable the overlapping pairs of the collider. The pairs are kept while the body
+        // is sleeping but they are skipped during collision detection if the other body is also inactive
+        const Array<uint64>& overlappingPairs = mCollidersComponents.getOverlappingPairs(collidersEntities[i]);
+        const uint32 nbOverlappingPairs = static_cast<uint32>(overlappingPairs.size());
+        for (uint32 j=0; j < nbOverlappingPairs; j++) {
+            mCollisionDetection.mOverlappingPairs.updatePairEnabledState(overlappingPairs[j]);
+        }
     }
 }
 
@@ -333,26 +348,33 @@ void PhysicsWorld::update(decimal timeStep) {
     // Report the contacts to the user
     mCollisionDetection.reportContactsAndTriggers();
 
-    // Recompute the inverse inertia tensors of rigid bodies
-    updateBodiesInverseWorldInertiaTensors();
-
     // Enable or disable the joints
     enableDisableJoints();
 
-    // Integrate the velocities
-    mDynamicsSystem.integrateRigidBodiesVelocities(timeStep);
+    mSolverStatistics = SolverStatistics();
+
+    // The contacts computed by the collision detection are reused for all the sub-steps
+    const decimal subTimeStep = timeStep / decimal(mNbSubsteps);
+    for (uint32 substep=0; substep < mNbSubsteps; substep++) {
+
+        // Recompute the inverse inertia tensors of rigid bodies
+        updateBodiesInverseWorldInertiaTensors();
 
-    // Solve the contacts and constraints
-    solveContactsAndConstraints(timeStep);
+        // Integrate the velocities
+        mDynamicsSystem.integrateRigidBodiesVelocities(subTimeStep);
 
-    // Integrate the position and orientation of each body
-    mDynamicsSystem.integrateRigidBodiesPositions(timeStep, mContactSolverSystem.isSplitImpulseActive());
+        // Solve the contacts and constraints
+        solveContactsAndConstraints(subTimeStep, substep == 0);
 
-    // Solve the position correction for constraints
-    solvePositionCorrection();
+        // Integrate the position and orientation of each body
+        mDynamicsSystem.integrateRigidBodiesPositions(subTimeStep, mContactSolverSystem.isSplitImpulseActive());
 
-    // Update the state (positions and velocities) of the bodies
-    mDynamicsSystem.updateBodiesState();
+        // Solve the position correction for constraints
+        solvePositionCorrection();
+
+        // Update the state (positions and velocities) of the bodies
+        mDynamicsSystem.updateBodiesState();
+    }
 
     // Update the colliders components
     mCollisionDetection.updateColliders();
@@ -388,24 +410,75 @@ void PhysicsWorld::updateBodiesInverseWorldInertiaTensors() {
 }
 
 // Solve the contacts and constraints
-void PhysicsWorld::solveContactsAndConstraints(decimal timeStep) {
+/// After the first sub-step of a frame, the penetration depths of the contacts computed by the
+/// collision detection are outdated and are recomputed by the contact solver
+void PhysicsWorld::solveContactsAndConstraints(decimal timeStep, bool isFirstSubstep) {
 
     RP3D_PROFILE("PhysicsWorld::solveContactsAndConstraints()", mProfiler);
 
     // ---------- Solve velocity constraints for joints and contacts ---------- //
 
     // Initialize the contact solver
-    mContactSolverSystem.init(mCollisionDetection.mCurrentContactManifolds, mCollisionDetection.mCurrentContactPoints, timeStep);
+    mContactSolverSystem.init(mCollisionDetection.mCurrentContactManifolds, mCollisionDetection.mCurrentContactPoints, timeStep,
+                              !isFirstSubstep);
 
     // Initialize the constraint solver
     mConstraintSolverSystem.initialize(timeStep);
 
-    // For each iteration of the velocity solver
-    for (uint32 i=0; i<mNbVelocitySolverIterations; i++) {
+    if (mIsPerIslandSolverEnabled) {
+
+        // Order the joints island by island
+        mConstraintSolverSystem.orderJointsByIsland();
+
+        // For each island
+        const uint32 nbIslands = mIslands.getNbIslands();
+        for (uint32 island=0; island < nbIslands; island++) {
+
+            const uint32 nbMaxIterations = computeIslandNbIterations(island, mNbVelocitySolverIterations);
+
+            // For each iteration of the velocity solver
+            uint32 nbIterations = 0;
+            while (nbIterations < nbMaxIterations) {
+
+                mConstraintSolverSystem.solveVelocityConstraints(island);
 
-        mConstraintSolverSystem.solveVelocityConstraints();
+                mContactSolverSystem.solveIsland(island);
 
-        mContactSolverSystem.solve();
+                mConstraintSolverSystem.solveArticulations(island);
+
+                nbIterations++;
+
+                // Stop iterating on this island if the solver has converged
+                if (hasVelocitySolverConverged()) break;
+            }
+
+            mSolverStatistics.nbVelocityIterations += nbIterations;
+            mSolverStatistics.maxNbVelocityIterations = std::max(mSolverStatistics.maxNbVelocityIterations, nbIterations);
+        }
+
+        mSolverStatistics.nbIslands = nbIslands;
+    }
+    else {
+
+        // For each iteration of the velocity solver
+        uint32 nbIterations = 0;
+        while (nbIterations < mNbVelocitySolverIterations) {
+
+            mConstraintSolverSystem.solveVelocityConstraints();
+
+            mContactSolverSystem.solve();
+
+            mConstraintSolverSystem.solveArticulations();
+
+            nbIterations++;
+
+            // Stop iterating if the solver has converged
+            if (hasVelocitySolverConverged()) break;
+        }
+
+        mSolverStatistics.nbIslands = 1;
+        mSolverStatistics.nbVelocityIterations += nbIterations;
+        mSolverStatistics.maxNbVelocityIterations = std::max(mSolverStatistics.maxNbVelocityIterations, nbIterations);
     }
 
     mContactSolverSystem.storeImpulses();
@@ -421,12 +494,85 @@ void PhysicsWorld::solvePositionCorrection() {
 
     // ---------- Solve the position error correction for the constraints ---------- //
 
-    // For each iteration of the position (error correction) solver
-    for (uint32 i=0; i<mNbPositionSolverIterations; i++) {
+    // Check the position errors of the joints after the integration of the positions
+    mConstraintSolverSystem.computePositionErrors();
+
+    // Nothing to correct if all the joints are within the slop (the islands are at rest)
+    if (!mConstraintSolverSystem.hasPositionErrors()) return;
+
+    // Find the islands with a position error (the joints are already ordered by island in the per-island mode)
+    if (!mIsPerIslandSolverEnabled) {
+        mConstraintSolverSystem.orderJointsByIsland();
+    }
+    mConstraintSolverSystem.findPositionErrorIslands();
+
+    if (mIsPerIslandSolverEnabled) {
+
+        // For each island
+        const uint32 nbIslands = mIslands.getNbIslands();
+        for (uint32 island=0; island < nbIslands; island++) {
+
+            // Only the islands with a joint position error need to be corrected
+            if (!mConstraintSolverSystem.hasIslandPositionError(island)) continue;
 
-        // Solve the position constraints
-        mConstraintSolverSystem.solvePositionConstraints();
+            const uint32 nbMaxIterations = computeIslandNbIterations(island, mNbPositionSolverIterations);
+
+            // For each iteration of the position (error correction) solver
+            uint32 nbIterations = 0;
+            while (nbIterations < nbMaxIterations) {
+
+                // Solve the position constraints of the island
+                mConstraintSolverSystem.solvePositionConstraints(island);
+
+                nbIterations++;
+
+                // Stop iterating on this island if the solver has converged
+                if (mConstraintSolverSystem.getMaxImpulseChange() < mPositionSolverTolerance) break;
+            }
+
+            mSolverStatistics.nbPositionIterations += nbIterations;
+            mSolverStatistics.maxNbPositionIterations = std::max(mSolverStatistics.maxNbPositionIterations, nbIterations);
+        }
     }
+    else {
+
+        // For each iteration of the position (error correction) solver
+        uint32 nbIterations = 0;
+        while (nbIterations < mNbPositionSolverIterations) {
+
+            // Solve the position constraints
+            mConstraintSolverSystem.solvePositionConstraints();
+
+            nbIterations++;
+
+            // Stop iterating if the solver has converged
+            if (mConstraintSolverSystem.getMaxImpulseChange() < mPositionSolverTolerance) break;
+        }
+
+        mSolverStatistics.nbPositionIterations += nbIterations;
+        mSolverStatistics.maxNbPositionIterations = std::max(mSolverStatistics.maxNbPositionIterations, nbIterations);
+    }
+}
+
+// Return true if the last iteration of the velocity solver has converged
+/// The solver has converged when the largest impulse change applied to a joint or a
+/// contact during the last iteration is smaller than the velocity solver tolerance
+bool PhysicsWorld::hasVelocitySolverConverged() const {
+
+    return mConstraintSolverSystem.getMaxImpulseChange() < mVelocitySolverTolerance &&
+           mContactSolverSystem.getMaxImpulseChange() < mVelocitySolverTolerance;
+}
+
+// Return the number of solver iterations of an island given the number of iterations of the world
+/// The number of iterations is scaled by the largest solver priority of the dynamic bodies of
+/// the island. An island with a non-zero number of iterations is always solved at least once.
+uint32 PhysicsWorld::computeIslandNbIterations(uint32 islandIndex, uint32 nbIterations) const {
+
+    const decimal solverPriority = mIslands.solverPriorities[islandIndex];
+    if (solverPriority >= decimal(1.0) || nbIterations == 0) return nbIterations;
+
+    const uint32 nbIslandIterations = static_cast<uint32>(std::ceil(solverPriority * nbIterations));
+    return std::max(nbIslandIterations, uint32(1));
 }
 
 // Enable or disable the joints
@@ -434,7 +580,7 @@ void PhysicsWorld::enableDisableJoints() {
 
     const uint32 nbJointComponents = mJointsComponents.getNbComponents();
 
-    Array<Entity> jointsEntites(mMemoryManager.getHeapAllocator(), nbJointComponents);
+    Array<Entity> jointsEntites(mMemoryManager.getSingleFrameAllocator(), nbJointComponents);
 
     // Get all the joints entities
     for (uint32 i = 0; i < nbJointComponents; i++) {
@@ -647,7 +793,8 @@ Joint* PhysicsWorld::createJoint(const JointInfo& jointInfo) {
     }
 
     JointComponents::JointComponent jointComponent(jointInfo.body1->getEntity(), jointInfo.body2->getEntity(), newJoint, jointInfo.type,
-                                                   jointInfo.positionCorrectionTechnique, jointInfo.isCollisionEnabled);
+                                                   jointInfo.positionCorrectionTechnique, jointInfo.isCollisionEnabled,
+                                                   jointInfo.isArticulated);
     mJointsComponents.addComponent(entity, isJointDisabled, jointComponent);
 
     // If the collision between the two bodies of the constraint is disabled
@@ -834,6 +981,12 @@ void PhysicsWorld::createIslands() {
                 continue;
             }
 
+            // The solver iterations of the island depend on the largest priority of its dynamic bodies
+            if (mRigidBodyComponents.mBodyTypes[bodyToVisitIndex] == BodyType::DYNAMIC) {
+                mIslands.solverPriorities[islandIndex] = std::max(mIslands.solverPriorities[islandIndex],
+                                                                  mRigidBodyComponents.mSolverPriorities[bodyToVisitIndex]);
+            }
+
             // If the body is involved in contacts with other bodies
             // For each contact pair in which the current body is involded
             const uint32 nbBodyContactPairs = static_cast<uint32>(mRigidBodyComponents.mContactPairs[bodyToVisitIndex].size());
@@ -887,6 +1040,7 @@ void PhysicsWorld::createIslands() {
 
                 // Add the joint into the island
                 mJointsComponents.mIsAlreadyInIsland[jointComponentIndex] = true;
+                mIslands.addJointToIsland(joints[i]);
 
                 const Entity body1Entity = mJointsComponents.mBody1Entities[jointComponentIndex];
                 const Entity body2Entity = mJointsComponents.mBody2Entities[jointComponentIndex];
@@ -1007,6 +1161,21 @@ void PhysicsWorld::enableSleeping(bool isSleepingEnabled) {
              "Physics World: isSleepingEnabled=" + (isSleepingEnabled ? std::string("true") : std::string("false")) ,  __FILE__, __LINE__);
 }
 
+// Enable/Disable the solving of the velocity constraints island by island
+/// In this mode, all the velocity iterations of an island are done before moving to the next
+/// island. The joints and contacts of an island only involve the bodies of that island which
+/// improves the cache reuse of the body velocities in large worlds with many islands.
+/**
+ * @param isPerIslandSolverEnabled True if you want to solve the constraints island by island
+ *                                 and false otherwise
+ */
+void PhysicsWorld::enablePerIslandSolver(bool isPerIslandSolverEnabled) {
+    mIsPerIslandSolverEnabled = isPerIslandSolverEnabled;
+
+    RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::World,
+             "Physics World: isPerIslandSolverEnabled=" + (isPerIslandSolverEnabled ? std::string("true") : std::string("false")) ,  __FILE__, __LINE__);
+}
+
 // Set the number of iterations for the position constraint solver
 /**
  * @param nbIterations Number of iterations for the position solver
@@ -1019,6 +1188,116 @@ void PhysicsWorld::setNbIterationsPositionSolver(uint32 nbIterations) {
              "Physics World: Set nb iterations position solver to " + std::to_string(nbIterations),  __FILE__, __LINE__);
 }
 
+// Set the number of sub-steps of each call to update()
+/// With more than one sub-step, the time step is divided into sub-steps. For each sub-step, the velocities
+/// are integrated, the constraints are solved and the positions are integrated while the contacts
+/// computed by the collision detection at the beginning of the step are reused. A few sub-steps with a
+/// single velocity solver iteration are often more stable for tall stacks and long chains of joints
+/// than a single step with many iterations.
+/**
+ * @param nbSubsteps Number of sub-steps (at least one)
+ */
+void PhysicsWorld::setNbSubsteps(uint16 nbSubsteps) {
+
+    assert(nbSubsteps > 0);
+
+    mNbSubsteps = nbSubsteps;
+
+    RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::World,
+             "Physics World: Set nb sub-steps to " + std::to_string(nbSubsteps),  __FILE__, __LINE__);
+}
+
+// Set the maximum number of bodies of an island to solve its joints with the direct solver
+/// The joints of an island with at most this number of bodies (a vehicle, a machine, ...) are solved
+/// exactly at each velocity solver iteration with a sparse LDL^T factorization of the joints of the
+/// island instead of the iterative solver. The factorization is computed once per step and its
+/// structure is reused while the joints of the island do not change. The contacts, the limits and the
+/// motors of the joints are still solved by the iterative solver. This is useful for the islands with
+/// a few bodies but many joints (possibly forming loops) where the iterative solver converges slowly.
+/**
+ * @param maxNbBodies Maximum number of bodies of an island solved by the direct solver (zero to disable it)
+ */
+void PhysicsWorld::setDirectJointSolverMaxNbBodies(uint32 maxNbBodies) {
+
+    mConstraintSolverSystem.setDirectSolverMaxNbBodies(maxNbBodies);
+
+    RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::World,
+             "Physics World: Set direct joint solver max nb bodies to " + std::to_string(maxNbBodies),  __FILE__, __LINE__);
+}
+
+// Set the impulse change tolerance used to stop the velocity solver iterations
+/// The velocity solver stops iterating (on an island in the per-island mode) as soon as
+/// the largest impulse change of an iteration is smaller than this tolerance. Use zero
+/// to always run all the iterations.
+/**
+ * @param tolerance The impulse change tolerance (in Newtons * seconds)
+ */
+void PhysicsWorld::setVelocitySolverTolerance(decimal tolerance) {
+
+    assert(tolerance >= decimal(0.0));
+
+    mVelocitySolverTolerance = tolerance;
+
+    RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::World,
+             "Physics World: Set velocity solver tolerance to " + std::to_string(tolerance),  __FILE__, __LINE__);
+}
+
+// Set the position impulse tolerance used to stop the position solver iterations
+/// The position solver stops iterating (on an island in the per-island mode) as soon as
+/// the largest position impulse of an iteration is smaller than this tolerance. Use zero
+/// to always run all the iterations.
+/**
+ * @param tolerance The position impulse tolerance
+ */
+void PhysicsWorld::setPositionSolverTolerance(decimal tolerance) {
+
+    assert(tolerance >= decimal(0.0));
+
+    mPositionSolverTolerance = tolerance;
+
+    RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::World,
+             "Physics World: Set position solver tolerance to " + std::to_string(tolerance),  __FILE__, __LINE__);
+}
+
+// Set the distance under which separated colliders generate speculative contacts
+/// When two colliders are separated by less than this distance, the narrow-phase already creates
+/// contact points between them with a negative penetration depth (the separation). The contact
+/// solver lets the bodies close this gap during the step but prevents them from moving closer.
+/// Such speculative contacts stop impacts within a single step and stabilize the stacks with less
+/// iterations. The contacts of such pairs are reported to the event listener (with a negative
+/// penetration depth) but triggers are not affected. Note that the margin should be smaller than the
+/// inflation of the fat AABBs of the broad-phase (DYNAMIC_TREE_FAT_AABB_INFLATE_PERCENTAGE of the size of
+/// the colliders). Otherwise, some speculative contacts are only found once the fat AABBs overlap.
+/**
+ * @param contactMargin The contact margin (in meters, zero to disable the speculative contacts)
+ */
+void PhysicsWorld::setContactMargin(decimal contactMargin) {
+
+    assert(contactMargin >= decimal(0.0));
+
+    mConfig.contactMargin = contactMargin;
+
+    RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::World,
+             "Physics World: Set contact margin to " + std::to_string(contactMargin),  __FILE__, __LINE__);
+}
+
+// Set the number of edge pairs from which the convex polyhedra collide with GJK/EPA instead of SAT
+/// The cost of the SAT algorithm between two convex polyhedra grows with the product of their numbers
+/// of edges because every pair of edges is a candidate separating axis. For two polyhedra with at least
+/// this number of edge pairs, the penetration is computed with the GJK and EPA algorithms (that only
+/// need the support points of the shapes) and the contact manifold is built by clipping the faces
+/// of the polyhedra along the EPA normal. The SAT algorithm is still used if EPA fails.
+/**
+ * @param minNbEdgePairs The minimal number of edge pairs (zero to always use the SAT algorithm)
+ */
+void PhysicsWorld::setConvexPolyhedronEPAMinNbEdgePairs(uint32 minNbEdgePairs) {
+
+    mConfig.convexPolyhedronEPAMinNbEdgePairs = minNbEdgePairs;
+
+    RP3D_LOG(mConfig.worldName, Logger::Level::Information, Logger::Category::World,
+             "Physics World: Set convex polyhedron EPA min number of edge pairs to " + std::to_string(minNbEdgePairs),  __FILE__, __LINE__);
+}
+
 // Set the gravity vector of the world
 /**
  * @param gravity The gravity vector (in meter per seconds squared)
@@ -40,6 +40,7 @@ HeapAllocator::HeapAllocator(MemoryAllocator& baseAllocator, size_t initAllocate
 
 #ifndef NDEBUG
         mNbTimesAllocateMethodCalled = 0;
+        mNbTotalAllocations = 0;
 #endif
 
     reserve(initAllocatedMemory == 0 ? INIT_ALLOCATED_SIZE : initAllocatedMemory);
@@ -119,6 +120,7 @@ void* HeapAllocator::allocate(size_t size) {
 
 #ifndef NDEBUG
         mNbTimesAllocateMethodCalled++;
+        mNbTotalAllocations++;
 #endif
 
     MemoryUnitHeader* currentUnit = mMemoryUnits;
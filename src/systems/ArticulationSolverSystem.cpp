@@ -0,0 +1,1303 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+// Libraries
+#include <reactphysics3d/systems/ArticulationSolverSystem.h>
+#include <reactphysics3d/engine/Islands.h>
+#include <cmath>
+#include <limits>
+
+using namespace reactphysics3d;
+
+// Static variables definition
+const uint32 ArticulationSolverSystem::INVALID_INDEX = std::numeric_limits<uint32>::max();
+
+// Constructor
+ArticulationSolverSystem::ArticulationSolverSystem(MemoryAllocator& allocator, Islands& islands, RigidBodyComponents& rigidBodyComponents,
+                                                   JointComponents& jointComponents,
+                                                   BallAndSocketJointComponents& ballAndSocketJointComponents,
+                                                   FixedJointComponents& fixedJointComponents,
+                                                   HingeJointComponents& hingeJointComponents,
+                                                   SliderJointComponents& sliderJointComponents)
+              :mAllocator(allocator), mIslands(islands), mRigidBodyComponents(rigidBodyComponents), mJointComponents(jointComponents),
+               mBallAndSocketJointComponents(ballAndSocketJointComponents), mFixedJointComponents(fixedJointComponents),
+               mHingeJointComponents(hingeJointComponents), mSliderJointComponents(sliderJointComponents),
+               mJoints(allocator), mNodes(allocator), mIslandsStartNodeIndex(allocator), mBodiesIndices(allocator),
+               mBodies(allocator), mBodiesNodeIndices(allocator), mBodiesJointsStartIndex(allocator), mBodiesJoints(allocator),
+               mBodiesToVisit(allocator), mDirectIslands(allocator), mIslandsDirectIsland(allocator), mColumnBlocks(allocator),
+               mSymbolicMatrix(allocator), mDirectSolverMaxNbBodies(0), mHasArticulations(false), mMaxImpulseChangeSquare(0) {
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+    mProfiler = nullptr;
+
+#endif
+
+}
+
+// Destructor
+ArticulationSolverSystem::~ArticulationSolverSystem() {
+
+    // Destroy the factorizations of the direct islands
+    for (auto it = mDirectIslands.begin(); it != mDirectIslands.end(); ++it) {
+        destroyDirectIsland(it->second);
+    }
+}
+
+// Build and factorize the articulation trees of the islands
+/// This must be called after the joint solvers have been initialized for the current step
+void ArticulationSolverSystem::initBeforeSolve() {
+
+    RP3D_PROFILE("ArticulationSolverSystem::initBeforeSolve()", mProfiler);
+
+    mJoints.clear();
+    mNodes.clear();
+    mIslandsStartNodeIndex.clear();
+    mIslandsDirectIsland.clear();
+    mHasArticulations = false;
+
+    // By default, the joints are solved by the iterative solvers
+    bool hasArticulatedJoints = false;
+    const uint32 nbJoints = mJointComponents.getNbEnabledComponents();
+    for (uint32 i=0; i < nbJoints; i++) {
+        mJointComponents.mIsSolvedDirectly[i] = false;
+        hasArticulatedJoints |= mJointComponents.mIsArticulated[i];
+    }
+
+    const bool isDirectSolverEnabled = mDirectSolverMaxNbBodies > 0 && nbJoints > 0;
+    if (!hasArticulatedJoints && !isDirectSolverEnabled) return;
+
+    // Make sure that each rigid body component has an entry in the bodies indices array
+    const uint32 nbBodyComponents = mRigidBodyComponents.getNbComponents();
+    mBodiesIndices.reserve(nbBodyComponents);
+    while (mBodiesIndices.size() < nbBodyComponents) {
+        mBodiesIndices.add(INVALID_INDEX);
+    }
+
+    for (auto it = mDirectIslands.begin(); it != mDirectIslands.end(); ++it) {
+        it->second->isUsed = false;
+    }
+
+    // Build the direct islands and the articulation trees island by island
+    bool hasDirectIslands = false;
+    const uint32 nbIslands = mIslands.getNbIslands();
+    for (uint32 i=0; i < nbIslands; i++) {
+
+        mIslandsStartNodeIndex.add(static_cast<uint32>(mNodes.size()));
+
+        DirectIsland* directIsland = isDirectSolverEnabled ? buildDirectIsland(i) : nullptr;
+        mIslandsDirectIsland.add(directIsland);
+
+        if (directIsland != nullptr) {
+            hasDirectIslands = true;
+        }
+        else if (hasArticulatedJoints) {
+            buildIslandTrees(i);
+        }
+    }
+    mIslandsStartNodeIndex.add(static_cast<uint32>(mNodes.size()));
+
+    // Destroy the factorizations of the islands that do not exist anymore
+    for (auto it = mDirectIslands.begin(); it != mDirectIslands.end(); ) {
+        if (!it->second->isUsed) {
+            destroyDirectIsland(it->second);
+            it = mDirectIslands.remove(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    mHasArticulations = mNodes.size() > 0 || hasDirectIslands;
+
+    // Factorize the articulation matrix of all the trees
+    if (mNodes.size() > 0) {
+        factorize(0, static_cast<uint32>(mNodes.size()));
+    }
+
+    // Factorize the matrices of the direct islands
+    if (hasDirectIslands) {
+        for (uint32 i=0; i < nbIslands; i++) {
+            if (mIslandsDirectIsland[i] != nullptr) {
+                factorizeDirectIsland(*mIslandsDirectIsland[i]);
+            }
+        }
+    }
+}
+
+// Return true if a body can be a node of an articulation tree
+/// Only the dynamic bodies without locked axis and with finite mass and inertia tensor are part of the trees
+bool ArticulationSolverSystem::isArticulationBody(uint32 bodyComponentIndex) const {
+
+    const Vector3& inverseInertiaLocal = mRigidBodyComponents.mInverseInertiaTensorsLocal[bodyComponentIndex];
+
+    return mRigidBodyComponents.mBodyTypes[bodyComponentIndex] == BodyType::DYNAMIC &&
+           mRigidBodyComponents.mInverseMasses[bodyComponentIndex] > decimal(0.0) &&
+           inverseInertiaLocal.x > decimal(0.0) && inverseInertiaLocal.y > decimal(0.0) && inverseInertiaLocal.z > decimal(0.0) &&
+           mRigidBodyComponents.mLinearLockAxisFactors[bodyComponentIndex] == Vector3(1, 1, 1) &&
+           mRigidBodyComponents.mAngularLockAxisFactors[bodyComponentIndex] == Vector3(1, 1, 1);
+}
+
+// Gather the articulated joints of an island and build the trees of the island
+void ArticulationSolverSystem::buildIslandTrees(uint32 islandIndex) {
+
+    const uint32 firstJointIndex = static_cast<uint32>(mJoints.size());
+
+    mBodies.clear();
+
+    // For each joint of the island
+    const uint32 startJointIndex = mIslands.startJointEntitiesIndex[islandIndex];
+    const uint32 endJointIndex = startJointIndex + mIslands.nbJointsInIsland[islandIndex];
+    for (uint32 j=startJointIndex; j < endJointIndex; j++) {
+
+        const Entity jointEntity = mIslands.jointEntities[j];
+
+        // A disabled joint is not initialized for the solver
+        if (mJointComponents.getIsEntityDisabled(jointEntity)) continue;
+
+        const uint32 jointComponentIndex = mJointComponents.getEntityIndex(jointEntity);
+        if (!mJointComponents.mIsArticulated[jointComponentIndex]) continue;
+
+        const uint32 body1ComponentIndex = mRigidBodyComponents.getEntityIndex(mJointComponents.mBody1Entities[jointComponentIndex]);
+        const uint32 body2ComponentIndex = mRigidBodyComponents.getEntityIndex(mJointComponents.mBody2Entities[jointComponentIndex]);
+        const bool isBody1InTree = isArticulationBody(body1ComponentIndex);
+        const bool isBody2InTree = isArticulationBody(body2ComponentIndex);
+
+        // A body of the joint that is not in a tree must be static or kinematic
+        // because the articulation solver does not apply impulses on it
+        if (!isBody1InTree && !isBody2InTree) continue;
+        if (!isBody1InTree && mRigidBodyComponents.mBodyTypes[body1ComponentIndex] == BodyType::DYNAMIC) continue;
+        if (!isBody2InTree && mRigidBodyComponents.mBodyTypes[body2ComponentIndex] == BodyType::DYNAMIC) continue;
+
+        addJoint(jointEntity, jointComponentIndex, body1ComponentIndex, body2ComponentIndex);
+
+        // Add the bodies of the joint into the bodies of the island
+        if (isBody1InTree && mBodiesIndices[body1ComponentIndex] == INVALID_INDEX) {
+            mBodiesIndices[body1ComponentIndex] = static_cast<uint32>(mBodies.size());
+            mBodies.add(body1ComponentIndex);
+        }
+        if (isBody2InTree && mBodiesIndices[body2ComponentIndex] == INVALID_INDEX) {
+            mBodiesIndices[body2ComponentIndex] = static_cast<uint32>(mBodies.size());
+            mBodies.add(body2ComponentIndex);
+        }
+    }
+
+    const uint32 endArticulationJointIndex = static_cast<uint32>(mJoints.size());
+    if (endArticulationJointIndex == firstJointIndex) return;
+
+    // Compute the array of joints of each body
+    const uint32 nbBodies = static_cast<uint32>(mBodies.size());
+    mBodiesNodeIndices.clear();
+    mBodiesJointsStartIndex.clear();
+    mBodiesJoints.clear();
+    for (uint32 b=0; b <= nbBodies; b++) {
+        mBodiesNodeIndices.add(INVALID_INDEX);
+        mBodiesJointsStartIndex.add(0);
+    }
+    for (uint32 j=firstJointIndex; j < endArticulationJointIndex; j++) {
+
+        const uint32 body1Index = mBodiesIndices[mJoints[j].body1ComponentIndex];
+        const uint32 body2Index = mBodiesIndices[mJoints[j].body2ComponentIndex];
+        if (body1Index != INVALID_INDEX) mBodiesJointsStartIndex[body1Index]++;
+        if (body2Index != INVALID_INDEX) mBodiesJointsStartIndex[body2Index]++;
+        mBodiesJoints.add(0);
+        mBodiesJoints.add(0);
+    }
+    for (uint32 b=1; b < nbBodies; b++) {
+        mBodiesJointsStartIndex[b] += mBodiesJointsStartIndex[b - 1];
+    }
+    mBodiesJointsStartIndex[nbBodies] = mBodiesJointsStartIndex[nbBodies - 1];
+    for (uint32 j=endArticulationJointIndex; j > firstJointIndex; j--) {
+
+        const uint32 body1Index = mBodiesIndices[mJoints[j - 1].body1ComponentIndex];
+        const uint32 body2Index = mBodiesIndices[mJoints[j - 1].body2ComponentIndex];
+        if (body1Index != INVALID_INDEX) mBodiesJoints[--mBodiesJointsStartIndex[body1Index]] = j - 1;
+        if (body2Index != INVALID_INDEX) mBodiesJoints[--mBodiesJointsStartIndex[body2Index]] = j - 1;
+    }
+
+    // The joints between a dynamic body and a static or kinematic body are the roots of
+    // the articulations with a fixed base
+    for (uint32 j=firstJointIndex; j < endArticulationJointIndex; j++) {
+
+        const uint32 body1Index = mBodiesIndices[mJoints[j].body1ComponentIndex];
+        const uint32 body2Index = mBodiesIndices[mJoints[j].body2ComponentIndex];
+        if (body1Index != INVALID_INDEX && body2Index != INVALID_INDEX) continue;
+
+        const uint32 bodyIndex = body1Index != INVALID_INDEX ? body1Index : body2Index;
+        if (mBodiesNodeIndices[bodyIndex] != INVALID_INDEX) continue;
+
+        mJoints[j].nodeIndex = addNode(INVALID_INDEX, false, j);
+        mBodiesNodeIndices[bodyIndex] = addNode(mJoints[j].nodeIndex, true, mBodies[bodyIndex]);
+
+        buildTree(bodyIndex);
+    }
+
+    // The remaining bodies are the roots of the floating articulations
+    for (uint32 b=0; b < nbBodies; b++) {
+
+        if (mBodiesNodeIndices[b] != INVALID_INDEX) continue;
+
+        mBodiesNodeIndices[b] = addNode(INVALID_INDEX, true, mBodies[b]);
+
+        buildTree(b);
+    }
+
+    // The joints in the trees are not solved by the iterative solver anymore
+    for (uint32 j=firstJointIndex; j < endArticulationJointIndex; j++) {
+        if (mJoints[j].nodeIndex != INVALID_INDEX) {
+            mJointComponents.mIsSolvedDirectly[mJoints[j].jointComponentIndex] = true;
+        }
+    }
+
+    // Reset the bodies indices for the next island
+    for (uint32 b=0; b < nbBodies; b++) {
+        mBodiesIndices[mBodies[b]] = INVALID_INDEX;
+    }
+}
+
+// Add a joint into the array of joints of the current step
+void ArticulationSolverSystem::addJoint(Entity jointEntity, uint32 jointComponentIndex, uint32 body1ComponentIndex,
+                                        uint32 body2ComponentIndex) {
+
+    ArticulationJoint joint;
+    joint.type = mJointComponents.mTypes[jointComponentIndex];
+    joint.jointComponentIndex = jointComponentIndex;
+    joint.body1ComponentIndex = body1ComponentIndex;
+    joint.body2ComponentIndex = body2ComponentIndex;
+    joint.nodeIndex = INVALID_INDEX;
+
+    switch(joint.type) {
+        case JointType::BALLSOCKETJOINT:
+            joint.componentIndex = mBallAndSocketJointComponents.getEntityIndex(jointEntity);
+            break;
+        case JointType::FIXEDJOINT:
+            joint.componentIndex = mFixedJointComponents.getEntityIndex(jointEntity);
+            break;
+        case JointType::HINGEJOINT:
+            joint.componentIndex = mHingeJointComponents.getEntityIndex(jointEntity);
+            break;
+        case JointType::SLIDERJOINT:
+            joint.componentIndex = mSliderJointComponents.getEntityIndex(jointEntity);
+            break;
+    }
+
+    computeJacobian(joint);
+
+    mJoints.add(joint);
+}
+
+// Add the bodies and joints reachable from a body of the current island into its tree
+/// A joint that links two bodies that are already in the tree (a loop) is left to the iterative solver
+void ArticulationSolverSystem::buildTree(uint32 rootBodyIndex) {
+
+    mBodiesToVisit.clear();
+    mBodiesToVisit.add(rootBodyIndex);
+
+    while (mBodiesToVisit.size() > 0) {
+
+        const uint32 bodyIndex = mBodiesToVisit[mBodiesToVisit.size() - 1];
+        mBodiesToVisit.removeAt(mBodiesToVisit.size() - 1);
+
+        const uint32 bodyNodeIndex = mBodiesNodeIndices[bodyIndex];
+
+        // For each joint of the body
+        for (uint32 k=mBodiesJointsStartIndex[bodyIndex]; k < mBodiesJointsStartIndex[bodyIndex + 1]; k++) {
+
+            const uint32 jointIndex = mBodiesJoints[k];
+            ArticulationJoint& joint = mJoints[jointIndex];
+
+            // If the joint is already in the tree
+            if (joint.nodeIndex != INVALID_INDEX) continue;
+
+            const uint32 body1Index = mBodiesIndices[joint.body1ComponentIndex];
+            const uint32 body2Index = mBodiesIndices[joint.body2ComponentIndex];
+            const uint32 otherBodyIndex = body1Index == bodyIndex ? body2Index : body1Index;
+
+            // If the joint closes a loop
+            if (otherBodyIndex == INVALID_INDEX || mBodiesNodeIndices[otherBodyIndex] != INVALID_INDEX) continue;
+
+            joint.nodeIndex = addNode(bodyNodeIndex, false, jointIndex);
+            mBodiesNodeIndices[otherBodyIndex] = addNode(joint.nodeIndex, true, mBodies[otherBodyIndex]);
+
+            mBodiesToVisit.add(otherBodyIndex);
+        }
+    }
+}
+
+// Add a node into a tree and return its index
+uint32 ArticulationSolverSystem::addNode(uint32 parentIndex, bool isBody, uint32 index) {
+
+    ArticulationNode node;
+    node.parentIndex = parentIndex;
+    node.isBody = isBody;
+    node.index = index;
+    node.nbRows = isBody ? 6 : mJoints[index].nbRows;
+
+    const uint32 n = node.nbRows;
+
+    for (uint32 i=0; i < 36; i++) {
+        node.diagonalBlock[i] = decimal(0.0);
+    }
+
+    if (isBody) {
+
+        // The diagonal block of a body is its mass matrix
+        const decimal mass = decimal(1.0) / mRigidBodyComponents.mInverseMasses[index];
+        const Matrix3x3 inertiaTensorWorld = mRigidBodyComponents.mInverseInertiaTensorsWorld[index].getInverse();
+        for (uint32 i=0; i < 3; i++) {
+            node.diagonalBlock[i * 6 + i] = mass;
+            for (uint32 j=0; j < 3; j++) {
+                node.diagonalBlock[(i + 3) * 6 + j + 3] = inertiaTensorWorld[i][j];
+            }
+        }
+
+        // The block with the parent joint is the transpose of the Jacobian of the joint for this body
+        if (parentIndex != INVALID_INDEX) {
+            const ArticulationJoint& joint = mJoints[mNodes[parentIndex].index];
+            const decimal* jacobian = joint.body1ComponentIndex == index ? joint.jacobianBody1 : joint.jacobianBody2;
+            const uint32 m = joint.nbRows;
+            for (uint32 r=0; r < 6; r++) {
+                for (uint32 c=0; c < m; c++) {
+                    node.parentBlock[r * m + c] = jacobian[c * 6 + r];
+                }
+            }
+        }
+    }
+    else if (parentIndex != INVALID_INDEX) {
+
+        // The block with the parent body is the Jacobian of the joint for this body
+        const ArticulationJoint& joint = mJoints[index];
+        const decimal* jacobian = joint.body1ComponentIndex == mNodes[parentIndex].index ? joint.jacobianBody1 : joint.jacobianBody2;
+        for (uint32 i=0; i < n * 6; i++) {
+            node.parentBlock[i] = jacobian[i];
+        }
+    }
+
+    mNodes.add(node);
+
+    return static_cast<uint32>(mNodes.size() - 1);
+}
+
+// Set a row of the Jacobian of an articulated joint
+void ArticulationSolverSystem::setJacobianRow(ArticulationJoint& joint, uint32 row, const Vector3& linearBody1,
+                                              const Vector3& angularBody1, const Vector3& linearBody2,
+                                              const Vector3& angularBody2) {
+
+    for (int i=0; i < 3; i++) {
+        joint.jacobianBody1[row * 6 + i] = linearBody1[i];
+        joint.jacobianBody1[row * 6 + i + 3] = angularBody1[i];
+        joint.jacobianBody2[row * 6 + i] = linearBody2[i];
+        joint.jacobianBody2[row * 6 + i + 3] = angularBody2[i];
+    }
+}
+
+// Compute the Jacobian and bias of the equality constraints of an articulated joint
+/// The rows of the Jacobian are the same as the ones used by the iterative solver of the joint
+/// so that the impulses of both solvers can be accumulated together
+void ArticulationSolverSystem::computeJacobian(ArticulationJoint& joint) const {
+
+    const uint32 i = joint.componentIndex;
+    const Vector3 zero(0, 0, 0);
+    const Vector3 axis[3] = {Vector3(1, 0, 0), Vector3(0, 1, 0), Vector3(0, 0, 1)};
+
+    switch(joint.type) {
+
+        case JointType::BALLSOCKETJOINT:
+        {
+            // Three translation constraints
+            const Matrix3x3 skewR1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mBallAndSocketJointComponents.mR1World[i]);
+            const Matrix3x3 skewR2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mBallAndSocketJointComponents.mR2World[i]);
+            joint.nbRows = 3;
+            for (uint32 k=0; k < 3; k++) {
+                setJacobianRow(joint, k, -axis[k], skewR1[k], axis[k], -skewR2[k]);
+                joint.bias[k] = mBallAndSocketJointComponents.mBiasVector[i][k];
+            }
+            break;
+        }
+        case JointType::FIXEDJOINT:
+        {
+            // Three translation and three rotation constraints
+            const Matrix3x3 skewR1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mFixedJointComponents.mR1World[i]);
+            const Matrix3x3 skewR2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mFixedJointComponents.mR2World[i]);
+            joint.nbRows = 6;
+            for (uint32 k=0; k < 3; k++) {
+                setJacobianRow(joint, k, -axis[k], skewR1[k], axis[k], -skewR2[k]);
+                setJacobianRow(joint, k + 3, zero, -axis[k], zero, axis[k]);
+                joint.bias[k] = mFixedJointComponents.mBiasTranslation[i][k];
+                joint.bias[k + 3] = mFixedJointComponents.mBiasRotation[i][k];
+            }
+            break;
+        }
+        case JointType::HINGEJOINT:
+        {
+            // Three translation and two rotation constraints
+            const Matrix3x3 skewR1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mHingeJointComponents.mR1World[i]);
+            const Matrix3x3 skewR2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mHingeJointComponents.mR2World[i]);
+            const Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[i];
+            const Vector3& c2CrossA1 = mHingeJointComponents.mC2CrossA1[i];
+            joint.nbRows = 5;
+            for (uint32 k=0; k < 3; k++) {
+                setJacobianRow(joint, k, -axis[k], skewR1[k], axis[k], -skewR2[k]);
+                joint.bias[k] = mHingeJointComponents.mBiasTranslation[i][k];
+            }
+            setJacobianRow(joint, 3, zero, -b2CrossA1, zero, b2CrossA1);
+            setJacobianRow(joint, 4, zero, -c2CrossA1, zero, c2CrossA1);
+            joint.bias[3] = mHingeJointComponents.mBiasRotation[i].x;
+            joint.bias[4] = mHingeJointComponents.mBiasRotation[i].y;
+            break;
+        }
+        case JointType::SLIDERJOINT:
+        {
+            // Two translation and three rotation constraints
+            const Vector3& n1 = mSliderJointComponents.mN1[i];
+            const Vector3& n2 = mSliderJointComponents.mN2[i];
+            joint.nbRows = 5;
+            setJacobianRow(joint, 0, -n1, -mSliderJointComponents.mR1PlusUCrossN1[i], n1, mSliderJointComponents.mR2CrossN1[i]);
+            setJacobianRow(joint, 1, -n2, -mSliderJointComponents.mR1PlusUCrossN2[i], n2, mSliderJointComponents.mR2CrossN2[i]);
+            joint.bias[0] = mSliderJointComponents.mBiasTranslation[i].x;
+            joint.bias[1] = mSliderJointComponents.mBiasTranslation[i].y;
+            for (uint32 k=0; k < 3; k++) {
+                setJacobianRow(joint, k + 2, zero, -axis[k], zero, axis[k]);
+                joint.bias[k + 2] = mSliderJointComponents.mBiasRotation[i][k];
+            }
+            break;
+        }
+    }
+}
+
+// Compute the velocity error -(J * v + b) of the constraints of a joint
+void ArticulationSolverSystem::computeVelocityError(const ArticulationJoint& joint, decimal* error) const {
+
+    const Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[joint.body1ComponentIndex];
+    const Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[joint.body1ComponentIndex];
+    const Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[joint.body2ComponentIndex];
+    const Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[joint.body2ComponentIndex];
+
+    for (uint32 r=0; r < joint.nbRows; r++) {
+
+        const decimal* j1 = joint.jacobianBody1 + r * 6;
+        const decimal* j2 = joint.jacobianBody2 + r * 6;
+        const decimal Jv = j1[0] * v1.x + j1[1] * v1.y + j1[2] * v1.z + j1[3] * w1.x + j1[4] * w1.y + j1[5] * w1.z +
+                           j2[0] * v2.x + j2[1] * v2.y + j2[2] * v2.z + j2[3] * w2.x + j2[4] * w2.y + j2[5] * w2.z;
+        error[r] = -Jv - joint.bias[r];
+    }
+}
+
+// Factorize the articulation matrix of the nodes in a given range
+/// The articulation matrix H = [M J^T; J 0] has the sparsity of the tree. It is factorized
+/// from the leaves to the root with H = L * D * L^T where L only has a block between each node
+/// and its parent
+void ArticulationSolverSystem::factorize(uint32 startNodeIndex, uint32 endNodeIndex) {
+
+    RP3D_PROFILE("ArticulationSolverSystem::factorize()", mProfiler);
+
+    // For each node (the children before their parent)
+    for (uint32 i=endNodeIndex; i > startNodeIndex; i--) {
+
+        ArticulationNode& node = mNodes[i - 1];
+        const uint32 n = node.nbRows;
+
+        // All the children of the node have already been eliminated from its diagonal block
+        computeSymmetricInverse(node.diagonalBlock, n, node.inverseDiagonalBlock);
+
+        if (node.parentIndex == INVALID_INDEX) continue;
+
+        ArticulationNode& parent = mNodes[node.parentIndex];
+        const uint32 m = parent.nbRows;
+
+        // Compute the link block L = D^-1 * H_ip (n x m)
+        for (uint32 r=0; r < n; r++) {
+            for (uint32 c=0; c < m; c++) {
+                decimal sum = decimal(0.0);
+                for (uint32 k=0; k < n; k++) {
+                    sum += node.inverseDiagonalBlock[r * n + k] * node.parentBlock[k * m + c];
+                }
+                node.linkBlock[r * m + c] = sum;
+            }
+        }
+
+        // Eliminate the node from the diagonal block of its parent: D_p = D_p - H_ip^T * L (m x m)
+        for (uint32 r=0; r < m; r++) {
+            for (uint32 c=0; c < m; c++) {
+                decimal sum = decimal(0.0);
+                for (uint32 k=0; k < n; k++) {
+                    sum += node.parentBlock[k * m + r] * node.linkBlock[k * m + c];
+                }
+                parent.diagonalBlock[r * m + c] -= sum;
+            }
+        }
+    }
+}
+
+// Solve the articulations of all the islands
+void ArticulationSolverSystem::solveVelocityConstraint() {
+
+    if (!mHasArticulations) return;
+
+    if (mNodes.size() > 0) {
+        solve(0, static_cast<uint32>(mNodes.size()));
+    }
+
+    // Solve the direct islands
+    for (uint32 i=0; i < mIslandsDirectIsland.size(); i++) {
+        if (mIslandsDirectIsland[i] != nullptr) {
+            solveDirectIsland(*mIslandsDirectIsland[i]);
+        }
+    }
+}
+
+// Solve the articulations of a given island
+void ArticulationSolverSystem::solveVelocityConstraint(uint32 islandIndex) {
+
+    if (!mHasArticulations) return;
+
+    if (mIslandsDirectIsland[islandIndex] != nullptr) {
+        solveDirectIsland(*mIslandsDirectIsland[islandIndex]);
+        return;
+    }
+
+    const uint32 startNodeIndex = mIslandsStartNodeIndex[islandIndex];
+    const uint32 endNodeIndex = mIslandsStartNodeIndex[islandIndex + 1];
+    if (startNodeIndex < endNodeIndex) {
+        solve(startNodeIndex, endNodeIndex);
+    }
+}
+
+// Solve the articulations of the nodes in a given range
+/// We solve H * [deltaV; -lambda] = [0; -Jv - b] for the velocity changes deltaV of the bodies
+/// and the impulses lambda of the joints with the factorization of H
+void ArticulationSolverSystem::solve(uint32 startNodeIndex, uint32 endNodeIndex) {
+
+    RP3D_PROFILE("ArticulationSolverSystem::solve()", mProfiler);
+
+    // Compute the right-hand side
+    for (uint32 i=startNodeIndex; i < endNodeIndex; i++) {
+
+        ArticulationNode& node = mNodes[i];
+
+        if (node.isBody) {
+            for (uint32 r=0; r < 6; r++) {
+                node.x[r] = decimal(0.0);
+            }
+        }
+        else {
+
+            computeVelocityError(mJoints[node.index], node.x);
+        }
+    }
+
+    // Forward substitution (from the leaves to the root)
+    for (uint32 i=endNodeIndex; i > startNodeIndex; i--) {
+
+        const ArticulationNode& node = mNodes[i - 1];
+        if (node.parentIndex == INVALID_INDEX) continue;
+
+        ArticulationNode& parent = mNodes[node.parentIndex];
+        const uint32 n = node.nbRows;
+        const uint32 m = parent.nbRows;
+        for (uint32 r=0; r < m; r++) {
+            decimal sum = decimal(0.0);
+            for (uint32 k=0; k < n; k++) {
+                sum += node.linkBlock[k * m + r] * node.x[k];
+            }
+            parent.x[r] -= sum;
+        }
+    }
+
+    // Multiplication by the inverse of the diagonal blocks
+    for (uint32 i=startNodeIndex; i < endNodeIndex; i++) {
+
+        ArticulationNode& node = mNodes[i];
+        const uint32 n = node.nbRows;
+
+        decimal x[6];
+        for (uint32 r=0; r < n; r++) {
+            x[r] = decimal(0.0);
+            for (uint32 k=0; k < n; k++) {
+                x[r] += node.inverseDiagonalBlock[r * n + k] * node.x[k];
+            }
+        }
+        for (uint32 r=0; r < n; r++) {
+            node.x[r] = x[r];
+        }
+    }
+
+    // Backward substitution (from the root to the leaves)
+    for (uint32 i=startNodeIndex; i < endNodeIndex; i++) {
+
+        ArticulationNode& node = mNodes[i];
+        if (node.parentIndex == INVALID_INDEX) continue;
+
+        const ArticulationNode& parent = mNodes[node.parentIndex];
+        const uint32 n = node.nbRows;
+        const uint32 m = parent.nbRows;
+        for (uint32 r=0; r < n; r++) {
+            decimal sum = decimal(0.0);
+            for (uint32 c=0; c < m; c++) {
+                sum += node.linkBlock[r * m + c] * parent.x[c];
+            }
+            node.x[r] -= sum;
+        }
+    }
+
+    // Apply the velocity changes to the bodies and accumulate the impulses of the joints
+    for (uint32 i=startNodeIndex; i < endNodeIndex; i++) {
+
+        const ArticulationNode& node = mNodes[i];
+
+        if (node.isBody) {
+            mRigidBodyComponents.mConstrainedLinearVelocities[node.index] += Vector3(node.x[0], node.x[1], node.x[2]);
+            mRigidBodyComponents.mConstrainedAngularVelocities[node.index] += Vector3(node.x[3], node.x[4], node.x[5]);
+        }
+        else {
+
+            decimal lambda[6];
+            decimal lambdaSquare = decimal(0.0);
+            for (uint32 r=0; r < node.nbRows; r++) {
+                lambda[r] = -node.x[r];
+                lambdaSquare += lambda[r] * lambda[r];
+            }
+
+            applyJointImpulse(mJoints[node.index], lambda);
+
+            mMaxImpulseChangeSquare = std::max(mMaxImpulseChangeSquare, lambdaSquare);
+        }
+    }
+}
+
+// Apply an impulse (the Lagrange multipliers of the constraints) on a joint
+/// The velocities of the bodies have already been changed by the solver. We only need to
+/// accumulate the impulse for the warm starting and the reaction force and torque of the joint.
+void ArticulationSolverSystem::applyJointImpulse(const ArticulationJoint& joint, const decimal* lambda) {
+
+    const uint32 i = joint.componentIndex;
+
+    switch(joint.type) {
+
+        case JointType::BALLSOCKETJOINT:
+            mBallAndSocketJointComponents.mImpulse[i] += Vector3(lambda[0], lambda[1], lambda[2]);
+            break;
+        case JointType::FIXEDJOINT:
+            mFixedJointComponents.mImpulseTranslation[i] += Vector3(lambda[0], lambda[1], lambda[2]);
+            mFixedJointComponents.mImpulseRotation[i] += Vector3(lambda[3], lambda[4], lambda[5]);
+            break;
+        case JointType::HINGEJOINT:
+            mHingeJointComponents.mImpulseTranslation[i] += Vector3(lambda[0], lambda[1], lambda[2]);
+            mHingeJointComponents.mImpulseRotation[i] += Vector2(lambda[3], lambda[4]);
+            break;
+        case JointType::SLIDERJOINT:
+            mSliderJointComponents.mImpulseTranslation[i] += Vector2(lambda[0], lambda[1]);
+            mSliderJointComponents.mImpulseRotation[i] += Vector3(lambda[2], lambda[3], lambda[4]);
+            break;
+    }
+}
+
+// Gather the joints of an island and return its direct island if it can be solved by the direct solver
+/// All the joints of an island are solved by the direct solver if the island has at most the maximum number
+/// of bodies of the direct solver and if all the dynamic bodies of its joints have a finite mass and inertia
+/// tensor without locked axis. The symbolic factorization of the island is only recomputed if its joints
+/// have changed since the previous step.
+ArticulationSolverSystem::DirectIsland* ArticulationSolverSystem::buildDirectIsland(uint32 islandIndex) {
+
+    if (mIslands.nbBodiesInIsland[islandIndex] > mDirectSolverMaxNbBodies) return nullptr;
+
+    const uint32 startJointIndex = mIslands.startJointEntitiesIndex[islandIndex];
+    const uint32 endJointIndex = startJointIndex + mIslands.nbJointsInIsland[islandIndex];
+
+    // Check that all the joints of the island can be solved by the direct solver
+    uint32 firstJointIndex = INVALID_INDEX;
+    for (uint32 j=startJointIndex; j < endJointIndex; j++) {
+
+        const Entity jointEntity = mIslands.jointEntities[j];
+
+        // A disabled joint is not initialized for the solver
+        if (mJointComponents.getIsEntityDisabled(jointEntity)) continue;
+
+        const uint32 jointComponentIndex = mJointComponents.getEntityIndex(jointEntity);
+        const uint32 body1ComponentIndex = mRigidBodyComponents.getEntityIndex(mJointComponents.mBody1Entities[jointComponentIndex]);
+        const uint32 body2ComponentIndex = mRigidBodyComponents.getEntityIndex(mJointComponents.mBody2Entities[jointComponentIndex]);
+        const bool isBody1Dynamic = mRigidBodyComponents.mBodyTypes[body1ComponentIndex] == BodyType::DYNAMIC;
+        const bool isBody2Dynamic = mRigidBodyComponents.mBodyTypes[body2ComponentIndex] == BodyType::DYNAMIC;
+
+        if (!isBody1Dynamic && !isBody2Dynamic) return nullptr;
+        if (isBody1Dynamic && !isArticulationBody(body1ComponentIndex)) return nullptr;
+        if (isBody2Dynamic && !isArticulationBody(body2ComponentIndex)) return nullptr;
+
+        if (firstJointIndex == INVALID_INDEX) {
+            firstJointIndex = j;
+        }
+    }
+
+    if (firstJointIndex == INVALID_INDEX) return nullptr;
+
+    // Get the factorization of the island from the previous steps (the first joint of an island is the key)
+    const Entity firstJointEntity = mIslands.jointEntities[firstJointIndex];
+    DirectIsland* island;
+    auto it = mDirectIslands.find(firstJointEntity);
+    if (it != mDirectIslands.end()) {
+        island = it->second;
+    }
+    else {
+        island = new (mAllocator.allocate(sizeof(DirectIsland))) DirectIsland(mAllocator);
+        mDirectIslands.add(Pair<Entity, DirectIsland*>(firstJointEntity, island));
+    }
+
+    island->isUsed = true;
+    island->startJointIndex = static_cast<uint32>(mJoints.size());
+
+    mBodies.clear();
+
+    // Add the joints of the island and check if the topology of the island has changed
+    bool isTopologyUnchanged = true;
+    uint32 nbJoints = 0;
+    for (uint32 j=firstJointIndex; j < endJointIndex; j++) {
+
+        const Entity jointEntity = mIslands.jointEntities[j];
+
+        if (mJointComponents.getIsEntityDisabled(jointEntity)) continue;
+
+        const uint32 jointComponentIndex = mJointComponents.getEntityIndex(jointEntity);
+        const uint32 body1ComponentIndex = mRigidBodyComponents.getEntityIndex(mJointComponents.mBody1Entities[jointComponentIndex]);
+        const uint32 body2ComponentIndex = mRigidBodyComponents.getEntityIndex(mJointComponents.mBody2Entities[jointComponentIndex]);
+
+        addJoint(jointEntity, jointComponentIndex, body1ComponentIndex, body2ComponentIndex);
+
+        mJointComponents.mIsSolvedDirectly[jointComponentIndex] = true;
+
+        // Compute the local indices of the dynamic bodies of the joint
+        uint32 bodiesIndices[2] = {INVALID_INDEX, INVALID_INDEX};
+        const uint32 bodiesComponentIndices[2] = {body1ComponentIndex, body2ComponentIndex};
+        for (uint32 b=0; b < 2; b++) {
+
+            const uint32 bodyComponentIndex = bodiesComponentIndices[b];
+            if (mRigidBodyComponents.mBodyTypes[bodyComponentIndex] != BodyType::DYNAMIC) continue;
+
+            if (mBodiesIndices[bodyComponentIndex] == INVALID_INDEX) {
+                mBodiesIndices[bodyComponentIndex] = static_cast<uint32>(mBodies.size());
+                mBodies.add(bodyComponentIndex);
+            }
+            bodiesIndices[b] = mBodiesIndices[bodyComponentIndex];
+        }
+
+        if (nbJoints < island->jointEntities.size()) {
+
+            isTopologyUnchanged &= island->jointEntities[nbJoints] == jointEntity &&
+                                   island->jointsBodies[2 * nbJoints] == bodiesIndices[0] &&
+                                   island->jointsBodies[2 * nbJoints + 1] == bodiesIndices[1];
+
+            island->jointEntities[nbJoints] = jointEntity;
+            island->jointsBodies[2 * nbJoints] = bodiesIndices[0];
+            island->jointsBodies[2 * nbJoints + 1] = bodiesIndices[1];
+        }
+        else {
+
+            isTopologyUnchanged = false;
+
+            island->jointEntities.add(jointEntity);
+            island->jointsBodies.add(bodiesIndices[0]);
+            island->jointsBodies.add(bodiesIndices[1]);
+        }
+
+        nbJoints++;
+    }
+
+    // Remove the joints that are not in the island anymore
+    isTopologyUnchanged &= nbJoints == island->jointEntities.size();
+    while (island->jointEntities.size() > nbJoints) {
+        island->jointEntities.removeAt(island->jointEntities.size() - 1);
+        island->jointsBodies.removeAt(island->jointsBodies.size() - 1);
+        island->jointsBodies.removeAt(island->jointsBodies.size() - 1);
+    }
+    island->nbJoints = nbJoints;
+
+    if (!isTopologyUnchanged) {
+        computeSymbolicFactorization(*island);
+    }
+
+    // Reset the bodies indices for the next island
+    for (uint32 b=0; b < mBodies.size(); b++) {
+        mBodiesIndices[mBodies[b]] = INVALID_INDEX;
+    }
+
+    return island;
+}
+
+// Compute the elimination order and the sparsity of the factor of a direct island
+/// Two joints are coupled in the matrix A = J * M^-1 * J^T if they share a dynamic body. The joints are
+/// eliminated with the minimum degree heuristic. Eliminating a joint couples all its remaining neighbors
+/// together (the fill-in of the factor) and the neighbors are the rows of its column in the factor.
+void ArticulationSolverSystem::computeSymbolicFactorization(DirectIsland& island) {
+
+    RP3D_PROFILE("ArticulationSolverSystem::computeSymbolicFactorization()", mProfiler);
+
+    const uint32 n = island.nbJoints;
+
+    // Adjacency matrix of the joints followed by the position of each joint in the elimination order
+    mSymbolicMatrix.clear();
+    mSymbolicMatrix.addWithoutInit(n * n + n);
+    uint32* matrix = &(mSymbolicMatrix[0]);
+    uint32* positions = matrix + n * n;
+    for (uint32 i=0; i < n * n; i++) {
+        matrix[i] = 0;
+    }
+    for (uint32 a=0; a < n; a++) {
+        for (uint32 b=0; b < a; b++) {
+            for (uint32 s=0; s < 2; s++) {
+                const uint32 body = island.jointsBodies[2 * a + s];
+                if (body != INVALID_INDEX && (island.jointsBodies[2 * b] == body || island.jointsBodies[2 * b + 1] == body)) {
+                    matrix[a * n + b] = 1;
+                    matrix[b * n + a] = 1;
+                }
+            }
+        }
+    }
+
+    island.eliminationOrder.clear();
+    island.columnsStartIndex.clear();
+    island.rowIndices.clear();
+
+    // Minimum degree ordering (an eliminated joint is marked on the diagonal of the adjacency matrix)
+    for (uint32 k=0; k < n; k++) {
+
+        uint32 joint = INVALID_INDEX;
+        uint32 minDegree = INVALID_INDEX;
+        for (uint32 a=0; a < n; a++) {
+
+            if (matrix[a * n + a] != 0) continue;
+
+            uint32 degree = 0;
+            for (uint32 b=0; b < n; b++) {
+                degree += b != a && matrix[b * n + b] == 0 ? matrix[a * n + b] : 0;
+            }
+            if (degree < minDegree) {
+                minDegree = degree;
+                joint = a;
+            }
+        }
+
+        island.eliminationOrder.add(joint);
+        positions[joint] = k;
+        matrix[joint * n + joint] = 1;
+
+        // The remaining neighbors of the joint are the rows of its column and are coupled together
+        const uint32 columnStartIndex = static_cast<uint32>(island.rowIndices.size());
+        island.columnsStartIndex.add(columnStartIndex);
+        for (uint32 a=0; a < n; a++) {
+            if (matrix[a * n + a] == 0 && matrix[joint * n + a] != 0) {
+                for (uint32 e=columnStartIndex; e < island.rowIndices.size(); e++) {
+                    const uint32 b = island.rowIndices[e];
+                    matrix[a * n + b] = 1;
+                    matrix[b * n + a] = 1;
+                }
+                island.rowIndices.add(a);
+            }
+        }
+    }
+    island.columnsStartIndex.add(static_cast<uint32>(island.rowIndices.size()));
+
+    // Replace the joints by their positions in the elimination order and sort the rows of each column
+    for (uint32 k=0; k < n; k++) {
+        for (uint32 e=island.columnsStartIndex[k]; e < island.columnsStartIndex[k + 1]; e++) {
+            const uint32 row = positions[island.rowIndices[e]];
+            uint32 f = e;
+            for (; f > island.columnsStartIndex[k] && island.rowIndices[f - 1] > row; f--) {
+                island.rowIndices[f] = island.rowIndices[f - 1];
+            }
+            island.rowIndices[f] = row;
+        }
+    }
+
+    // The adjacency matrix now gives the index of the block (i, j) of the factor (with i >= j)
+    for (uint32 i=0; i < n * n; i++) {
+        matrix[i] = INVALID_INDEX;
+    }
+    for (uint32 k=0; k < n; k++) {
+        matrix[k * n + k] = k;
+        for (uint32 e=island.columnsStartIndex[k]; e < island.columnsStartIndex[k + 1]; e++) {
+            matrix[island.rowIndices[e] * n + k] = n + e;
+        }
+    }
+
+    // Compute the blocks updated by each pair of off-diagonal blocks of each column
+    island.updatesStartIndex.clear();
+    island.updateBlocks.clear();
+    for (uint32 k=0; k < n; k++) {
+        island.updatesStartIndex.add(static_cast<uint32>(island.updateBlocks.size()));
+        for (uint32 a=island.columnsStartIndex[k]; a < island.columnsStartIndex[k + 1]; a++) {
+            for (uint32 b=island.columnsStartIndex[k]; b <= a; b++) {
+                assert(matrix[island.rowIndices[a] * n + island.rowIndices[b]] != INVALID_INDEX);
+                island.updateBlocks.add(matrix[island.rowIndices[a] * n + island.rowIndices[b]]);
+            }
+        }
+    }
+    island.updatesStartIndex.add(static_cast<uint32>(island.updateBlocks.size()));
+
+    // Compute the couplings of the joints through their bodies
+    island.assemblyEntries.clear();
+    for (uint32 a=0; a < n; a++) {
+        for (uint32 s=0; s < 2; s++) {
+
+            const uint32 body = island.jointsBodies[2 * a + s];
+            if (body == INVALID_INDEX) continue;
+
+            island.assemblyEntries.add({a, a, body, positions[a]});
+
+            for (uint32 b=0; b < a; b++) {
+                if (island.jointsBodies[2 * b] == body || island.jointsBodies[2 * b + 1] == body) {
+                    const uint32 rowJoint = positions[a] > positions[b] ? a : b;
+                    const uint32 columnJoint = rowJoint == a ? b : a;
+                    island.assemblyEntries.add({rowJoint, columnJoint, body, matrix[positions[rowJoint] * n + positions[columnJoint]]});
+                }
+            }
+        }
+    }
+
+    const uint32 nbBlocks = n + static_cast<uint32>(island.rowIndices.size());
+    island.blocks.clear();
+    island.blocks.addWithoutInit(nbBlocks * 36);
+    island.inverseDiagonalBlocks.clear();
+    island.inverseDiagonalBlocks.addWithoutInit(n * 36);
+    island.pivotTolerances.clear();
+    island.pivotTolerances.addWithoutInit(n);
+    island.x.clear();
+    island.x.addWithoutInit(n * 6);
+}
+
+// Assemble and factorize the matrix of a direct island
+/// The matrix A = J * M^-1 * J^T is factorized with A = L * D * L^T where D and L are block matrices.
+/// The columns are eliminated in the elimination order of the symbolic factorization.
+void ArticulationSolverSystem::factorizeDirectIsland(DirectIsland& island) {
+
+    RP3D_PROFILE("ArticulationSolverSystem::factorizeDirectIsland()", mProfiler);
+
+    const uint32 n = island.nbJoints;
+    ArticulationJoint* joints = &(mJoints[island.startJointIndex]);
+
+    // Compute the inverse mass matrices of the bodies multiplied by the transposed Jacobians
+    for (uint32 j=0; j < n; j++) {
+
+        ArticulationJoint& joint = joints[j];
+        for (uint32 s=0; s < 2; s++) {
+
+            const uint32 bodyComponentIndex = s == 0 ? joint.body1ComponentIndex : joint.body2ComponentIndex;
+            const decimal* jacobian = s == 0 ? joint.jacobianBody1 : joint.jacobianBody2;
+            decimal* inverseMassJacobian = s == 0 ? joint.inverseMassJacobianBody1 : joint.inverseMassJacobianBody2;
+
+            if (island.jointsBodies[2 * j + s] == INVALID_INDEX) {
+                for (uint32 i=0; i < joint.nbRows * 6; i++) {
+                    inverseMassJacobian[i] = decimal(0.0);
+                }
+                continue;
+            }
+
+            const decimal inverseMass = mRigidBodyComponents.mInverseMasses[bodyComponentIndex];
+            const Matrix3x3& inverseInertiaTensor = mRigidBodyComponents.mInverseInertiaTensorsWorld[bodyComponentIndex];
+            for (uint32 r=0; r < joint.nbRows; r++) {
+                const decimal* row = jacobian + r * 6;
+                const Vector3 angular = inverseInertiaTensor * Vector3(row[3], row[4], row[5]);
+                for (uint32 i=0; i < 3; i++) {
+                    inverseMassJacobian[r * 6 + i] = inverseMass * row[i];
+                    inverseMassJacobian[r * 6 + i + 3] = angular[i];
+                }
+            }
+        }
+    }
+
+    // Assemble the matrix
+    for (uint32 i=0; i < island.blocks.size(); i++) {
+        island.blocks[i] = decimal(0.0);
+    }
+    for (uint32 e=0; e < island.assemblyEntries.size(); e++) {
+
+        const DirectIslandAssemblyEntry& entry = island.assemblyEntries[e];
+        const ArticulationJoint& rowJoint = joints[entry.rowJoint];
+        const ArticulationJoint& columnJoint = joints[entry.columnJoint];
+        const decimal* jacobian = island.jointsBodies[2 * entry.rowJoint] == entry.body ? rowJoint.jacobianBody1 :
+                                                                                            rowJoint.jacobianBody2;
+        const decimal* inverseMassJacobian = island.jointsBodies[2 * entry.columnJoint] == entry.body ?
+                                                 columnJoint.inverseMassJacobianBody1 : columnJoint.inverseMassJacobianBody2;
+
+        decimal* block = &(island.blocks[entry.block * 36]);
+        const uint32 m = columnJoint.nbRows;
+        for (uint32 r=0; r < rowJoint.nbRows; r++) {
+            for (uint32 c=0; c < m; c++) {
+                decimal sum = decimal(0.0);
+                for (uint32 k=0; k < 6; k++) {
+                    sum += jacobian[r * 6 + k] * inverseMassJacobian[c * 6 + k];
+                }
+                block[r * m + c] += sum;
+            }
+        }
+    }
+
+    // The pivots that become very small compared to the assembled diagonal blocks correspond to redundant constraints
+    const decimal relativePivotTolerance = decimal(100.0) * MACHINE_EPSILON;
+    for (uint32 k=0; k < n; k++) {
+        const uint32 m = joints[island.eliminationOrder[k]].nbRows;
+        decimal maxDiagonal = decimal(0.0);
+        for (uint32 i=0; i < m; i++) {
+            maxDiagonal = std::max(maxDiagonal, std::abs(island.blocks[k * 36 + i * m + i]));
+        }
+        island.pivotTolerances[k] = maxDiagonal * relativePivotTolerance;
+    }
+
+    // For each column in the elimination order
+    for (uint32 k=0; k < n; k++) {
+
+        const uint32 m = joints[island.eliminationOrder[k]].nbRows;
+        const decimal* inverseDiagonalBlock = &(island.inverseDiagonalBlocks[k * 36]);
+        const uint32 columnStartIndex = island.columnsStartIndex[k];
+        const uint32 columnEndIndex = island.columnsStartIndex[k + 1];
+
+        // All the previous columns have already been eliminated from the diagonal block
+        computeSymmetricInverse(&(island.blocks[k * 36]), m, &(island.inverseDiagonalBlocks[k * 36]), island.pivotTolerances[k]);
+
+        if (columnStartIndex == columnEndIndex) continue;
+
+        // Compute the blocks of the factor L = W * D^-1
+        mColumnBlocks.clear();
+        mColumnBlocks.addWithoutInit((columnEndIndex - columnStartIndex) * 36);
+        for (uint32 e=columnStartIndex; e < columnEndIndex; e++) {
+
+            const uint32 nbRows = joints[island.eliminationOrder[island.rowIndices[e]]].nbRows;
+            const decimal* block = &(island.blocks[(n + e) * 36]);
+            decimal* lower = &(mColumnBlocks[(e - columnStartIndex) * 36]);
+            for (uint32 r=0; r < nbRows; r++) {
+                for (uint32 c=0; c < m; c++) {
+                    decimal sum = decimal(0.0);
+                    for (uint32 i=0; i < m; i++) {
+                        sum += block[r * m + i] * inverseDiagonalBlock[i * m + c];
+                    }
+                    lower[r * m + c] = sum;
+                }
+            }
+        }
+
+        // Eliminate the column from the remaining blocks: A_ab = A_ab - L_a * W_b^T
+        uint32 update = island.updatesStartIndex[k];
+        for (uint32 a=columnStartIndex; a < columnEndIndex; a++) {
+
+            const uint32 nbRowsA = joints[island.eliminationOrder[island.rowIndices[a]]].nbRows;
+            const decimal* lowerA = &(mColumnBlocks[(a - columnStartIndex) * 36]);
+
+            for (uint32 b=columnStartIndex; b <= a; b++) {
+
+                const uint32 nbRowsB = joints[island.eliminationOrder[island.rowIndices[b]]].nbRows;
+                const decimal* blockB = &(island.blocks[(n + b) * 36]);
+                decimal* target = &(island.blocks[island.updateBlocks[update] * 36]);
+                update++;
+
+                for (uint32 r=0; r < nbRowsA; r++) {
+                    for (uint32 c=0; c < nbRowsB; c++) {
+                        decimal sum = decimal(0.0);
+                        for (uint32 i=0; i < m; i++) {
+                            sum += lowerA[r * m + i] * blockB[c * m + i];
+                        }
+                        target[r * nbRowsB + c] -= sum;
+                    }
+                }
+            }
+        }
+
+        // Replace the blocks of the column by the blocks of the factor
+        for (uint32 i=0; i < mColumnBlocks.size(); i++) {
+            island.blocks[(n + columnStartIndex) * 36 + i] = mColumnBlocks[i];
+        }
+    }
+}
+
+// Solve the joints of a direct island
+/// We solve J * M^-1 * J^T * lambda = -(J * v + b) for the impulses lambda of the joints with
+/// the factorization of the matrix and apply the velocity changes M^-1 * J^T * lambda to the bodies
+void ArticulationSolverSystem::solveDirectIsland(DirectIsland& island) {
+
+    RP3D_PROFILE("ArticulationSolverSystem::solveDirectIsland()", mProfiler);
+
+    const uint32 n = island.nbJoints;
+    const ArticulationJoint* joints = &(mJoints[island.startJointIndex]);
+    decimal* x = &(island.x[0]);
+
+    // Compute the right-hand side
+    for (uint32 k=0; k < n; k++) {
+        computeVelocityError(joints[island.eliminationOrder[k]], x + k * 6);
+    }
+
+    // Forward substitution
+    for (uint32 k=0; k < n; k++) {
+
+        const uint32 m = joints[island.eliminationOrder[k]].nbRows;
+        for (uint32 e=island.columnsStartIndex[k]; e < island.columnsStartIndex[k + 1]; e++) {
+
+            const uint32 i = island.rowIndices[e];
+            const uint32 nbRows = joints[island.eliminationOrder[i]].nbRows;
+            const decimal* lower = &(island.blocks[(n + e) * 36]);
+            for (uint32 r=0; r < nbRows; r++) {
+                decimal sum = decimal(0.0);
+                for (uint32 c=0; c < m; c++) {
+                    sum += lower[r * m + c] * x[k * 6 + c];
+                }
+                x[i * 6 + r] -= sum;
+            }
+        }
+    }
+
+    // Multiplication by the inverse of the diagonal blocks
+    for (uint32 k=0; k < n; k++) {
+
+        const uint32 m = joints[island.eliminationOrder[k]].nbRows;
+        const decimal* inverseDiagonalBlock = &(island.inverseDiagonalBlocks[k * 36]);
+
+        decimal y[6];
+        for (uint32 r=0; r < m; r++) {
+            y[r] = decimal(0.0);
+            for (uint32 c=0; c < m; c++) {
+                y[r] += inverseDiagonalBlock[r * m + c] * x[k * 6 + c];
+            }
+        }
+        for (uint32 r=0; r < m; r++) {
+            x[k * 6 + r] = y[r];
+        }
+    }
+
+    // Backward substitution
+    for (uint32 k=n; k > 0; k--) {
+
+        const uint32 m = joints[island.eliminationOrder[k - 1]].nbRows;
+        for (uint32 e=island.columnsStartIndex[k - 1]; e < island.columnsStartIndex[k]; e++) {
+
+            const uint32 i = island.rowIndices[e];
+            const uint32 nbRows = joints[island.eliminationOrder[i]].nbRows;
+            const decimal* lower = &(island.blocks[(n + e) * 36]);
+            for (uint32 c=0; c < m; c++) {
+                decimal sum = decimal(0.0);
+                for (uint32 r=0; r < nbRows; r++) {
+                    sum += lower[r * m + c] * x[i * 6 + r];
+                }
+                x[(k - 1) * 6 + c] -= sum;
+            }
+        }
+    }
+
+    // Apply the velocity changes to the bodies and accumulate the impulses of the joints
+    for (uint32 k=0; k < n; k++) {
+
+        const uint32 j = island.eliminationOrder[k];
+        const ArticulationJoint& joint = joints[j];
+        const decimal* lambda = x + k * 6;
+
+        decimal lambdaSquare = decimal(0.0);
+        for (uint32 r=0; r < joint.nbRows; r++) {
+            lambdaSquare += lambda[r] * lambda[r];
+        }
+
+        for (uint32 s=0; s < 2; s++) {
+
+            if (island.jointsBodies[2 * j + s] == INVALID_INDEX) continue;
+
+            const uint32 bodyComponentIndex = s == 0 ? joint.body1ComponentIndex : joint.body2ComponentIndex;
+            const decimal* inverseMassJacobian = s == 0 ? joint.inverseMassJacobianBody1 : joint.inverseMassJacobianBody2;
+
+            decimal deltaVelocity[6] = {0, 0, 0, 0, 0, 0};
+            for (uint32 r=0; r < joint.nbRows; r++) {
+                for (uint32 i=0; i < 6; i++) {
+                    deltaVelocity[i] += inverseMassJacobian[r * 6 + i] * lambda[r];
+                }
+            }
+            mRigidBodyComponents.mConstrainedLinearVelocities[bodyComponentIndex] += Vector3(deltaVelocity[0], deltaVelocity[1], deltaVelocity[2]);
+            mRigidBodyComponents.mConstrainedAngularVelocities[bodyComponentIndex] += Vector3(deltaVelocity[3], deltaVelocity[4], deltaVelocity[5]);
+        }
+
+        applyJointImpulse(joint, lambda);
+
+        mMaxImpulseChangeSquare = std::max(mMaxImpulseChangeSquare, lambdaSquare);
+    }
+}
+
+// Destroy a direct island
+void ArticulationSolverSystem::destroyDirectIsland(DirectIsland* island) {
+
+    island->~DirectIsland();
+    mAllocator.release(island, sizeof(DirectIsland));
+}
+
+// Compute the inverse of a small symmetric and definite matrix
+/// The diagonal blocks of the bodies are positive definite and the ones of the joints are
+/// negative definite. Therefore, we can use a LDL^T decomposition without pivoting. The
+/// directions with a zero pivot or a pivot smaller than the tolerance (redundant constraints)
+/// are ignored.
+void ArticulationSolverSystem::computeSymmetricInverse(const decimal* matrix, uint32 n, decimal* inverse, decimal pivotTolerance) {
+
+    decimal lower[36];
+    decimal inverseDiagonal[6];
+    decimal diagonal[6];
+
+    decimal maxDiagonal = decimal(0.0);
+    for (uint32 i=0; i < n; i++) {
+        maxDiagonal = std::max(maxDiagonal, std::abs(matrix[i * n + i]));
+    }
+    const decimal epsilon = std::max(maxDiagonal * decimal(n) * MACHINE_EPSILON, pivotTolerance);
+
+    // Compute the LDL^T decomposition
+    for (uint32 j=0; j < n; j++) {
+
+        decimal d = matrix[j * n + j];
+        for (uint32 k=0; k < j; k++) {
+            d -= lower[j * n + k] * lower[j * n + k] * diagonal[k];
+        }
+        diagonal[j] = d;
+        inverseDiagonal[j] = std::abs(d) > epsilon ? decimal(1.0) / d : decimal(0.0);
+
+        for (uint32 i=j+1; i < n; i++) {
+            decimal sum = matrix[i * n + j];
+            for (uint32 k=0; k < j; k++) {
+                sum -= lower[i * n + k] * lower[j * n + k] * diagonal[k];
+            }
+            lower[i * n + j] = sum * inverseDiagonal[j];
+        }
+    }
+
+    // Solve for each column of the identity matrix
+    decimal y[6];
+    for (uint32 c=0; c < n; c++) {
+
+        for (uint32 i=0; i < n; i++) {
+            y[i] = i == c ? decimal(1.0) : decimal(0.0);
+            for (uint32 k=0; k < i; k++) {
+                y[i] -= lower[i * n + k] * y[k];
+            }
+        }
+        for (uint32 i=0; i < n; i++) {
+            y[i] *= inverseDiagonal[i];
+        }
+        for (uint32 i=n; i > 0; i--) {
+            for (uint32 k=i; k < n; k++) {
+                y[i - 1] -= lower[k * n + i - 1] * y[k];
+            }
+        }
+        for (uint32 i=0; i < n; i++) {
+            inverse[i * n + c] = y[i];
+        }
+    }
+}
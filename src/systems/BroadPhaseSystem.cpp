@@ -38,8 +38,16 @@ using namespace reactphysics3d;
 BroadPhaseSystem::BroadPhaseSystem(CollisionDetectionSystem& collisionDetection, ColliderComponents& collidersComponents,
                                    TransformComponents& transformComponents, RigidBodyComponents& rigidBodyComponents)
                     :mDynamicAABBTree(collisionDetection.getMemoryManager().getHeapAllocator(), DYNAMIC_TREE_FAT_AABB_INFLATE_PERCENTAGE),
+                     mProxies(collisionDetection.getMemoryManager().getHeapAllocator()),
+                     mCompounds(collisionDetection.getMemoryManager().getHeapAllocator()),
+                     mCompoundPairs(collisionDetection.getMemoryManager().getHeapAllocator()),
+                     mCompoundsToUpdate(collisionDetection.getMemoryManager().getHeapAllocator()),
+                     mFlaggedCompounds(collisionDetection.getMemoryManager().getHeapAllocator()),
+                     mOverlappingTreeNodes(collisionDetection.getMemoryManager().getHeapAllocator()),
+                     mOverlappingLocalNodes(collisionDetection.getMemoryManager().getHeapAllocator()),
                      mCollidersComponents(collidersComponents), mTransformsComponents(transformComponents),
                      mRigidBodyComponents(rigidBodyComponents), mMovedShapes(collisionDetection.getMemoryManager().getHeapAllocator()),
+                     mShapesToTest(collisionDetection.getMemoryManager().getHeapAllocator()),
                      mCollisionDetection(collisionDetection) {
 
 #ifdef IS_RP3D_PROFILING_ENABLED
@@ -51,6 +59,59 @@ BroadPhaseSystem::BroadPhaseSystem(CollisionDetectionSystem& collisionDetection,
 
 }
 
+// Destructor
+BroadPhaseSystem::~BroadPhaseSystem() {
+
+    // Release the remaining compound bodies
+    MemoryAllocator& allocator = mCollisionDetection.getMemoryManager().getHeapAllocator();
+    for (auto it = mCompounds.begin(); it != mCompounds.end(); ++it) {
+        it->second->~CompoundBroadPhase();
+        allocator.release(it->second, sizeof(CompoundBroadPhase));
+    }
+}
+
+// Set the broad-phase proxy with a given broad-phase ID
+void BroadPhaseSystem::setProxy(int32 proxyId, int32 nodeId, Collider* collider, CompoundBroadPhase* compound) {
+
+    assert(proxyId >= 0);
+
+    while (mProxies.size() <= static_cast<uint32>(proxyId)) {
+        mProxies.add(BroadPhaseProxy(-1, nullptr, nullptr));
+    }
+
+    mProxies[proxyId] = BroadPhaseProxy(nodeId, collider, compound);
+}
+
+// Release a broad-phase proxy
+void BroadPhaseSystem::releaseProxy(int32 proxyId) {
+    mProxies[proxyId] = BroadPhaseProxy(-1, nullptr, nullptr);
+}
+
+// Return the world-space AABB of the local tree of a compound body
+AABB BroadPhaseSystem::computeCompoundAABB(const CompoundBroadPhase* compound) const {
+
+    AABB aabb = compound->tree.getRootAABB();
+    aabb.applyTransform(mTransformsComponents.getTransform(compound->bodyEntity));
+
+    return aabb;
+}
+
+// Return the world-space fat AABB of a given broad-phase shape
+/// The fat AABB of a collider of a compound body is its local fat AABB transformed
+/// with the current transform of the body
+AABB BroadPhaseSystem::getFatAABB(int broadPhaseId) const {
+
+    const BroadPhaseProxy& proxy = mProxies[broadPhaseId];
+
+    if (proxy.compound != nullptr && proxy.collider != nullptr) {
+        AABB aabb = proxy.compound->tree.getFatAABB(proxy.nodeId);
+        aabb.applyTransform(mTransformsComponents.getTransform(proxy.compound->bodyEntity));
+        return aabb;
+    }
+
+    return mDynamicAABBTree.getFatAABB(proxy.nodeId);
+}
+
 // Return true if the two broad-phase collision shapes are overlapping
 bool BroadPhaseSystem::testOverlappingShapes(int32 shape1BroadPhaseId, int32 shape2BroadPhaseId) const {
 
@@ -59,8 +120,8 @@ bool BroadPhaseSystem::testOverlappingShapes(int32 shape1BroadPhaseId, int32 sha
     assert(shape1BroadPhaseId != -1 && shape2BroadPhaseId != -1);
 
     // Get the two AABBs of the collision shapes
-    const AABB& aabb1 = mDynamicAABBTree.getFatAABB(shape1BroadPhaseId);
-    const AABB& aabb2 = mDynamicAABBTree.getFatAABB(shape2BroadPhaseId);
+    const AABB aabb1 = getFatAABB(shape1BroadPhaseId);
+    const AABB aabb2 = getFatAABB(shape2BroadPhaseId);
 
     // Check if the two AABBs are overlapping
     return aabb1.testCollision(aabb2);
@@ -71,22 +132,104 @@ void BroadPhaseSystem::raycast(const Ray& ray, RaycastTest& raycastTest, unsigne
 
     RP3D_PROFILE("BroadPhaseSystem::raycast()", mProfiler);
 
-    BroadPhaseRaycastCallback broadPhaseRaycastCallback(mDynamicAABBTree, raycastWithCategoryMaskBits, raycastTest);
-
-    // Compute the inverse ray direction
-    const Vector3 rayDirection = ray.point2 - ray.point1;
-    const Vector3 rayDirectionInverse(decimal(1.0) / rayDirection.x, decimal(1.0) / rayDirection.y, decimal(1.0) / rayDirection.z);
+    BroadPhaseRaycastCallback broadPhaseRaycastCallback(*this, mDynamicAABBTree, nullptr, raycastWithCategoryMaskBits, raycastTest);
 
     mDynamicAABBTree.raycast(ray, broadPhaseRaycastCallback);
 }
 
+// Tests if an AABB overlaps with any collider in the world
+bool BroadPhaseSystem::testAABBOverlap(const AABB& aabb) const {
+
+    // Fast path when there is no compound body in the world
+    if (mCompounds.size() == 0) {
+        return mDynamicAABBTree.reportAnyShapeOverlappingWithAABB(aabb);
+    }
+
+    Array<int32> overlappingNodes(mCollisionDetection.getMemoryManager().getHeapAllocator());
+    mDynamicAABBTree.reportAllShapesOverlappingWithAABB(aabb, overlappingNodes);
+
+    for (uint32 i=0; i < overlappingNodes.size(); i++) {
+
+        const BroadPhaseProxy& proxy = mProxies[overlappingNodes[i]];
+
+        // If the proxy is a collider
+        if (proxy.collider != nullptr) {
+            return true;
+        }
+
+        // Test the AABB against the local tree of the compound body
+        AABB localAABB = aabb;
+        localAABB.applyTransform(mTransformsComponents.getTransform(proxy.compound->bodyEntity).getInverse());
+        if (proxy.compound->tree.reportAnyShapeOverlappingWithAABB(localAABB)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 // Add a collider into the broad-phase collision detection
 void BroadPhaseSystem::addCollider(Collider* collider, const AABB& aabb) {
 
     assert(collider->getBroadPhaseId() == -1);
 
+    const Entity bodyEntity = collider->getBody()->getEntity();
+
+    // If the body is a compound body
+    if (collider->getBody()->isCompound()) {
+
+        // Get the broad-phase data of the compound body (or create it)
+        CompoundBroadPhase* compound;
+        auto it = mCompounds.find(bodyEntity);
+        if (it != mCompounds.end()) {
+            compound = it->second;
+        }
+        else {
+            MemoryAllocator& allocator = mCollisionDetection.getMemoryManager().getHeapAllocator();
+            compound = new (allocator.allocate(sizeof(CompoundBroadPhase))) CompoundBroadPhase(allocator, bodyEntity);
+            mCompounds.add(Pair<Entity, CompoundBroadPhase*>(bodyEntity, compound));
+
+#ifdef IS_RP3D_PROFILING_ENABLED
+
+            compound->tree.setProfiler(mProfiler);
+
+#endif
+        }
+
+        // Add the local-space AABB of the collider into the local tree of the body
+        AABB localAABB;
+        collider->getCollisionShape()->computeAABB(localAABB, mCollidersComponents.getLocalToBodyTransform(collider->getEntity()));
+        const int32 proxyId = mDynamicAABBTree.reserveNodeID();
+        setProxy(proxyId, compound->tree.addObject(localAABB, proxyId, 0), collider, compound);
+        compound->colliderProxies.add(proxyId);
+
+        // Set the broad-phase ID of the collider
+        mCollidersComponents.setBroadPhaseId(collider->getEntity(), proxyId);
+
+        // If the body does not have a proxy in the world tree yet
+        if (compound->proxyId == -1) {
+
+            compound->proxyId = mDynamicAABBTree.addObject(computeCompoundAABB(compound), nullptr);
+            setProxy(compound->proxyId, compound->proxyId, nullptr, compound);
+            mMovedShapes.add(compound->proxyId);
+        }
+        else {
+
+            // Update the proxy of the body with the new local tree
+            compound->hasTreeChanged = true;
+            if (!compound->isUpdateNeeded) {
+                compound->isUpdateNeeded = true;
+                mCompoundsToUpdate.add(compound);
+            }
+            updateCompounds();
+        }
+
+        return;
+    }
+
     // Add the collision shape into the dynamic AABB tree and get its broad-phase ID
     int nodeId = mDynamicAABBTree.addObject(aabb, collider);
+    setProxy(nodeId, nodeId, collider, nullptr);
 
     // Set the broad-phase ID of the collider
     mCollidersComponents.setBroadPhaseId(collider->getEntity(), nodeId);
@@ -102,15 +245,80 @@ void BroadPhaseSystem::removeCollider(Collider* collider) {
     assert(collider->getBroadPhaseId() != -1);
 
     int broadPhaseID = collider->getBroadPhaseId();
+    const BroadPhaseProxy proxy = mProxies[broadPhaseID];
 
     mCollidersComponents.setBroadPhaseId(collider->getEntity(), -1);
 
+    // If the collider is in the local tree of a compound body
+    if (proxy.compound != nullptr) {
+
+        CompoundBroadPhase* compound = proxy.compound;
+
+        // Remove the collider from the local tree
+        compound->tree.removeObject(proxy.nodeId);
+        compound->colliderProxies.remove(broadPhaseID);
+        mDynamicAABBTree.releaseReservedNodeID(broadPhaseID);
+        releaseProxy(broadPhaseID);
+
+        // If the body does not have colliders in the broad-phase anymore
+        if (compound->colliderProxies.size() == 0) {
+
+            // Remove the proxy of the body from the world tree
+            removeCompoundPairs(compound->proxyId);
+            mDynamicAABBTree.removeObject(compound->proxyId);
+            removeMovedCollider(compound->proxyId);
+            releaseProxy(compound->proxyId);
+            if (compound->isUpdateNeeded) {
+                mCompoundsToUpdate.remove(compound);
+            }
+            if (compound->havePairsBeenFlagged) {
+                mFlaggedCompounds.remove(compound);
+            }
+
+            // Destroy the broad-phase data of the compound body
+            mCompounds.remove(compound->bodyEntity);
+            MemoryAllocator& allocator = mCollisionDetection.getMemoryManager().getHeapAllocator();
+            compound->~CompoundBroadPhase();
+            allocator.release(compound, sizeof(CompoundBroadPhase));
+        }
+        else {
+
+            compound->hasTreeChanged = true;
+            if (!compound->isUpdateNeeded) {
+                compound->isUpdateNeeded = true;
+                mCompoundsToUpdate.add(compound);
+            }
+        }
+
+        return;
+    }
+
     // Remove the collision shape from the dynamic AABB tree
-    mDynamicAABBTree.removeObject(broadPhaseID);
+    removeCompoundPairs(broadPhaseID);
+    mDynamicAABBTree.removeObject(proxy.nodeId);
 
     // Remove the collision shape into the array of shapes that have moved (or have been created)
     // during the last simulation step
     removeMovedCollider(broadPhaseID);
+
+    releaseProxy(broadPhaseID);
+}
+
+// Remove all the compound pairs involving a given proxy of the world tree
+void BroadPhaseSystem::removeCompoundPairs(int32 proxyId) {
+
+    if (mCompoundPairs.size() == 0) return;
+
+    Array<uint64> pairsToRemove(mCollisionDetection.getMemoryManager().getHeapAllocator());
+    for (auto it = mCompoundPairs.begin(); it != mCompoundPairs.end(); ++it) {
+        if (it->second.first == proxyId || it->second.second == proxyId) {
+            pairsToRemove.add(it->first);
+        }
+    }
+
+    for (uint32 i=0; i < pairsToRemove.size(); i++) {
+        mCompoundPairs.remove(pairsToRemove[i]);
+    }
 }
 
 // Update the broad-phase state of a single collider
@@ -121,8 +329,8 @@ void BroadPhaseSystem::updateCollider(Entity colliderEntity) {
     // Get the index of the collider component in the array
     uint32 index = mCollidersComponents.mMapEntityToComponentIndex[colliderEntity];
 
-    // Update the collider component
-    updateCollidersComponents(index, 1);
+    // Update the collider component (its local-to-body transform might have changed)
+    updateCollidersComponents(index, 1, true);
 }
 
 // Update the broad-phase state of all the enabled colliders
@@ -132,7 +340,7 @@ void BroadPhaseSystem::updateColliders() {
 
     // Update all the enabled collider components
     if (mCollidersComponents.getNbEnabledComponents() > 0) {
-        updateCollidersComponents(0, mCollidersComponents.getNbEnabledComponents());
+        updateCollidersComponents(0, mCollidersComponents.getNbEnabledComponents(), false);
     }
 }
 
@@ -156,7 +364,10 @@ void BroadPhaseSystem::updateColliderInternal(int32 broadPhaseId, Collider* coll
 }
 
 // Update the broad-phase state of some colliders components
-void BroadPhaseSystem::updateCollidersComponents(uint32 startIndex, uint32 nbItems) {
+/// The colliders of a compound body are only updated in the local tree of the body when their
+/// local-space AABB might have changed. Then, the proxies of the compound bodies are updated in
+/// the tree of the world.
+void BroadPhaseSystem::updateCollidersComponents(uint32 startIndex, uint32 nbItems, bool updateCompoundLocalAABBs) {
 
     RP3D_PROFILE("BroadPhaseSystem::updateCollidersComponents()", mProfiler);
 
@@ -175,25 +386,72 @@ void BroadPhaseSystem::updateCollidersComponents(uint32 startIndex, uint32 nbIte
         const int32 broadPhaseId = mCollidersComponents.mBroadPhaseIds[i];
         if (broadPhaseId != -1) {
 
-            const Entity& bodyEntity = mCollidersComponents.mBodiesEntities[i];
-            const Transform& transform = mTransformsComponents.getTransform(bodyEntity);
-
-            // Recompute the world-space AABB of the collision shape
-            AABB aabb;
-            mCollidersComponents.mCollisionShapes[i]->computeAABB(aabb, transform * mCollidersComponents.mLocalToBodyTransforms[i]);
-
             // If the size of the collision shape has been changed by the user,
             // we need to reset the broad-phase AABB to its new size
             const bool forceReInsert = mCollidersComponents.mHasCollisionShapeChangedSize[i];
 
-            // Update the broad-phase state of the collider
-            updateColliderInternal(broadPhaseId, mCollidersComponents.mColliders[i], aabb, forceReInsert);
+            CompoundBroadPhase* compound = mProxies[broadPhaseId].compound;
+
+            // If the collider is in the local tree of a compound body
+            if (compound != nullptr) {
+
+                if (updateCompoundLocalAABBs || forceReInsert) {
+
+                    // Recompute the local-space AABB of the collision shape
+                    AABB localAABB;
+                    mCollidersComponents.mCollisionShapes[i]->computeAABB(localAABB, mCollidersComponents.mLocalToBodyTransforms[i]);
+
+                    if (compound->tree.updateObject(mProxies[broadPhaseId].nodeId, localAABB, forceReInsert)) {
+                        compound->hasTreeChanged = true;
+                    }
+                }
+
+                // The proxy of the body needs to be updated in the world tree
+                if (!compound->isUpdateNeeded) {
+                    compound->isUpdateNeeded = true;
+                    mCompoundsToUpdate.add(compound);
+                }
+            }
+            else {
+
+                const Entity& bodyEntity = mCollidersComponents.mBodiesEntities[i];
+                const Transform& transform = mTransformsComponents.getTransform(bodyEntity);
+
+                // Recompute the world-space AABB of the collision shape
+                AABB aabb;
+                mCollidersComponents.mCollisionShapes[i]->computeAABB(aabb, transform * mCollidersComponents.mLocalToBodyTransforms[i]);
+
+                // Update the broad-phase state of the collider
+                updateColliderInternal(broadPhaseId, mCollidersComponents.mColliders[i], aabb, forceReInsert);
+            }
 
             mCollidersComponents.mHasCollisionShapeChangedSize[i] = false;
         }
     }
+
+    updateCompounds();
 }
 
+// Update the proxies of the compound bodies in the dynamic AABB tree of the world
+void BroadPhaseSystem::updateCompounds() {
+
+    for (uint32 i=0; i < mCompoundsToUpdate.size(); i++) {
+
+        CompoundBroadPhase* compound = mCompoundsToUpdate[i];
+
+        // Update the world tree with the world-space AABB of the local tree (the proxy is
+        // reinserted if the local tree has changed because its AABB might be smaller)
+        const AABB aabb = computeCompoundAABB(compound);
+        if (mDynamicAABBTree.updateObject(compound->proxyId, aabb, compound->hasTreeChanged)) {
+            mMovedShapes.add(compound->proxyId);
+        }
+
+        compound->hasTreeChanged = false;
+        compound->isUpdateNeeded = false;
+    }
+
+    mCompoundsToUpdate.clear();
+}
 
 // Add a collider in the array of colliders that have moved in the last simulation step
 // and that need to be tested again for broad-phase overlapping.
@@ -201,23 +459,162 @@ void BroadPhaseSystem::addMovedCollider(int broadPhaseID, Collider* collider) {
 
     assert(broadPhaseID != -1);
 
-    // Store the broad-phase ID into the array of shapes that have moved
-    mMovedShapes.add(broadPhaseID);
+    // Store the broad-phase ID of the proxy of the world tree into the array of shapes that have moved
+    mMovedShapes.add(getWorldProxyId(broadPhaseID));
 
     // Notify that the overlapping pairs where this shape is involved need to be tested for overlap
     mCollisionDetection.notifyOverlappingPairsToTestOverlap(collider);
 }
 
+// Flag the overlapping pairs of the colliders of a compound body to be tested for overlap
+void BroadPhaseSystem::flagCompoundPairs(CompoundBroadPhase* compound) {
+
+    if (compound->havePairsBeenFlagged) return;
+
+    for (uint32 i=0; i < compound->colliderProxies.size(); i++) {
+        mCollisionDetection.notifyOverlappingPairsToTestOverlap(mProxies[compound->colliderProxies[i]].collider);
+    }
+
+    compound->havePairsBeenFlagged = true;
+    mFlaggedCompounds.add(compound);
+}
+
+// Return true if the proxy of the world tree is enabled (its body is not sleeping)
+bool BroadPhaseSystem::isWorldProxyEnabled(int32 proxyId) const {
+
+    const BroadPhaseProxy& proxy = mProxies[proxyId];
+    const Collider* collider = proxy.collider != nullptr ? proxy.collider : mProxies[proxy.compound->colliderProxies[0]].collider;
+
+    return mCollidersComponents.getEntityIndex(collider->getEntity()) < mCollidersComponents.getNbEnabledComponents();
+}
+
+// Compute the colliders pairs of a pair of world tree proxies with at least one compound body
+/// This is the middle-phase traversal of the local trees of the compound bodies. The AABBs of
+/// the colliders of the second proxy are transformed into the local-space of the compound body
+/// of the first proxy and tested against its local tree.
+void BroadPhaseSystem::computeCompoundPairOverlappingColliders(int32 proxy1Id, int32 proxy2Id,
+                                                               Array<Pair<int32, int32>>& overlappingColliders) {
+
+    // Make sure that the first proxy is a compound body
+    if (mProxies[proxy1Id].compound == nullptr) {
+        std::swap(proxy1Id, proxy2Id);
+    }
+
+    const CompoundBroadPhase* compound1 = mProxies[proxy1Id].compound;
+    const CompoundBroadPhase* compound2 = mProxies[proxy2Id].compound;
+    assert(compound1 != nullptr);
+
+    const Transform worldToLocal1 = mTransformsComponents.getTransform(compound1->bodyEntity).getInverse();
+
+    // If the second proxy is a collider
+    if (compound2 == nullptr) {
+
+        AABB localAABB = mDynamicAABBTree.getFatAABB(proxy2Id);
+        localAABB.applyTransform(worldToLocal1);
+
+        mOverlappingLocalNodes.clear();
+        compound1->tree.reportAllShapesOverlappingWithAABB(localAABB, mOverlappingLocalNodes);
+        for (uint32 i=0; i < mOverlappingLocalNodes.size(); i++) {
+            overlappingColliders.add(Pair<int32, int32>(getLocalNodeProxyId(compound1->tree, mOverlappingLocalNodes[i]), proxy2Id));
+        }
+    }
+    else {  // If the second proxy is also a compound body
+
+        const Transform local2ToLocal1 = worldToLocal1 * mTransformsComponents.getTransform(compound2->bodyEntity);
+
+        for (uint32 c=0; c < compound2->colliderProxies.size(); c++) {
+
+            const int32 collider2ProxyId = compound2->colliderProxies[c];
+            AABB localAABB = compound2->tree.getFatAABB(mProxies[collider2ProxyId].nodeId);
+            localAABB.applyTransform(local2ToLocal1);
+
+            mOverlappingLocalNodes.clear();
+            compound1->tree.reportAllShapesOverlappingWithAABB(localAABB, mOverlappingLocalNodes);
+            for (uint32 i=0; i < mOverlappingLocalNodes.size(); i++) {
+                overlappingColliders.add(Pair<int32, int32>(getLocalNodeProxyId(compound1->tree, mOverlappingLocalNodes[i]), collider2ProxyId));
+            }
+        }
+    }
+}
+
 // Compute all the overlapping pairs of collision shapes
+/// The output array contains the pairs of broad-phase IDs of the overlapping colliders. The pairs of
+/// proxies of the world tree that involve a compound body are kept while their AABBs are overlapping
+/// and their colliders pairs are computed with the local trees of the compound bodies in each frame.
 void BroadPhaseSystem::computeOverlappingPairs(MemoryManager& memoryManager, Array<Pair<int32, int32>>& overlappingNodes) {
 
     RP3D_PROFILE("BroadPhaseSystem::computeOverlappingPairs()", mProfiler);
 
     // Get the array of the colliders that have moved or have been created in the last frame
-    Array<int> shapesToTest = mMovedShapes.toArray(memoryManager.getHeapAllocator());
+    mShapesToTest.clear();
+    for (auto it = mMovedShapes.begin(); it != mMovedShapes.end(); ++it) {
+        mShapesToTest.add(*it);
+    }
 
     // Ask the dynamic AABB tree to report all collision shapes that overlap with the shapes to test
-    mDynamicAABBTree.reportAllShapesOverlappingWithShapes(shapesToTest, 0, static_cast<uint32>(shapesToTest.size()), overlappingNodes);
+    mOverlappingTreeNodes.clear();
+    if (mShapesToTest.size() > 0) {
+        mDynamicAABBTree.reportAllShapesOverlappingWithShapes(mShapesToTest, 0, static_cast<uint32>(mShapesToTest.size()), mOverlappingTreeNodes);
+    }
+
+    // For each pair of overlapping nodes of the world tree
+    for (uint32 i=0; i < mOverlappingTreeNodes.size(); i++) {
+
+        const int32 proxy1Id = mOverlappingTreeNodes[i].first;
+        const int32 proxy2Id = mOverlappingTreeNodes[i].second;
+
+        // If both proxies are colliders
+        if (mProxies[proxy1Id].compound == nullptr && mProxies[proxy2Id].compound == nullptr) {
+            overlappingNodes.add(Pair<int32, int32>(proxy1Id, proxy2Id));
+        }
+        else if (proxy1Id != proxy2Id) {
+
+            // Keep the pair with a compound body until the AABBs of the two proxies are not overlapping anymore
+            const uint64 pairId = pairNumbers(std::max(proxy1Id, proxy2Id), std::min(proxy1Id, proxy2Id));
+            if (!mCompoundPairs.containsKey(pairId)) {
+                mCompoundPairs.add(Pair<uint64, Pair<int32, int32>>(pairId, Pair<int32, int32>(proxy1Id, proxy2Id)));
+            }
+        }
+    }
+
+    // For each pair of proxies with a compound body
+    if (mCompoundPairs.size() > 0) {
+
+        RP3D_PROFILE("BroadPhaseSystem::computeCompoundPairs()", mProfiler);
+
+        Array<uint64> pairsToRemove(memoryManager.getHeapAllocator());
+        for (auto it = mCompoundPairs.begin(); it != mCompoundPairs.end(); ++it) {
+
+            const int32 proxy1Id = it->second.first;
+            const int32 proxy2Id = it->second.second;
+
+            // Nothing changes if both bodies are sleeping
+            if (!isWorldProxyEnabled(proxy1Id) && !isWorldProxyEnabled(proxy2Id)) continue;
+
+            // The overlapping pairs of the colliders of the compound bodies need to be tested for
+            // overlap (the pairs that are still overlapping will be reported below)
+            if (mProxies[proxy1Id].compound != nullptr) flagCompoundPairs(mProxies[proxy1Id].compound);
+            if (mProxies[proxy2Id].compound != nullptr) flagCompoundPairs(mProxies[proxy2Id].compound);
+
+            // If the AABBs of the proxies are not overlapping anymore
+            if (!mDynamicAABBTree.getFatAABB(proxy1Id).testCollision(mDynamicAABBTree.getFatAABB(proxy2Id))) {
+                pairsToRemove.add(it->first);
+                continue;
+            }
+
+            // Compute the overlapping colliders with the local trees
+            computeCompoundPairOverlappingColliders(proxy1Id, proxy2Id, overlappingNodes);
+        }
+
+        for (uint32 i=0; i < pairsToRemove.size(); i++) {
+            mCompoundPairs.remove(pairsToRemove[i]);
+        }
+
+        for (uint32 i=0; i < mFlaggedCompounds.size(); i++) {
+            mFlaggedCompounds[i]->havePairsBeenFlagged = false;
+        }
+        mFlaggedCompounds.clear();
+    }
 
     // Reset the array of collision shapes that have move (or have been created) during the
     // last simulation step
@@ -235,16 +632,43 @@ decimal BroadPhaseRaycastCallback::raycastBroadPhaseShape(int32 nodeId, const Ra
 
     decimal hitFraction = decimal(-1.0);
 
-    // Get the collider from the node
-    Collider* collider = static_cast<Collider*>(mDynamicAABBTree.getNodeDataPointer(nodeId));
+    // Get the proxy of the node
+    const int32 proxyId = mTreeToWorldTransform == nullptr ? nodeId : BroadPhaseSystem::getLocalNodeProxyId(mDynamicAABBTree, nodeId);
+    const BroadPhaseProxy& proxy = mBroadPhaseSystem.mProxies[proxyId];
 
-    // Check if the raycast filtering mask allows raycast against this shape
-    if ((mRaycastWithCategoryMaskBits & collider->getCollisionCategoryBits()) != 0) {
+    // If the proxy is a compound body
+    if (proxy.collider == nullptr) {
+
+        // Raycast against the local tree of the body with the ray in local-space
+        const Transform& bodyTransform = mBroadPhaseSystem.mTransformsComponents.getTransform(proxy.compound->bodyEntity);
+        const Transform worldToLocal = bodyTransform.getInverse();
+        const Ray localRay(worldToLocal * ray.point1, worldToLocal * ray.point2, ray.maxFraction);
+
+        BroadPhaseRaycastCallback localRaycastCallback(mBroadPhaseSystem, proxy.compound->tree, &bodyTransform,
+                                                       mRaycastWithCategoryMaskBits, mRaycastTest);
+        proxy.compound->tree.raycast(localRay, localRaycastCallback);
+
+        hitFraction = localRaycastCallback.getSmallestHitFraction();
+    }
+    else if ((mRaycastWithCategoryMaskBits & proxy.collider->getCollisionCategoryBits()) != 0) {
+
+        // Check if the raycast filtering mask allows raycast against this shape
 
         // Ask the collision detection to perform a ray cast test against
         // the collider of this node because the ray is overlapping
         // with the shape in the broad-phase
-        hitFraction = mRaycastTest.raycastAgainstShape(collider, ray);
+        if (mTreeToWorldTransform != nullptr) {
+            const Ray worldRay((*mTreeToWorldTransform) * ray.point1, (*mTreeToWorldTransform) * ray.point2, ray.maxFraction);
+            hitFraction = mRaycastTest.raycastAgainstShape(proxy.collider, worldRay);
+        }
+        else {
+            hitFraction = mRaycastTest.raycastAgainstShape(proxy.collider, ray);
+        }
+    }
+
+    // Keep the smallest hit fraction (a zero fraction stops the raycast)
+    if (hitFraction >= decimal(0.0) && (mSmallestHitFraction < decimal(0.0) || hitFraction < mSmallestHitFraction)) {
+        mSmallestHitFraction = hitFraction;
     }
 
     return hitFraction;
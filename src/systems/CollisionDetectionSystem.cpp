@@ -60,15 +60,20 @@ CollisionDetectionSystem::CollisionDetectionSystem(PhysicsWorld* world, Collider
                      mBroadPhaseOverlappingNodes(mMemoryManager.getHeapAllocator(), 32),
                      mBroadPhaseSystem(*this, mCollidersComponents, transformComponents, rigidBodyComponents),
                      mMapBroadPhaseIdToColliderEntity(memoryManager.getPoolAllocator()),
-                     mNarrowPhaseInput(mMemoryManager.getSingleFrameAllocator(), mOverlappingPairs), mPotentialContactPoints(mMemoryManager.getSingleFrameAllocator()),
+                     mNarrowPhaseInput(mMemoryManager.getSingleFrameAllocator(), mMemoryManager.getHeapAllocator(), mOverlappingPairs), mPotentialContactPoints(mMemoryManager.getSingleFrameAllocator()),
                      mPotentialContactManifolds(mMemoryManager.getSingleFrameAllocator()), mContactPairs1(mMemoryManager.getPoolAllocator()),
                      mContactPairs2(mMemoryManager.getPoolAllocator()), mPreviousContactPairs(&mContactPairs1), mCurrentContactPairs(&mContactPairs2),
                      mLostContactPairs(mMemoryManager.getSingleFrameAllocator()), mPreviousMapPairIdToContactPairIndex(mMemoryManager.getHeapAllocator()),
+                     mMapPairIdToContactPairIndex(mMemoryManager.getHeapAllocator()),
                      mContactManifolds1(mMemoryManager.getPoolAllocator()), mContactManifolds2(mMemoryManager.getPoolAllocator()),
                      mPreviousContactManifolds(&mContactManifolds1), mCurrentContactManifolds(&mContactManifolds2),
                      mContactPoints1(mMemoryManager.getPoolAllocator()), mContactPoints2(mMemoryManager.getPoolAllocator()),
                      mPreviousContactPoints(&mContactPoints1), mCurrentContactPoints(&mContactPoints2), mCollisionBodyContactPairsIndices(mMemoryManager.getSingleFrameAllocator()),
-                     mNbPreviousPotentialContactManifolds(0), mNbPreviousPotentialContactPoints(0), mTriangleHalfEdgeStructure(triangleHalfEdgeStructure) {
+                     mFlatContactPairs(mMemoryManager.getHeapAllocator()), mFlatContactManifolds(mMemoryManager.getHeapAllocator()),
+                     mFlatContactPoints(mMemoryManager.getHeapAllocator()), mContactPairsToReport(mMemoryManager.getHeapAllocator()),
+                     mLostContactPairsToReport(mMemoryManager.getHeapAllocator()),
+                     mNbPreviousPotentialContactManifolds(0), mNbPreviousPotentialContactPoints(0), mTriangleHalfEdgeStructure(triangleHalfEdgeStructure),
+                     mCollidersWithChangedMaterial(mMemoryManager.getHeapAllocator()) {
 
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -114,47 +119,63 @@ void CollisionDetectionSystem::computeBroadPhase() {
     // Remove non overlapping pairs
     removeNonOverlappingPairs();
 
+    // Take into account the materials modified by the user
+    updateChangedMaterials();
+
     mBroadPhaseOverlappingNodes.clear();
 }
 
+// Recompute the mixed materials of the overlapping pairs of the colliders whose material has changed
+void CollisionDetectionSystem::updateChangedMaterials() {
+
+    RP3D_PROFILE("CollisionDetectionSystem::updateChangedMaterials()", mProfiler);
+
+    for (uint32 i=0; i < mCollidersWithChangedMaterial.size(); i++) {
+
+        // The collider might have been destroyed in the meantime
+        const Entity colliderEntity = mCollidersWithChangedMaterial[i];
+        if (!mCollidersComponents.hasComponent(colliderEntity)) continue;
+
+        const uint32 colliderIndex = mCollidersComponents.getEntityIndex(colliderEntity);
+        mCollidersComponents.mHasMaterialChanged[colliderIndex] = false;
+        mOverlappingPairs.updateMixedMaterials(colliderIndex);
+    }
+
+    mCollidersWithChangedMaterial.clear();
+}
+
 // Remove pairs that are not overlapping anymore
+// Only the pairs that have been flagged (because one of their colliders has moved) are tested here
 void CollisionDetectionSystem::removeNonOverlappingPairs() {
 
     RP3D_PROFILE("CollisionDetectionSystem::removeNonOverlappingPairs()", mProfiler);
 
-    // For each convex pairs
-    for (uint64 i=0; i < mOverlappingPairs.mConvexPairs.size(); i++) {
+    // For each pair that might not be overlapping anymore
+    const uint64 nbPairsToTest = mOverlappingPairs.mPairsToTestOverlap.size();
+    for (uint64 p=0; p < nbPairsToTest; p++) {
 
-        OverlappingPairs::ConvexOverlappingPair& overlappingPair = mOverlappingPairs.mConvexPairs[i];
+        const uint64 pairId = mOverlappingPairs.mPairsToTestOverlap[p];
 
-        // Check if we need to test overlap. If so, test if the two shapes are still overlapping.
-        // Otherwise, we destroy the overlapping pair
-        if (overlappingPair.needToTestOverlap) {
+        // Get the pair (it might have been removed since it has been flagged)
+        bool isConvexPair = true;
+        auto it = mOverlappingPairs.mMapConvexPairIdToPairIndex.find(pairId);
+        if (it == mOverlappingPairs.mMapConvexPairIdToPairIndex.end()) {
 
-            if(mBroadPhaseSystem.testOverlappingShapes(overlappingPair.broadPhaseId1, overlappingPair.broadPhaseId2)) {
-                overlappingPair.needToTestOverlap = false;
+            it = mOverlappingPairs.mMapConcavePairIdToPairIndex.find(pairId);
+            if (it == mOverlappingPairs.mMapConcavePairIdToPairIndex.end()) {
+                continue;
             }
-            else {
 
-                // If the two colliders of the pair were colliding in the previous frame
-                if (overlappingPair.collidingInPreviousFrame) {
-
-                    // Create a new lost contact pair
-                    addLostContactPair(overlappingPair);
-                }
-
-                mOverlappingPairs.removePair(i, true);
-                i--;
-            }
+            isConvexPair = false;
         }
-    }
-
-    // For each concave pairs
-    for (uint64 i=0; i < mOverlappingPairs.mConcavePairs.size(); i++) {
 
-        OverlappingPairs::ConcaveOverlappingPair& overlappingPair = mOverlappingPairs.mConcavePairs[i];
+        const uint64 pairIndex = it->second;
+        OverlappingPairs::OverlappingPair& overlappingPair = isConvexPair ?
+                                    static_cast<OverlappingPairs::OverlappingPair&>(mOverlappingPairs.mConvexPairs[pairIndex]) :
+                                    static_cast<OverlappingPairs::OverlappingPair&>(mOverlappingPairs.mConcavePairs[pairIndex]);
 
-        // Check if we need to test overlap. If so, test if the two shapes are still overlapping.
+        // Check if we still need to test overlap (the pair might have been reported as overlapping
+        // during the broad-phase). If so, test if the two shapes are still overlapping.
         // Otherwise, we destroy the overlapping pair
         if (overlappingPair.needToTestOverlap) {
 
@@ -170,11 +191,12 @@ void CollisionDetectionSystem::removeNonOverlappingPairs() {
                     addLostContactPair(overlappingPair);
                 }
 
-                mOverlappingPairs.removePair(i, false);
-                i--;
+                mOverlappingPairs.removePair(pairIndex, isConvexPair);
             }
         }
     }
+
+    mOverlappingPairs.mPairsToTestOverlap.clear();
 }
 
 // Add a lost contact pair (pair of colliders that are not in contact anymore)
@@ -193,6 +215,12 @@ void CollisionDetectionSystem::addLostContactPair(OverlappingPairs::OverlappingP
     // Create a lost contact pair
     ContactPair lostContactPair(overlappingPair.pairID, body1Entity, body2Entity, overlappingPair.collider1, overlappingPair.collider2, static_cast<uint32>(mLostContactPairs.size()),
                                 true, isTrigger);
+
+    // The ContactExit event is reported if one of the two colliders reports its contacts
+    if (!isTrigger && (mCollidersComponents.mReportContacts[collider1Index] || mCollidersComponents.mReportContacts[collider2Index])) {
+        mLostContactPairsToReport.add(mLostContactPairs.size());
+    }
+
     mLostContactPairs.add(lostContactPair);
 }
 
@@ -333,8 +361,9 @@ void CollisionDetectionSystem::computeMiddlePhase(NarrowPhaseInput& narrowPhaseI
     // Remove the obsolete last frame collision infos and mark all the others as obsolete
     mOverlappingPairs.clearObsoleteLastFrameCollisionInfos();
 
-    // For each possible convex vs convex pair of bodies
-    const uint64 nbConvexVsConvexPairs = mOverlappingPairs.mConvexPairs.size();
+    // For each possible convex vs convex pair of bodies (the disabled pairs where both bodies
+    // are sleeping or static are stored at the end of the array and are skipped)
+    const uint64 nbConvexVsConvexPairs = mOverlappingPairs.getNbEnabledConvexPairs();
     for (uint64 i=0; i < nbConvexVsConvexPairs; i++) {
 
         OverlappingPairs::ConvexOverlappingPair& overlappingPair = mOverlappingPairs.mConvexPairs[i];
@@ -359,19 +388,21 @@ void CollisionDetectionSystem::computeMiddlePhase(NarrowPhaseInput& narrowPhaseI
         const bool isCollider2Trigger = mCollidersComponents.mIsTrigger[collider2Index];
         const bool reportContacts = needToReportContacts && !isCollider1Trigger && !isCollider2Trigger;
 
+        // The speculative contacts are only generated for the contacts solved by the world
+        const decimal contactMargin = reportContacts ? mWorld->mConfig.contactMargin : decimal(0.0);
+
         // No middle-phase is necessary, simply create a narrow phase info
         // for the narrow-phase collision detection
         narrowPhaseInput.addNarrowPhaseTest(overlappingPair.pairID, collider1Entity, collider2Entity, collisionShape1, collisionShape2,
                                             mCollidersComponents.mLocalToWorldTransforms[collider1Index],
                                             mCollidersComponents.mLocalToWorldTransforms[collider2Index],
-                                            algorithmType, reportContacts, &overlappingPair.lastFrameCollisionInfo,
-                                            mMemoryManager.getSingleFrameAllocator());
+                                            algorithmType, reportContacts, contactMargin, &overlappingPair.lastFrameCollisionInfo);
 
         overlappingPair.collidingInCurrentFrame = false;
     }
 
-    // For each possible convex vs concave pair of bodies
-    const uint64 nbConcavePairs = mOverlappingPairs.mConcavePairs.size();
+    // For each possible convex vs concave pair of bodies (only the enabled pairs)
+    const uint64 nbConcavePairs = mOverlappingPairs.getNbEnabledConcavePairs();
     for (uint64 i=0; i < nbConcavePairs; i++) {
 
         OverlappingPairs::ConcaveOverlappingPair& overlappingPair = mOverlappingPairs.mConcavePairs[i];
@@ -380,7 +411,8 @@ void CollisionDetectionSystem::computeMiddlePhase(NarrowPhaseInput& narrowPhaseI
         assert(mCollidersComponents.getBroadPhaseId(overlappingPair.collider2) != -1);
         assert(mCollidersComponents.getBroadPhaseId(overlappingPair.collider1) != mCollidersComponents.getBroadPhaseId(overlappingPair.collider2));
 
-        computeConvexVsConcaveMiddlePhase(overlappingPair, mMemoryManager.getSingleFrameAllocator(), narrowPhaseInput, needToReportContacts);
+        computeConvexVsConcaveMiddlePhase(overlappingPair, mMemoryManager.getSingleFrameAllocator(), narrowPhaseInput, needToReportContacts,
+                                          needToReportContacts ? mWorld->mConfig.contactMargin : decimal(0.0));
 
         overlappingPair.collidingInCurrentFrame = false;
     }
@@ -427,7 +459,7 @@ void CollisionDetectionSystem::computeMiddlePhaseCollisionSnapshot(Array<uint64>
         narrowPhaseInput.addNarrowPhaseTest(pairId, collider1Entity, collider2Entity, collisionShape1, collisionShape2,
                                                   mCollidersComponents.mLocalToWorldTransforms[collider1Index],
                                                   mCollidersComponents.mLocalToWorldTransforms[collider2Index],
-                                                  algorithmType, reportContacts, &mOverlappingPairs.mConvexPairs[pairIndex].lastFrameCollisionInfo, mMemoryManager.getSingleFrameAllocator());
+                                                  algorithmType, reportContacts, decimal(0.0), &mOverlappingPairs.mConvexPairs[pairIndex].lastFrameCollisionInfo);
 
     }
 
@@ -442,12 +474,14 @@ void CollisionDetectionSystem::computeMiddlePhaseCollisionSnapshot(Array<uint64>
         assert(mCollidersComponents.getBroadPhaseId(mOverlappingPairs.mConcavePairs[pairIndex].collider2) != -1);
         assert(mCollidersComponents.getBroadPhaseId(mOverlappingPairs.mConcavePairs[pairIndex].collider1) != mCollidersComponents.getBroadPhaseId(mOverlappingPairs.mConcavePairs[pairIndex].collider2));
 
-        computeConvexVsConcaveMiddlePhase(mOverlappingPairs.mConcavePairs[pairIndex], mMemoryManager.getSingleFrameAllocator(), narrowPhaseInput, reportContacts);
+        computeConvexVsConcaveMiddlePhase(mOverlappingPairs.mConcavePairs[pairIndex], mMemoryManager.getSingleFrameAllocator(), narrowPhaseInput, reportContacts,
+                                          decimal(0.0));
     }
 }
 
 // Compute the concave vs convex middle-phase algorithm for a given pair of bodies
-void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPairs::ConcaveOverlappingPair& overlappingPair, MemoryAllocator& allocator, NarrowPhaseInput& narrowPhaseInput, bool reportContacts) {
+void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPairs::ConcaveOverlappingPair& overlappingPair, MemoryAllocator& allocator, NarrowPhaseInput& narrowPhaseInput, bool reportContacts,
+                                                                 decimal contactMargin) {
 
     RP3D_PROFILE("CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase()", mProfiler);
 
@@ -480,25 +514,53 @@ void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPair
     assert(!concaveShape->isConvex());
     assert(overlappingPair.narrowPhaseAlgorithmType != NarrowPhaseAlgorithmType::None);
 
-    // Compute the convex shape AABB in the local-space of the concave shape
+    const bool isCollider1Trigger = mCollidersComponents.mIsTrigger[collider1Index];
+    const bool isCollider2Trigger = mCollidersComponents.mIsTrigger[collider2Index];
+    reportContacts = reportContacts && !isCollider1Trigger && !isCollider2Trigger;
+
+    // The speculative contacts are only generated for the contacts solved by the world
+    if (!reportContacts) {
+        contactMargin = decimal(0.0);
+    }
+
+    // Compute the convex shape AABB in the local-space of the concave shape (enlarged by
+    // the contact margin to also find the triangles of the speculative contacts)
     AABB aabb;
     convexShape->computeAABB(aabb, convexToConcaveTransform);
+    aabb.inflate(contactMargin, contactMargin, contactMargin);
+
+    // If the convex shape is not inside the AABB of the cached triangles of the pair anymore (or if the
+    // concave shape has been scaled), we compute the concave shape triangles that are overlapping with a
+    // larger AABB. Therefore, the triangles do not need to be computed again in the next frames as long as
+    // the convex shape does not move too much.
+    if (!overlappingPair.isTrianglesCacheValid || !overlappingPair.cachedTrianglesAABB.contains(aabb) ||
+        overlappingPair.cachedTrianglesScale != concaveShape->getScale()) {
+
+        const Vector3 gap(aabb.getExtent() * CONCAVE_PAIR_TRIANGLES_CACHE_AABB_INFLATE_PERCENTAGE * decimal(0.5));
+        overlappingPair.cachedTrianglesAABB = AABB(aabb.getMin() - gap, aabb.getMax() + gap);
+        overlappingPair.cachedTrianglesScale = concaveShape->getScale();
+        overlappingPair.isTrianglesCacheValid = true;
+
+        overlappingPair.cachedTrianglesVertices.clear();
+        overlappingPair.cachedTrianglesVerticesNormals.clear();
+        overlappingPair.cachedTrianglesShapeIds.clear();
+        overlappingPair.cachedTrianglesInternalEdges.clear();
+        concaveShape->computeOverlappingTriangles(overlappingPair.cachedTrianglesAABB, overlappingPair.cachedTrianglesVertices,
+                                                  overlappingPair.cachedTrianglesVerticesNormals, overlappingPair.cachedTrianglesShapeIds,
+                                                  overlappingPair.cachedTrianglesInternalEdges, allocator);
+    }
 
-    // Compute the concave shape triangles that are overlapping with the convex mesh AABB
-    Array<Vector3> triangleVertices(allocator, 64);
-    Array<Vector3> triangleVerticesNormals(allocator, 64);
-    Array<uint> shapeIds(allocator, 64);
-    concaveShape->computeOverlappingTriangles(aabb, triangleVertices, triangleVerticesNormals, shapeIds, allocator);
+    const Array<Vector3>& triangleVertices = overlappingPair.cachedTrianglesVertices;
+    const Array<Vector3>& triangleVerticesNormals = overlappingPair.cachedTrianglesVerticesNormals;
+    const Array<uint32>& shapeIds = overlappingPair.cachedTrianglesShapeIds;
+    const Array<uint8>& trianglesInternalEdges = overlappingPair.cachedTrianglesInternalEdges;
 
     assert(triangleVertices.size() == triangleVerticesNormals.size());
     assert(shapeIds.size() == triangleVertices.size() / 3);
+    assert(trianglesInternalEdges.size() == shapeIds.size());
     assert(triangleVertices.size() % 3 == 0);
     assert(triangleVerticesNormals.size() % 3 == 0);
 
-    const bool isCollider1Trigger = mCollidersComponents.mIsTrigger[collider1Index];
-    const bool isCollider2Trigger = mCollidersComponents.mIsTrigger[collider2Index];
-    reportContacts = reportContacts && !isCollider1Trigger && !isCollider2Trigger;
-
     CollisionShape* shape1 = nullptr;
     CollisionShape* shape2 = nullptr;
 
@@ -513,10 +575,16 @@ void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPair
     const uint32 nbShapeIds = static_cast<uint32>(shapeIds.size());
     for (uint32 i=0; i < nbShapeIds; i++) {
 
-        // Create a triangle collision shape (the allocated memory for the TriangleShape will be released in the
-        // destructor of the corresponding NarrowPhaseInfo.
-        TriangleShape* triangleShape = new (allocator.allocate(sizeof(TriangleShape)))
-                                       TriangleShape(&(triangleVertices[i * 3]), &(triangleVerticesNormals[i * 3]), shapeIds[i], mTriangleHalfEdgeStructure, allocator);
+        // If the triangle is not overlapping with the convex shape AABB (the cached
+        // triangles are overlapping with the larger AABB of the cache)
+        if (!aabb.testCollisionTriangleAABB(&(triangleVertices[i * 3]))) {
+            continue;
+        }
+
+        // Get a triangle collision shape for the triangle (the triangle shapes are owned by the narrow-phase
+        // input and reused between frames instead of being allocated and constructed for each triangle)
+        TriangleShape* triangleShape = narrowPhaseInput.getTriangleShape(&(triangleVertices[i * 3]), &(triangleVerticesNormals[i * 3]),
+                                                                         shapeIds[i], trianglesInternalEdges[i], mTriangleHalfEdgeStructure);
 
     #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -539,7 +607,7 @@ void CollisionDetectionSystem::computeConvexVsConcaveMiddlePhase(OverlappingPair
         // Create a narrow phase info for the narrow-phase collision detection
         narrowPhaseInput.addNarrowPhaseTest(overlappingPair.pairID, collider1, collider2, shape1, shape2,
                                             shape1LocalToWorldTransform, shape2LocalToWorldTransform,
-                                            overlappingPair.narrowPhaseAlgorithmType, reportContacts, lastFrameInfo, allocator);
+                                            overlappingPair.narrowPhaseAlgorithmType, reportContacts, contactMargin, lastFrameInfo);
     }
 }
 
@@ -556,6 +624,7 @@ bool CollisionDetectionSystem::testNarrowPhaseCollision(NarrowPhaseInput& narrow
     SphereVsConvexPolyhedronAlgorithm* sphereVsConvexPolyAlgo = mCollisionDispatch.getSphereVsConvexPolyhedronAlgorithm();
     CapsuleVsConvexPolyhedronAlgorithm* capsuleVsConvexPolyAlgo = mCollisionDispatch.getCapsuleVsConvexPolyhedronAlgorithm();
     ConvexPolyhedronVsConvexPolyhedronAlgorithm* convexPolyVsConvexPolyAlgo = mCollisionDispatch.getConvexPolyhedronVsConvexPolyhedronAlgorithm();
+    GenericConvexVsConvexAlgorithm* genericConvexVsConvexAlgo = mCollisionDispatch.getGenericConvexVsConvexAlgorithm();
 
     // get the narrow-phase batches to test for collision for contacts
     NarrowPhaseInfoBatch& sphereVsSphereBatchContacts = narrowPhaseInput.getSphereVsSphereBatch();
@@ -564,6 +633,7 @@ bool CollisionDetectionSystem::testNarrowPhaseCollision(NarrowPhaseInput& narrow
     NarrowPhaseInfoBatch& sphereVsConvexPolyhedronBatchContacts = narrowPhaseInput.getSphereVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& capsuleVsConvexPolyhedronBatchContacts = narrowPhaseInput.getCapsuleVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& convexPolyhedronVsConvexPolyhedronBatchContacts = narrowPhaseInput.getConvexPolyhedronVsConvexPolyhedronBatch();
+    NarrowPhaseInfoBatch& genericConvexVsConvexBatchContacts = narrowPhaseInput.getGenericConvexVsConvexBatch();
 
     // Compute the narrow-phase collision detection for each kind of collision shapes (for contacts)
     if (sphereVsSphereBatchContacts.getNbObjects() > 0) {
@@ -582,7 +652,11 @@ bool CollisionDetectionSystem::testNarrowPhaseCollision(NarrowPhaseInput& narrow
         contactFound |= capsuleVsConvexPolyAlgo->testCollision(capsuleVsConvexPolyhedronBatchContacts, 0, capsuleVsConvexPolyhedronBatchContacts.getNbObjects(), clipWithPreviousAxisIfStillColliding, allocator);
     }
     if (convexPolyhedronVsConvexPolyhedronBatchContacts.getNbObjects() > 0) {
-        contactFound |= convexPolyVsConvexPolyAlgo->testCollision(convexPolyhedronVsConvexPolyhedronBatchContacts, 0, convexPolyhedronVsConvexPolyhedronBatchContacts.getNbObjects(), clipWithPreviousAxisIfStillColliding, allocator);
+        contactFound |= convexPolyVsConvexPolyAlgo->testCollision(convexPolyhedronVsConvexPolyhedronBatchContacts, 0, convexPolyhedronVsConvexPolyhedronBatchContacts.getNbObjects(), clipWithPreviousAxisIfStillColliding,
+                                                                  mWorld->mConfig.convexPolyhedronEPAMinNbEdgePairs, allocator);
+    }
+    if (genericConvexVsConvexBatchContacts.getNbObjects() > 0) {
+        contactFound |= genericConvexVsConvexAlgo->testCollision(genericConvexVsConvexBatchContacts, 0, genericConvexVsConvexBatchContacts.getNbObjects(), allocator);
     }
 
     return contactFound;
@@ -592,11 +666,14 @@ bool CollisionDetectionSystem::testNarrowPhaseCollision(NarrowPhaseInput& narrow
 void CollisionDetectionSystem::processAllPotentialContacts(NarrowPhaseInput& narrowPhaseInput, bool updateLastFrameInfo,
                                                      Array<ContactPointInfo>& potentialContactPoints,
                                                      Array<ContactManifoldInfo>& potentialContactManifolds,
-                                                     Array<ContactPair>* contactPairs) {
+                                                     Array<ContactPair>* contactPairs, Array<uint64>* contactPairsToReport) {
 
     assert(contactPairs->size() == 0);
 
-    Map<uint64, uint> mapPairIdToContactPairIndex(mMemoryManager.getHeapAllocator(), mPreviousMapPairIdToContactPairIndex.size());
+    // Reuse the memory of the map from the previous call
+    Map<uint64, uint>& mapPairIdToContactPairIndex = mMapPairIdToContactPairIndex;
+    mapPairIdToContactPairIndex.clear();
+    mapPairIdToContactPairIndex.reserve(mPreviousMapPairIdToContactPairIndex.size());
 
     // get the narrow-phase batches to test for collision
     NarrowPhaseInfoBatch& sphereVsSphereBatch = narrowPhaseInput.getSphereVsSphereBatch();
@@ -605,15 +682,18 @@ void CollisionDetectionSystem::processAllPotentialContacts(NarrowPhaseInput& nar
     NarrowPhaseInfoBatch& sphereVsConvexPolyhedronBatch = narrowPhaseInput.getSphereVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& capsuleVsConvexPolyhedronBatch = narrowPhaseInput.getCapsuleVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& convexPolyhedronVsConvexPolyhedronBatch = narrowPhaseInput.getConvexPolyhedronVsConvexPolyhedronBatch();
+    NarrowPhaseInfoBatch& genericConvexVsConvexBatch = narrowPhaseInput.getGenericConvexVsConvexBatch();
 
     // Process the potential contacts
-    processPotentialContacts(sphereVsSphereBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs);
-    processPotentialContacts(sphereVsCapsuleBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs);
-    processPotentialContacts(capsuleVsCapsuleBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs);
-    processPotentialContacts(sphereVsConvexPolyhedronBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs);
-    processPotentialContacts(capsuleVsConvexPolyhedronBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs);
+    processPotentialContacts(sphereVsSphereBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs, contactPairsToReport);
+    processPotentialContacts(sphereVsCapsuleBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs, contactPairsToReport);
+    processPotentialContacts(capsuleVsCapsuleBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs, contactPairsToReport);
+    processPotentialContacts(sphereVsConvexPolyhedronBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs, contactPairsToReport);
+    processPotentialContacts(capsuleVsConvexPolyhedronBatch, updateLastFrameInfo, potentialContactPoints, potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs, contactPairsToReport);
     processPotentialContacts(convexPolyhedronVsConvexPolyhedronBatch, updateLastFrameInfo, potentialContactPoints,
-                             potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs);
+                             potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs, contactPairsToReport);
+    processPotentialContacts(genericConvexVsConvexBatch, updateLastFrameInfo, potentialContactPoints,
+                             potentialContactManifolds, mapPairIdToContactPairIndex, contactPairs, contactPairsToReport);
 }
 
 // Compute the narrow-phase collision detection
@@ -632,9 +712,13 @@ void CollisionDetectionSystem::computeNarrowPhase() {
     // Test the narrow-phase collision detection on the batches to be tested
     testNarrowPhaseCollision(mNarrowPhaseInput, true, allocator);
 
+    // The contact pairs to report are only selected if there is an event listener
+    mContactPairsToReport.clear();
+    Array<uint64>* contactPairsToReport = mWorld->mEventListener != nullptr ? &mContactPairsToReport : nullptr;
+
     // Process all the potential contacts after narrow-phase collision
     processAllPotentialContacts(mNarrowPhaseInput, true, mPotentialContactPoints,
-                                mPotentialContactManifolds, mCurrentContactPairs);
+                                mPotentialContactManifolds, mCurrentContactPairs, contactPairsToReport);
 
     // Reduce the number of contact points in the manifolds
     reducePotentialContactManifolds(mCurrentContactPairs, mPotentialContactManifolds, mPotentialContactPoints);
@@ -721,6 +805,7 @@ void CollisionDetectionSystem::computeOverlapSnapshotContactPairs(NarrowPhaseInp
     NarrowPhaseInfoBatch& sphereVsConvexPolyhedronBatch = narrowPhaseInput.getSphereVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& capsuleVsConvexPolyhedronBatch = narrowPhaseInput.getCapsuleVsConvexPolyhedronBatch();
     NarrowPhaseInfoBatch& convexPolyhedronVsConvexPolyhedronBatch = narrowPhaseInput.getConvexPolyhedronVsConvexPolyhedronBatch();
+    NarrowPhaseInfoBatch& genericConvexVsConvexBatch = narrowPhaseInput.getGenericConvexVsConvexBatch();
 
     // Process the potential contacts
     computeOverlapSnapshotContactPairs(sphereVsSphereBatch, contactPairs, setOverlapContactPairId);
@@ -729,6 +814,7 @@ void CollisionDetectionSystem::computeOverlapSnapshotContactPairs(NarrowPhaseInp
     computeOverlapSnapshotContactPairs(sphereVsConvexPolyhedronBatch, contactPairs, setOverlapContactPairId);
     computeOverlapSnapshotContactPairs(capsuleVsConvexPolyhedronBatch, contactPairs, setOverlapContactPairId);
     computeOverlapSnapshotContactPairs(convexPolyhedronVsConvexPolyhedronBatch, contactPairs, setOverlapContactPairId);
+    computeOverlapSnapshotContactPairs(genericConvexVsConvexBatch, contactPairs, setOverlapContactPairId);
 }
 
 // Notify that the overlapping pairs where a given collider is involved need to be tested for overlap
@@ -805,7 +891,7 @@ bool CollisionDetectionSystem::computeNarrowPhaseCollisionSnapshot(NarrowPhaseIn
         Array<ContactPoint> contactPoints(allocator);
 
         // Process all the potential contacts after narrow-phase collision
-        processAllPotentialContacts(narrowPhaseInput, true, potentialContactPoints, potentialContactManifolds, &contactPairs);
+        processAllPotentialContacts(narrowPhaseInput, true, potentialContactPoints, potentialContactManifolds, &contactPairs, nullptr);
 
         // Reduce the number of contact points in the manifolds
         reducePotentialContactManifolds(&contactPairs, potentialContactManifolds, potentialContactPoints);
@@ -814,7 +900,7 @@ bool CollisionDetectionSystem::computeNarrowPhaseCollisionSnapshot(NarrowPhaseIn
         createSnapshotContacts(contactPairs, contactManifolds, contactPoints, potentialContactManifolds, potentialContactPoints);
 
         // Report the contacts to the user
-        reportContacts(callback, &contactPairs, &contactManifolds, &contactPoints, lostContactPairs);
+        reportContacts(callback, &contactPairs, &contactManifolds, &contactPoints, lostContactPairs, false);
     }
 
     return collisionFound;
@@ -883,7 +969,8 @@ void CollisionDetectionSystem::createContacts() {
 
             // Create and add the contact manifold
             mCurrentContactManifolds->emplace(contactPair.body1Entity, contactPair.body2Entity, contactPair.collider1Entity,
-                                              contactPair.collider2Entity, contactPointsIndex, nbContactPoints);
+                                              contactPair.collider2Entity, contactPointsIndex, nbContactPoints,
+                                              contactPair.frictionCoefficient, contactPair.restitutionFactor);
 
             assert(potentialManifold.nbPotentialContactPoints > 0);
 
@@ -893,7 +980,8 @@ void CollisionDetectionSystem::createContacts() {
                 ContactPointInfo& potentialContactPoint = mPotentialContactPoints[potentialManifold.potentialContactPointsIndices[c]];
 
                 // Create and add the contact point
-                mCurrentContactPoints->emplace(potentialContactPoint, mWorld->mConfig.persistentContactDistanceThreshold);
+                mCurrentContactPoints->emplace(potentialContactPoint, mWorld->mConfig.persistentContactDistanceThreshold,
+                                               mWorld->mConfig.contactMargin);
             }
         }
     }
@@ -901,6 +989,11 @@ void CollisionDetectionSystem::createContacts() {
     // Initialize the current contacts with the contacts from the previous frame (for warmstarting)
     initContactsWithPreviousOnes();
 
+    // Select the contact pairs to report (only if they are reported to an event listener)
+    if (mWorld->mEventListener != nullptr) {
+        computeContactPairsToReport();
+    }
+
     // Compute the lost contacts (contact pairs that were colliding in previous frame but not in this one)
     computeLostContactPairs();
 
@@ -923,11 +1016,63 @@ void CollisionDetectionSystem::createContacts() {
     mNarrowPhaseInput.clear();
 }
 
+// Select the contact pairs of the current frame that need to be reported to the event listener
+/// A contact pair is reported if one of its two colliders reports its contacts. Those pairs have been
+/// added to the array of contact pairs to report during the narrow-phase. A persisting contact pair
+/// (ContactStay event) is only kept if the total penetration impulse of its contact points (from the
+/// previous simulation step) reaches the contact report impulse threshold of such a collider.
+void CollisionDetectionSystem::computeContactPairsToReport() {
+
+    RP3D_PROFILE("CollisionDetectionSystem::computeContactPairsToReport()", mProfiler);
+
+    uint64 nbContactPairsToReport = 0;
+
+    const uint64 nbCandidateContactPairs = mContactPairsToReport.size();
+    for (uint64 i=0; i < nbCandidateContactPairs; i++) {
+
+        const uint64 contactPairIndex = mContactPairsToReport[i];
+        const ContactPair& contactPair = (*mCurrentContactPairs)[contactPairIndex];
+
+        assert(!contactPair.isTrigger);
+
+        // The ContactStart events are always reported
+        bool isReported = true;
+
+        if (contactPair.collidingInPreviousFrame) {
+
+            const uint32 collider1Index = mCollidersComponents.getEntityIndex(contactPair.collider1Entity);
+            const uint32 collider2Index = mCollidersComponents.getEntityIndex(contactPair.collider2Entity);
+
+            // Compute the total penetration impulse of the contact pair
+            decimal totalImpulse = decimal(0.0);
+            for (uint32 c=contactPair.contactPointsIndex; c < contactPair.contactPointsIndex + contactPair.nbToTalContactPoints; c++) {
+                totalImpulse += (*mCurrentContactPoints)[c].getPenetrationImpulse();
+            }
+
+            isReported = (mCollidersComponents.mReportContacts[collider1Index] &&
+                          totalImpulse >= mCollidersComponents.mContactReportImpulseThresholds[collider1Index]) ||
+                         (mCollidersComponents.mReportContacts[collider2Index] &&
+                          totalImpulse >= mCollidersComponents.mContactReportImpulseThresholds[collider2Index]);
+        }
+
+        // Keep the reported pairs (in the same order) at the beginning of the array
+        if (isReported) {
+            mContactPairsToReport[nbContactPairsToReport] = contactPairIndex;
+            nbContactPairsToReport++;
+        }
+    }
+
+    // Remove the pairs that are not reported from the end of the array
+    while (mContactPairsToReport.size() > nbContactPairsToReport) {
+        mContactPairsToReport.removeAt(mContactPairsToReport.size() - 1);
+    }
+}
+
 // Compute the lost contact pairs (contact pairs in contact in the previous frame but not in the current one)
 void CollisionDetectionSystem::computeLostContactPairs() {
 
-    // For each convex pair
-    const uint32 nbConvexPairs = static_cast<uint32>(mOverlappingPairs.mConvexPairs.size());
+    // For each enabled convex pair (disabled pairs have not been tested in this frame)
+    const uint32 nbConvexPairs = static_cast<uint32>(mOverlappingPairs.getNbEnabledConvexPairs());
     for (uint32 i=0; i < nbConvexPairs; i++) {
 
         // If the two colliders of the pair were colliding in the previous frame but not in the current one
@@ -942,8 +1087,8 @@ void CollisionDetectionSystem::computeLostContactPairs() {
         }
     }
 
-    // For each convex pair
-    const uint32 nbConcavePairs = static_cast<uint32>(mOverlappingPairs.mConcavePairs.size());
+    // For each enabled concave pair
+    const uint32 nbConcavePairs = static_cast<uint32>(mOverlappingPairs.getNbEnabledConcavePairs());
     for (uint32 i=0; i < nbConcavePairs; i++) {
 
         // If the two colliders of the pair were colliding in the previous frame but not in the current one
@@ -994,7 +1139,8 @@ void CollisionDetectionSystem::createSnapshotContacts(Array<ContactPair>& contac
 
             // Create and add the contact manifold
             contactManifolds.emplace(contactPair.body1Entity, contactPair.body2Entity, contactPair.collider1Entity,
-                                     contactPair.collider2Entity, contactPointsIndex, nbContactPoints);
+                                     contactPair.collider2Entity, contactPointsIndex, nbContactPoints,
+                                     contactPair.frictionCoefficient, contactPair.restitutionFactor);
 
             assert(potentialManifold.nbPotentialContactPoints > 0);
 
@@ -1004,7 +1150,8 @@ void CollisionDetectionSystem::createSnapshotContacts(Array<ContactPair>& contac
                 ContactPointInfo& potentialContactPoint = potentialContactPoints[potentialManifold.potentialContactPointsIndices[c]];
 
                 // Create a new contact point
-                ContactPoint contactPoint(potentialContactPoint, mWorld->mConfig.persistentContactDistanceThreshold);
+                ContactPoint contactPoint(potentialContactPoint, mWorld->mConfig.persistentContactDistanceThreshold,
+                                          mWorld->mConfig.contactMargin);
 
                 // Add the contact point
                 contactPoints.add(contactPoint);
@@ -1148,7 +1295,7 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
                                                         Array<ContactPointInfo>& potentialContactPoints,
                                                         Array<ContactManifoldInfo>& potentialContactManifolds,
                                                         Map<uint64, uint>& mapPairIdToContactPairIndex,
-                                                        Array<ContactPair>* contactPairs) {
+                                                        Array<ContactPair>* contactPairs, Array<uint64>* contactPairsToReport) {
 
     RP3D_PROFILE("CollisionDetectionSystem::processPotentialContacts()", mProfiler);
 
@@ -1199,10 +1346,17 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
                 const uint32 newContactPairIndex = static_cast<uint32>(contactPairs->size());
 
                 contactPairs->emplace(pairId, body1Entity, body2Entity, collider1Entity, collider2Entity,
-                                      newContactPairIndex, overlappingPair->collidingInPreviousFrame, isTrigger);
+                                      newContactPairIndex, overlappingPair->collidingInPreviousFrame, isTrigger,
+                                      overlappingPair->frictionCoefficient, overlappingPair->restitutionFactor);
 
                 ContactPair* pairContact = &((*contactPairs)[newContactPairIndex]);
 
+                // If one of the colliders reports its contacts, the pair might be reported to the event listener
+                if (contactPairsToReport != nullptr && !isTrigger &&
+                    (mCollidersComponents.mReportContacts[collider1Index] || mCollidersComponents.mReportContacts[collider2Index])) {
+                    contactPairsToReport->add(newContactPairIndex);
+                }
+
                 // Create a new potential contact manifold for the overlapping pair
                 uint32 contactManifoldIndex = static_cast<uint>(potentialContactManifolds.size());
                 potentialContactManifolds.emplace(pairId);
@@ -1246,10 +1400,17 @@ void CollisionDetectionSystem::processPotentialContacts(NarrowPhaseInfoBatch& na
 
                     const uint32 newContactPairIndex = static_cast<uint32>(contactPairs->size());
                     contactPairs->emplace(pairId, body1Entity, body2Entity, collider1Entity, collider2Entity,
-                                                       newContactPairIndex, overlappingPair->collidingInPreviousFrame , isTrigger);
+                                                       newContactPairIndex, overlappingPair->collidingInPreviousFrame , isTrigger,
+                                                       overlappingPair->frictionCoefficient, overlappingPair->restitutionFactor);
                     pairContact = &((*contactPairs)[newContactPairIndex]);
                     mapPairIdToContactPairIndex.add(Pair<uint64, uint>(pairId, newContactPairIndex));
 
+                    // If one of the colliders reports its contacts, the pair might be reported to the event listener
+                    if (contactPairsToReport != nullptr && !isTrigger &&
+                        (mCollidersComponents.mReportContacts[collider1Index] || mCollidersComponents.mReportContacts[collider2Index])) {
+                        contactPairsToReport->add(newContactPairIndex);
+                    }
+
                 }
                 else { // If a ContactPair already exists for this overlapping pair, we use this one
 
@@ -1643,7 +1804,7 @@ void CollisionDetectionSystem::reportContactsAndTriggers() {
     // Report contacts and triggers to the user
     if (mWorld->mEventListener != nullptr) {
 
-        reportContacts(*(mWorld->mEventListener), mCurrentContactPairs, mCurrentContactManifolds, mCurrentContactPoints, mLostContactPairs);
+        reportContacts(*(mWorld->mEventListener), mCurrentContactPairs, mCurrentContactManifolds, mCurrentContactPoints, mLostContactPairs, true);
         reportTriggers(*(mWorld->mEventListener), mCurrentContactPairs, mLostContactPairs);
     }
 
@@ -1656,24 +1817,108 @@ void CollisionDetectionSystem::reportContactsAndTriggers() {
     mOverlappingPairs.updateCollidingInPreviousFrame();
 
     mLostContactPairs.clear(true);
+    mLostContactPairsToReport.clear();
 }
 
 // Report all contacts to the user
 void CollisionDetectionSystem::reportContacts(CollisionCallback& callback, Array<ContactPair>* contactPairs,
-                                              Array<ContactManifold>* manifolds, Array<ContactPoint>* contactPoints, Array<ContactPair>& lostContactPairs) {
+                                              Array<ContactManifold>* manifolds, Array<ContactPoint>* contactPoints, Array<ContactPair>& lostContactPairs,
+                                              bool onlyReportedPairs) {
 
     RP3D_PROFILE("CollisionDetectionSystem::reportContacts()", mProfiler);
 
     // If there are contacts
     if (contactPairs->size() + lostContactPairs.size() > 0) {
 
-        CollisionCallback::CallbackData callbackData(contactPairs, manifolds, contactPoints, lostContactPairs, *mWorld);
+        CollisionCallback::CallbackData callbackData(contactPairs, manifolds, contactPoints, lostContactPairs,
+                                                     onlyReportedPairs ? &mContactPairsToReport : nullptr,
+                                                     onlyReportedPairs ? &mLostContactPairsToReport : nullptr, *mWorld);
+
+        // If all the contact pairs have been filtered out, there is nothing to report
+        if (onlyReportedPairs && callbackData.getNbContactPairs() == 0) return;
+
+        // Note that the flat view of the contacts is only computed if the callback requests it
 
         // Call the callback method to report the contacts
         callback.onContact(callbackData);
     }
 }
 
+// Fill-in the flat arrays of contacts data that are reported to the user
+/// The contact pairs data are stored in the same order as the contact pairs of the
+/// CollisionCallback::CallbackData (contact pairs first and then lost contact pairs)
+void CollisionDetectionSystem::computeFlatContacts(const CollisionCallback::CallbackData& callbackData) {
+
+    RP3D_PROFILE("CollisionDetectionSystem::computeFlatContacts()", mProfiler);
+
+    // The arrays are cleared (but not released) because they are reused at each frame
+    mFlatContactPairs.clear();
+    mFlatContactManifolds.clear();
+    mFlatContactPoints.clear();
+
+    // For each reported contact pair
+    const uint64 nbContactPairs = callbackData.mContactPairsIndices.size();
+    for (uint64 p=0; p < nbContactPairs; p++) {
+
+        const ContactPair& contactPair = (*callbackData.mContactPairs)[callbackData.mContactPairsIndices[p]];
+
+        const Transform& collider1ToWorld = mCollidersComponents.getLocalToWorldTransform(contactPair.collider1Entity);
+        const Transform& collider2ToWorld = mCollidersComponents.getLocalToWorldTransform(contactPair.collider2Entity);
+
+        const CollisionCallback::ContactPair::EventType eventType = contactPair.collidingInPreviousFrame ?
+                                                                        CollisionCallback::ContactPair::EventType::ContactStay :
+                                                                        CollisionCallback::ContactPair::EventType::ContactStart;
+        const CollisionCallback::FlatContactPair pairData = {contactPair.body1Entity, contactPair.body2Entity,
+                                                             contactPair.collider1Entity, contactPair.collider2Entity, eventType,
+                                                             static_cast<uint32>(mFlatContactManifolds.size()), contactPair.nbContactManifolds,
+                                                             static_cast<uint32>(mFlatContactPoints.size()), contactPair.nbToTalContactPoints};
+        mFlatContactPairs.add(pairData);
+
+        // For each contact manifold of the pair
+        for (uint32 m=contactPair.contactManifoldsIndex; m < contactPair.contactManifoldsIndex + contactPair.nbContactManifolds; m++) {
+
+            const ContactManifold& manifold = (*callbackData.mContactManifolds)[m];
+
+            CollisionCallback::FlatContactManifold manifoldData;
+            manifoldData.contactPointsIndex = static_cast<uint32>(mFlatContactPoints.size());
+            manifoldData.nbContactPoints = manifold.nbContactPoints;
+            manifoldData.frictionImpulse1 = manifold.frictionImpulse1;
+            manifoldData.frictionImpulse2 = manifold.frictionImpulse2;
+            manifoldData.frictionTwistImpulse = manifold.frictionTwistImpulse;
+            mFlatContactManifolds.add(manifoldData);
+
+            // For each contact point of the manifold
+            for (uint32 c=manifold.contactPointsIndex; c < manifold.contactPointsIndex + manifold.nbContactPoints; c++) {
+
+                const ContactPoint& contactPoint = (*callbackData.mContactPoints)[c];
+
+                CollisionCallback::FlatContactPoint pointData;
+                pointData.worldPointOnCollider1 = collider1ToWorld * contactPoint.getLocalPointOnShape1();
+                pointData.worldPointOnCollider2 = collider2ToWorld * contactPoint.getLocalPointOnShape2();
+                pointData.worldNormal = contactPoint.getNormal();
+                pointData.penetrationDepth = contactPoint.getPenetrationDepth();
+                pointData.penetrationImpulse = contactPoint.getPenetrationImpulse();
+                mFlatContactPoints.add(pointData);
+            }
+        }
+    }
+
+    // For each reported lost contact pair
+    const uint64 nbLostContactPairs = callbackData.mLostContactPairsIndices.size();
+    for (uint64 p=0; p < nbLostContactPairs; p++) {
+
+        const ContactPair& lostContactPair = callbackData.mLostContactPairs[callbackData.mLostContactPairsIndices[p]];
+
+        // A lost contact pair does not have any contact manifold or contact point anymore
+        const CollisionCallback::FlatContactPair pairData = {lostContactPair.body1Entity, lostContactPair.body2Entity,
+                                                             lostContactPair.collider1Entity, lostContactPair.collider2Entity,
+                                                             CollisionCallback::ContactPair::EventType::ContactExit,
+                                                             static_cast<uint32>(mFlatContactManifolds.size()), 0,
+                                                             static_cast<uint32>(mFlatContactPoints.size()), 0};
+        mFlatContactPairs.add(pairData);
+    }
+}
+
 // Report all triggers to the user
 void CollisionDetectionSystem::reportTriggers(EventListener& eventListener, Array<ContactPair>* contactPairs, Array<ContactPair>& lostContactPairs) {
 
@@ -1697,7 +1942,7 @@ void CollisionDetectionSystem::reportDebugRenderingContacts(Array<ContactPair>*
     // If there are contacts
     if (contactPairs->size() + lostContactPairs.size() > 0) {
 
-        CollisionCallback::CallbackData callbackData(contactPairs, manifolds, contactPoints, lostContactPairs, *mWorld);
+        CollisionCallback::CallbackData callbackData(contactPairs, manifolds, contactPoints, lostContactPairs, nullptr, nullptr, *mWorld);
 
         // Call the callback method to report the contacts
         mWorld->mDebugRenderer.onContact(callbackData);
@@ -1706,7 +1951,7 @@ void CollisionDetectionSystem::reportDebugRenderingContacts(Array<ContactPair>*
 
 bool CollisionDetectionSystem::testOverlap(CollisionBody* body)
 {
-  NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mOverlappingPairs);
+  NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mMemoryManager.getPoolAllocator(), mOverlappingPairs);
 
   // Compute the broad-phase collision detection
   computeBroadPhase();
@@ -1726,7 +1971,7 @@ bool CollisionDetectionSystem::testOverlap(CollisionBody* body)
 // Return true if two bodies overlap (collide)
 bool CollisionDetectionSystem::testOverlap(CollisionBody* body1, CollisionBody* body2) {
 
-    NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mOverlappingPairs);
+    NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mMemoryManager.getPoolAllocator(), mOverlappingPairs);
 
     // Compute the broad-phase collision detection
     computeBroadPhase();
@@ -1751,7 +1996,7 @@ bool CollisionDetectionSystem::testOverlap(CollisionBody* body1, CollisionBody*
 // Report all the bodies that overlap (collide) in the world
 void CollisionDetectionSystem::testOverlap(OverlapCallback& callback) {
 
-    NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mOverlappingPairs);
+    NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mMemoryManager.getPoolAllocator(), mOverlappingPairs);
 
     // Compute the broad-phase collision detection
     computeBroadPhase();
@@ -1766,7 +2011,7 @@ void CollisionDetectionSystem::testOverlap(OverlapCallback& callback) {
 // Report all the bodies that overlap (collide) with the body in parameter
 void CollisionDetectionSystem::testOverlap(CollisionBody* body, OverlapCallback& callback) {
 
-    NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mOverlappingPairs);
+    NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mMemoryManager.getPoolAllocator(), mOverlappingPairs);
 
     // Compute the broad-phase collision detection
     computeBroadPhase();
@@ -1789,7 +2034,7 @@ void CollisionDetectionSystem::testOverlap(CollisionBody* body, OverlapCallback&
 // Test collision and report contacts between two bodies.
 void CollisionDetectionSystem::testCollision(CollisionBody* body1, CollisionBody* body2, CollisionCallback& callback) {
 
-    NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mOverlappingPairs);
+    NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mMemoryManager.getPoolAllocator(), mOverlappingPairs);
 
     // Compute the broad-phase collision detection
     computeBroadPhase();
@@ -1812,7 +2057,7 @@ void CollisionDetectionSystem::testCollision(CollisionBody* body1, CollisionBody
 // Test collision and report all the contacts involving the body in parameter
 void CollisionDetectionSystem::testCollision(CollisionBody* body, CollisionCallback& callback) {
 
-    NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mOverlappingPairs);
+    NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mMemoryManager.getPoolAllocator(), mOverlappingPairs);
 
     // Compute the broad-phase collision detection
     computeBroadPhase();
@@ -1835,7 +2080,7 @@ void CollisionDetectionSystem::testCollision(CollisionBody* body, CollisionCallb
 // Test collision and report contacts between each colliding bodies in the world
 void CollisionDetectionSystem::testCollision(CollisionCallback& callback) {
 
-    NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mOverlappingPairs);
+    NarrowPhaseInput narrowPhaseInput(mMemoryManager.getPoolAllocator(), mMemoryManager.getPoolAllocator(), mOverlappingPairs);
 
     // Compute the broad-phase collision detection
     computeBroadPhase();
@@ -29,11 +29,13 @@
 #include <reactphysics3d/components/BallAndSocketJointComponents.h>
 #include <reactphysics3d/utils/Profiler.h>
 #include <reactphysics3d/engine/Island.h>
+#include <reactphysics3d/engine/Islands.h>
+#include <reactphysics3d/memory/MemoryManager.h>
 
 using namespace reactphysics3d;
 
 // Constructor
-ConstraintSolverSystem::ConstraintSolverSystem(PhysicsWorld& world, Islands& islands, RigidBodyComponents& rigidBodyComponents,
+ConstraintSolverSystem::ConstraintSolverSystem(MemoryManager& memoryManager, PhysicsWorld& world, Islands& islands, RigidBodyComponents& rigidBodyComponents,
                                                TransformComponents& transformComponents,
                                                JointComponents& jointComponents,
                                                BallAndSocketJointComponents& ballAndSocketJointComponents,
@@ -45,7 +47,18 @@ ConstraintSolverSystem::ConstraintSolverSystem(PhysicsWorld& world, Islands& isl
                    mSolveBallAndSocketJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, ballAndSocketJointComponents),
                    mSolveFixedJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, fixedJointComponents),
                    mSolveHingeJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, hingeJointComponents),
-                   mSolveSliderJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, sliderJointComponents) {
+                   mSolveSliderJointSystem(world, rigidBodyComponents, transformComponents, jointComponents, sliderJointComponents),
+                   mArticulationSolverSystem(memoryManager.getHeapAllocator(), islands, rigidBodyComponents, jointComponents,
+                                             ballAndSocketJointComponents, fixedJointComponents, hingeJointComponents,
+                                             sliderJointComponents),
+                   mJointComponents(jointComponents), mBallAndSocketJointComponents(ballAndSocketJointComponents),
+                   mFixedJointComponents(fixedJointComponents), mHingeJointComponents(hingeJointComponents),
+                   mSliderJointComponents(sliderJointComponents),
+                   mIslandsBallAndSocketJoints(memoryManager.getHeapAllocator()), mIslandsFixedJoints(memoryManager.getHeapAllocator()),
+                   mIslandsHingeJoints(memoryManager.getHeapAllocator()), mIslandsSliderJoints(memoryManager.getHeapAllocator()),
+                   mHasPositionErrors(false), mIslandsHavePositionError(memoryManager.getHeapAllocator()),
+                   mPositionErrorBallAndSocketJoints(memoryManager.getHeapAllocator()), mPositionErrorFixedJoints(memoryManager.getHeapAllocator()),
+                   mPositionErrorHingeJoints(memoryManager.getHeapAllocator()), mPositionErrorSliderJoints(memoryManager.getHeapAllocator()) {
 
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -82,6 +95,9 @@ void ConstraintSolverSystem::initialize(decimal dt) {
     mSolveHingeJointSystem.initBeforeSolve();
     mSolveSliderJointSystem.initBeforeSolve();
 
+    // Build the articulation trees from the initialized joints
+    mArticulationSolverSystem.initBeforeSolve();
+
     if (mIsWarmStartingActive) {
         mSolveBallAndSocketJointSystem.warmstart();
         mSolveFixedJointSystem.warmstart();
@@ -95,19 +111,256 @@ void ConstraintSolverSystem::solveVelocityConstraints() {
 
     RP3D_PROFILE("ConstraintSolverSystem::solveVelocityConstraints()", mProfiler);
 
+    resetMaxImpulseChange();
+
     mSolveBallAndSocketJointSystem.solveVelocityConstraint();
     mSolveFixedJointSystem.solveVelocityConstraint();
     mSolveHingeJointSystem.solveVelocityConstraint();
     mSolveSliderJointSystem.solveVelocityConstraint();
 }
 
+// Order the joints of each type island by island
+/// This must be called after the joint solvers have been initialized for the current frame
+void ConstraintSolverSystem::orderJointsByIsland() {
+
+    RP3D_PROFILE("ConstraintSolverSystem::orderJointsByIsland()", mProfiler);
+
+    mIslandsBallAndSocketJoints.clear();
+    mIslandsFixedJoints.clear();
+    mIslandsHingeJoints.clear();
+    mIslandsSliderJoints.clear();
+
+    // For each island
+    const uint32 nbIslands = mIslands.getNbIslands();
+    for (uint32 i=0; i < nbIslands; i++) {
+
+        mIslandsBallAndSocketJoints.islandsStartIndex.add(static_cast<uint32>(mIslandsBallAndSocketJoints.componentIndices.size()));
+        mIslandsFixedJoints.islandsStartIndex.add(static_cast<uint32>(mIslandsFixedJoints.componentIndices.size()));
+        mIslandsHingeJoints.islandsStartIndex.add(static_cast<uint32>(mIslandsHingeJoints.componentIndices.size()));
+        mIslandsSliderJoints.islandsStartIndex.add(static_cast<uint32>(mIslandsSliderJoints.componentIndices.size()));
+
+        // For each joint of the island (in the order they have been reached while building the island)
+        const uint32 startJointIndex = mIslands.startJointEntitiesIndex[i];
+        const uint32 endJointIndex = startJointIndex + mIslands.nbJointsInIsland[i];
+        for (uint32 j=startJointIndex; j < endJointIndex; j++) {
+
+            const Entity jointEntity = mIslands.jointEntities[j];
+
+            // A disabled joint is not initialized for the solver
+            if (mJointComponents.getIsEntityDisabled(jointEntity)) continue;
+
+            switch(mJointComponents.getType(jointEntity)) {
+
+                case JointType::BALLSOCKETJOINT:
+                    mIslandsBallAndSocketJoints.componentIndices.add(mBallAndSocketJointComponents.getEntityIndex(jointEntity));
+                    break;
+                case JointType::FIXEDJOINT:
+                    mIslandsFixedJoints.componentIndices.add(mFixedJointComponents.getEntityIndex(jointEntity));
+                    break;
+                case JointType::HINGEJOINT:
+                    mIslandsHingeJoints.componentIndices.add(mHingeJointComponents.getEntityIndex(jointEntity));
+                    break;
+                case JointType::SLIDERJOINT:
+                    mIslandsSliderJoints.componentIndices.add(mSliderJointComponents.getEntityIndex(jointEntity));
+                    break;
+            }
+        }
+    }
+
+    mIslandsBallAndSocketJoints.islandsStartIndex.add(static_cast<uint32>(mIslandsBallAndSocketJoints.componentIndices.size()));
+    mIslandsFixedJoints.islandsStartIndex.add(static_cast<uint32>(mIslandsFixedJoints.componentIndices.size()));
+    mIslandsHingeJoints.islandsStartIndex.add(static_cast<uint32>(mIslandsHingeJoints.componentIndices.size()));
+    mIslandsSliderJoints.islandsStartIndex.add(static_cast<uint32>(mIslandsSliderJoints.componentIndices.size()));
+}
+
+// Solve the velocity constraints of a given island
+/// The joints of the island are solved batch by batch (one batch for each type of joint)
+void ConstraintSolverSystem::solveVelocityConstraints(uint32 islandIndex) {
+
+    resetMaxImpulseChange();
+
+    uint32 nbJoints = mIslandsBallAndSocketJoints.getNbIslandJoints(islandIndex);
+    if (nbJoints > 0) {
+        mSolveBallAndSocketJointSystem.solveVelocityConstraint(mIslandsBallAndSocketJoints.getIslandJoints(islandIndex), nbJoints);
+    }
+
+    nbJoints = mIslandsFixedJoints.getNbIslandJoints(islandIndex);
+    if (nbJoints > 0) {
+        mSolveFixedJointSystem.solveVelocityConstraint(mIslandsFixedJoints.getIslandJoints(islandIndex), nbJoints);
+    }
+
+    nbJoints = mIslandsHingeJoints.getNbIslandJoints(islandIndex);
+    if (nbJoints > 0) {
+        mSolveHingeJointSystem.solveVelocityConstraint(mIslandsHingeJoints.getIslandJoints(islandIndex), nbJoints);
+    }
+
+    nbJoints = mIslandsSliderJoints.getNbIslandJoints(islandIndex);
+    if (nbJoints > 0) {
+        mSolveSliderJointSystem.solveVelocityConstraint(mIslandsSliderJoints.getIslandJoints(islandIndex), nbJoints);
+    }
+}
+
+// Solve the joints of the articulations
+/// This is called after the contacts at each iteration so that the joints of the
+/// articulations are exactly satisfied at the end of the velocity solver
+void ConstraintSolverSystem::solveArticulations() {
+
+    RP3D_PROFILE("ConstraintSolverSystem::solveArticulations()", mProfiler);
+
+    mArticulationSolverSystem.solveVelocityConstraint();
+}
+
+// Solve the joints of the articulations of a given island
+void ConstraintSolverSystem::solveArticulations(uint32 islandIndex) {
+
+    mArticulationSolverSystem.solveVelocityConstraint(islandIndex);
+}
+
+// Check which joints have a position error larger than the slop after the integration of the positions
+void ConstraintSolverSystem::computePositionErrors() {
+
+    RP3D_PROFILE("ConstraintSolverSystem::computePositionErrors()", mProfiler);
+
+    mSolveBallAndSocketJointSystem.computePositionErrors();
+    mSolveFixedJointSystem.computePositionErrors();
+    mSolveHingeJointSystem.computePositionErrors();
+    mSolveSliderJointSystem.computePositionErrors();
+
+    // Check if a joint has a position error larger than the slop
+    mHasPositionErrors = false;
+    const uint32 nbJoints = mJointComponents.getNbEnabledComponents();
+    for (uint32 i=0; i < nbJoints; i++) {
+        mHasPositionErrors |= mJointComponents.mHasPositionError[i];
+    }
+}
+
+// Find the islands with a joint that has a position error larger than the slop
+/// This must be called after the joints have been ordered by island. The joints of the islands
+/// with a position error are gathered for the position solver. The position error is not corrected
+/// in the other islands because correcting a joint moves the bodies of the other joints of its island.
+void ConstraintSolverSystem::findPositionErrorIslands() {
+
+    RP3D_PROFILE("ConstraintSolverSystem::findPositionErrorIslands()", mProfiler);
+
+    mIslandsHavePositionError.clear();
+    mPositionErrorBallAndSocketJoints.clear();
+    mPositionErrorFixedJoints.clear();
+    mPositionErrorHingeJoints.clear();
+    mPositionErrorSliderJoints.clear();
+
+    // For each island
+    const uint32 nbIslands = mIslands.getNbIslands();
+    for (uint32 i=0; i < nbIslands; i++) {
+
+        bool hasPositionError = false;
+        for (uint32 j=mIslandsBallAndSocketJoints.islandsStartIndex[i]; j < mIslandsBallAndSocketJoints.islandsStartIndex[i + 1] && !hasPositionError; j++) {
+            hasPositionError = mJointComponents.mHasPositionError[mBallAndSocketJointComponents.mJointComponentIndices[mIslandsBallAndSocketJoints.componentIndices[j]]];
+        }
+        for (uint32 j=mIslandsFixedJoints.islandsStartIndex[i]; j < mIslandsFixedJoints.islandsStartIndex[i + 1] && !hasPositionError; j++) {
+            hasPositionError = mJointComponents.mHasPositionError[mFixedJointComponents.mJointComponentIndices[mIslandsFixedJoints.componentIndices[j]]];
+        }
+        for (uint32 j=mIslandsHingeJoints.islandsStartIndex[i]; j < mIslandsHingeJoints.islandsStartIndex[i + 1] && !hasPositionError; j++) {
+            hasPositionError = mJointComponents.mHasPositionError[mHingeJointComponents.mJointComponentIndices[mIslandsHingeJoints.componentIndices[j]]];
+        }
+        for (uint32 j=mIslandsSliderJoints.islandsStartIndex[i]; j < mIslandsSliderJoints.islandsStartIndex[i + 1] && !hasPositionError; j++) {
+            hasPositionError = mJointComponents.mHasPositionError[mSliderJointComponents.mJointComponentIndices[mIslandsSliderJoints.componentIndices[j]]];
+        }
+
+        mIslandsHavePositionError.add(hasPositionError);
+
+        if (!hasPositionError) continue;
+
+        // Gather the joints of the island for the position solver
+        for (uint32 j=mIslandsBallAndSocketJoints.islandsStartIndex[i]; j < mIslandsBallAndSocketJoints.islandsStartIndex[i + 1]; j++) {
+            mPositionErrorBallAndSocketJoints.add(mIslandsBallAndSocketJoints.componentIndices[j]);
+        }
+        for (uint32 j=mIslandsFixedJoints.islandsStartIndex[i]; j < mIslandsFixedJoints.islandsStartIndex[i + 1]; j++) {
+            mPositionErrorFixedJoints.add(mIslandsFixedJoints.componentIndices[j]);
+        }
+        for (uint32 j=mIslandsHingeJoints.islandsStartIndex[i]; j < mIslandsHingeJoints.islandsStartIndex[i + 1]; j++) {
+            mPositionErrorHingeJoints.add(mIslandsHingeJoints.componentIndices[j]);
+        }
+        for (uint32 j=mIslandsSliderJoints.islandsStartIndex[i]; j < mIslandsSliderJoints.islandsStartIndex[i + 1]; j++) {
+            mPositionErrorSliderJoints.add(mIslandsSliderJoints.componentIndices[j]);
+        }
+    }
+}
+
 // Solve the position constraints
+/// Only the joints of the islands with a position error are solved
 void ConstraintSolverSystem::solvePositionConstraints() {
 
     RP3D_PROFILE("ConstraintSolverSystem::solvePositionConstraints()", mProfiler);
 
-    mSolveBallAndSocketJointSystem.solvePositionConstraint();
-    mSolveFixedJointSystem.solvePositionConstraint();
-    mSolveHingeJointSystem.solvePositionConstraint();
-    mSolveSliderJointSystem.solvePositionConstraint();
+    resetMaxImpulseChange();
+
+    if (mPositionErrorBallAndSocketJoints.size() > 0) {
+        mSolveBallAndSocketJointSystem.solvePositionConstraint(&(mPositionErrorBallAndSocketJoints[0]),
+                                                               static_cast<uint32>(mPositionErrorBallAndSocketJoints.size()));
+    }
+    if (mPositionErrorFixedJoints.size() > 0) {
+        mSolveFixedJointSystem.solvePositionConstraint(&(mPositionErrorFixedJoints[0]), static_cast<uint32>(mPositionErrorFixedJoints.size()));
+    }
+    if (mPositionErrorHingeJoints.size() > 0) {
+        mSolveHingeJointSystem.solvePositionConstraint(&(mPositionErrorHingeJoints[0]), static_cast<uint32>(mPositionErrorHingeJoints.size()));
+    }
+    if (mPositionErrorSliderJoints.size() > 0) {
+        mSolveSliderJointSystem.solvePositionConstraint(&(mPositionErrorSliderJoints[0]), static_cast<uint32>(mPositionErrorSliderJoints.size()));
+    }
+}
+
+// Solve the position constraints of a given island
+/// The joints of the island are solved batch by batch (one batch for each type of joint)
+void ConstraintSolverSystem::solvePositionConstraints(uint32 islandIndex) {
+
+    resetMaxImpulseChange();
+
+    uint32 nbJoints = mIslandsBallAndSocketJoints.getNbIslandJoints(islandIndex);
+    if (nbJoints > 0) {
+        mSolveBallAndSocketJointSystem.solvePositionConstraint(mIslandsBallAndSocketJoints.getIslandJoints(islandIndex), nbJoints);
+    }
+
+    nbJoints = mIslandsFixedJoints.getNbIslandJoints(islandIndex);
+    if (nbJoints > 0) {
+        mSolveFixedJointSystem.solvePositionConstraint(mIslandsFixedJoints.getIslandJoints(islandIndex), nbJoints);
+    }
+
+    nbJoints = mIslandsHingeJoints.getNbIslandJoints(islandIndex);
+    if (nbJoints > 0) {
+        mSolveHingeJointSystem.solvePositionConstraint(mIslandsHingeJoints.getIslandJoints(islandIndex), nbJoints);
+    }
+
+    nbJoints = mIslandsSliderJoints.getNbIslandJoints(islandIndex);
+    if (nbJoints > 0) {
+        mSolveSliderJointSystem.solvePositionConstraint(mIslandsSliderJoints.getIslandJoints(islandIndex), nbJoints);
+    }
+}
+
+// Return the number of joints in a given island
+/// This must be called after the joints have been ordered by island
+uint32 ConstraintSolverSystem::getNbIslandJoints(uint32 islandIndex) const {
+
+    return mIslandsBallAndSocketJoints.getNbIslandJoints(islandIndex) + mIslandsFixedJoints.getNbIslandJoints(islandIndex) +
+           mIslandsHingeJoints.getNbIslandJoints(islandIndex) + mIslandsSliderJoints.getNbIslandJoints(islandIndex);
+}
+
+// Reset the largest impulse change applied by the joint solvers
+void ConstraintSolverSystem::resetMaxImpulseChange() {
+
+    mSolveBallAndSocketJointSystem.resetMaxImpulseChange();
+    mSolveFixedJointSystem.resetMaxImpulseChange();
+    mSolveHingeJointSystem.resetMaxImpulseChange();
+    mSolveSliderJointSystem.resetMaxImpulseChange();
+    mArticulationSolverSystem.resetMaxImpulseChange();
+}
+
+// Return the largest impulse change applied to a joint during the last solver iteration
+decimal ConstraintSolverSystem::getMaxImpulseChange() const {
+
+    const decimal maxImpulseChangeSquare = std::max(std::max(std::max(mSolveBallAndSocketJointSystem.getMaxImpulseChangeSquare(),
+                                                                      mSolveFixedJointSystem.getMaxImpulseChangeSquare()),
+                                                             std::max(mSolveHingeJointSystem.getMaxImpulseChangeSquare(),
+                                                                      mSolveSliderJointSystem.getMaxImpulseChangeSquare())),
+                                                    mArticulationSolverSystem.getMaxImpulseChangeSquare());
+    return std::sqrt(maxImpulseChangeSquare);
 }
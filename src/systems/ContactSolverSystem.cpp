@@ -50,9 +50,11 @@ ContactSolverSystem::ContactSolverSystem(MemoryManager& memoryManager, PhysicsWo
                                          ColliderComponents& colliderComponents, decimal& restitutionVelocityThreshold)
               :mMemoryManager(memoryManager), mWorld(world), mRestitutionVelocityThreshold(restitutionVelocityThreshold),
                mContactConstraints(nullptr), mContactPoints(nullptr),
-               mIslands(islands), mAllContactManifolds(nullptr), mAllContactPoints(nullptr),
+               mIslands(islands), mIslandsContactManifoldsStartIndex(memoryManager.getHeapAllocator()),
+               mIslandsContactPointsStartIndex(memoryManager.getHeapAllocator()),
+               mAllContactManifolds(nullptr), mAllContactPoints(nullptr),
                mBodyComponents(bodyComponents), mRigidBodyComponents(rigidBodyComponents),
-               mColliderComponents(colliderComponents), mIsSplitImpulseActive(true) {
+               mColliderComponents(colliderComponents), mIsSplitImpulseActive(true), mUpdatePenetrationDepths(false), mMaxImpulseChange(0) {
 
 #ifdef IS_RP3D_PROFILING_ENABLED
 
@@ -62,7 +64,8 @@ ContactSolverSystem::ContactSolverSystem(MemoryManager& memoryManager, PhysicsWo
 }
 
 // Initialize the contact constraints
-void ContactSolverSystem::init(Array<ContactManifold>* contactManifolds, Array<ContactPoint>* contactPoints, decimal timeStep) {
+void ContactSolverSystem::init(Array<ContactManifold>* contactManifolds, Array<ContactPoint>* contactPoints, decimal timeStep,
+                               bool updatePenetrationDepths) {
 
     mAllContactManifolds = contactManifolds;
     mAllContactPoints = contactPoints;
@@ -70,6 +73,7 @@ void ContactSolverSystem::init(Array<ContactManifold>* contactManifolds, Array<C
     RP3D_PROFILE("ContactSolver::init()", mProfiler);
 
     mTimeStep = timeStep;
+    mUpdatePenetrationDepths = updatePenetrationDepths;
 
     const uint32 nbContactManifolds = static_cast<uint32>(mAllContactManifolds->size());
     const uint32 nbContactPoints = static_cast<uint32>(mAllContactPoints->size());
@@ -80,6 +84,9 @@ void ContactSolverSystem::init(Array<ContactManifold>* contactManifolds, Array<C
     mContactConstraints = nullptr;
     mContactPoints = nullptr;
 
+    mIslandsContactManifoldsStartIndex.clear();
+    mIslandsContactPointsStartIndex.clear();
+
     if (nbContactManifolds == 0 || nbContactPoints == 0) return;
 
     mContactPoints = static_cast<ContactPointSolver*>(mMemoryManager.allocate(MemoryManager::AllocationType::Frame,
@@ -94,10 +101,16 @@ void ContactSolverSystem::init(Array<ContactManifold>* contactManifolds, Array<C
     const uint32 nbIslands = mIslands.getNbIslands();
     for (uint32 i = 0; i < nbIslands; i++) {
 
+        // Record where the contacts of the island start (the contacts are stored island by island)
+        mIslandsContactManifoldsStartIndex.add(mNbContactManifolds);
+        mIslandsContactPointsStartIndex.add(mNbContactPoints);
+
         if (mIslands.nbContactManifolds[i] > 0) {
             initializeForIsland(i);
         }
     }
+    mIslandsContactManifoldsStartIndex.add(mNbContactManifolds);
+    mIslandsContactPointsStartIndex.add(mNbContactPoints);
 
     // Warmstarting
     warmStart();
@@ -154,7 +167,7 @@ void ContactSolverSystem::initializeForIsland(uint32 islandIndex) {
         mContactConstraints[mNbContactManifolds].angularLockAxisFactorBody1 = mRigidBodyComponents.mAngularLockAxisFactors[rigidBodyIndex1];
         mContactConstraints[mNbContactManifolds].angularLockAxisFactorBody2 = mRigidBodyComponents.mAngularLockAxisFactors[rigidBodyIndex2];
         mContactConstraints[mNbContactManifolds].nbContacts = externalManifold.nbContactPoints;
-        mContactConstraints[mNbContactManifolds].frictionCoefficient = computeMixedFrictionCoefficient(mColliderComponents.mMaterials[collider1Index], mColliderComponents.mMaterials[collider2Index]);
+        mContactConstraints[mNbContactManifolds].frictionCoefficient = externalManifold.frictionCoefficient;
         mContactConstraints[mNbContactManifolds].externalContactManifold = &externalManifold;
         mContactConstraints[mNbContactManifolds].normal.setToZero();
         mContactConstraints[mNbContactManifolds].frictionPointBody1.setToZero();
@@ -192,6 +205,12 @@ void ContactSolverSystem::initializeForIsland(uint32 islandIndex) {
             mContactPoints[mNbContactPoints].r2.y = p2.y - x2.y;
             mContactPoints[mNbContactPoints].r2.z = p2.z - x2.z;
             mContactPoints[mNbContactPoints].penetrationDepth = externalContact.getPenetrationDepth();
+
+            // If the contact is reused for another sub-step, the bodies have moved since the collision
+            // detection and we recompute the penetration depth using the current contact points
+            if (mUpdatePenetrationDepths) {
+                mContactPoints[mNbContactPoints].penetrationDepth = (p1 - p2).dot(mContactPoints[mNbContactPoints].normal);
+            }
             mContactPoints[mNbContactPoints].isRestingContact = externalContact.getIsRestingContact();
             externalContact.setIsRestingContact(true);
             mContactPoints[mNbContactPoints].penetrationImpulse = externalContact.getPenetrationImpulse();
@@ -246,9 +265,28 @@ void ContactSolverSystem::initializeForIsland(uint32 islandIndex) {
             decimal deltaVDotN = deltaV.x * mContactPoints[mNbContactPoints].normal.x +
                                  deltaV.y * mContactPoints[mNbContactPoints].normal.y +
                                  deltaV.z * mContactPoints[mNbContactPoints].normal.z;
-            const decimal restitutionFactor = computeMixedRestitutionFactor(mColliderComponents.mMaterials[collider1Index], mColliderComponents.mMaterials[collider2Index]);
-            if (deltaVDotN < -mRestitutionVelocityThreshold) {
-                mContactPoints[mNbContactPoints].restitutionBias = restitutionFactor * deltaVDotN;
+            if (!mUpdatePenetrationDepths) {
+
+                // A negative penetration depth is a speculative contact (the shapes are still separated but
+                // closer than the contact margin). The bodies only bounce if they hit each other during this step
+                const bool isSpeculativeContact = mContactPoints[mNbContactPoints].penetrationDepth < decimal(0.0);
+                const bool isImpactDuringStep = !isSpeculativeContact ||
+                                                deltaVDotN * mTimeStep <= mContactPoints[mNbContactPoints].penetrationDepth;
+                if (deltaVDotN < -mRestitutionVelocityThreshold && isImpactDuringStep) {
+                    mContactPoints[mNbContactPoints].restitutionBias = externalManifold.restitutionFactor * deltaVDotN;
+                }
+
+                // The bodies are allowed to get closer by the separation distance during this step
+                if (isSpeculativeContact) {
+                    mContactPoints[mNbContactPoints].restitutionBias -= mContactPoints[mNbContactPoints].penetrationDepth / mTimeStep;
+                }
+            }
+            else if (mContactPoints[mNbContactPoints].penetrationDepth < decimal(0.0)) {
+
+                // The restitution has already been applied at the first sub-step. If the contact points
+                // have separated during the previous sub-steps, the bodies are allowed to get closer
+                // by the separation distance during this sub-step
+                mContactPoints[mNbContactPoints].restitutionBias = -mContactPoints[mNbContactPoints].penetrationDepth / mTimeStep;
             }
 
             mContactConstraints[mNbContactManifolds].normal.x += mContactPoints[mNbContactPoints].normal.x;
@@ -483,14 +521,37 @@ void ContactSolverSystem::solve() {
 
     RP3D_PROFILE("ContactSolverSystem::solve()", mProfiler);
 
+    solveContactConstraints(0, mNbContactManifolds, 0);
+}
+
+// Solve the contacts of a given island
+void ContactSolverSystem::solveIsland(uint32 islandIndex) {
+
+    mMaxImpulseChange = decimal(0.0);
+
+    // If there are no contacts in the world
+    if (mNbContactManifolds == 0) return;
+
+    assert(islandIndex + 1 < mIslandsContactManifoldsStartIndex.size());
+
+    solveContactConstraints(mIslandsContactManifoldsStartIndex[islandIndex], mIslandsContactManifoldsStartIndex[islandIndex + 1],
+                            mIslandsContactPointsStartIndex[islandIndex]);
+}
+
+// Solve a range of contact manifolds
+/// The contact manifolds in the range [startIndex; endIndex[ are solved. The contact points of the first
+/// contact manifold of the range start at index "contactPointsStartIndex" in the array of contact points.
+void ContactSolverSystem::solveContactConstraints(uint32 startIndex, uint32 endIndex, uint32 contactPointsStartIndex) {
+
     decimal deltaLambda;
     decimal lambdaTemp;
-    uint32 contactPointIndex = 0;
+    decimal maxImpulseChange = decimal(0.0);
+    uint32 contactPointIndex = contactPointsStartIndex;
 
     const decimal beta = mIsSplitImpulseActive ? BETA_SPLIT_IMPULSE : BETA;
 
     // For each contact manifold
-    for (uint32 c=0; c<mNbContactManifolds; c++) {
+    for (uint32 c=startIndex; c<endIndex; c++) {
 
         decimal sumPenetrationImpulse = 0.0;
 
@@ -538,6 +599,7 @@ void ContactSolverSystem::solve() {
             mContactPoints[contactPointIndex].penetrationImpulse = std::max(mContactPoints[contactPointIndex].penetrationImpulse +
                                                        deltaLambda, decimal(0.0));
             deltaLambda = mContactPoints[contactPointIndex].penetrationImpulse - lambdaTemp;
+            maxImpulseChange = std::max(maxImpulseChange, std::abs(deltaLambda));
 
             Vector3 linearImpulse(mContactPoints[contactPointIndex].normal.x * deltaLambda,
                                   mContactPoints[contactPointIndex].normal.y * deltaLambda,
@@ -589,6 +651,7 @@ void ContactSolverSystem::solve() {
                             mContactPoints[contactPointIndex].penetrationSplitImpulse +
                             deltaLambdaSplit, decimal(0.0));
                 deltaLambdaSplit = mContactPoints[contactPointIndex].penetrationSplitImpulse - lambdaTempSplit;
+                maxImpulseChange = std::max(maxImpulseChange, std::abs(deltaLambdaSplit));
 
                 Vector3 linearImpulse(mContactPoints[contactPointIndex].normal.x * deltaLambdaSplit,
                                       mContactPoints[contactPointIndex].normal.y * deltaLambdaSplit,
@@ -640,6 +703,7 @@ void ContactSolverSystem::solve() {
                                                     std::min(mContactConstraints[c].friction1Impulse +
                                                              deltaLambda, frictionLimit));
         deltaLambda = mContactConstraints[c].friction1Impulse - lambdaTemp;
+        maxImpulseChange = std::max(maxImpulseChange, std::abs(deltaLambda));
 
         // Compute the impulse P=J^T * lambda
         Vector3 angularImpulseBody1(-mContactConstraints[c].r1CrossT1.x * deltaLambda,
@@ -693,6 +757,7 @@ void ContactSolverSystem::solve() {
                                                     std::min(mContactConstraints[c].friction2Impulse +
                                                              deltaLambda, frictionLimit));
         deltaLambda = mContactConstraints[c].friction2Impulse - lambdaTemp;
+        maxImpulseChange = std::max(maxImpulseChange, std::abs(deltaLambda));
 
         // Compute the impulse P=J^T * lambda
         angularImpulseBody1.x = -mContactConstraints[c].r1CrossT2.x * deltaLambda;
@@ -741,6 +806,7 @@ void ContactSolverSystem::solve() {
                                                         std::min(mContactConstraints[c].frictionTwistImpulse
                                                                  + deltaLambda, frictionLimit));
         deltaLambda = mContactConstraints[c].frictionTwistImpulse - lambdaTemp;
+        maxImpulseChange = std::max(maxImpulseChange, std::abs(deltaLambda));
 
         // Compute the impulse P=J^T * lambda
         angularImpulseBody2.x = mContactConstraints[c].normal.x * deltaLambda;
@@ -759,6 +825,8 @@ void ContactSolverSystem::solve() {
         mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].y += angularVelocity2.y;
         mRigidBodyComponents.mConstrainedAngularVelocities[rigidBody2Index].z += angularVelocity2.z;
     }
+
+    mMaxImpulseChange = maxImpulseChange;
 }
 
 // Store the computed impulses to use them to
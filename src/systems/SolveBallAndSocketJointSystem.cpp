@@ -33,6 +33,8 @@ using namespace reactphysics3d;
 
 // Static variables definition
 const decimal SolveBallAndSocketJointSystem::BETA = decimal(0.2);
+const decimal SolveBallAndSocketJointSystem::POSITION_SLOP = decimal(0.0001);
+const decimal SolveBallAndSocketJointSystem::ROTATION_SLOP = decimal(0.0002);
 
 // Constructor
 SolveBallAndSocketJointSystem::SolveBallAndSocketJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
@@ -41,7 +43,7 @@ SolveBallAndSocketJointSystem::SolveBallAndSocketJointSystem(PhysicsWorld& world
                                                              BallAndSocketJointComponents& ballAndSocketJointComponents)
               :mWorld(world), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
                mJointComponents(jointComponents), mBallAndSocketJointComponents(ballAndSocketJointComponents),
-               mTimeStep(0), mIsWarmStartingActive(true) {
+               mTimeStep(0), mIsWarmStartingActive(true), mMaxImpulseChangeSquare(0) {
 
 }
 
@@ -64,6 +66,13 @@ void SolveBallAndSocketJointSystem::initBeforeSolve() {
         const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
         const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
+        // Cache the components indices and inverse masses of the bodies for the solver iterations
+        mBallAndSocketJointComponents.mJointComponentIndices[i] = jointIndex;
+        mBallAndSocketJointComponents.mBody1ComponentIndices[i] = componentIndexBody1;
+        mBallAndSocketJointComponents.mBody2ComponentIndices[i] = componentIndexBody2;
+        mBallAndSocketJointComponents.mInverseMassBody1[i] = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+        mBallAndSocketJointComponents.mInverseMassBody2[i] = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+
         assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity));
         assert(!mRigidBodyComponents.getIsEntityDisabled(body2Entity));
 
@@ -166,14 +175,8 @@ void SolveBallAndSocketJointSystem::warmstart() {
     const uint32 nbJoints = mBallAndSocketJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
 
-        const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
-
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+        const uint32 componentIndexBody1 = mBallAndSocketJointComponents.mBody1ComponentIndices[i];
+        const uint32 componentIndexBody2 = mBallAndSocketJointComponents.mBody2ComponentIndices[i];
 
         // Get the velocities
         Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
@@ -198,7 +201,7 @@ void SolveBallAndSocketJointSystem::warmstart() {
         angularImpulseBody1 += coneLimitImpulse;
 
         // Apply the impulse to the body 1
-        v1 += mRigidBodyComponents.mInverseMasses[componentIndexBody1] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+        v1 += mBallAndSocketJointComponents.mInverseMassBody1[i] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
         w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
         // Compute the impulse P=J^T * lambda for the body 2
@@ -208,7 +211,7 @@ void SolveBallAndSocketJointSystem::warmstart() {
         angularImpulseBody2 += -coneLimitImpulse;
 
         // Apply the impulse to the body to the body 2
-        v2 += mRigidBodyComponents.mInverseMasses[componentIndexBody2] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * mBallAndSocketJointComponents.mImpulse[i];
+        v2 += mBallAndSocketJointComponents.mInverseMassBody2[i] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * mBallAndSocketJointComponents.mImpulse[i];
         w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
     }
 }
@@ -219,80 +222,93 @@ void SolveBallAndSocketJointSystem::solveVelocityConstraint() {
     // For each joint component
     const uint32 nbJoints = mBallAndSocketJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
+        solveVelocityConstraintForJoint(i);
+    }
+}
 
-        const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+// Solve the velocity constraint of a batch of joints
+/// The joints are given by their indices in the ball-and-socket joint components
+void SolveBallAndSocketJointSystem::solveVelocityConstraint(const uint32* jointComponentIndices, uint32 nbJoints) {
 
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+    for (uint32 j=0; j < nbJoints; j++) {
+        solveVelocityConstraintForJoint(jointComponentIndices[j]);
+    }
+}
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+// Solve the velocity constraint of a single joint
+void SolveBallAndSocketJointSystem::solveVelocityConstraintForJoint(uint32 index) {
 
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+    const uint32 componentIndexBody1 = mBallAndSocketJointComponents.mBody1ComponentIndices[index];
+    const uint32 componentIndexBody2 = mBallAndSocketJointComponents.mBody2ComponentIndices[index];
 
-        const Matrix3x3& i1 = mBallAndSocketJointComponents.mI1[i];
-        const Matrix3x3& i2 = mBallAndSocketJointComponents.mI2[i];
+    // Get the velocities
+    Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+    Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+    Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+    Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-        // --------------- Limits Constraints --------------- //
+    const Matrix3x3& i1 = mBallAndSocketJointComponents.mI1[index];
+    const Matrix3x3& i2 = mBallAndSocketJointComponents.mI2[index];
 
-        if (mBallAndSocketJointComponents.mIsConeLimitEnabled[i]) {
+    // --------------- Limits Constraints --------------- //
 
-            // If the cone limit is violated
-            if (mBallAndSocketJointComponents.mIsConeLimitViolated[i]) {
+    if (mBallAndSocketJointComponents.mIsConeLimitEnabled[index]) {
 
-                // Compute J*v for the cone limit constraine
-                const decimal JvConeLimit = mBallAndSocketJointComponents.mConeLimitACrossB[i].dot(w1 - w2);
+        // If the cone limit is violated
+        if (mBallAndSocketJointComponents.mIsConeLimitViolated[index]) {
 
-                // Compute the Lagrange multiplier lambda for the cone limit constraint
-                decimal deltaLambdaConeLimit = mBallAndSocketJointComponents.mInverseMassMatrixConeLimit[i] * (-JvConeLimit -mBallAndSocketJointComponents.mBConeLimit[i]);
-                decimal lambdaTemp = mBallAndSocketJointComponents.mConeLimitImpulse[i];
-                mBallAndSocketJointComponents.mConeLimitImpulse[i] = std::max(mBallAndSocketJointComponents.mConeLimitImpulse[i] + deltaLambdaConeLimit, decimal(0.0));
-                deltaLambdaConeLimit = mBallAndSocketJointComponents.mConeLimitImpulse[i] - lambdaTemp;
+            // Compute J*v for the cone limit constraine
+            const decimal JvConeLimit = mBallAndSocketJointComponents.mConeLimitACrossB[index].dot(w1 - w2);
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
-                const Vector3 angularImpulseBody1 = deltaLambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
+            // Compute the Lagrange multiplier lambda for the cone limit constraint
+            decimal deltaLambdaConeLimit = mBallAndSocketJointComponents.mInverseMassMatrixConeLimit[index] * (-JvConeLimit -mBallAndSocketJointComponents.mBConeLimit[index]);
+            decimal lambdaTemp = mBallAndSocketJointComponents.mConeLimitImpulse[index];
+            mBallAndSocketJointComponents.mConeLimitImpulse[index] = std::max(mBallAndSocketJointComponents.mConeLimitImpulse[index] + deltaLambdaConeLimit, decimal(0.0));
+            deltaLambdaConeLimit = mBallAndSocketJointComponents.mConeLimitImpulse[index] - lambdaTemp;
+            updateMaxImpulseChange(deltaLambdaConeLimit * deltaLambdaConeLimit);
 
-                // Apply the impulse to the body 1
-                w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+            // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
+            const Vector3 angularImpulseBody1 = deltaLambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[index];
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
-                const Vector3 angularImpulseBody2 = -deltaLambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
+            // Apply the impulse to the body 1
+            w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-                // Apply the impulse to the body 2
-                w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+            // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
+            const Vector3 angularImpulseBody2 = -deltaLambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[index];
+
+            // Apply the impulse to the body 2
+            w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
 
-            }
         }
+    }
 
-        // --------------- Joint Constraints --------------- //
+    // The joint constraints of a joint in an articulation tree or a direct island are solved by the articulation solver
+    if (mJointComponents.mIsSolvedDirectly[mBallAndSocketJointComponents.mJointComponentIndices[index]]) return;
 
-        // Compute J*v
-        const Vector3 Jv = v2 + w2.cross(mBallAndSocketJointComponents.mR2World[i]) - v1 - w1.cross(mBallAndSocketJointComponents.mR1World[i]);
+    // --------------- Joint Constraints --------------- //
 
-        // Compute the Lagrange multiplier lambda
-        const Vector3 deltaLambda = mBallAndSocketJointComponents.mInverseMassMatrix[i] * (-Jv - mBallAndSocketJointComponents.mBiasVector[i]);
-        mBallAndSocketJointComponents.mImpulse[i] += deltaLambda;
+    // Compute J*v
+    const Vector3 Jv = v2 + w2.cross(mBallAndSocketJointComponents.mR2World[index]) - v1 - w1.cross(mBallAndSocketJointComponents.mR1World[index]);
 
-        // Compute the impulse P=J^T * lambda for the body 1
-        const Vector3 linearImpulseBody1 = -deltaLambda;
-        const Vector3 angularImpulseBody1 = deltaLambda.cross(mBallAndSocketJointComponents.mR1World[i]);
+    // Compute the Lagrange multiplier lambda
+    const Vector3 deltaLambda = mBallAndSocketJointComponents.mInverseMassMatrix[index] * (-Jv - mBallAndSocketJointComponents.mBiasVector[index]);
+    updateMaxImpulseChange(deltaLambda.lengthSquare());
+    mBallAndSocketJointComponents.mImpulse[index] += deltaLambda;
 
-        // Apply the impulse to the body 1
-        v1 += mRigidBodyComponents.mInverseMasses[componentIndexBody1] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+    // Compute the impulse P=J^T * lambda for the body 1
+    const Vector3 linearImpulseBody1 = -deltaLambda;
+    const Vector3 angularImpulseBody1 = deltaLambda.cross(mBallAndSocketJointComponents.mR1World[index]);
 
-        // Compute the impulse P=J^T * lambda for the body 2
-        const Vector3 angularImpulseBody2 = -deltaLambda.cross(mBallAndSocketJointComponents.mR2World[i]);
+    // Apply the impulse to the body 1
+    v1 += mBallAndSocketJointComponents.mInverseMassBody1[index] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-        // Apply the impulse to the body 2
-        v2 += mRigidBodyComponents.mInverseMasses[componentIndexBody2] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambda;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
-    }
+    // Compute the impulse P=J^T * lambda for the body 2
+    const Vector3 angularImpulseBody2 = -deltaLambda.cross(mBallAndSocketJointComponents.mR2World[index]);
+
+    // Apply the impulse to the body 2
+    v2 += mBallAndSocketJointComponents.mInverseMassBody2[index] * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambda;
+    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
 }
 
 // Solve the position constraint (for position error correction)
@@ -301,146 +317,200 @@ void SolveBallAndSocketJointSystem::solvePositionConstraint() {
     // For each joint component
     const uint32 nbEnabledJoints = mBallAndSocketJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbEnabledJoints; i++) {
+        solvePositionConstraintForJoint(i);
+    }
+}
 
-        const Entity jointEntity = mBallAndSocketJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+// Solve the position constraint of a batch of joints
+/// The joints are given by their indices in the ball-and-socket joint components
+void SolveBallAndSocketJointSystem::solvePositionConstraint(const uint32* jointComponentIndices, uint32 nbJoints) {
 
-        // If the error position correction technique is not the non-linear-gauss-seidel, we do
-        // do not execute this method
-        if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) continue;
+    for (uint32 j=0; j < nbJoints; j++) {
+        solvePositionConstraintForJoint(jointComponentIndices[j]);
+    }
+}
 
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+// Check which joints have a position error larger than the slop
+/// This is called after the integration of the positions of the bodies so that the drift of the
+/// current step is taken into account. The position correction is only applied to the islands that
+/// have such a joint and it then drives the error of all their joints back to zero.
+void SolveBallAndSocketJointSystem::computePositionErrors() {
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+    // For each joint component
+    const uint32 nbEnabledJoints = mBallAndSocketJointComponents.getNbEnabledComponents();
+    for (uint32 i=0; i < nbEnabledJoints; i++) {
+
+        const uint32 jointIndex = mBallAndSocketJointComponents.mJointComponentIndices[i];
 
-        Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
-        Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
+        // Only the non-linear Gauss-Seidel technique corrects the position error after the integration
+        if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) {
+            mJointComponents.mHasPositionError[jointIndex] = false;
+            continue;
+        }
 
-        // Recompute the world inverse inertia tensors
-        RigidBody::computeWorldInertiaTensorInverse(q1.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody1],
-                                                    mBallAndSocketJointComponents.mI1[i]);
+        const uint32 componentIndexBody1 = mBallAndSocketJointComponents.mBody1ComponentIndices[i];
+        const uint32 componentIndexBody2 = mBallAndSocketJointComponents.mBody2ComponentIndices[i];
 
-        RigidBody::computeWorldInertiaTensorInverse(q2.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody2],
-                                                    mBallAndSocketJointComponents.mI2[i]);
+        const Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
+        const Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
+        const Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
+        const Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
 
         // Compute the vector from body center to the anchor point in world-space
-        mBallAndSocketJointComponents.mR1World[i] = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1] *
-                                                    (mBallAndSocketJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
-        mBallAndSocketJointComponents.mR2World[i] = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2] *
-                                                    (mBallAndSocketJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
+        const Vector3 r1World = q1 * (mBallAndSocketJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
+        const Vector3 r2World = q2 * (mBallAndSocketJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
 
-        const Vector3& r1World = mBallAndSocketJointComponents.mR1World[i];
-        const Vector3& r2World = mBallAndSocketJointComponents.mR2World[i];
+        bool hasPositionError = (x2 + r2World - x1 - r1World).lengthSquare() > POSITION_SLOP * POSITION_SLOP;
 
-        // Compute the corresponding skew-symmetric matrices
-        Matrix3x3 skewSymmetricMatrixU1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r1World);
-        Matrix3x3 skewSymmetricMatrixU2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r2World);
+        // Check if the cone limit is violated
+        if (!hasPositionError && mBallAndSocketJointComponents.mIsConeLimitEnabled[i]) {
+            const decimal coneAngle = computeCurrentConeHalfAngle(r1World.getUnit(), -r2World.getUnit());
+            hasPositionError = mBallAndSocketJointComponents.mConeLimitHalfAngle[i] - coneAngle < -ROTATION_SLOP;
+        }
 
-        // Get the inverse mass and inverse inertia tensors of the bodies
-        const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+        mJointComponents.mHasPositionError[jointIndex] = hasPositionError;
+    }
+}
 
-        // --------------- Limits Constraints --------------- //
+// Solve the position constraint of a single joint
+void SolveBallAndSocketJointSystem::solvePositionConstraintForJoint(uint32 index) {
 
-        if (mBallAndSocketJointComponents.mIsConeLimitEnabled[i]) {
+    const uint32 jointIndex = mBallAndSocketJointComponents.mJointComponentIndices[index];
 
-            // Check if the cone limit constraints is violated or not
-            const Vector3 r1WorldUnit = r1World.getUnit();
-            const Vector3 r2WorldUnit = r2World.getUnit();
-            mBallAndSocketJointComponents.mConeLimitACrossB[i] = r1WorldUnit.cross(-r2WorldUnit);
-            decimal coneAngle = computeCurrentConeHalfAngle(r1WorldUnit, -r2WorldUnit);
-            decimal coneLimitError = mBallAndSocketJointComponents.mConeLimitHalfAngle[i] - coneAngle;
-            mBallAndSocketJointComponents.mIsConeLimitViolated[i] = coneLimitError < 0;
+    // If the error position correction technique is not the non-linear-gauss-seidel, we do
+    // do not execute this method
+    if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) return;
 
-            // If the cone limit is violated
-            if (mBallAndSocketJointComponents.mIsConeLimitViolated[i]) {
+    const uint32 componentIndexBody1 = mBallAndSocketJointComponents.mBody1ComponentIndices[index];
+    const uint32 componentIndexBody2 = mBallAndSocketJointComponents.mBody2ComponentIndices[index];
 
-                // Compute the inverse of the mass matrix K=JM^-1J^t for the cone limit (1x1 matrix)
-                decimal inverseMassMatrixConeLimit = mBallAndSocketJointComponents.mConeLimitACrossB[i].dot(mBallAndSocketJointComponents.mI1[i] * mBallAndSocketJointComponents.mConeLimitACrossB[i]) +
-                                                 mBallAndSocketJointComponents.mConeLimitACrossB[i].dot(mBallAndSocketJointComponents.mI2[i] * mBallAndSocketJointComponents.mConeLimitACrossB[i]);
-                mBallAndSocketJointComponents.mInverseMassMatrixConeLimit[i] = (inverseMassMatrixConeLimit > decimal(0.0)) ?
-                                                                               decimal(1.0) / inverseMassMatrixConeLimit : decimal(0.0);
+    Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
+    Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
 
-                // Compute the Lagrange multiplier lambda for the cone limit constraint
-                decimal lambdaConeLimit = mBallAndSocketJointComponents.mInverseMassMatrixConeLimit[i] * (-coneLimitError );
+    // Recompute the world inverse inertia tensors
+    RigidBody::computeWorldInertiaTensorInverse(q1.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody1],
+                                                mBallAndSocketJointComponents.mI1[index]);
 
-                // Compute the impulse P=J^T * lambda of body 1
-                const Vector3 angularImpulseBody1 = lambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
+    RigidBody::computeWorldInertiaTensorInverse(q2.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody2],
+                                                mBallAndSocketJointComponents.mI2[index]);
 
-                // Compute the pseudo velocity of body 1
-                const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mBallAndSocketJointComponents.mI1[i] * angularImpulseBody1);
+    // Compute the vector from body center to the anchor point in world-space
+    mBallAndSocketJointComponents.mR1World[index] = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1] *
+                                                (mBallAndSocketJointComponents.mLocalAnchorPointBody1[index] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
+    mBallAndSocketJointComponents.mR2World[index] = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2] *
+                                                (mBallAndSocketJointComponents.mLocalAnchorPointBody2[index] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
 
-                // Update the body position/orientation of body 1
-                q1 += Quaternion(0, w1) * q1 * decimal(0.5);
-                q1.normalize();
+    const Vector3& r1World = mBallAndSocketJointComponents.mR1World[index];
+    const Vector3& r2World = mBallAndSocketJointComponents.mR2World[index];
 
-                // Compute the impulse P=J^T * lambda of body 2
-                const Vector3 angularImpulseBody2 = -lambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[i];
+    // Compute the corresponding skew-symmetric matrices
+    Matrix3x3 skewSymmetricMatrixU1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r1World);
+    Matrix3x3 skewSymmetricMatrixU2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r2World);
 
-                // Compute the pseudo velocity of body 2
-                const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mBallAndSocketJointComponents.mI2[i] * angularImpulseBody2);
+    // Get the inverse mass and inverse inertia tensors of the bodies
+    const decimal inverseMassBody1 = mBallAndSocketJointComponents.mInverseMassBody1[index];
+    const decimal inverseMassBody2 = mBallAndSocketJointComponents.mInverseMassBody2[index];
 
-                // Update the body position/orientation of body 2
-                q2 += Quaternion(0, w2) * q2 * decimal(0.5);
-                q2.normalize();
-            }
-        }
+    // --------------- Limits Constraints --------------- //
 
-        // --------------- Joint Constraints --------------- //
+    if (mBallAndSocketJointComponents.mIsConeLimitEnabled[index]) {
 
-        // Recompute the inverse mass matrix K=J^TM^-1J of of the 3 translation constraints
-        decimal inverseMassBodies = inverseMassBody1 + inverseMassBody2;
-        Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
-                                        0, inverseMassBodies, 0,
-                                        0, 0, inverseMassBodies) +
-                               skewSymmetricMatrixU1 * mBallAndSocketJointComponents.mI1[i] * skewSymmetricMatrixU1.getTranspose() +
-                               skewSymmetricMatrixU2 * mBallAndSocketJointComponents.mI2[i] * skewSymmetricMatrixU2.getTranspose();
-        mBallAndSocketJointComponents.mInverseMassMatrix[i].setToZero();
-        decimal massMatrixDeterminant = massMatrix.getDeterminant();
-        if (std::abs(massMatrixDeterminant) > MACHINE_EPSILON) {
-
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
-                mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-                mBallAndSocketJointComponents.mInverseMassMatrix[i] = massMatrix.getInverse(massMatrixDeterminant);
-            }
+        // Check if the cone limit constraints is violated or not
+        const Vector3 r1WorldUnit = r1World.getUnit();
+        const Vector3 r2WorldUnit = r2World.getUnit();
+        mBallAndSocketJointComponents.mConeLimitACrossB[index] = r1WorldUnit.cross(-r2WorldUnit);
+        decimal coneAngle = computeCurrentConeHalfAngle(r1WorldUnit, -r2WorldUnit);
+        decimal coneLimitError = mBallAndSocketJointComponents.mConeLimitHalfAngle[index] - coneAngle;
+        mBallAndSocketJointComponents.mIsConeLimitViolated[index] = coneLimitError < 0;
 
-            Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
-            Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
+        // If the cone limit is violated
+        if (mBallAndSocketJointComponents.mIsConeLimitViolated[index]) {
 
-            // Compute the constraint error (value of the C(x) function)
-            const Vector3 constraintError = (x2 + r2World - x1 - r1World);
+            // Compute the inverse of the mass matrix K=JM^-1J^t for the cone limit (1x1 matrix)
+            decimal inverseMassMatrixConeLimit = mBallAndSocketJointComponents.mConeLimitACrossB[index].dot(mBallAndSocketJointComponents.mI1[index] * mBallAndSocketJointComponents.mConeLimitACrossB[index]) +
+                                             mBallAndSocketJointComponents.mConeLimitACrossB[index].dot(mBallAndSocketJointComponents.mI2[index] * mBallAndSocketJointComponents.mConeLimitACrossB[index]);
+            mBallAndSocketJointComponents.mInverseMassMatrixConeLimit[index] = (inverseMassMatrixConeLimit > decimal(0.0)) ?
+                                                                           decimal(1.0) / inverseMassMatrixConeLimit : decimal(0.0);
 
-            // Compute the Lagrange multiplier lambda
-            // TODO : Do not solve the system by computing the inverse each time and multiplying with the
-            //        right-hand side vector but instead use a method to directly solve the linear system.
-            const Vector3 lambda = mBallAndSocketJointComponents.mInverseMassMatrix[i] * (-constraintError);
+            // Compute the Lagrange multiplier lambda for the cone limit constraint
+            decimal lambdaConeLimit = mBallAndSocketJointComponents.mInverseMassMatrixConeLimit[index] * (-coneLimitError );
+            updateMaxImpulseChange(lambdaConeLimit * lambdaConeLimit);
 
-            // Compute the impulse of body 1
-            const Vector3 linearImpulseBody1 = -lambda;
-            const Vector3 angularImpulseBody1 = lambda.cross(r1World);
+            // Compute the impulse P=J^T * lambda of body 1
+            const Vector3 angularImpulseBody1 = lambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[index];
 
             // Compute the pseudo velocity of body 1
-            const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-            const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mBallAndSocketJointComponents.mI1[i] * angularImpulseBody1);
+            const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mBallAndSocketJointComponents.mI1[index] * angularImpulseBody1);
 
-            // Update the body center of mass and orientation of body 1
-            x1 += v1;
+            // Update the body position/orientation of body 1
             q1 += Quaternion(0, w1) * q1 * decimal(0.5);
             q1.normalize();
 
-            // Compute the impulse of body 2
-            const Vector3 angularImpulseBody2 = -lambda.cross(r2World);
+            // Compute the impulse P=J^T * lambda of body 2
+            const Vector3 angularImpulseBody2 = -lambdaConeLimit * mBallAndSocketJointComponents.mConeLimitACrossB[index];
 
             // Compute the pseudo velocity of body 2
-            const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * lambda;
-            const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mBallAndSocketJointComponents.mI2[i] * angularImpulseBody2);
+            const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mBallAndSocketJointComponents.mI2[index] * angularImpulseBody2);
 
             // Update the body position/orientation of body 2
-            x2 += v2;
             q2 += Quaternion(0, w2) * q2 * decimal(0.5);
             q2.normalize();
         }
     }
+
+    // --------------- Joint Constraints --------------- //
+
+    // Recompute the inverse mass matrix K=J^TM^-1J of of the 3 translation constraints
+    decimal inverseMassBodies = inverseMassBody1 + inverseMassBody2;
+    Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
+                                    0, inverseMassBodies, 0,
+                                    0, 0, inverseMassBodies) +
+                           skewSymmetricMatrixU1 * mBallAndSocketJointComponents.mI1[index] * skewSymmetricMatrixU1.getTranspose() +
+                           skewSymmetricMatrixU2 * mBallAndSocketJointComponents.mI2[index] * skewSymmetricMatrixU2.getTranspose();
+    mBallAndSocketJointComponents.mInverseMassMatrix[index].setToZero();
+    decimal massMatrixDeterminant = massMatrix.getDeterminant();
+    if (std::abs(massMatrixDeterminant) > MACHINE_EPSILON) {
+
+        if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
+            mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+            mBallAndSocketJointComponents.mInverseMassMatrix[index] = massMatrix.getInverse(massMatrixDeterminant);
+        }
+
+        Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
+        Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
+
+        // Compute the constraint error (value of the C(x) function)
+        const Vector3 constraintError = (x2 + r2World - x1 - r1World);
+
+        // Compute the Lagrange multiplier lambda
+        // TODO : Do not solve the system by computing the inverse each time and multiplying with the
+        //        right-hand side vector but instead use a method to directly solve the linear system.
+        const Vector3 lambda = mBallAndSocketJointComponents.mInverseMassMatrix[index] * (-constraintError);
+        updateMaxImpulseChange(lambda.lengthSquare());
+
+        // Compute the impulse of body 1
+        const Vector3 linearImpulseBody1 = -lambda;
+        const Vector3 angularImpulseBody1 = lambda.cross(r1World);
+
+        // Compute the pseudo velocity of body 1
+        const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+        const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mBallAndSocketJointComponents.mI1[index] * angularImpulseBody1);
+
+        // Update the body center of mass and orientation of body 1
+        x1 += v1;
+        q1 += Quaternion(0, w1) * q1 * decimal(0.5);
+        q1.normalize();
+
+        // Compute the impulse of body 2
+        const Vector3 angularImpulseBody2 = -lambda.cross(r2World);
+
+        // Compute the pseudo velocity of body 2
+        const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * lambda;
+        const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mBallAndSocketJointComponents.mI2[index] * angularImpulseBody2);
+
+        // Update the body position/orientation of body 2
+        x2 += v2;
+        q2 += Quaternion(0, w2) * q2 * decimal(0.5);
+        q2.normalize();
+    }
 }
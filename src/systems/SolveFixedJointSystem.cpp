@@ -32,6 +32,8 @@ using namespace reactphysics3d;
 
 // Static variables definition
 const decimal SolveFixedJointSystem::BETA = decimal(0.2);
+const decimal SolveFixedJointSystem::POSITION_SLOP = decimal(0.0001);
+const decimal SolveFixedJointSystem::ROTATION_SLOP = decimal(0.0002);
 
 // Constructor
 SolveFixedJointSystem::SolveFixedJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
@@ -40,7 +42,7 @@ SolveFixedJointSystem::SolveFixedJointSystem(PhysicsWorld& world, RigidBodyCompo
                                              FixedJointComponents& fixedJointComponents)
               :mWorld(world), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
                mJointComponents(jointComponents), mFixedJointComponents(fixedJointComponents),
-               mTimeStep(0), mIsWarmStartingActive(true) {
+               mTimeStep(0), mIsWarmStartingActive(true), mMaxImpulseChangeSquare(0) {
 
 }
 
@@ -63,6 +65,13 @@ void SolveFixedJointSystem::initBeforeSolve() {
         const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
         const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
+        // Cache the components indices and inverse masses of the bodies for the solver iterations
+        mFixedJointComponents.mJointComponentIndices[i] = jointIndex;
+        mFixedJointComponents.mBody1ComponentIndices[i] = componentIndexBody1;
+        mFixedJointComponents.mBody2ComponentIndices[i] = componentIndexBody2;
+        mFixedJointComponents.mInverseMassBody1[i] = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+        mFixedJointComponents.mInverseMassBody2[i] = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+
         assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity));
         assert(!mRigidBodyComponents.getIsEntityDisabled(body2Entity));
 
@@ -149,15 +158,8 @@ void SolveFixedJointSystem::warmstart() {
     const uint32 nbJoints = mFixedJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
 
-        const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
-
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+        const uint32 componentIndexBody1 = mFixedJointComponents.mBody1ComponentIndices[i];
+        const uint32 componentIndexBody2 = mFixedJointComponents.mBody2ComponentIndices[i];
 
         // Get the velocities
         Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
@@ -166,8 +168,8 @@ void SolveFixedJointSystem::warmstart() {
         Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
         // Get the inverse mass of the bodies
-        const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+        const decimal inverseMassBody1 = mFixedJointComponents.mInverseMassBody1[i];
+        const decimal inverseMassBody2 = mFixedJointComponents.mInverseMassBody2[i];
 
         const Vector3& impulseTranslation = mFixedJointComponents.mImpulseTranslation[i];
         const Vector3& impulseRotation = mFixedJointComponents.mImpulseRotation[i];
@@ -205,84 +207,96 @@ void SolveFixedJointSystem::warmstart() {
 // Solve the velocity constraint
 void SolveFixedJointSystem::solveVelocityConstraint() {
 
-    // For each joint
+    // For each joint component
     const uint32 nbJoints = mFixedJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
+        solveVelocityConstraintForJoint(i);
+    }
+}
 
-        const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+// Solve the velocity constraint of a batch of joints
+/// The joints are given by their indices in the fixed joint components
+void SolveFixedJointSystem::solveVelocityConstraint(const uint32* jointComponentIndices, uint32 nbJoints) {
 
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+    for (uint32 j=0; j < nbJoints; j++) {
+        solveVelocityConstraintForJoint(jointComponentIndices[j]);
+    }
+}
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+// Solve the velocity constraint of a single joint
+void SolveFixedJointSystem::solveVelocityConstraintForJoint(uint32 index) {
 
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+    // The joint constraints of a joint in an articulation tree or a direct island are solved by the articulation solver
+    if (mJointComponents.mIsSolvedDirectly[mFixedJointComponents.mJointComponentIndices[index]]) return;
 
-        // Get the inverse mass of the bodies
-        decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+    const uint32 componentIndexBody1 = mFixedJointComponents.mBody1ComponentIndices[index];
+    const uint32 componentIndexBody2 = mFixedJointComponents.mBody2ComponentIndices[index];
 
-        const Vector3& r1World = mFixedJointComponents.mR1World[i];
-        const Vector3& r2World = mFixedJointComponents.mR2World[i];
+    // Get the velocities
+    Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+    Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+    Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+    Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-        // --------------- Translation Constraints --------------- //
+    // Get the inverse mass of the bodies
+    decimal inverseMassBody1 = mFixedJointComponents.mInverseMassBody1[index];
+    decimal inverseMassBody2 = mFixedJointComponents.mInverseMassBody2[index];
 
-        // Compute J*v for the 3 translation constraints
-        const Vector3 JvTranslation = v2 + w2.cross(r2World) - v1 - w1.cross(r1World);
+    const Vector3& r1World = mFixedJointComponents.mR1World[index];
+    const Vector3& r2World = mFixedJointComponents.mR2World[index];
 
-        const Matrix3x3& inverseMassMatrixTranslation = mFixedJointComponents.mInverseMassMatrixTranslation[i];
+    // --------------- Translation Constraints --------------- //
 
-        // Compute the Lagrange multiplier lambda
-        const Vector3 deltaLambda = inverseMassMatrixTranslation * (-JvTranslation - mFixedJointComponents.mBiasTranslation[i]);
-        mFixedJointComponents.mImpulseTranslation[i] += deltaLambda;
+    // Compute J*v for the 3 translation constraints
+    const Vector3 JvTranslation = v2 + w2.cross(r2World) - v1 - w1.cross(r1World);
 
-        // Compute the impulse P=J^T * lambda for body 1
-        const Vector3 linearImpulseBody1 = -deltaLambda;
-        Vector3 angularImpulseBody1 = deltaLambda.cross(r1World);
+    const Matrix3x3& inverseMassMatrixTranslation = mFixedJointComponents.mInverseMassMatrixTranslation[index];
 
-        const Matrix3x3& i1 = mFixedJointComponents.mI1[i];
+    // Compute the Lagrange multiplier lambda
+    const Vector3 deltaLambda = inverseMassMatrixTranslation * (-JvTranslation - mFixedJointComponents.mBiasTranslation[index]);
+    updateMaxImpulseChange(deltaLambda.lengthSquare());
+    mFixedJointComponents.mImpulseTranslation[index] += deltaLambda;
 
-        // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+    // Compute the impulse P=J^T * lambda for body 1
+    const Vector3 linearImpulseBody1 = -deltaLambda;
+    Vector3 angularImpulseBody1 = deltaLambda.cross(r1World);
 
-        // Compute the impulse P=J^T * lambda  for body 2
-        const Vector3 angularImpulseBody2 = -deltaLambda.cross(r2World);
+    const Matrix3x3& i1 = mFixedJointComponents.mI1[index];
 
-        const Matrix3x3& i2 = mFixedJointComponents.mI2[i];
+    // Apply the impulse to the body 1
+    v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-        // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambda;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+    // Compute the impulse P=J^T * lambda  for body 2
+    const Vector3 angularImpulseBody2 = -deltaLambda.cross(r2World);
 
-        // --------------- Rotation Constraints --------------- //
+    const Matrix3x3& i2 = mFixedJointComponents.mI2[index];
 
-        // Compute J*v for the 3 rotation constraints
-        const Vector3 JvRotation = w2 - w1;
+    // Apply the impulse to the body 2
+    v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambda;
+    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
 
-        const Vector3& biasRotation = mFixedJointComponents.mBiasRotation[i];
-        const Matrix3x3& inverseMassMatrixRotation = mFixedJointComponents.mInverseMassMatrixRotation[i];
+    // --------------- Rotation Constraints --------------- //
 
-        // Compute the Lagrange multiplier lambda for the 3 rotation constraints
-        Vector3 deltaLambda2 = inverseMassMatrixRotation * (-JvRotation - biasRotation);
-        mFixedJointComponents.mImpulseRotation[i] += deltaLambda2;
+    // Compute J*v for the 3 rotation constraints
+    const Vector3 JvRotation = w2 - w1;
 
-        // Compute the impulse P=J^T * lambda for the 3 rotation constraints for body 1
-        angularImpulseBody1 = -deltaLambda2;
+    const Vector3& biasRotation = mFixedJointComponents.mBiasRotation[index];
+    const Matrix3x3& inverseMassMatrixRotation = mFixedJointComponents.mInverseMassMatrixRotation[index];
 
-        // Apply the impulse to the body 1
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+    // Compute the Lagrange multiplier lambda for the 3 rotation constraints
+    Vector3 deltaLambda2 = inverseMassMatrixRotation * (-JvRotation - biasRotation);
+    updateMaxImpulseChange(deltaLambda2.lengthSquare());
+    mFixedJointComponents.mImpulseRotation[index] += deltaLambda2;
 
-        // Apply the impulse to the body 2
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * deltaLambda2);
-    }
+    // Compute the impulse P=J^T * lambda for the 3 rotation constraints for body 1
+    angularImpulseBody1 = -deltaLambda2;
+
+    // Apply the impulse to the body 1
+    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+
+    // Apply the impulse to the body 2
+    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * deltaLambda2);
 }
 
 // Solve the position constraint (for position error correction)
@@ -291,159 +305,210 @@ void SolveFixedJointSystem::solvePositionConstraint() {
     // For each joint
     const uint32 nbEnabledJoints = mFixedJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbEnabledJoints; i++) {
+        solvePositionConstraintForJoint(i);
+    }
+}
 
-        const Entity jointEntity = mFixedJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
+// Solve the position constraint of a batch of joints
+/// The joints are given by their indices in the fixed joint components
+void SolveFixedJointSystem::solvePositionConstraint(const uint32* jointComponentIndices, uint32 nbJoints) {
 
-        // If the error position correction technique is not the non-linear-gauss-seidel, we do
-        // do not execute this method
-        if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) continue;
+    for (uint32 j=0; j < nbJoints; j++) {
+        solvePositionConstraintForJoint(jointComponentIndices[j]);
+    }
+}
 
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+// Check which joints have a position error larger than the slop
+/// This is called after the integration of the positions of the bodies so that the drift of the
+/// current step is taken into account. The position correction is only applied to the islands that
+/// have such a joint and it then drives the error of all their joints back to zero.
+void SolveFixedJointSystem::computePositionErrors() {
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+    // For each joint component
+    const uint32 nbEnabledJoints = mFixedJointComponents.getNbEnabledComponents();
+    for (uint32 i=0; i < nbEnabledJoints; i++) {
 
-        // Get the bodies positions and orientations
-        Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
-        Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
+        const uint32 jointIndex = mFixedJointComponents.mJointComponentIndices[i];
+
+        // Only the non-linear Gauss-Seidel technique corrects the position error after the integration
+        if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) {
+            mJointComponents.mHasPositionError[jointIndex] = false;
+            continue;
+        }
 
-        // Recompute the world inverse inertia tensors
-        RigidBody::computeWorldInertiaTensorInverse(q1.getMatrix(), mRigidBodyComponents.getInertiaTensorLocalInverse(body1Entity),
-                                                    mFixedJointComponents.mI1[i]);
+        const uint32 componentIndexBody1 = mFixedJointComponents.mBody1ComponentIndices[i];
+        const uint32 componentIndexBody2 = mFixedJointComponents.mBody2ComponentIndices[i];
 
-        RigidBody::computeWorldInertiaTensorInverse(q2.getMatrix(), mRigidBodyComponents.getInertiaTensorLocalInverse(body2Entity),
-                                                    mFixedJointComponents.mI2[i]);
+        const Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
+        const Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
+        const Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
+        const Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
 
         // Compute the vector from body center to the anchor point in world-space
-        mFixedJointComponents.mR1World[i] = q1 * (mFixedJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
-        mFixedJointComponents.mR2World[i] = q2 * (mFixedJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
+        const Vector3 r1World = q1 * (mFixedJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
+        const Vector3 r2World = q2 * (mFixedJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
 
-        // Get the inverse mass and inverse inertia tensors of the bodies
-        decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+        // Compute the rotation error (the rotation angles are approximated by twice the vector part of the error quaternion)
+        const Quaternion orientationError = q2 * mFixedJointComponents.mInitOrientationDifferenceInv[i] * q1.getInverse();
 
-        const Vector3& r1World = mFixedJointComponents.mR1World[i];
-        const Vector3& r2World = mFixedJointComponents.mR2World[i];
+        const bool hasPositionError = (x2 + r2World - x1 - r1World).lengthSquare() > POSITION_SLOP * POSITION_SLOP ||
+                                      decimal(4.0) * orientationError.getVectorV().lengthSquare() > ROTATION_SLOP * ROTATION_SLOP;
 
-        // Compute the corresponding skew-symmetric matrices
-        Matrix3x3 skewSymmetricMatrixU1= Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r1World);
-        Matrix3x3 skewSymmetricMatrixU2= Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r2World);
+        mJointComponents.mHasPositionError[jointIndex] = hasPositionError;
+    }
+}
 
-        // --------------- Translation Constraints --------------- //
+// Solve the position constraint of a single joint
+void SolveFixedJointSystem::solvePositionConstraintForJoint(uint32 index) {
 
-        // Compute the matrix K=JM^-1J^t (3x3 matrix) for the 3 translation constraints
-        decimal inverseMassBodies = inverseMassBody1 + inverseMassBody2;
-        Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
-                                        0, inverseMassBodies, 0,
-                                        0, 0, inverseMassBodies) +
-                               skewSymmetricMatrixU1 * mFixedJointComponents.mI1[i] * skewSymmetricMatrixU1.getTranspose() +
-                               skewSymmetricMatrixU2 * mFixedJointComponents.mI2[i] * skewSymmetricMatrixU2.getTranspose();
-        mFixedJointComponents.mInverseMassMatrixTranslation[i].setToZero();
-        decimal massMatrixDeterminant = massMatrix.getDeterminant();
-        if (std::abs(massMatrixDeterminant) > MACHINE_EPSILON) {
+    const uint32 jointIndex = mFixedJointComponents.mJointComponentIndices[index];
 
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
-                mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-                mFixedJointComponents.mInverseMassMatrixTranslation[i] = massMatrix.getInverse(massMatrixDeterminant);
-            }
+    // If the error position correction technique is not the non-linear-gauss-seidel, we do
+    // do not execute this method
+    if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) return;
+
+    const uint32 componentIndexBody1 = mFixedJointComponents.mBody1ComponentIndices[index];
+    const uint32 componentIndexBody2 = mFixedJointComponents.mBody2ComponentIndices[index];
 
-            Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
-            Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
-            // Compute position error for the 3 translation constraints
-            const Vector3 errorTranslation = x2 + r2World - x1 - r1World;
+    // Get the bodies positions and orientations
+    Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
+    Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
 
-            // Compute the Lagrange multiplier lambda
-            const Vector3 lambdaTranslation = mFixedJointComponents.mInverseMassMatrixTranslation[i] * (-errorTranslation);
+    // Recompute the world inverse inertia tensors
+    RigidBody::computeWorldInertiaTensorInverse(q1.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody1],
+                                                mFixedJointComponents.mI1[index]);
 
-            // Compute the impulse of body 1
-            Vector3 linearImpulseBody1 = -lambdaTranslation;
-            Vector3 angularImpulseBody1 = lambdaTranslation.cross(r1World);
+    RigidBody::computeWorldInertiaTensorInverse(q2.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody2],
+                                                mFixedJointComponents.mI2[index]);
 
-            // Compute the pseudo velocity of body 1
-            const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-            Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mFixedJointComponents.mI1[i] * angularImpulseBody1);
+    // Compute the vector from body center to the anchor point in world-space
+    mFixedJointComponents.mR1World[index] = q1 * (mFixedJointComponents.mLocalAnchorPointBody1[index] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
+    mFixedJointComponents.mR2World[index] = q2 * (mFixedJointComponents.mLocalAnchorPointBody2[index] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
 
-            // Update the body position/orientation of body 1
-            x1 += v1;
-            q1 += Quaternion(0, w1) * q1 * decimal(0.5);
-            q1.normalize();
+    // Get the inverse mass and inverse inertia tensors of the bodies
+    decimal inverseMassBody1 = mFixedJointComponents.mInverseMassBody1[index];
+    decimal inverseMassBody2 = mFixedJointComponents.mInverseMassBody2[index];
 
-            // Compute the impulse of body 2
-            Vector3 angularImpulseBody2 = -lambdaTranslation.cross(r2World);
+    const Vector3& r1World = mFixedJointComponents.mR1World[index];
+    const Vector3& r2World = mFixedJointComponents.mR2World[index];
 
-            // Compute the pseudo velocity of body 2
-            const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * lambdaTranslation;
-            Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mFixedJointComponents.mI2[i] * angularImpulseBody2);
+    // Compute the corresponding skew-symmetric matrices
+    Matrix3x3 skewSymmetricMatrixU1= Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r1World);
+    Matrix3x3 skewSymmetricMatrixU2= Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(r2World);
 
-            // Update the body position/orientation of body 2
-            x2 += v2;
-            q2 += Quaternion(0, w2) * q2 * decimal(0.5);
-            q2.normalize();
+    // --------------- Translation Constraints --------------- //
+
+    // Compute the matrix K=JM^-1J^t (3x3 matrix) for the 3 translation constraints
+    decimal inverseMassBodies = inverseMassBody1 + inverseMassBody2;
+    Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
+                                    0, inverseMassBodies, 0,
+                                    0, 0, inverseMassBodies) +
+                           skewSymmetricMatrixU1 * mFixedJointComponents.mI1[index] * skewSymmetricMatrixU1.getTranspose() +
+                           skewSymmetricMatrixU2 * mFixedJointComponents.mI2[index] * skewSymmetricMatrixU2.getTranspose();
+    mFixedJointComponents.mInverseMassMatrixTranslation[index].setToZero();
+    decimal massMatrixDeterminant = massMatrix.getDeterminant();
+    if (std::abs(massMatrixDeterminant) > MACHINE_EPSILON) {
+
+        if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
+            mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+            mFixedJointComponents.mInverseMassMatrixTranslation[index] = massMatrix.getInverse(massMatrixDeterminant);
         }
 
-        // --------------- Rotation Constraints --------------- //
+        Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
+        Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
+        // Compute position error for the 3 translation constraints
+        const Vector3 errorTranslation = x2 + r2World - x1 - r1World;
 
-        // Compute the inverse of the mass matrix K=JM^-1J^t for the 3 rotation
-        // contraints (3x3 matrix)
-        mFixedJointComponents.mInverseMassMatrixRotation[i] = mFixedJointComponents.mI1[i] + mFixedJointComponents.mI2[i];
-        decimal massMatrixRotationDeterminant = mFixedJointComponents.mInverseMassMatrixRotation[i].getDeterminant();
-        if (std::abs(massMatrixRotationDeterminant) > MACHINE_EPSILON) {
+        // Compute the Lagrange multiplier lambda
+        const Vector3 lambdaTranslation = mFixedJointComponents.mInverseMassMatrixTranslation[index] * (-errorTranslation);
+        updateMaxImpulseChange(lambdaTranslation.lengthSquare());
 
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
-                mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-                mFixedJointComponents.mInverseMassMatrixRotation[i] = mFixedJointComponents.mInverseMassMatrixRotation[i].getInverse(massMatrixRotationDeterminant);
-            }
+        // Compute the impulse of body 1
+        Vector3 linearImpulseBody1 = -lambdaTranslation;
+        Vector3 angularImpulseBody1 = lambdaTranslation.cross(r1World);
+
+        // Compute the pseudo velocity of body 1
+        const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+        Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mFixedJointComponents.mI1[index] * angularImpulseBody1);
+
+        // Update the body position/orientation of body 1
+        x1 += v1;
+        q1 += Quaternion(0, w1) * q1 * decimal(0.5);
+        q1.normalize();
+
+        // Compute the impulse of body 2
+        Vector3 angularImpulseBody2 = -lambdaTranslation.cross(r2World);
 
-            // Calculate difference in rotation
-            //
-            // The rotation should be:
-            //
-            // q2 = q1 r0
-            //
-            // But because of drift the actual rotation is:
-            //
-            // q2 = qError q1 r0
-            // <=> qError = q2 r0^-1 q1^-1
-            //
-            // Where:
-            // q1 = current rotation of body 1
-            // q2 = current rotation of body 2
-            // qError = error that needs to be reduced to zero
-            Quaternion qError = q2 * mFixedJointComponents.mInitOrientationDifferenceInv[i] * q1.getInverse();
-
-            // A quaternion can be seen as:
-            //
-            // q = [sin(theta / 2) * v, cos(theta/2)]
-            //
-            // Where:
-            // v = rotation vector
-            // theta = rotation angle
-            //
-            // If we assume theta is small (error is small) then sin(x) = x so an approximation of the error angles is:
-            const Vector3 errorRotation = decimal(2.0) * qError.getVectorV();
-
-            // Compute the Lagrange multiplier lambda for the 3 rotation constraints
-            Vector3 lambdaRotation = mFixedJointComponents.mInverseMassMatrixRotation[i] * (-errorRotation);
-
-            // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
-            Vector3 angularImpulseBody1 = -lambdaRotation;
-
-            // Compute the pseudo velocity of body 1
-            Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mFixedJointComponents.mI1[i] * angularImpulseBody1);
-
-            // Update the body position/orientation of body 1
-            q1 += Quaternion(0, w1) * q1 * decimal(0.5);
-            q1.normalize();
-
-            // Compute the pseudo velocity of body 2
-            Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mFixedJointComponents.mI2[i] * lambdaRotation);
-
-            // Update the body position/orientation of body 2
-            q2 += Quaternion(0, w2) * q2 * decimal(0.5);
-            q2.normalize();
+        // Compute the pseudo velocity of body 2
+        const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * lambdaTranslation;
+        Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mFixedJointComponents.mI2[index] * angularImpulseBody2);
+
+        // Update the body position/orientation of body 2
+        x2 += v2;
+        q2 += Quaternion(0, w2) * q2 * decimal(0.5);
+        q2.normalize();
+    }
+
+    // --------------- Rotation Constraints --------------- //
+
+    // Compute the inverse of the mass matrix K=JM^-1J^t for the 3 rotation
+    // contraints (3x3 matrix)
+    mFixedJointComponents.mInverseMassMatrixRotation[index] = mFixedJointComponents.mI1[index] + mFixedJointComponents.mI2[index];
+    decimal massMatrixRotationDeterminant = mFixedJointComponents.mInverseMassMatrixRotation[index].getDeterminant();
+    if (std::abs(massMatrixRotationDeterminant) > MACHINE_EPSILON) {
+
+        if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
+            mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+            mFixedJointComponents.mInverseMassMatrixRotation[index] = mFixedJointComponents.mInverseMassMatrixRotation[index].getInverse(massMatrixRotationDeterminant);
         }
+
+        // Calculate difference in rotation
+        //
+        // The rotation should be:
+        //
+        // q2 = q1 r0
+        //
+        // But because of drift the actual rotation is:
+        //
+        // q2 = qError q1 r0
+        // <=> qError = q2 r0^-1 q1^-1
+        //
+        // Where:
+        // q1 = current rotation of body 1
+        // q2 = current rotation of body 2
+        // qError = error that needs to be reduced to zero
+        Quaternion qError = q2 * mFixedJointComponents.mInitOrientationDifferenceInv[index] * q1.getInverse();
+
+        // A quaternion can be seen as:
+        //
+        // q = [sin(theta / 2) * v, cos(theta/2)]
+        //
+        // Where:
+        // v = rotation vector
+        // theta = rotation angle
+        //
+        // If we assume theta is small (error is small) then sin(x) = x so an approximation of the error angles is:
+        const Vector3 errorRotation = decimal(2.0) * qError.getVectorV();
+
+        // Compute the Lagrange multiplier lambda for the 3 rotation constraints
+        Vector3 lambdaRotation = mFixedJointComponents.mInverseMassMatrixRotation[index] * (-errorRotation);
+        updateMaxImpulseChange(lambdaRotation.lengthSquare());
+
+        // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
+        Vector3 angularImpulseBody1 = -lambdaRotation;
+
+        // Compute the pseudo velocity of body 1
+        Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mFixedJointComponents.mI1[index] * angularImpulseBody1);
+
+        // Update the body position/orientation of body 1
+        q1 += Quaternion(0, w1) * q1 * decimal(0.5);
+        q1.normalize();
+
+        // Compute the pseudo velocity of body 2
+        Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mFixedJointComponents.mI2[index] * lambdaRotation);
+
+        // Update the body position/orientation of body 2
+        q2 += Quaternion(0, w2) * q2 * decimal(0.5);
+        q2.normalize();
     }
 }
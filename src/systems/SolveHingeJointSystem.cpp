@@ -32,6 +32,8 @@ using namespace reactphysics3d;
 
 // Static variables definition
 const decimal SolveHingeJointSystem::BETA = decimal(0.2);
+const decimal SolveHingeJointSystem::POSITION_SLOP = decimal(0.0001);
+const decimal SolveHingeJointSystem::ROTATION_SLOP = decimal(0.0002);
 
 // Constructor
 SolveHingeJointSystem::SolveHingeJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
@@ -40,7 +42,7 @@ SolveHingeJointSystem::SolveHingeJointSystem(PhysicsWorld& world, RigidBodyCompo
                                                              HingeJointComponents& hingeJointComponents)
               :mWorld(world), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
                mJointComponents(jointComponents), mHingeJointComponents(hingeJointComponents),
-               mTimeStep(0), mIsWarmStartingActive(true) {
+               mTimeStep(0), mIsWarmStartingActive(true), mMaxImpulseChangeSquare(0) {
 
 }
 
@@ -63,6 +65,13 @@ void SolveHingeJointSystem::initBeforeSolve() {
         const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
         const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
+        // Cache the components indices and inverse masses of the bodies for the solver iterations
+        mHingeJointComponents.mJointComponentIndices[i] = jointIndex;
+        mHingeJointComponents.mBody1ComponentIndices[i] = componentIndexBody1;
+        mHingeJointComponents.mBody2ComponentIndices[i] = componentIndexBody2;
+        mHingeJointComponents.mInverseMassBody1[i] = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+        mHingeJointComponents.mInverseMassBody2[i] = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+
         assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity));
         assert(!mRigidBodyComponents.getIsEntityDisabled(body2Entity));
 
@@ -164,7 +173,7 @@ void SolveHingeJointSystem::initBeforeSolve() {
         }
 
         // Compute the current angle around the hinge axis
-        decimal hingeAngle = computeCurrentHingeAngle(jointEntity, orientationBody1, orientationBody2);
+        decimal hingeAngle = computeCurrentHingeAngle(i, orientationBody1, orientationBody2);
 
         // Check if the limit constraints are violated or not
         decimal lowerLimitError = hingeAngle - mHingeJointComponents.mLowerLimit[i];
@@ -220,15 +229,8 @@ void SolveHingeJointSystem::warmstart() {
     const uint32 nbJoints = mHingeJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
 
-        const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
-
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+        const uint32 componentIndexBody1 = mHingeJointComponents.mBody1ComponentIndices[i];
+        const uint32 componentIndexBody2 = mHingeJointComponents.mBody2ComponentIndices[i];
 
         // Get the velocities
         Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
@@ -237,8 +239,8 @@ void SolveHingeJointSystem::warmstart() {
         Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
         // Get the inverse mass and inverse inertia tensors of the bodies
-        const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+        const decimal inverseMassBody1 = mHingeJointComponents.mInverseMassBody1[i];
+        const decimal inverseMassBody2 = mHingeJointComponents.mInverseMassBody2[i];
 
         const Vector3& impulseTranslation = mHingeJointComponents.mImpulseTranslation[i];
         const Vector2& impulseRotation = mHingeJointComponents.mImpulseRotation[i];
@@ -299,171 +301,186 @@ void SolveHingeJointSystem::solveVelocityConstraint() {
     // For each joint component
     const uint32 nbJoints = mHingeJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
+        solveVelocityConstraintForJoint(i);
+    }
+}
 
-        const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
-
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
-
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
-
-        // Get the inverse mass and inverse inertia tensors of the bodies
-        decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
-
-        const Matrix3x3& i1 = mHingeJointComponents.mI1[i];
-        const Matrix3x3& i2 = mHingeJointComponents.mI2[i];
-
-        const Vector3& r1World = mHingeJointComponents.mR1World[i];
-        const Vector3& r2World = mHingeJointComponents.mR2World[i];
+// Solve the velocity constraint of a batch of joints
+/// The joints are given by their indices in the hinge joint components
+void SolveHingeJointSystem::solveVelocityConstraint(const uint32* jointComponentIndices, uint32 nbJoints) {
 
-        const Vector3& a1 = mHingeJointComponents.mA1[i];
+    for (uint32 j=0; j < nbJoints; j++) {
+        solveVelocityConstraintForJoint(jointComponentIndices[j]);
+    }
+}
 
-        const decimal inverseMassMatrixLimitMotor = mHingeJointComponents.mInverseMassMatrixLimitMotor[i];
+// Solve the velocity constraint of a single joint
+void SolveHingeJointSystem::solveVelocityConstraintForJoint(uint32 index) {
 
-        // --------------- Limits Constraints --------------- //
+    const uint32 componentIndexBody1 = mHingeJointComponents.mBody1ComponentIndices[index];
+    const uint32 componentIndexBody2 = mHingeJointComponents.mBody2ComponentIndices[index];
 
-        if (mHingeJointComponents.mIsLimitEnabled[i]) {
+    // Get the velocities
+    Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+    Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+    Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+    Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-            // If the lower limit is violated
-            if (mHingeJointComponents.mIsLowerLimitViolated[i]) {
+    // Get the inverse mass and inverse inertia tensors of the bodies
+    decimal inverseMassBody1 = mHingeJointComponents.mInverseMassBody1[index];
+    decimal inverseMassBody2 = mHingeJointComponents.mInverseMassBody2[index];
 
-                // Compute J*v for the lower limit constraint
-                const decimal JvLowerLimit = (w2 - w1).dot(a1);
+    const Matrix3x3& i1 = mHingeJointComponents.mI1[index];
+    const Matrix3x3& i2 = mHingeJointComponents.mI2[index];
 
-                // Compute the Lagrange multiplier lambda for the lower limit constraint
-                decimal deltaLambdaLower = inverseMassMatrixLimitMotor * (-JvLowerLimit -mHingeJointComponents.mBLowerLimit[i]);
-                decimal lambdaTemp = mHingeJointComponents.mImpulseLowerLimit[i];
-                mHingeJointComponents.mImpulseLowerLimit[i] = std::max(mHingeJointComponents.mImpulseLowerLimit[i] + deltaLambdaLower, decimal(0.0));
-                deltaLambdaLower = mHingeJointComponents.mImpulseLowerLimit[i] - lambdaTemp;
+    const Vector3& r1World = mHingeJointComponents.mR1World[index];
+    const Vector3& r2World = mHingeJointComponents.mR2World[index];
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
-                const Vector3 angularImpulseBody1 = -deltaLambdaLower * a1;
+    const Vector3& a1 = mHingeJointComponents.mA1[index];
 
-                // Apply the impulse to the body 1
-                w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+    const decimal inverseMassMatrixLimitMotor = mHingeJointComponents.mInverseMassMatrixLimitMotor[index];
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
-                const Vector3 angularImpulseBody2 = deltaLambdaLower * a1;
+    // --------------- Limits Constraints --------------- //
 
-                // Apply the impulse to the body 2
-                w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
-            }
+    if (mHingeJointComponents.mIsLimitEnabled[index]) {
 
-            // If the upper limit is violated
-            if (mHingeJointComponents.mIsUpperLimitViolated[i]) {
+        // If the lower limit is violated
+        if (mHingeJointComponents.mIsLowerLimitViolated[index]) {
 
-                // Compute J*v for the upper limit constraint
-                const decimal JvUpperLimit = -(w2 - w1).dot(a1);
+            // Compute J*v for the lower limit constraint
+            const decimal JvLowerLimit = (w2 - w1).dot(a1);
 
-                // Compute the Lagrange multiplier lambda for the upper limit constraint
-                decimal deltaLambdaUpper = inverseMassMatrixLimitMotor * (-JvUpperLimit -mHingeJointComponents.mBUpperLimit[i]);
-                decimal lambdaTemp = mHingeJointComponents.mImpulseUpperLimit[i];
-                mHingeJointComponents.mImpulseUpperLimit[i] = std::max(mHingeJointComponents.mImpulseUpperLimit[i] + deltaLambdaUpper, decimal(0.0));
-                deltaLambdaUpper = mHingeJointComponents.mImpulseUpperLimit[i] - lambdaTemp;
+            // Compute the Lagrange multiplier lambda for the lower limit constraint
+            decimal deltaLambdaLower = inverseMassMatrixLimitMotor * (-JvLowerLimit -mHingeJointComponents.mBLowerLimit[index]);
+            decimal lambdaTemp = mHingeJointComponents.mImpulseLowerLimit[index];
+            mHingeJointComponents.mImpulseLowerLimit[index] = std::max(mHingeJointComponents.mImpulseLowerLimit[index] + deltaLambdaLower, decimal(0.0));
+            deltaLambdaLower = mHingeJointComponents.mImpulseLowerLimit[index] - lambdaTemp;
+            updateMaxImpulseChange(deltaLambdaLower * deltaLambdaLower);
 
-                // Compute the impulse P=J^T * lambda for the upper limit constraint of body 1
-                const Vector3 angularImpulseBody1 = deltaLambdaUpper * a1;
+            // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
+            const Vector3 angularImpulseBody1 = -deltaLambdaLower * a1;
 
-                // Apply the impulse to the body 1
-                w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+            // Apply the impulse to the body 1
+            w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-                // Compute the impulse P=J^T * lambda for the upper limit constraint of body 2
-                const Vector3 angularImpulseBody2 = -deltaLambdaUpper * a1;
+            // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
+            const Vector3 angularImpulseBody2 = deltaLambdaLower * a1;
 
-                // Apply the impulse to the body 2
-                w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
-            }
+            // Apply the impulse to the body 2
+            w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
         }
 
-        // --------------- Motor --------------- //
+        // If the upper limit is violated
+        if (mHingeJointComponents.mIsUpperLimitViolated[index]) {
 
-        // If the motor is enabled
-        if (mHingeJointComponents.mIsMotorEnabled[i]) {
+            // Compute J*v for the upper limit constraint
+            const decimal JvUpperLimit = -(w2 - w1).dot(a1);
 
-            // Compute J*v for the motor
-            const decimal JvMotor = a1.dot(w1 - w2);
+            // Compute the Lagrange multiplier lambda for the upper limit constraint
+            decimal deltaLambdaUpper = inverseMassMatrixLimitMotor * (-JvUpperLimit -mHingeJointComponents.mBUpperLimit[index]);
+            decimal lambdaTemp = mHingeJointComponents.mImpulseUpperLimit[index];
+            mHingeJointComponents.mImpulseUpperLimit[index] = std::max(mHingeJointComponents.mImpulseUpperLimit[index] + deltaLambdaUpper, decimal(0.0));
+            deltaLambdaUpper = mHingeJointComponents.mImpulseUpperLimit[index] - lambdaTemp;
+            updateMaxImpulseChange(deltaLambdaUpper * deltaLambdaUpper);
 
-            // Compute the Lagrange multiplier lambda for the motor
-            const decimal maxMotorImpulse = mHingeJointComponents.mMaxMotorTorque[i] * mTimeStep;
-            decimal deltaLambdaMotor = mHingeJointComponents.mInverseMassMatrixLimitMotor[i] * (-JvMotor - mHingeJointComponents.mMotorSpeed[i]);
-            decimal lambdaTemp = mHingeJointComponents.mImpulseMotor[i];
-            mHingeJointComponents.mImpulseMotor[i] = clamp(mHingeJointComponents.mImpulseMotor[i] + deltaLambdaMotor, -maxMotorImpulse, maxMotorImpulse);
-            deltaLambdaMotor = mHingeJointComponents.mImpulseMotor[i] - lambdaTemp;
-
-            // Compute the impulse P=J^T * lambda for the motor of body 1
-            const Vector3 angularImpulseBody1 = -deltaLambdaMotor * a1;
+            // Compute the impulse P=J^T * lambda for the upper limit constraint of body 1
+            const Vector3 angularImpulseBody1 = deltaLambdaUpper * a1;
 
             // Apply the impulse to the body 1
             w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-            // Compute the impulse P=J^T * lambda for the motor of body 2
-            const Vector3 angularImpulseBody2 = deltaLambdaMotor * a1;
+            // Compute the impulse P=J^T * lambda for the upper limit constraint of body 2
+            const Vector3 angularImpulseBody2 = -deltaLambdaUpper * a1;
 
             // Apply the impulse to the body 2
             w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
         }
+    }
 
-        // --------------- Joint Rotation Constraints --------------- //
+    // --------------- Motor --------------- //
 
-        const Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[i];
-        const Vector3& c2CrossA1 = mHingeJointComponents.mC2CrossA1[i];
+    // If the motor is enabled
+    if (mHingeJointComponents.mIsMotorEnabled[index]) {
 
-        // Compute J*v for the 2 rotation constraints
-        const Vector2 JvRotation(-b2CrossA1.dot(w1) + b2CrossA1.dot(w2),
-                                 -c2CrossA1.dot(w1) + c2CrossA1.dot(w2));
+        // Compute J*v for the motor
+        const decimal JvMotor = a1.dot(w1 - w2);
 
-        // Compute the Lagrange multiplier lambda for the 2 rotation constraints
-        Vector2 deltaLambdaRotation = mHingeJointComponents.mInverseMassMatrixRotation[i] *
-                                      (-JvRotation - mHingeJointComponents.mBiasRotation[i]);
-        mHingeJointComponents.mImpulseRotation[i] += deltaLambdaRotation;
+        // Compute the Lagrange multiplier lambda for the motor
+        const decimal maxMotorImpulse = mHingeJointComponents.mMaxMotorTorque[index] * mTimeStep;
+        decimal deltaLambdaMotor = mHingeJointComponents.mInverseMassMatrixLimitMotor[index] * (-JvMotor - mHingeJointComponents.mMotorSpeed[index]);
+        decimal lambdaTemp = mHingeJointComponents.mImpulseMotor[index];
+        mHingeJointComponents.mImpulseMotor[index] = clamp(mHingeJointComponents.mImpulseMotor[index] + deltaLambdaMotor, -maxMotorImpulse, maxMotorImpulse);
+        deltaLambdaMotor = mHingeJointComponents.mImpulseMotor[index] - lambdaTemp;
+        updateMaxImpulseChange(deltaLambdaMotor * deltaLambdaMotor);
 
-        // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 1
-        Vector3 angularImpulseBody1 = -b2CrossA1 * deltaLambdaRotation.x - c2CrossA1 * deltaLambdaRotation.y;
+        // Compute the impulse P=J^T * lambda for the motor of body 1
+        const Vector3 angularImpulseBody1 = -deltaLambdaMotor * a1;
 
         // Apply the impulse to the body 1
         w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
 
-        // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 2
-        Vector3 angularImpulseBody2 = b2CrossA1 * deltaLambdaRotation.x + c2CrossA1 * deltaLambdaRotation.y;
+        // Compute the impulse P=J^T * lambda for the motor of body 2
+        const Vector3 angularImpulseBody2 = deltaLambdaMotor * a1;
 
         // Apply the impulse to the body 2
         w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+    }
 
-        // --------------- Joint Translation Constraints --------------- //
+    // The joint constraints of a joint in an articulation tree or a direct island are solved by the articulation solver
+    if (mJointComponents.mIsSolvedDirectly[mHingeJointComponents.mJointComponentIndices[index]]) return;
 
-        // Compute J*v
-        const Vector3 JvTranslation = v2 + w2.cross(r2World) - v1 - w1.cross(r1World);
+    // --------------- Joint Rotation Constraints --------------- //
 
-        // Compute the Lagrange multiplier lambda
-        const Vector3 deltaLambdaTranslation = mHingeJointComponents.mInverseMassMatrixTranslation[i] *
-                                               (-JvTranslation - mHingeJointComponents.mBiasTranslation[i]);
-        mHingeJointComponents.mImpulseTranslation[i] += deltaLambdaTranslation;
+    const Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[index];
+    const Vector3& c2CrossA1 = mHingeJointComponents.mC2CrossA1[index];
 
-        // Compute the impulse P=J^T * lambda of body 1
-        const Vector3 linearImpulseBody1 = -deltaLambdaTranslation;
-        angularImpulseBody1 = deltaLambdaTranslation.cross(r1World);
+    // Compute J*v for the 2 rotation constraints
+    const Vector2 JvRotation(-b2CrossA1.dot(w1) + b2CrossA1.dot(w2),
+                             -c2CrossA1.dot(w1) + c2CrossA1.dot(w2));
 
-        // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+    // Compute the Lagrange multiplier lambda for the 2 rotation constraints
+    Vector2 deltaLambdaRotation = mHingeJointComponents.mInverseMassMatrixRotation[index] *
+                                  (-JvRotation - mHingeJointComponents.mBiasRotation[index]);
+    updateMaxImpulseChange(deltaLambdaRotation.lengthSquare());
+    mHingeJointComponents.mImpulseRotation[index] += deltaLambdaRotation;
 
-        // Compute the impulse P=J^T * lambda of body 2
-        angularImpulseBody2 = -deltaLambdaTranslation.cross(r2World);
+    // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 1
+    Vector3 angularImpulseBody1 = -b2CrossA1 * deltaLambdaRotation.x - c2CrossA1 * deltaLambdaRotation.y;
 
-        // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambdaTranslation;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
-    }
+    // Apply the impulse to the body 1
+    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+
+    // Compute the impulse P=J^T * lambda for the 2 rotation constraints of body 2
+    Vector3 angularImpulseBody2 = b2CrossA1 * deltaLambdaRotation.x + c2CrossA1 * deltaLambdaRotation.y;
+
+    // Apply the impulse to the body 2
+    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+
+    // --------------- Joint Translation Constraints --------------- //
+
+    // Compute J*v
+    const Vector3 JvTranslation = v2 + w2.cross(r2World) - v1 - w1.cross(r1World);
+
+    // Compute the Lagrange multiplier lambda
+    const Vector3 deltaLambdaTranslation = mHingeJointComponents.mInverseMassMatrixTranslation[index] *
+                                           (-JvTranslation - mHingeJointComponents.mBiasTranslation[index]);
+    updateMaxImpulseChange(deltaLambdaTranslation.lengthSquare());
+    mHingeJointComponents.mImpulseTranslation[index] += deltaLambdaTranslation;
+
+    // Compute the impulse P=J^T * lambda of body 1
+    const Vector3 linearImpulseBody1 = -deltaLambdaTranslation;
+    angularImpulseBody1 = deltaLambdaTranslation.cross(r1World);
+
+    // Apply the impulse to the body 1
+    v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+
+    // Compute the impulse P=J^T * lambda of body 2
+    angularImpulseBody2 = -deltaLambdaTranslation.cross(r2World);
+
+    // Apply the impulse to the body 2
+    v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * deltaLambdaTranslation;
+    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
 }
 
 // Solve the position constraint (for position error correction)
@@ -472,248 +489,312 @@ void SolveHingeJointSystem::solvePositionConstraint() {
     // For each joint component
     const uint32 nbEnabledJoints = mHingeJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbEnabledJoints; i++) {
+        solvePositionConstraintForJoint(i);
+    }
+}
 
-        const Entity jointEntity = mHingeJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        // If the error position correction technique is not the non-linear-gauss-seidel, we do not execute this method
-        if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) continue;
-
-        // Get the bodies entities
-        Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
-
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+// Solve the position constraint of a batch of joints
+/// The joints are given by their indices in the hinge joint components
+void SolveHingeJointSystem::solvePositionConstraint(const uint32* jointComponentIndices, uint32 nbJoints) {
 
-        Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
-        Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
+    for (uint32 j=0; j < nbJoints; j++) {
+        solvePositionConstraintForJoint(jointComponentIndices[j]);
+    }
+}
 
-        // Recompute the world inverse inertia tensors
-        RigidBody::computeWorldInertiaTensorInverse(q1.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody1],
-                                                    mHingeJointComponents.mI1[i]);
+// Check which joints have a position error larger than the slop
+/// This is called after the integration of the positions of the bodies so that the drift of the
+/// current step is taken into account. The position correction is only applied to the islands that
+/// have such a joint and it then drives the error of all their joints back to zero.
+void SolveHingeJointSystem::computePositionErrors() {
 
-        RigidBody::computeWorldInertiaTensorInverse(q2.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody2],
-                                                    mHingeJointComponents.mI2[i]);
+    // For each joint component
+    const uint32 nbEnabledJoints = mHingeJointComponents.getNbEnabledComponents();
+    for (uint32 i=0; i < nbEnabledJoints; i++) {
 
-        // Compute the vector from body center to the anchor point in world-space
-        mHingeJointComponents.mR1World[i] = q1 * (mHingeJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
-        mHingeJointComponents.mR2World[i] = q2 * (mHingeJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
+        const uint32 jointIndex = mHingeJointComponents.mJointComponentIndices[i];
 
-        // Compute the corresponding skew-symmetric matrices
-        Matrix3x3 skewSymmetricMatrixU1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mHingeJointComponents.mR1World[i]);
-        Matrix3x3 skewSymmetricMatrixU2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mHingeJointComponents.mR2World[i]);
+        // Only the non-linear Gauss-Seidel technique corrects the position error after the integration
+        if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) {
+            mJointComponents.mHasPositionError[jointIndex] = false;
+            continue;
+        }
 
+        const uint32 componentIndexBody1 = mHingeJointComponents.mBody1ComponentIndices[i];
+        const uint32 componentIndexBody2 = mHingeJointComponents.mBody2ComponentIndices[i];
 
-        Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[i];
-        Vector3& c2CrossA1 = mHingeJointComponents.mC2CrossA1[i];
+        const Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
+        const Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
+        const Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
+        const Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
 
-        Vector3& a1 = mHingeJointComponents.mA1[i];
+        // Compute the vector from body center to the anchor point in world-space
+        const Vector3 r1World = q1 * (mHingeJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
+        const Vector3 r2World = q2 * (mHingeJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
 
-        // Compute vectors needed in the Jacobian
-        a1 = q1 * mHingeJointComponents.mHingeLocalAxisBody1[i];
-        Vector3 a2 = q2 * mHingeJointComponents.mHingeLocalAxisBody2[i];
-        a1.normalize();
-        mHingeJointComponents.mA1[i] = a1;
-        a2.normalize();
+        // Compute the rotation error (the hinge axis of body 1 must be orthogonal to the vectors b2 and c2)
+        const Vector3 a1 = (q1 * mHingeJointComponents.mHingeLocalAxisBody1[i]).getUnit();
+        const Vector3 a2 = (q2 * mHingeJointComponents.mHingeLocalAxisBody2[i]).getUnit();
         const Vector3 b2 = a2.getOneUnitOrthogonalVector();
         const Vector3 c2 = a2.cross(b2);
-        b2CrossA1 = b2.cross(a1);
-        mHingeJointComponents.mB2CrossA1[i] = b2CrossA1;
-        c2CrossA1 = c2.cross(a1);
-        mHingeJointComponents.mC2CrossA1[i] = c2CrossA1;
+        const Vector2 rotationError(a1.dot(b2), a1.dot(c2));
 
-        // Compute the current angle around the hinge axis
-        const decimal hingeAngle = computeCurrentHingeAngle(jointEntity, q1, q2);
+        bool hasPositionError = (x2 + r2World - x1 - r1World).lengthSquare() > POSITION_SLOP * POSITION_SLOP ||
+                                rotationError.lengthSquare() > ROTATION_SLOP * ROTATION_SLOP;
 
-        // Check if the limit constraints are violated or not
-        decimal lowerLimitError = hingeAngle - mHingeJointComponents.mLowerLimit[i];
-        decimal upperLimitError = mHingeJointComponents.mUpperLimit[i] - hingeAngle;
-        mHingeJointComponents.mIsLowerLimitViolated[i] = lowerLimitError <= 0;
-        mHingeJointComponents.mIsUpperLimitViolated[i] = upperLimitError <= 0;
+        // Check if the limits are violated
+        if (!hasPositionError && mHingeJointComponents.mIsLimitEnabled[i]) {
+            const decimal hingeAngle = computeCurrentHingeAngle(i, q1, q2);
+            hasPositionError = hingeAngle - mHingeJointComponents.mLowerLimit[i] < -ROTATION_SLOP ||
+                               mHingeJointComponents.mUpperLimit[i] - hingeAngle < -ROTATION_SLOP;
+        }
 
-        // --------------- Limits Constraints --------------- //
+        mJointComponents.mHasPositionError[jointIndex] = hasPositionError;
+    }
+}
 
-        if (mHingeJointComponents.mIsLimitEnabled[i]) {
+// Solve the position constraint of a single joint
+void SolveHingeJointSystem::solvePositionConstraintForJoint(uint32 index) {
 
-            decimal inverseMassMatrixLimitMotor = mHingeJointComponents.mInverseMassMatrixLimitMotor[i];
+    const uint32 jointIndex = mHingeJointComponents.mJointComponentIndices[index];
 
-            Vector3& a1 = mHingeJointComponents.mA1[i];
+    // If the error position correction technique is not the non-linear-gauss-seidel, we do not execute this method
+    if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) return;
 
-            if (mHingeJointComponents.mIsLowerLimitViolated[i] || mHingeJointComponents.mIsUpperLimitViolated[i]) {
+    const uint32 componentIndexBody1 = mHingeJointComponents.mBody1ComponentIndices[index];
+    const uint32 componentIndexBody2 = mHingeJointComponents.mBody2ComponentIndices[index];
 
-                // Compute the inverse of the mass matrix K=JM^-1J^t for the limits (1x1 matrix)
-                mHingeJointComponents.mInverseMassMatrixLimitMotor[i] = a1.dot(mHingeJointComponents.mI1[i] * a1) + a1.dot(mHingeJointComponents.mI2[i] * a1);
-                mHingeJointComponents.mInverseMassMatrixLimitMotor[i] = (inverseMassMatrixLimitMotor > decimal(0.0)) ?
-                                          decimal(1.0) / mHingeJointComponents.mInverseMassMatrixLimitMotor[i] : decimal(0.0);
-            }
+    Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
+    Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
 
-            // If the lower limit is violated
-            if (mHingeJointComponents.mIsLowerLimitViolated[i]) {
+    // Recompute the world inverse inertia tensors
+    RigidBody::computeWorldInertiaTensorInverse(q1.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody1],
+                                                mHingeJointComponents.mI1[index]);
 
-                // Compute the Lagrange multiplier lambda for the lower limit constraint
-                decimal lambdaLowerLimit = inverseMassMatrixLimitMotor * (-lowerLimitError );
+    RigidBody::computeWorldInertiaTensorInverse(q2.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody2],
+                                                mHingeJointComponents.mI2[index]);
 
-                // Compute the impulse P=J^T * lambda of body 1
-                const Vector3 angularImpulseBody1 = -lambdaLowerLimit * a1;
+    // Compute the vector from body center to the anchor point in world-space
+    mHingeJointComponents.mR1World[index] = q1 * (mHingeJointComponents.mLocalAnchorPointBody1[index] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
+    mHingeJointComponents.mR2World[index] = q2 * (mHingeJointComponents.mLocalAnchorPointBody2[index] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
 
-                // Compute the pseudo velocity of body 1
-                const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
+    // Compute the corresponding skew-symmetric matrices
+    Matrix3x3 skewSymmetricMatrixU1 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mHingeJointComponents.mR1World[index]);
+    Matrix3x3 skewSymmetricMatrixU2 = Matrix3x3::computeSkewSymmetricMatrixForCrossProduct(mHingeJointComponents.mR2World[index]);
 
-                // Update the body position/orientation of body 1
-                q1 += Quaternion(0, w1) * q1 * decimal(0.5);
-                q1.normalize();
 
-                // Compute the impulse P=J^T * lambda of body 2
-                const Vector3 angularImpulseBody2 = lambdaLowerLimit * a1;
+    Vector3& b2CrossA1 = mHingeJointComponents.mB2CrossA1[index];
+    Vector3& c2CrossA1 = mHingeJointComponents.mC2CrossA1[index];
 
-                // Compute the pseudo velocity of body 2
-                const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
+    Vector3& a1 = mHingeJointComponents.mA1[index];
 
-                // Update the body position/orientation of body 2
-                q2 += Quaternion(0, w2) * q2 * decimal(0.5);
-                q2.normalize();
-            }
+    // Compute vectors needed in the Jacobian
+    a1 = q1 * mHingeJointComponents.mHingeLocalAxisBody1[index];
+    Vector3 a2 = q2 * mHingeJointComponents.mHingeLocalAxisBody2[index];
+    a1.normalize();
+    mHingeJointComponents.mA1[index] = a1;
+    a2.normalize();
+    const Vector3 b2 = a2.getOneUnitOrthogonalVector();
+    const Vector3 c2 = a2.cross(b2);
+    b2CrossA1 = b2.cross(a1);
+    mHingeJointComponents.mB2CrossA1[index] = b2CrossA1;
+    c2CrossA1 = c2.cross(a1);
+    mHingeJointComponents.mC2CrossA1[index] = c2CrossA1;
 
-            // If the upper limit is violated
-            if (mHingeJointComponents.mIsUpperLimitViolated[i]) {
+    // Compute the current angle around the hinge axis
+    const decimal hingeAngle = computeCurrentHingeAngle(index, q1, q2);
 
-                // Compute the Lagrange multiplier lambda for the upper limit constraint
-                decimal lambdaUpperLimit = inverseMassMatrixLimitMotor * (-upperLimitError);
+    // Check if the limit constraints are violated or not
+    decimal lowerLimitError = hingeAngle - mHingeJointComponents.mLowerLimit[index];
+    decimal upperLimitError = mHingeJointComponents.mUpperLimit[index] - hingeAngle;
+    mHingeJointComponents.mIsLowerLimitViolated[index] = lowerLimitError <= 0;
+    mHingeJointComponents.mIsUpperLimitViolated[index] = upperLimitError <= 0;
 
-                // Compute the impulse P=J^T * lambda of body 1
-                const Vector3 angularImpulseBody1 = lambdaUpperLimit * a1;
+    // --------------- Limits Constraints --------------- //
 
-                // Compute the pseudo velocity of body 1
-                const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
+    if (mHingeJointComponents.mIsLimitEnabled[index]) {
 
-                // Update the body position/orientation of body 1
-                q1 += Quaternion(0, w1) * q1 * decimal(0.5);
-                q1.normalize();
+        decimal inverseMassMatrixLimitMotor = mHingeJointComponents.mInverseMassMatrixLimitMotor[index];
 
-                // Compute the impulse P=J^T * lambda of body 2
-                const Vector3 angularImpulseBody2 = -lambdaUpperLimit * a1;
+        Vector3& a1 = mHingeJointComponents.mA1[index];
 
-                // Compute the pseudo velocity of body 2
-                const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
+        if (mHingeJointComponents.mIsLowerLimitViolated[index] || mHingeJointComponents.mIsUpperLimitViolated[index]) {
 
-                // Update the body position/orientation of body 2
-                q2 += Quaternion(0, w2) * q2 * decimal(0.5);
-                q2.normalize();
-            }
+            // Compute the inverse of the mass matrix K=JM^-1J^t for the limits (1x1 matrix)
+            mHingeJointComponents.mInverseMassMatrixLimitMotor[index] = a1.dot(mHingeJointComponents.mI1[index] * a1) + a1.dot(mHingeJointComponents.mI2[index] * a1);
+            mHingeJointComponents.mInverseMassMatrixLimitMotor[index] = (inverseMassMatrixLimitMotor > decimal(0.0)) ?
+                                      decimal(1.0) / mHingeJointComponents.mInverseMassMatrixLimitMotor[index] : decimal(0.0);
         }
 
-        // --------------- Rotation Constraints --------------- //
-
-        // Compute the inverse mass matrix K=JM^-1J^t for the 2 rotation constraints (2x2 matrix)
-        Vector3 I1B2CrossA1 = mHingeJointComponents.mI1[i] * b2CrossA1;
-        Vector3 I1C2CrossA1 = mHingeJointComponents.mI1[i] * c2CrossA1;
-        Vector3 I2B2CrossA1 = mHingeJointComponents.mI2[i] * b2CrossA1;
-        Vector3 I2C2CrossA1 = mHingeJointComponents.mI2[i] * c2CrossA1;
-        const decimal el11 = b2CrossA1.dot(I1B2CrossA1) +
-                             b2CrossA1.dot(I2B2CrossA1);
-        const decimal el12 = b2CrossA1.dot(I1C2CrossA1) +
-                             b2CrossA1.dot(I2C2CrossA1);
-        const decimal el21 = c2CrossA1.dot(I1B2CrossA1) +
-                             c2CrossA1.dot(I2B2CrossA1);
-        const decimal el22 = c2CrossA1.dot(I1C2CrossA1) +
-                             c2CrossA1.dot(I2C2CrossA1);
-        const Matrix2x2 matrixKRotation(el11, el12, el21, el22);
-        mHingeJointComponents.mInverseMassMatrixRotation[i].setToZero();
-        decimal matrixDeterminant = matrixKRotation.getDeterminant();
-        if (std::abs(matrixDeterminant) > MACHINE_EPSILON) {
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
-                mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-                mHingeJointComponents.mInverseMassMatrixRotation[i] = matrixKRotation.getInverse(matrixDeterminant);
-            }
-
-            // Compute the position error for the 3 rotation constraints
-            const Vector2 errorRotation = Vector2(a1.dot(b2), a1.dot(c2));
+        // If the lower limit is violated
+        if (mHingeJointComponents.mIsLowerLimitViolated[index]) {
 
-            // Compute the Lagrange multiplier lambda for the 3 rotation constraints
-            Vector2 lambdaRotation = mHingeJointComponents.mInverseMassMatrixRotation[i] * (-errorRotation);
+            // Compute the Lagrange multiplier lambda for the lower limit constraint
+            decimal lambdaLowerLimit = inverseMassMatrixLimitMotor * (-lowerLimitError );
+            updateMaxImpulseChange(lambdaLowerLimit * lambdaLowerLimit);
 
-            // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
-            Vector3 angularImpulseBody1 = -b2CrossA1 * lambdaRotation.x - c2CrossA1 * lambdaRotation.y;
+            // Compute the impulse P=J^T * lambda of body 1
+            const Vector3 angularImpulseBody1 = -lambdaLowerLimit * a1;
 
             // Compute the pseudo velocity of body 1
-            Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
+            const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[index] * angularImpulseBody1);
 
             // Update the body position/orientation of body 1
             q1 += Quaternion(0, w1) * q1 * decimal(0.5);
             q1.normalize();
 
-            // Compute the impulse of body 2
-            Vector3 angularImpulseBody2 = b2CrossA1 * lambdaRotation.x + c2CrossA1 * lambdaRotation.y;
+            // Compute the impulse P=J^T * lambda of body 2
+            const Vector3 angularImpulseBody2 = lambdaLowerLimit * a1;
 
             // Compute the pseudo velocity of body 2
-            Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
+            const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[index] * angularImpulseBody2);
 
             // Update the body position/orientation of body 2
             q2 += Quaternion(0, w2) * q2 * decimal(0.5);
             q2.normalize();
         }
 
-        // --------------- Translation Constraints --------------- //
-
-        // Compute the matrix K=JM^-1J^t (3x3 matrix) for the 3 translation constraints
-        const decimal body1InverseMass = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal body2InverseMass = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
-        decimal inverseMassBodies = body1InverseMass + body2InverseMass;
-        Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
-                                        0, inverseMassBodies, 0,
-                                        0, 0, inverseMassBodies) +
-                               skewSymmetricMatrixU1 * mHingeJointComponents.mI1[i] * skewSymmetricMatrixU1.getTranspose() +
-                               skewSymmetricMatrixU2 * mHingeJointComponents.mI2[i] * skewSymmetricMatrixU2.getTranspose();
-        mHingeJointComponents.mInverseMassMatrixTranslation[i].setToZero();
-        matrixDeterminant = massMatrix.getDeterminant();
-        if (std::abs(matrixDeterminant) > MACHINE_EPSILON) {
-
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
-                mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-                mHingeJointComponents.mInverseMassMatrixTranslation[i] = massMatrix.getInverse(matrixDeterminant);
-            }
-
-
-            Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
-            Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
-
-            // Compute position error for the 3 translation constraints
-            const Vector3 errorTranslation = x2 + mHingeJointComponents.mR2World[i] - x1 - mHingeJointComponents.mR1World[i];
-
-            // Compute the Lagrange multiplier lambda
-            const Vector3 lambdaTranslation = mHingeJointComponents.mInverseMassMatrixTranslation[i] * (-errorTranslation);
+        // If the upper limit is violated
+        if (mHingeJointComponents.mIsUpperLimitViolated[index]) {
 
-            // Compute the impulse of body 1
-            Vector3 linearImpulseBody1 = -lambdaTranslation;
-            Vector3 angularImpulseBody1 = lambdaTranslation.cross(mHingeJointComponents.mR1World[i]);
+            // Compute the Lagrange multiplier lambda for the upper limit constraint
+            decimal lambdaUpperLimit = inverseMassMatrixLimitMotor * (-upperLimitError);
+            updateMaxImpulseChange(lambdaUpperLimit * lambdaUpperLimit);
 
-            // Get the inverse mass and inverse inertia tensors of the bodies
-            decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-            decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+            // Compute the impulse P=J^T * lambda of body 1
+            const Vector3 angularImpulseBody1 = lambdaUpperLimit * a1;
 
             // Compute the pseudo velocity of body 1
-            const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-            Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[i] * angularImpulseBody1);
+            const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[index] * angularImpulseBody1);
 
             // Update the body position/orientation of body 1
-            x1 += v1;
             q1 += Quaternion(0, w1) * q1 * decimal(0.5);
             q1.normalize();
 
-            // Compute the impulse of body 2
-            Vector3 angularImpulseBody2 = -lambdaTranslation.cross(mHingeJointComponents.mR2World[i]);
+            // Compute the impulse P=J^T * lambda of body 2
+            const Vector3 angularImpulseBody2 = -lambdaUpperLimit * a1;
 
             // Compute the pseudo velocity of body 2
-            const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * lambdaTranslation;
-            Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[i] * angularImpulseBody2);
+            const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[index] * angularImpulseBody2);
 
             // Update the body position/orientation of body 2
-            x2 += v2;
             q2 += Quaternion(0, w2) * q2 * decimal(0.5);
             q2.normalize();
         }
     }
+
+    // --------------- Rotation Constraints --------------- //
+
+    // Compute the inverse mass matrix K=JM^-1J^t for the 2 rotation constraints (2x2 matrix)
+    Vector3 I1B2CrossA1 = mHingeJointComponents.mI1[index] * b2CrossA1;
+    Vector3 I1C2CrossA1 = mHingeJointComponents.mI1[index] * c2CrossA1;
+    Vector3 I2B2CrossA1 = mHingeJointComponents.mI2[index] * b2CrossA1;
+    Vector3 I2C2CrossA1 = mHingeJointComponents.mI2[index] * c2CrossA1;
+    const decimal el11 = b2CrossA1.dot(I1B2CrossA1) +
+                         b2CrossA1.dot(I2B2CrossA1);
+    const decimal el12 = b2CrossA1.dot(I1C2CrossA1) +
+                         b2CrossA1.dot(I2C2CrossA1);
+    const decimal el21 = c2CrossA1.dot(I1B2CrossA1) +
+                         c2CrossA1.dot(I2B2CrossA1);
+    const decimal el22 = c2CrossA1.dot(I1C2CrossA1) +
+                         c2CrossA1.dot(I2C2CrossA1);
+    const Matrix2x2 matrixKRotation(el11, el12, el21, el22);
+    mHingeJointComponents.mInverseMassMatrixRotation[index].setToZero();
+    decimal matrixDeterminant = matrixKRotation.getDeterminant();
+    if (std::abs(matrixDeterminant) > MACHINE_EPSILON) {
+        if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
+            mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+            mHingeJointComponents.mInverseMassMatrixRotation[index] = matrixKRotation.getInverse(matrixDeterminant);
+        }
+
+        // Compute the position error for the 3 rotation constraints
+        const Vector2 errorRotation = Vector2(a1.dot(b2), a1.dot(c2));
+
+        // Compute the Lagrange multiplier lambda for the 3 rotation constraints
+        Vector2 lambdaRotation = mHingeJointComponents.mInverseMassMatrixRotation[index] * (-errorRotation);
+        updateMaxImpulseChange(lambdaRotation.lengthSquare());
+
+        // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
+        Vector3 angularImpulseBody1 = -b2CrossA1 * lambdaRotation.x - c2CrossA1 * lambdaRotation.y;
+
+        // Compute the pseudo velocity of body 1
+        Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[index] * angularImpulseBody1);
+
+        // Update the body position/orientation of body 1
+        q1 += Quaternion(0, w1) * q1 * decimal(0.5);
+        q1.normalize();
+
+        // Compute the impulse of body 2
+        Vector3 angularImpulseBody2 = b2CrossA1 * lambdaRotation.x + c2CrossA1 * lambdaRotation.y;
+
+        // Compute the pseudo velocity of body 2
+        Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[index] * angularImpulseBody2);
+
+        // Update the body position/orientation of body 2
+        q2 += Quaternion(0, w2) * q2 * decimal(0.5);
+        q2.normalize();
+    }
+
+    // --------------- Translation Constraints --------------- //
+
+    // Compute the matrix K=JM^-1J^t (3x3 matrix) for the 3 translation constraints
+    const decimal body1InverseMass = mHingeJointComponents.mInverseMassBody1[index];
+    const decimal body2InverseMass = mHingeJointComponents.mInverseMassBody2[index];
+    decimal inverseMassBodies = body1InverseMass + body2InverseMass;
+    Matrix3x3 massMatrix = Matrix3x3(inverseMassBodies, 0, 0,
+                                    0, inverseMassBodies, 0,
+                                    0, 0, inverseMassBodies) +
+                           skewSymmetricMatrixU1 * mHingeJointComponents.mI1[index] * skewSymmetricMatrixU1.getTranspose() +
+                           skewSymmetricMatrixU2 * mHingeJointComponents.mI2[index] * skewSymmetricMatrixU2.getTranspose();
+    mHingeJointComponents.mInverseMassMatrixTranslation[index].setToZero();
+    matrixDeterminant = massMatrix.getDeterminant();
+    if (std::abs(matrixDeterminant) > MACHINE_EPSILON) {
+
+        if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC ||
+            mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+            mHingeJointComponents.mInverseMassMatrixTranslation[index] = massMatrix.getInverse(matrixDeterminant);
+        }
+
+
+        Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
+        Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
+
+        // Compute position error for the 3 translation constraints
+        const Vector3 errorTranslation = x2 + mHingeJointComponents.mR2World[index] - x1 - mHingeJointComponents.mR1World[index];
+
+        // Compute the Lagrange multiplier lambda
+        const Vector3 lambdaTranslation = mHingeJointComponents.mInverseMassMatrixTranslation[index] * (-errorTranslation);
+        updateMaxImpulseChange(lambdaTranslation.lengthSquare());
+
+        // Compute the impulse of body 1
+        Vector3 linearImpulseBody1 = -lambdaTranslation;
+        Vector3 angularImpulseBody1 = lambdaTranslation.cross(mHingeJointComponents.mR1World[index]);
+
+        // Get the inverse mass and inverse inertia tensors of the bodies
+        decimal inverseMassBody1 = mHingeJointComponents.mInverseMassBody1[index];
+        decimal inverseMassBody2 = mHingeJointComponents.mInverseMassBody2[index];
+
+        // Compute the pseudo velocity of body 1
+        const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+        Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mHingeJointComponents.mI1[index] * angularImpulseBody1);
+
+        // Update the body position/orientation of body 1
+        x1 += v1;
+        q1 += Quaternion(0, w1) * q1 * decimal(0.5);
+        q1.normalize();
+
+        // Compute the impulse of body 2
+        Vector3 angularImpulseBody2 = -lambdaTranslation.cross(mHingeJointComponents.mR2World[index]);
+
+        // Compute the pseudo velocity of body 2
+        const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * lambdaTranslation;
+        Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mHingeJointComponents.mI2[index] * angularImpulseBody2);
+
+        // Update the body position/orientation of body 2
+        x2 += v2;
+        q2 += Quaternion(0, w2) * q2 * decimal(0.5);
+        q2.normalize();
+    }
 }
 
 // Given an angle in radian, this method returns the corresponding angle in the range [-pi; pi]
@@ -757,7 +838,7 @@ decimal SolveHingeJointSystem::computeCorrespondingAngleNearLimits(decimal input
 }
 
 // Compute the current angle around the hinge axis
-decimal SolveHingeJointSystem::computeCurrentHingeAngle(Entity jointEntity, const Quaternion& orientationBody1, const Quaternion& orientationBody2) {
+decimal SolveHingeJointSystem::computeCurrentHingeAngle(uint32 jointComponentIndex, const Quaternion& orientationBody1, const Quaternion& orientationBody2) {
 
     decimal hingeAngle;
 
@@ -766,7 +847,7 @@ decimal SolveHingeJointSystem::computeCurrentHingeAngle(Entity jointEntity, cons
     currentOrientationDiff.normalize();
 
     // Compute the relative rotation considering the initial orientation difference
-    Quaternion relativeRotation = currentOrientationDiff * mHingeJointComponents.getInitOrientationDifferenceInv(jointEntity);
+    Quaternion relativeRotation = currentOrientationDiff * mHingeJointComponents.mInitOrientationDifferenceInv[jointComponentIndex];
     relativeRotation.normalize();
 
     // A quaternion q = [cos(theta/2); sin(theta/2) * rotAxis] where rotAxis is a unit
@@ -780,7 +861,7 @@ decimal SolveHingeJointSystem::computeCurrentHingeAngle(Entity jointEntity, cons
     decimal sinHalfAngleAbs = relativeRotation.getVectorV().length();
 
     // Compute the dot product of the relative rotation axis and the hinge axis
-    decimal dotProduct = relativeRotation.getVectorV().dot(mHingeJointComponents.getA1(jointEntity));
+    decimal dotProduct = relativeRotation.getVectorV().dot(mHingeJointComponents.mA1[jointComponentIndex]);
 
     // If the relative rotation axis and the hinge axis are pointing the same direction
     if (dotProduct >= decimal(0.0)) {
@@ -795,6 +876,6 @@ decimal SolveHingeJointSystem::computeCurrentHingeAngle(Entity jointEntity, cons
 
     // Compute and return the corresponding angle near one the two limits
     return computeCorrespondingAngleNearLimits(hingeAngle,
-                                               mHingeJointComponents.getLowerLimit(jointEntity),
-                                               mHingeJointComponents.getUpperLimit(jointEntity));
+                                               mHingeJointComponents.mLowerLimit[jointComponentIndex],
+                                               mHingeJointComponents.mUpperLimit[jointComponentIndex]);
 }
@@ -32,6 +32,8 @@ using namespace reactphysics3d;
 
 // Static variables definition
 const decimal SolveSliderJointSystem::BETA = decimal(0.2);
+const decimal SolveSliderJointSystem::POSITION_SLOP = decimal(0.0001);
+const decimal SolveSliderJointSystem::ROTATION_SLOP = decimal(0.0002);
 
 // Constructor
 SolveSliderJointSystem::SolveSliderJointSystem(PhysicsWorld& world, RigidBodyComponents& rigidBodyComponents,
@@ -40,7 +42,7 @@ SolveSliderJointSystem::SolveSliderJointSystem(PhysicsWorld& world, RigidBodyCom
                                                              SliderJointComponents& sliderJointComponents)
               :mWorld(world), mRigidBodyComponents(rigidBodyComponents), mTransformComponents(transformComponents),
                mJointComponents(jointComponents), mSliderJointComponents(sliderJointComponents),
-               mTimeStep(0), mIsWarmStartingActive(true) {
+               mTimeStep(0), mIsWarmStartingActive(true), mMaxImpulseChangeSquare(0) {
 
 }
 
@@ -63,6 +65,13 @@ void SolveSliderJointSystem::initBeforeSolve() {
         const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
         const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
 
+        // Cache the components indices and inverse masses of the bodies for the solver iterations
+        mSliderJointComponents.mJointComponentIndices[i] = jointIndex;
+        mSliderJointComponents.mBody1ComponentIndices[i] = componentIndexBody1;
+        mSliderJointComponents.mBody2ComponentIndices[i] = componentIndexBody2;
+        mSliderJointComponents.mInverseMassBody1[i] = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
+        mSliderJointComponents.mInverseMassBody2[i] = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+
         assert(!mRigidBodyComponents.getIsEntityDisabled(body1Entity));
         assert(!mRigidBodyComponents.getIsEntityDisabled(body2Entity));
 
@@ -246,15 +255,8 @@ void SolveSliderJointSystem::warmstart() {
     const uint32 nbJoints = mSliderJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
 
-        const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
-
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+        const uint32 componentIndexBody1 = mSliderJointComponents.mBody1ComponentIndices[i];
+        const uint32 componentIndexBody2 = mSliderJointComponents.mBody2ComponentIndices[i];
 
         // Get the velocities
         Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
@@ -263,8 +265,8 @@ void SolveSliderJointSystem::warmstart() {
         Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
         // Get the inverse mass and inverse inertia tensors of the bodies
-        const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+        const decimal inverseMassBody1 = mSliderJointComponents.mInverseMassBody1[i];
+        const decimal inverseMassBody2 = mSliderJointComponents.mInverseMassBody2[i];
 
         const Vector3& n1 = mSliderJointComponents.mN1[i];
         const Vector3& n2 = mSliderJointComponents.mN2[i];
@@ -325,192 +327,207 @@ void SolveSliderJointSystem::solveVelocityConstraint() {
     // For each joint component
     const uint32 nbJoints = mSliderJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbJoints; i++) {
+        solveVelocityConstraintForJoint(i);
+    }
+}
 
-        const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
-
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
-
-        // Get the velocities
-        Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
-        Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
-        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
-
-        const Matrix3x3& i1 = mSliderJointComponents.mI1[i];
-        const Matrix3x3& i2 = mSliderJointComponents.mI2[i];
-
-        const Vector3& n1 = mSliderJointComponents.mN1[i];
-        const Vector3& n2 = mSliderJointComponents.mN2[i];
-
-        const Vector3& r2CrossN1 = mSliderJointComponents.mR2CrossN1[i];
-        const Vector3& r2CrossN2 = mSliderJointComponents.mR2CrossN2[i];
-        const Vector3& r1PlusUCrossN1 = mSliderJointComponents.mR1PlusUCrossN1[i];
-        const Vector3& r1PlusUCrossN2 = mSliderJointComponents.mR1PlusUCrossN2[i];
+// Solve the velocity constraint of a batch of joints
+/// The joints are given by their indices in the slider joint components
+void SolveSliderJointSystem::solveVelocityConstraint(const uint32* jointComponentIndices, uint32 nbJoints) {
 
-        // Get the inverse mass and inverse inertia tensors of the bodies
-        decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+    for (uint32 j=0; j < nbJoints; j++) {
+        solveVelocityConstraintForJoint(jointComponentIndices[j]);
+    }
+}
 
-        const Vector3& r2CrossSliderAxis = mSliderJointComponents.mR2CrossSliderAxis[i];
-        const Vector3& r1PlusUCrossSliderAxis = mSliderJointComponents.mR1PlusUCrossSliderAxis[i];
+// Solve the velocity constraint of a single joint
+void SolveSliderJointSystem::solveVelocityConstraintForJoint(uint32 index) {
 
-        const Vector3& sliderAxisWorld = mSliderJointComponents.mSliderAxisWorld[i];
+    const uint32 componentIndexBody1 = mSliderJointComponents.mBody1ComponentIndices[index];
+    const uint32 componentIndexBody2 = mSliderJointComponents.mBody2ComponentIndices[index];
 
-        // --------------- Limits Constraints --------------- //
+    // Get the velocities
+    Vector3& v1 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody1];
+    Vector3& v2 = mRigidBodyComponents.mConstrainedLinearVelocities[componentIndexBody2];
+    Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+    Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-        if (mSliderJointComponents.mIsLimitEnabled[i]) {
+    const Matrix3x3& i1 = mSliderJointComponents.mI1[index];
+    const Matrix3x3& i2 = mSliderJointComponents.mI2[index];
 
-            Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
-            Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
+    const Vector3& n1 = mSliderJointComponents.mN1[index];
+    const Vector3& n2 = mSliderJointComponents.mN2[index];
 
-            const decimal inverseMassMatrixLimit = mSliderJointComponents.mInverseMassMatrixLimit[i];
+    const Vector3& r2CrossN1 = mSliderJointComponents.mR2CrossN1[index];
+    const Vector3& r2CrossN2 = mSliderJointComponents.mR2CrossN2[index];
+    const Vector3& r1PlusUCrossN1 = mSliderJointComponents.mR1PlusUCrossN1[index];
+    const Vector3& r1PlusUCrossN2 = mSliderJointComponents.mR1PlusUCrossN2[index];
 
-            // If the lower limit is violated
-            if (mSliderJointComponents.mIsLowerLimitViolated[i]) {
+    // Get the inverse mass and inverse inertia tensors of the bodies
+    decimal inverseMassBody1 = mSliderJointComponents.mInverseMassBody1[index];
+    decimal inverseMassBody2 = mSliderJointComponents.mInverseMassBody2[index];
 
-                // Compute J*v for the lower limit constraint
-                const decimal JvLowerLimit = sliderAxisWorld.dot(v2) + r2CrossSliderAxis.dot(w2) -
-                                             sliderAxisWorld.dot(v1) - r1PlusUCrossSliderAxis.dot(w1);
+    const Vector3& r2CrossSliderAxis = mSliderJointComponents.mR2CrossSliderAxis[index];
+    const Vector3& r1PlusUCrossSliderAxis = mSliderJointComponents.mR1PlusUCrossSliderAxis[index];
 
-                // Compute the Lagrange multiplier lambda for the lower limit constraint
-                decimal deltaLambdaLower = inverseMassMatrixLimit * (-JvLowerLimit - mSliderJointComponents.mBLowerLimit[i]);
-                decimal lambdaTemp = mSliderJointComponents.mImpulseLowerLimit[i];
-                mSliderJointComponents.mImpulseLowerLimit[i] = std::max(mSliderJointComponents.mImpulseLowerLimit[i] + deltaLambdaLower, decimal(0.0));
-                deltaLambdaLower = mSliderJointComponents.mImpulseLowerLimit[i] - lambdaTemp;
+    const Vector3& sliderAxisWorld = mSliderJointComponents.mSliderAxisWorld[index];
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
-                const Vector3 linearImpulseBody1 = -deltaLambdaLower * sliderAxisWorld;
-                const Vector3 angularImpulseBody1 = -deltaLambdaLower * r1PlusUCrossSliderAxis;
+    // --------------- Limits Constraints --------------- //
 
-                // Apply the impulse to the body 1
-                v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-                w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+    if (mSliderJointComponents.mIsLimitEnabled[index]) {
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
-                const Vector3 linearImpulseBody2 = deltaLambdaLower * sliderAxisWorld;
-                const Vector3 angularImpulseBody2 = deltaLambdaLower * r2CrossSliderAxis;
+        Vector3& w1 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody1];
+        Vector3& w2 = mRigidBodyComponents.mConstrainedAngularVelocities[componentIndexBody2];
 
-                // Apply the impulse to the body 2
-                v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-                w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
-            }
+        const decimal inverseMassMatrixLimit = mSliderJointComponents.mInverseMassMatrixLimit[index];
 
-            // If the upper limit is violated
-            if (mSliderJointComponents.mIsUpperLimitViolated[i]) {
+        // If the lower limit is violated
+        if (mSliderJointComponents.mIsLowerLimitViolated[index]) {
 
-                // Compute J*v for the upper limit constraint
-                const decimal JvUpperLimit = sliderAxisWorld.dot(v1) + r1PlusUCrossSliderAxis.dot(w1)
-                                            - sliderAxisWorld.dot(v2) - r2CrossSliderAxis.dot(w2);
+            // Compute J*v for the lower limit constraint
+            const decimal JvLowerLimit = sliderAxisWorld.dot(v2) + r2CrossSliderAxis.dot(w2) -
+                                         sliderAxisWorld.dot(v1) - r1PlusUCrossSliderAxis.dot(w1);
 
-                // Compute the Lagrange multiplier lambda for the upper limit constraint
-                decimal deltaLambdaUpper = inverseMassMatrixLimit * (-JvUpperLimit -mSliderJointComponents.mBUpperLimit[i]);
-                decimal lambdaTemp = mSliderJointComponents.mImpulseUpperLimit[i];
-                mSliderJointComponents.mImpulseUpperLimit[i] = std::max(mSliderJointComponents.mImpulseUpperLimit[i] + deltaLambdaUpper, decimal(0.0));
-                deltaLambdaUpper = mSliderJointComponents.mImpulseUpperLimit[i] - lambdaTemp;
+            // Compute the Lagrange multiplier lambda for the lower limit constraint
+            decimal deltaLambdaLower = inverseMassMatrixLimit * (-JvLowerLimit - mSliderJointComponents.mBLowerLimit[index]);
+            decimal lambdaTemp = mSliderJointComponents.mImpulseLowerLimit[index];
+            mSliderJointComponents.mImpulseLowerLimit[index] = std::max(mSliderJointComponents.mImpulseLowerLimit[index] + deltaLambdaLower, decimal(0.0));
+            deltaLambdaLower = mSliderJointComponents.mImpulseLowerLimit[index] - lambdaTemp;
+            updateMaxImpulseChange(deltaLambdaLower * deltaLambdaLower);
 
-                // Compute the impulse P=J^T * lambda for the upper limit constraint of body 1
-                const Vector3 linearImpulseBody1 = deltaLambdaUpper * sliderAxisWorld;
-                const Vector3 angularImpulseBody1 = deltaLambdaUpper * r1PlusUCrossSliderAxis;
+            // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
+            const Vector3 linearImpulseBody1 = -deltaLambdaLower * sliderAxisWorld;
+            const Vector3 angularImpulseBody1 = -deltaLambdaLower * r1PlusUCrossSliderAxis;
 
-                // Apply the impulse to the body 1
-                v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-                w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+            // Apply the impulse to the body 1
+            v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+            w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[index] * angularImpulseBody1);
 
-                // Compute the impulse P=J^T * lambda for the upper limit constraint of body 2
-                const Vector3 linearImpulseBody2 = -deltaLambdaUpper * sliderAxisWorld;
-                const Vector3 angularImpulseBody2 = -deltaLambdaUpper * r2CrossSliderAxis;
+            // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
+            const Vector3 linearImpulseBody2 = deltaLambdaLower * sliderAxisWorld;
+            const Vector3 angularImpulseBody2 = deltaLambdaLower * r2CrossSliderAxis;
 
-                // Apply the impulse to the body 2
-                v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-                w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
-            }
+            // Apply the impulse to the body 2
+            v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
+            w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[index] * angularImpulseBody2);
         }
 
-        // --------------- Motor --------------- //
-
-        if (mSliderJointComponents.mIsMotorEnabled[i]) {
+        // If the upper limit is violated
+        if (mSliderJointComponents.mIsUpperLimitViolated[index]) {
 
-            // Compute J*v for the motor
-            const decimal JvMotor = sliderAxisWorld.dot(v1) - sliderAxisWorld.dot(v2);
+            // Compute J*v for the upper limit constraint
+            const decimal JvUpperLimit = sliderAxisWorld.dot(v1) + r1PlusUCrossSliderAxis.dot(w1)
+                                        - sliderAxisWorld.dot(v2) - r2CrossSliderAxis.dot(w2);
 
-            // Compute the Lagrange multiplier lambda for the motor
-            const decimal maxMotorImpulse = mSliderJointComponents.mMaxMotorForce[i] * mTimeStep;
-            decimal deltaLambdaMotor = mSliderJointComponents.mInverseMassMatrixMotor[i] * (-JvMotor - mSliderJointComponents.mMotorSpeed[i]);
-            decimal lambdaTemp = mSliderJointComponents.mImpulseMotor[i];
-            mSliderJointComponents.mImpulseMotor[i] = clamp(mSliderJointComponents.mImpulseMotor[i] + deltaLambdaMotor, -maxMotorImpulse, maxMotorImpulse);
-            deltaLambdaMotor = mSliderJointComponents.mImpulseMotor[i] - lambdaTemp;
+            // Compute the Lagrange multiplier lambda for the upper limit constraint
+            decimal deltaLambdaUpper = inverseMassMatrixLimit * (-JvUpperLimit -mSliderJointComponents.mBUpperLimit[index]);
+            decimal lambdaTemp = mSliderJointComponents.mImpulseUpperLimit[index];
+            mSliderJointComponents.mImpulseUpperLimit[index] = std::max(mSliderJointComponents.mImpulseUpperLimit[index] + deltaLambdaUpper, decimal(0.0));
+            deltaLambdaUpper = mSliderJointComponents.mImpulseUpperLimit[index] - lambdaTemp;
+            updateMaxImpulseChange(deltaLambdaUpper * deltaLambdaUpper);
 
-            // Compute the impulse P=J^T * lambda for the motor of body 1
-            const Vector3 linearImpulseBody1 = deltaLambdaMotor * sliderAxisWorld;
+            // Compute the impulse P=J^T * lambda for the upper limit constraint of body 1
+            const Vector3 linearImpulseBody1 = deltaLambdaUpper * sliderAxisWorld;
+            const Vector3 angularImpulseBody1 = deltaLambdaUpper * r1PlusUCrossSliderAxis;
 
             // Apply the impulse to the body 1
             v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+            w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[index] * angularImpulseBody1);
 
-            // Compute the impulse P=J^T * lambda for the motor of body 2
-            const Vector3 linearImpulseBody2 = -deltaLambdaMotor * sliderAxisWorld;
+            // Compute the impulse P=J^T * lambda for the upper limit constraint of body 2
+            const Vector3 linearImpulseBody2 = -deltaLambdaUpper * sliderAxisWorld;
+            const Vector3 angularImpulseBody2 = -deltaLambdaUpper * r2CrossSliderAxis;
 
             // Apply the impulse to the body 2
             v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
+            w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[index] * angularImpulseBody2);
         }
+    }
 
-        // --------------- Rotation Constraints --------------- //
+    // --------------- Motor --------------- //
 
-        // Compute J*v for the 3 rotation constraints
-        const Vector3 JvRotation = w2 - w1;
+    if (mSliderJointComponents.mIsMotorEnabled[index]) {
 
-        // Compute the Lagrange multiplier lambda for the 3 rotation constraints
-        Vector3 deltaLambda2 = mSliderJointComponents.mInverseMassMatrixRotation[i] *
-                               (-JvRotation - mSliderJointComponents.getBiasRotation(jointEntity));
-        mSliderJointComponents.mImpulseRotation[i] += deltaLambda2;
+        // Compute J*v for the motor
+        const decimal JvMotor = sliderAxisWorld.dot(v1) - sliderAxisWorld.dot(v2);
 
-        // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
-        Vector3 angularImpulseBody1 = -deltaLambda2;
+        // Compute the Lagrange multiplier lambda for the motor
+        const decimal maxMotorImpulse = mSliderJointComponents.mMaxMotorForce[index] * mTimeStep;
+        decimal deltaLambdaMotor = mSliderJointComponents.mInverseMassMatrixMotor[index] * (-JvMotor - mSliderJointComponents.mMotorSpeed[index]);
+        decimal lambdaTemp = mSliderJointComponents.mImpulseMotor[index];
+        mSliderJointComponents.mImpulseMotor[index] = clamp(mSliderJointComponents.mImpulseMotor[index] + deltaLambdaMotor, -maxMotorImpulse, maxMotorImpulse);
+        deltaLambdaMotor = mSliderJointComponents.mImpulseMotor[index] - lambdaTemp;
+        updateMaxImpulseChange(deltaLambdaMotor * deltaLambdaMotor);
+
+        // Compute the impulse P=J^T * lambda for the motor of body 1
+        const Vector3 linearImpulseBody1 = deltaLambdaMotor * sliderAxisWorld;
 
         // Apply the impulse to the body 1
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
 
-        // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 2
-        Vector3 angularImpulseBody2 = deltaLambda2;
+        // Compute the impulse P=J^T * lambda for the motor of body 2
+        const Vector3 linearImpulseBody2 = -deltaLambdaMotor * sliderAxisWorld;
 
         // Apply the impulse to the body 2
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
+    }
 
-        // --------------- Translation Constraints --------------- //
+    // The joint constraints of a joint in an articulation tree or a direct island are solved by the articulation solver
+    if (mJointComponents.mIsSolvedDirectly[mSliderJointComponents.mJointComponentIndices[index]]) return;
 
-        // Compute J*v for the 2 translation constraints
-        const decimal el1 = -n1.dot(v1) - w1.dot(r1PlusUCrossN1) +
-                             n1.dot(v2) + w2.dot(r2CrossN1);
-        const decimal el2 = -n2.dot(v1) - w1.dot(r1PlusUCrossN2) +
-                             n2.dot(v2) + w2.dot(r2CrossN2);
-        const Vector2 JvTranslation(el1, el2);
+    // --------------- Rotation Constraints --------------- //
 
-        // Compute the Lagrange multiplier lambda for the 2 translation constraints
-        const Vector2 deltaLambda = mSliderJointComponents.mInverseMassMatrixTranslation[i] * (-JvTranslation - mSliderJointComponents.mBiasTranslation[i]);
-        mSliderJointComponents.mImpulseTranslation[i] += deltaLambda;
+    // Compute J*v for the 3 rotation constraints
+    const Vector3 JvRotation = w2 - w1;
 
-        // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 1
-        const Vector3 linearImpulseBody1 = -n1 * deltaLambda.x - n2 * deltaLambda.y;
-        angularImpulseBody1 = -r1PlusUCrossN1 * deltaLambda.x -
-                r1PlusUCrossN2 * deltaLambda.y;
+    // Compute the Lagrange multiplier lambda for the 3 rotation constraints
+    Vector3 deltaLambda2 = mSliderJointComponents.mInverseMassMatrixRotation[index] *
+                           (-JvRotation - mSliderJointComponents.mBiasRotation[index]);
+    updateMaxImpulseChange(deltaLambda2.lengthSquare());
+    mSliderJointComponents.mImpulseRotation[index] += deltaLambda2;
 
-        // Apply the impulse to the body 1
-        v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-        w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+    // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
+    Vector3 angularImpulseBody1 = -deltaLambda2;
 
-        // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 2
-        const Vector3 linearImpulseBody2 = -linearImpulseBody1;
-        angularImpulseBody2 = r2CrossN1 * deltaLambda.x + r2CrossN2 * deltaLambda.y;
+    // Apply the impulse to the body 1
+    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[index] * angularImpulseBody1);
 
-        // Apply the impulse to the body 2
-        v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-        w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
-    }
+    // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 2
+    Vector3 angularImpulseBody2 = deltaLambda2;
+
+    // Apply the impulse to the body 2
+    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[index] * angularImpulseBody2);
+
+    // --------------- Translation Constraints --------------- //
+
+    // Compute J*v for the 2 translation constraints
+    const decimal el1 = -n1.dot(v1) - w1.dot(r1PlusUCrossN1) +
+                         n1.dot(v2) + w2.dot(r2CrossN1);
+    const decimal el2 = -n2.dot(v1) - w1.dot(r1PlusUCrossN2) +
+                         n2.dot(v2) + w2.dot(r2CrossN2);
+    const Vector2 JvTranslation(el1, el2);
+
+    // Compute the Lagrange multiplier lambda for the 2 translation constraints
+    const Vector2 deltaLambda = mSliderJointComponents.mInverseMassMatrixTranslation[index] * (-JvTranslation - mSliderJointComponents.mBiasTranslation[index]);
+    updateMaxImpulseChange(deltaLambda.lengthSquare());
+    mSliderJointComponents.mImpulseTranslation[index] += deltaLambda;
+
+    // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 1
+    const Vector3 linearImpulseBody1 = -n1 * deltaLambda.x - n2 * deltaLambda.y;
+    angularImpulseBody1 = -r1PlusUCrossN1 * deltaLambda.x -
+            r1PlusUCrossN2 * deltaLambda.y;
+
+    // Apply the impulse to the body 1
+    v1 += inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+    w1 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+
+    // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 2
+    const Vector3 linearImpulseBody2 = -linearImpulseBody1;
+    angularImpulseBody2 = r2CrossN1 * deltaLambda.x + r2CrossN2 * deltaLambda.y;
+
+    // Apply the impulse to the body 2
+    v2 += inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
+    w2 += mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
 }
 
 // Solve the position constraint (for position error correction)
@@ -519,306 +536,240 @@ void SolveSliderJointSystem::solvePositionConstraint() {
     // For each joint component
     const uint32 nbEnabledJoints = mSliderJointComponents.getNbEnabledComponents();
     for (uint32 i=0; i < nbEnabledJoints; i++) {
+        solvePositionConstraintForJoint(i);
+    }
+}
 
-        const Entity jointEntity = mSliderJointComponents.mJointEntities[i];
-        const uint32 jointIndex = mJointComponents.getEntityIndex(jointEntity);
-
-        // If the error position correction technique is not the non-linear-gauss-seidel, we do
-        // do not execute this method
-        if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) return;
-
-        // Get the bodies entities
-        const Entity body1Entity = mJointComponents.mBody1Entities[jointIndex];
-        const Entity body2Entity = mJointComponents.mBody2Entities[jointIndex];
+// Solve the position constraint of a batch of joints
+/// The joints are given by their indices in the slider joint components
+void SolveSliderJointSystem::solvePositionConstraint(const uint32* jointComponentIndices, uint32 nbJoints) {
 
-        const uint32 componentIndexBody1 = mRigidBodyComponents.getEntityIndex(body1Entity);
-        const uint32 componentIndexBody2 = mRigidBodyComponents.getEntityIndex(body2Entity);
+    for (uint32 j=0; j < nbJoints; j++) {
+        solvePositionConstraintForJoint(jointComponentIndices[j]);
+    }
+}
 
-        Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
-        Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
+// Check which joints have a position error larger than the slop
+/// This is called after the integration of the positions of the bodies so that the drift of the
+/// current step is taken into account. The position correction is only applied to the islands that
+/// have such a joint and it then drives the error of all their joints back to zero.
+void SolveSliderJointSystem::computePositionErrors() {
 
-        // Recompute the world inverse inertia tensors
-        RigidBody::computeWorldInertiaTensorInverse(q1.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody1],
-                                                    mSliderJointComponents.mI1[i]);
+    // For each joint component
+    const uint32 nbEnabledJoints = mSliderJointComponents.getNbEnabledComponents();
+    for (uint32 i=0; i < nbEnabledJoints; i++) {
 
-        RigidBody::computeWorldInertiaTensorInverse(q2.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody2],
-                                                    mSliderJointComponents.mI2[i]);
+        const uint32 jointIndex = mSliderJointComponents.mJointComponentIndices[i];
 
-        // Vector from body center to the anchor point
-        mSliderJointComponents.mR1[i] = q1 * (mSliderJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
-        mSliderJointComponents.mR2[i] = q2 * (mSliderJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
+        // Only the non-linear Gauss-Seidel technique corrects the position error after the integration
+        if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) {
+            mJointComponents.mHasPositionError[jointIndex] = false;
+            continue;
+        }
 
-        // Get the inverse mass and inverse inertia tensors of the bodies
-        const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+        const uint32 componentIndexBody1 = mSliderJointComponents.mBody1ComponentIndices[i];
+        const uint32 componentIndexBody2 = mSliderJointComponents.mBody2ComponentIndices[i];
 
-        const Vector3& r1 = mSliderJointComponents.mR1[i];
-        const Vector3& r2 = mSliderJointComponents.mR2[i];
-
-        const Vector3& n1 = mSliderJointComponents.mN1[i];
-        const Vector3& n2 = mSliderJointComponents.mN2[i];
-
-        Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
-        Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
+        const Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
+        const Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
+        const Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
+        const Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
 
         // Compute the vector u (difference between anchor points)
+        const Vector3 r1 = q1 * (mSliderJointComponents.mLocalAnchorPointBody1[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
+        const Vector3 r2 = q2 * (mSliderJointComponents.mLocalAnchorPointBody2[i] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
         const Vector3 u = x2 + r2 - x1 - r1;
 
-        // Compute the two orthogonal vectors to the slider axis in world-space
-        mSliderJointComponents.mSliderAxisWorld[i] = q1 * mSliderJointComponents.mSliderAxisBody1[i];
-        mSliderJointComponents.mSliderAxisWorld[i].normalize();
-        mSliderJointComponents.mN1[i] = mSliderJointComponents.mSliderAxisWorld[i].getOneUnitOrthogonalVector();
-        mSliderJointComponents.mN2[i] = mSliderJointComponents.mSliderAxisWorld[i].cross(n1);
+        // Compute the translation error orthogonal to the slider axis
+        const Vector3 sliderAxisWorld = (q1 * mSliderJointComponents.mSliderAxisBody1[i]).getUnit();
+        const Vector3 n1 = sliderAxisWorld.getOneUnitOrthogonalVector();
+        const Vector3 n2 = sliderAxisWorld.cross(n1);
+        const Vector2 translationError(u.dot(n1), u.dot(n2));
 
-        // Check if the limit constraints are violated or not
-        decimal uDotSliderAxis = u.dot(mSliderJointComponents.mSliderAxisWorld[i]);
-        decimal lowerLimitError = uDotSliderAxis - mSliderJointComponents.getLowerLimit(jointEntity);
-        decimal upperLimitError = mSliderJointComponents.getUpperLimit(jointEntity) - uDotSliderAxis;
-        mSliderJointComponents.mIsLowerLimitViolated[i] = lowerLimitError <= 0;
-        mSliderJointComponents.mIsUpperLimitViolated[i] = upperLimitError <= 0;
+        // Compute the rotation error (the rotation angles are approximated by twice the vector part of the error quaternion)
+        const Quaternion orientationError = q2 * mSliderJointComponents.mInitOrientationDifferenceInv[i] * q1.getInverse();
 
-        // Compute the cross products used in the Jacobians
-        mSliderJointComponents.mR2CrossN1[i] = r2.cross(n1);
-        mSliderJointComponents.mR2CrossN2[i] = r2.cross(n2);
-        mSliderJointComponents.mR2CrossSliderAxis[i] = r2.cross(mSliderJointComponents.mSliderAxisWorld[i]);
-        const Vector3 r1PlusU = r1 + u;
-        mSliderJointComponents.mR1PlusUCrossN1[i] = r1PlusU.cross(n1);
-        mSliderJointComponents.mR1PlusUCrossN2[i] = r1PlusU.cross(n2);
-        mSliderJointComponents.mR1PlusUCrossSliderAxis[i] = r1PlusU.cross(mSliderJointComponents.mSliderAxisWorld[i]);
+        bool hasPositionError = translationError.lengthSquare() > POSITION_SLOP * POSITION_SLOP ||
+                                decimal(4.0) * orientationError.getVectorV().lengthSquare() > ROTATION_SLOP * ROTATION_SLOP;
 
-        const Vector3& r2CrossN1 = mSliderJointComponents.mR2CrossN1[i];
-        const Vector3& r2CrossN2 = mSliderJointComponents.mR2CrossN2[i];
-        const Vector3& r1PlusUCrossN1 = mSliderJointComponents.mR1PlusUCrossN1[i];
-        const Vector3& r1PlusUCrossN2 = mSliderJointComponents.mR1PlusUCrossN2[i];
-
-        // --------------- Limits Constraints --------------- //
+        // Check if the limits are violated
+        if (!hasPositionError && mSliderJointComponents.mIsLimitEnabled[i]) {
+            const decimal uDotSliderAxis = u.dot(sliderAxisWorld);
+            hasPositionError = uDotSliderAxis - mSliderJointComponents.mLowerLimit[i] < -POSITION_SLOP ||
+                               mSliderJointComponents.mUpperLimit[i] - uDotSliderAxis < -POSITION_SLOP;
+        }
 
-        if (mSliderJointComponents.mIsLimitEnabled[i]) {
+        mJointComponents.mHasPositionError[jointIndex] = hasPositionError;
+    }
+}
 
-            Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
-            Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
+// Solve the position constraint of a single joint
+void SolveSliderJointSystem::solvePositionConstraintForJoint(uint32 index) {
 
-            const Vector3& r2CrossSliderAxis = mSliderJointComponents.mR2CrossSliderAxis[i];
-            const Vector3& r1PlusUCrossSliderAxis = mSliderJointComponents.mR1PlusUCrossSliderAxis[i];
+    const uint32 jointIndex = mSliderJointComponents.mJointComponentIndices[index];
 
-            if (mSliderJointComponents.mIsLowerLimitViolated[i] || mSliderJointComponents.mIsUpperLimitViolated[i]) {
+    // If the error position correction technique is not the non-linear-gauss-seidel, we do
+    // do not execute this method
+    if (mJointComponents.mPositionCorrectionTechniques[jointIndex] != JointsPositionCorrectionTechnique::NON_LINEAR_GAUSS_SEIDEL) return;
 
-                // Compute the inverse of the mass matrix K=JM^-1J^t for the limits (1x1 matrix)
-                const decimal body1MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-                const decimal body2MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
-                mSliderJointComponents.mInverseMassMatrixLimit[i] = body1MassInverse + body2MassInverse +
-                                        r1PlusUCrossSliderAxis.dot(mSliderJointComponents.mI1[i] * r1PlusUCrossSliderAxis) +
-                                        r2CrossSliderAxis.dot(mSliderJointComponents.mI2[i] * r2CrossSliderAxis);
-                mSliderJointComponents.mInverseMassMatrixLimit[i] = (mSliderJointComponents.mInverseMassMatrixLimit[i] > decimal(0.0)) ?
-                                          decimal(1.0) / mSliderJointComponents.mInverseMassMatrixLimit[i] : decimal(0.0);
-            }
+    const uint32 componentIndexBody1 = mSliderJointComponents.mBody1ComponentIndices[index];
+    const uint32 componentIndexBody2 = mSliderJointComponents.mBody2ComponentIndices[index];
 
-            const decimal inverseMassBody1 = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-            const decimal inverseMassBody2 = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
+    Quaternion& q1 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody1];
+    Quaternion& q2 = mRigidBodyComponents.mConstrainedOrientations[componentIndexBody2];
 
-            // If the lower limit is violated
-            if (mSliderJointComponents.mIsLowerLimitViolated[i]) {
+    // Recompute the world inverse inertia tensors
+    RigidBody::computeWorldInertiaTensorInverse(q1.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody1],
+                                                mSliderJointComponents.mI1[index]);
 
-                const Vector3& r1 = mSliderJointComponents.mR1[i];
-                const Vector3& r2 = mSliderJointComponents.mR2[i];
-                const Vector3 u = x2 + r2 - x1 - r1;
-                decimal uDotSliderAxis = u.dot(mSliderJointComponents.mSliderAxisWorld[i]);
-                decimal lowerLimitError = uDotSliderAxis - mSliderJointComponents.mLowerLimit[i];
+    RigidBody::computeWorldInertiaTensorInverse(q2.getMatrix(), mRigidBodyComponents.mInverseInertiaTensorsLocal[componentIndexBody2],
+                                                mSliderJointComponents.mI2[index]);
 
-                // Compute the Lagrange multiplier lambda for the lower limit constraint
-                decimal lambdaLowerLimit = mSliderJointComponents.mInverseMassMatrixLimit[i] * (-lowerLimitError);
+    // Vector from body center to the anchor point
+    mSliderJointComponents.mR1[index] = q1 * (mSliderJointComponents.mLocalAnchorPointBody1[index] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody1]);
+    mSliderJointComponents.mR2[index] = q2 * (mSliderJointComponents.mLocalAnchorPointBody2[index] - mRigidBodyComponents.mCentersOfMassLocal[componentIndexBody2]);
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
-                const Vector3 linearImpulseBody1 = -lambdaLowerLimit * mSliderJointComponents.mSliderAxisWorld[i];
-                const Vector3 angularImpulseBody1 = -lambdaLowerLimit * r1PlusUCrossSliderAxis;
+    // Get the inverse mass and inverse inertia tensors of the bodies
+    const decimal inverseMassBody1 = mSliderJointComponents.mInverseMassBody1[index];
+    const decimal inverseMassBody2 = mSliderJointComponents.mInverseMassBody2[index];
 
-                // Apply the impulse to the body 1
-                const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-                const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+    const Vector3& r1 = mSliderJointComponents.mR1[index];
+    const Vector3& r2 = mSliderJointComponents.mR2[index];
 
-                // Update the body position/orientation of body 1
-                x1 += v1;
-                q1 += Quaternion(0, w1) * q1 * decimal(0.5);
-                q1.normalize();
+    const Vector3& n1 = mSliderJointComponents.mN1[index];
+    const Vector3& n2 = mSliderJointComponents.mN2[index];
 
-                // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
-                const Vector3 linearImpulseBody2 = lambdaLowerLimit * mSliderJointComponents.mSliderAxisWorld[i];
-                const Vector3 angularImpulseBody2 = lambdaLowerLimit * r2CrossSliderAxis;
+    Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
+    Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
 
-                // Apply the impulse to the body 2
-                const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-                const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+    // Compute the vector u (difference between anchor points)
+    const Vector3 u = x2 + r2 - x1 - r1;
 
-                // Update the body position/orientation of body 2
-                x2 += v2;
-                q2 += Quaternion(0, w2) * q2 * decimal(0.5);
-                q2.normalize();
-            }
+    // Compute the two orthogonal vectors to the slider axis in world-space
+    mSliderJointComponents.mSliderAxisWorld[index] = q1 * mSliderJointComponents.mSliderAxisBody1[index];
+    mSliderJointComponents.mSliderAxisWorld[index].normalize();
+    mSliderJointComponents.mN1[index] = mSliderJointComponents.mSliderAxisWorld[index].getOneUnitOrthogonalVector();
+    mSliderJointComponents.mN2[index] = mSliderJointComponents.mSliderAxisWorld[index].cross(n1);
 
-            // If the upper limit is violated
-            if (mSliderJointComponents.mIsUpperLimitViolated[i]) {
+    // Check if the limit constraints are violated or not
+    decimal uDotSliderAxis = u.dot(mSliderJointComponents.mSliderAxisWorld[index]);
+    decimal lowerLimitError = uDotSliderAxis - mSliderJointComponents.mLowerLimit[index];
+    decimal upperLimitError = mSliderJointComponents.mUpperLimit[index] - uDotSliderAxis;
+    mSliderJointComponents.mIsLowerLimitViolated[index] = lowerLimitError <= 0;
+    mSliderJointComponents.mIsUpperLimitViolated[index] = upperLimitError <= 0;
 
-                const Vector3& r1 = mSliderJointComponents.mR1[i];
-                const Vector3& r2 = mSliderJointComponents.mR2[i];
-                const Vector3 u = x2 + r2 - x1 - r1;
-                decimal uDotSliderAxis = u.dot(mSliderJointComponents.mSliderAxisWorld[i]);
-                decimal upperLimitError = mSliderJointComponents.mUpperLimit[i] - uDotSliderAxis;
+    // Compute the cross products used in the Jacobians
+    mSliderJointComponents.mR2CrossN1[index] = r2.cross(n1);
+    mSliderJointComponents.mR2CrossN2[index] = r2.cross(n2);
+    mSliderJointComponents.mR2CrossSliderAxis[index] = r2.cross(mSliderJointComponents.mSliderAxisWorld[index]);
+    const Vector3 r1PlusU = r1 + u;
+    mSliderJointComponents.mR1PlusUCrossN1[index] = r1PlusU.cross(n1);
+    mSliderJointComponents.mR1PlusUCrossN2[index] = r1PlusU.cross(n2);
+    mSliderJointComponents.mR1PlusUCrossSliderAxis[index] = r1PlusU.cross(mSliderJointComponents.mSliderAxisWorld[index]);
 
-                // Compute the Lagrange multiplier lambda for the upper limit constraint
-                decimal lambdaUpperLimit = mSliderJointComponents.mInverseMassMatrixLimit[i] * (-upperLimitError);
+    const Vector3& r2CrossN1 = mSliderJointComponents.mR2CrossN1[index];
+    const Vector3& r2CrossN2 = mSliderJointComponents.mR2CrossN2[index];
+    const Vector3& r1PlusUCrossN1 = mSliderJointComponents.mR1PlusUCrossN1[index];
+    const Vector3& r1PlusUCrossN2 = mSliderJointComponents.mR1PlusUCrossN2[index];
 
-                // Compute the impulse P=J^T * lambda for the upper limit constraint of body 1
-                const Vector3 linearImpulseBody1 = lambdaUpperLimit * mSliderJointComponents.mSliderAxisWorld[i];
-                const Vector3 angularImpulseBody1 = lambdaUpperLimit * r1PlusUCrossSliderAxis;
+    // --------------- Limits Constraints --------------- //
 
-                // Apply the impulse to the body 1
-                const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-                const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+    if (mSliderJointComponents.mIsLimitEnabled[index]) {
 
-                // Update the body position/orientation of body 1
-                x1 += v1;
-                q1 += Quaternion(0, w1) * q1 * decimal(0.5);
-                q1.normalize();
+        Vector3& x1 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody1];
+        Vector3& x2 = mRigidBodyComponents.mConstrainedPositions[componentIndexBody2];
 
-                // Compute the impulse P=J^T * lambda for the upper limit constraint of body 2
-                const Vector3 linearImpulseBody2 = -lambdaUpperLimit * mSliderJointComponents.mSliderAxisWorld[i];
-                const Vector3 angularImpulseBody2 = -lambdaUpperLimit * r2CrossSliderAxis;
+        const Vector3& r2CrossSliderAxis = mSliderJointComponents.mR2CrossSliderAxis[index];
+        const Vector3& r1PlusUCrossSliderAxis = mSliderJointComponents.mR1PlusUCrossSliderAxis[index];
 
-                // Apply the impulse to the body 2
-                const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-                const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+        if (mSliderJointComponents.mIsLowerLimitViolated[index] || mSliderJointComponents.mIsUpperLimitViolated[index]) {
 
-                // Update the body position/orientation of body 2
-                x2 += v2;
-                q2 += Quaternion(0, w2) * q2 * decimal(0.5);
-                q2.normalize();
-            }
+            // Compute the inverse of the mass matrix K=JM^-1J^t for the limits (1x1 matrix)
+            const decimal body1MassInverse = mSliderJointComponents.mInverseMassBody1[index];
+            const decimal body2MassInverse = mSliderJointComponents.mInverseMassBody2[index];
+            mSliderJointComponents.mInverseMassMatrixLimit[index] = body1MassInverse + body2MassInverse +
+                                    r1PlusUCrossSliderAxis.dot(mSliderJointComponents.mI1[index] * r1PlusUCrossSliderAxis) +
+                                    r2CrossSliderAxis.dot(mSliderJointComponents.mI2[index] * r2CrossSliderAxis);
+            mSliderJointComponents.mInverseMassMatrixLimit[index] = (mSliderJointComponents.mInverseMassMatrixLimit[index] > decimal(0.0)) ?
+                                      decimal(1.0) / mSliderJointComponents.mInverseMassMatrixLimit[index] : decimal(0.0);
         }
 
-        // --------------- Rotation Constraints --------------- //
+        const decimal inverseMassBody1 = mSliderJointComponents.mInverseMassBody1[index];
+        const decimal inverseMassBody2 = mSliderJointComponents.mInverseMassBody2[index];
 
-        // Compute the inverse of the mass matrix K=JM^-1J^t for the 3 rotation
-        // contraints (3x3 matrix)
-        mSliderJointComponents.mInverseMassMatrixRotation[i] = mSliderJointComponents.mI1[i] + mSliderJointComponents.mI2[i];
-        decimal massMatrixRotationDeterminant = mSliderJointComponents.mInverseMassMatrixRotation[i].getDeterminant();
-        if (std::abs(massMatrixRotationDeterminant) > MACHINE_EPSILON) {
+        // If the lower limit is violated
+        if (mSliderJointComponents.mIsLowerLimitViolated[index]) {
 
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC || mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+            const Vector3& r1 = mSliderJointComponents.mR1[index];
+            const Vector3& r2 = mSliderJointComponents.mR2[index];
+            const Vector3 u = x2 + r2 - x1 - r1;
+            decimal uDotSliderAxis = u.dot(mSliderJointComponents.mSliderAxisWorld[index]);
+            decimal lowerLimitError = uDotSliderAxis - mSliderJointComponents.mLowerLimit[index];
 
-                mSliderJointComponents.mInverseMassMatrixRotation[i] = mSliderJointComponents.mInverseMassMatrixRotation[i].getInverse(massMatrixRotationDeterminant);
-            }
+            // Compute the Lagrange multiplier lambda for the lower limit constraint
+            decimal lambdaLowerLimit = mSliderJointComponents.mInverseMassMatrixLimit[index] * (-lowerLimitError);
+            updateMaxImpulseChange(lambdaLowerLimit * lambdaLowerLimit);
 
-            // Calculate difference in rotation
-            //
-            // The rotation should be:
-            //
-            // q2 = q1 r0
-            //
-            // But because of drift the actual rotation is:
-            //
-            // q2 = qError q1 r0
-            // <=> qError = q2 r0^-1 q1^-1
-            //
-            // Where:
-            // q1 = current rotation of body 1
-            // q2 = current rotation of body 2
-            // qError = error that needs to be reduced to zero
-            Quaternion qError = q2 * mSliderJointComponents.mInitOrientationDifferenceInv[i] * q1.getInverse();
-
-            // A quaternion can be seen as:
-            //
-            // q = [sin(theta / 2) * v, cos(theta/2)]
-            //
-            // Where:
-            // v = rotation vector
-            // theta = rotation angle
-            //
-            // If we assume theta is small (error is small) then sin(x) = x so an approximation of the error angles is:
-            const Vector3 errorRotation = decimal(2.0) * qError.getVectorV();
-
-            // Compute the Lagrange multiplier lambda for the 3 rotation constraints
-            Vector3 lambdaRotation = mSliderJointComponents.mInverseMassMatrixRotation[i] * (-errorRotation);
-
-            // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
-            Vector3 angularImpulseBody1 = -lambdaRotation;
+            // Compute the impulse P=J^T * lambda for the lower limit constraint of body 1
+            const Vector3 linearImpulseBody1 = -lambdaLowerLimit * mSliderJointComponents.mSliderAxisWorld[index];
+            const Vector3 angularImpulseBody1 = -lambdaLowerLimit * r1PlusUCrossSliderAxis;
 
             // Apply the impulse to the body 1
-            Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[i] * angularImpulseBody1);
+            const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+            const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[index] * angularImpulseBody1);
 
             // Update the body position/orientation of body 1
+            x1 += v1;
             q1 += Quaternion(0, w1) * q1 * decimal(0.5);
             q1.normalize();
 
-            // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 2
-            Vector3 angularImpulseBody2 = lambdaRotation;
+            // Compute the impulse P=J^T * lambda for the lower limit constraint of body 2
+            const Vector3 linearImpulseBody2 = lambdaLowerLimit * mSliderJointComponents.mSliderAxisWorld[index];
+            const Vector3 angularImpulseBody2 = lambdaLowerLimit * r2CrossSliderAxis;
 
             // Apply the impulse to the body 2
-            Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[i] * angularImpulseBody2);
+            const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
+            const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[index] * angularImpulseBody2);
 
             // Update the body position/orientation of body 2
+            x2 += v2;
             q2 += Quaternion(0, w2) * q2 * decimal(0.5);
             q2.normalize();
         }
 
-        // --------------- Translation Constraints --------------- //
+        // If the upper limit is violated
+        if (mSliderJointComponents.mIsUpperLimitViolated[index]) {
 
-        const Matrix3x3& i1 = mSliderJointComponents.getI1(jointEntity);
-        const Matrix3x3& i2 = mSliderJointComponents.getI2(jointEntity);
+            const Vector3& r1 = mSliderJointComponents.mR1[index];
+            const Vector3& r2 = mSliderJointComponents.mR2[index];
+            const Vector3 u = x2 + r2 - x1 - r1;
+            decimal uDotSliderAxis = u.dot(mSliderJointComponents.mSliderAxisWorld[index]);
+            decimal upperLimitError = mSliderJointComponents.mUpperLimit[index] - uDotSliderAxis;
 
-        // Recompute the inverse of the mass matrix K=JM^-1J^t for the 2 translation
-        // constraints (2x2 matrix)
-        const decimal body1MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody1];
-        const decimal body2MassInverse = mRigidBodyComponents.mInverseMasses[componentIndexBody2];
-        decimal sumInverseMass = body1MassInverse + body2MassInverse;
-        Vector3 I1R1PlusUCrossN1 = i1 * r1PlusUCrossN1;
-        Vector3 I1R1PlusUCrossN2 = i1 * r1PlusUCrossN2;
-        Vector3 I2R2CrossN1 = i2 * r2CrossN1;
-        Vector3 I2R2CrossN2 = i2 * r2CrossN2;
-        const decimal el11 = sumInverseMass + r1PlusUCrossN1.dot(I1R1PlusUCrossN1) +
-                             r2CrossN1.dot(I2R2CrossN1);
-        const decimal el12 = r1PlusUCrossN1.dot(I1R1PlusUCrossN2) +
-                             r2CrossN1.dot(I2R2CrossN2);
-        const decimal el21 = r1PlusUCrossN2.dot(I1R1PlusUCrossN1) +
-                             r2CrossN2.dot(I2R2CrossN1);
-        const decimal el22 = sumInverseMass + r1PlusUCrossN2.dot(I1R1PlusUCrossN2) +
-                             r2CrossN2.dot(I2R2CrossN2);
-        Matrix2x2 matrixKTranslation(el11, el12, el21, el22);
-        mSliderJointComponents.mInverseMassMatrixTranslation[i].setToZero();
-        decimal matrixKTranslationDeterminant = matrixKTranslation.getDeterminant();
-        if (std::abs(matrixKTranslationDeterminant) > MACHINE_EPSILON) {
-
-            if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC || mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
-
-                mSliderJointComponents.mInverseMassMatrixTranslation[i] = matrixKTranslation.getInverse(matrixKTranslationDeterminant);
-            }
-
-            // Compute the position error for the 2 translation constraints
-            const Vector2 translationError(u.dot(n1), u.dot(n2));
+            // Compute the Lagrange multiplier lambda for the upper limit constraint
+            decimal lambdaUpperLimit = mSliderJointComponents.mInverseMassMatrixLimit[index] * (-upperLimitError);
+            updateMaxImpulseChange(lambdaUpperLimit * lambdaUpperLimit);
 
-            // Compute the Lagrange multiplier lambda for the 2 translation constraints
-            Vector2 lambdaTranslation = mSliderJointComponents.mInverseMassMatrixTranslation[i] * (-translationError);
-
-            // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 1
-            const Vector3 linearImpulseBody1 = -n1 * lambdaTranslation.x - n2 * lambdaTranslation.y;
-            Vector3 angularImpulseBody1 = -r1PlusUCrossN1 * lambdaTranslation.x -
-                                                r1PlusUCrossN2 * lambdaTranslation.y;
+            // Compute the impulse P=J^T * lambda for the upper limit constraint of body 1
+            const Vector3 linearImpulseBody1 = lambdaUpperLimit * mSliderJointComponents.mSliderAxisWorld[index];
+            const Vector3 angularImpulseBody1 = lambdaUpperLimit * r1PlusUCrossSliderAxis;
 
             // Apply the impulse to the body 1
             const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
-            Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+            const Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[index] * angularImpulseBody1);
 
             // Update the body position/orientation of body 1
             x1 += v1;
             q1 += Quaternion(0, w1) * q1 * decimal(0.5);
             q1.normalize();
 
-            // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 2
-            const Vector3 linearImpulseBody2 = n1 * lambdaTranslation.x + n2 * lambdaTranslation.y;
-            Vector3 angularImpulseBody2 = r2CrossN1 * lambdaTranslation.x + r2CrossN2 * lambdaTranslation.y;
+            // Compute the impulse P=J^T * lambda for the upper limit constraint of body 2
+            const Vector3 linearImpulseBody2 = -lambdaUpperLimit * mSliderJointComponents.mSliderAxisWorld[index];
+            const Vector3 angularImpulseBody2 = -lambdaUpperLimit * r2CrossSliderAxis;
 
             // Apply the impulse to the body 2
             const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
-            Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+            const Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[index] * angularImpulseBody2);
 
             // Update the body position/orientation of body 2
             x2 += v2;
@@ -826,4 +777,137 @@ void SolveSliderJointSystem::solvePositionConstraint() {
             q2.normalize();
         }
     }
+
+    // --------------- Rotation Constraints --------------- //
+
+    // Compute the inverse of the mass matrix K=JM^-1J^t for the 3 rotation
+    // contraints (3x3 matrix)
+    mSliderJointComponents.mInverseMassMatrixRotation[index] = mSliderJointComponents.mI1[index] + mSliderJointComponents.mI2[index];
+    decimal massMatrixRotationDeterminant = mSliderJointComponents.mInverseMassMatrixRotation[index].getDeterminant();
+    if (std::abs(massMatrixRotationDeterminant) > MACHINE_EPSILON) {
+
+        if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC || mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+
+            mSliderJointComponents.mInverseMassMatrixRotation[index] = mSliderJointComponents.mInverseMassMatrixRotation[index].getInverse(massMatrixRotationDeterminant);
+        }
+
+        // Calculate difference in rotation
+        //
+        // The rotation should be:
+        //
+        // q2 = q1 r0
+        //
+        // But because of drift the actual rotation is:
+        //
+        // q2 = qError q1 r0
+        // <=> qError = q2 r0^-1 q1^-1
+        //
+        // Where:
+        // q1 = current rotation of body 1
+        // q2 = current rotation of body 2
+        // qError = error that needs to be reduced to zero
+        Quaternion qError = q2 * mSliderJointComponents.mInitOrientationDifferenceInv[index] * q1.getInverse();
+
+        // A quaternion can be seen as:
+        //
+        // q = [sin(theta / 2) * v, cos(theta/2)]
+        //
+        // Where:
+        // v = rotation vector
+        // theta = rotation angle
+        //
+        // If we assume theta is small (error is small) then sin(x) = x so an approximation of the error angles is:
+        const Vector3 errorRotation = decimal(2.0) * qError.getVectorV();
+
+        // Compute the Lagrange multiplier lambda for the 3 rotation constraints
+        Vector3 lambdaRotation = mSliderJointComponents.mInverseMassMatrixRotation[index] * (-errorRotation);
+        updateMaxImpulseChange(lambdaRotation.lengthSquare());
+
+        // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 1
+        Vector3 angularImpulseBody1 = -lambdaRotation;
+
+        // Apply the impulse to the body 1
+        Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (mSliderJointComponents.mI1[index] * angularImpulseBody1);
+
+        // Update the body position/orientation of body 1
+        q1 += Quaternion(0, w1) * q1 * decimal(0.5);
+        q1.normalize();
+
+        // Compute the impulse P=J^T * lambda for the 3 rotation constraints of body 2
+        Vector3 angularImpulseBody2 = lambdaRotation;
+
+        // Apply the impulse to the body 2
+        Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (mSliderJointComponents.mI2[index] * angularImpulseBody2);
+
+        // Update the body position/orientation of body 2
+        q2 += Quaternion(0, w2) * q2 * decimal(0.5);
+        q2.normalize();
+    }
+
+    // --------------- Translation Constraints --------------- //
+
+    const Matrix3x3& i1 = mSliderJointComponents.mI1[index];
+    const Matrix3x3& i2 = mSliderJointComponents.mI2[index];
+
+    // Recompute the inverse of the mass matrix K=JM^-1J^t for the 2 translation
+    // constraints (2x2 matrix)
+    const decimal body1MassInverse = mSliderJointComponents.mInverseMassBody1[index];
+    const decimal body2MassInverse = mSliderJointComponents.mInverseMassBody2[index];
+    decimal sumInverseMass = body1MassInverse + body2MassInverse;
+    Vector3 I1R1PlusUCrossN1 = i1 * r1PlusUCrossN1;
+    Vector3 I1R1PlusUCrossN2 = i1 * r1PlusUCrossN2;
+    Vector3 I2R2CrossN1 = i2 * r2CrossN1;
+    Vector3 I2R2CrossN2 = i2 * r2CrossN2;
+    const decimal el11 = sumInverseMass + r1PlusUCrossN1.dot(I1R1PlusUCrossN1) +
+                         r2CrossN1.dot(I2R2CrossN1);
+    const decimal el12 = r1PlusUCrossN1.dot(I1R1PlusUCrossN2) +
+                         r2CrossN1.dot(I2R2CrossN2);
+    const decimal el21 = r1PlusUCrossN2.dot(I1R1PlusUCrossN1) +
+                         r2CrossN2.dot(I2R2CrossN1);
+    const decimal el22 = sumInverseMass + r1PlusUCrossN2.dot(I1R1PlusUCrossN2) +
+                         r2CrossN2.dot(I2R2CrossN2);
+    Matrix2x2 matrixKTranslation(el11, el12, el21, el22);
+    mSliderJointComponents.mInverseMassMatrixTranslation[index].setToZero();
+    decimal matrixKTranslationDeterminant = matrixKTranslation.getDeterminant();
+    if (std::abs(matrixKTranslationDeterminant) > MACHINE_EPSILON) {
+
+        if (mRigidBodyComponents.mBodyTypes[componentIndexBody1] == BodyType::DYNAMIC || mRigidBodyComponents.mBodyTypes[componentIndexBody2] == BodyType::DYNAMIC) {
+
+            mSliderJointComponents.mInverseMassMatrixTranslation[index] = matrixKTranslation.getInverse(matrixKTranslationDeterminant);
+        }
+
+        // Compute the position error for the 2 translation constraints
+        const Vector2 translationError(u.dot(n1), u.dot(n2));
+
+        // Compute the Lagrange multiplier lambda for the 2 translation constraints
+        Vector2 lambdaTranslation = mSliderJointComponents.mInverseMassMatrixTranslation[index] * (-translationError);
+        updateMaxImpulseChange(lambdaTranslation.lengthSquare());
+
+        // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 1
+        const Vector3 linearImpulseBody1 = -n1 * lambdaTranslation.x - n2 * lambdaTranslation.y;
+        Vector3 angularImpulseBody1 = -r1PlusUCrossN1 * lambdaTranslation.x -
+                                            r1PlusUCrossN2 * lambdaTranslation.y;
+
+        // Apply the impulse to the body 1
+        const Vector3 v1 = inverseMassBody1 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody1] * linearImpulseBody1;
+        Vector3 w1 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody1] * (i1 * angularImpulseBody1);
+
+        // Update the body position/orientation of body 1
+        x1 += v1;
+        q1 += Quaternion(0, w1) * q1 * decimal(0.5);
+        q1.normalize();
+
+        // Compute the impulse P=J^T * lambda for the 2 translation constraints of body 2
+        const Vector3 linearImpulseBody2 = n1 * lambdaTranslation.x + n2 * lambdaTranslation.y;
+        Vector3 angularImpulseBody2 = r2CrossN1 * lambdaTranslation.x + r2CrossN2 * lambdaTranslation.y;
+
+        // Apply the impulse to the body 2
+        const Vector3 v2 = inverseMassBody2 * mRigidBodyComponents.mLinearLockAxisFactors[componentIndexBody2] * linearImpulseBody2;
+        Vector3 w2 = mRigidBodyComponents.mAngularLockAxisFactors[componentIndexBody2] * (i2 * angularImpulseBody2);
+
+        // Update the body position/orientation of body 2
+        x2 += v2;
+        q2 += Quaternion(0, w2) * q2 * decimal(0.5);
+        q2.normalize();
+    }
 }
@@ -33,6 +33,8 @@
 #include <reactphysics3d/collision/shapes/BoxShape.h>
 #include <reactphysics3d/collision/shapes/SphereShape.h>
 #include <reactphysics3d/collision/shapes/CapsuleShape.h>
+#include <reactphysics3d/collision/shapes/CylinderShape.h>
+#include <reactphysics3d/collision/shapes/ConeShape.h>
 #include <reactphysics3d/collision/Collider.h>
 #include <reactphysics3d/engine/PhysicsWorld.h>
 #include <reactphysics3d/containers/Pair.h>
@@ -346,6 +348,44 @@ void DebugRenderer::drawHeightFieldShape(const Transform& transform, const Heigh
    }
 }
 
+// Draw a truncated cone along the local y axis (used for the cylinders and the cones)
+void DebugRenderer::drawTruncatedCone(const Transform& transform, decimal bottomRadius, decimal topRadius, decimal bottomY,
+                                      decimal topY, uint32 color) {
+
+    const decimal sectorStep = 2 * PI_RP3D / NB_SECTORS_SPHERE;
+
+    const Vector3 bottomCenter = transform * Vector3(0, bottomY, 0);
+    const Vector3 topCenter = transform * Vector3(0, topY, 0);
+
+    for (uint32 j = 0; j < NB_SECTORS_SPHERE; j++) {
+
+        const decimal sectorAngle1 = j * sectorStep;
+        const decimal sectorAngle2 = (j + 1) * sectorStep;
+        const decimal sin1 = std::sin(sectorAngle1);
+        const decimal cos1 = std::cos(sectorAngle1);
+        const decimal sin2 = std::sin(sectorAngle2);
+        const decimal cos2 = std::cos(sectorAngle2);
+
+        const Vector3 bottom1 = transform * Vector3(bottomRadius * sin1, bottomY, bottomRadius * cos1);
+        const Vector3 bottom2 = transform * Vector3(bottomRadius * sin2, bottomY, bottomRadius * cos2);
+        const Vector3 top1 = transform * Vector3(topRadius * sin1, topY, topRadius * cos1);
+        const Vector3 top2 = transform * Vector3(topRadius * sin2, topY, topRadius * cos2);
+
+        // Bottom disc
+        mTriangles.add(DebugTriangle(bottomCenter, bottom2, bottom1, color));
+
+        // Side
+        mTriangles.add(DebugTriangle(bottom1, bottom2, top1, color));
+        if (topRadius > decimal(0.0)) {
+
+            mTriangles.add(DebugTriangle(top1, bottom2, top2, color));
+
+            // Top disc
+            mTriangles.add(DebugTriangle(topCenter, top1, top2, color));
+        }
+    }
+}
+
 // Draw the collision shape of a collider
 void DebugRenderer::drawCollisionShapeOfCollider(const Collider* collider, uint32 color) {
 	
@@ -369,6 +409,22 @@ void DebugRenderer::drawCollisionShapeOfCollider(const Collider* collider, uint3
             drawCapsule(collider->getLocalToWorldTransform(), capsuleShape->getRadius(), capsuleShape->getHeight(), color);
             break;
         }
+        case CollisionShapeName::CYLINDER:
+        {
+            const CylinderShape* cylinderShape = static_cast<const CylinderShape*>(collider->getCollisionShape());
+            const decimal halfHeight = decimal(0.5) * cylinderShape->getHeight();
+            drawTruncatedCone(collider->getLocalToWorldTransform(), cylinderShape->getRadius(), cylinderShape->getRadius(),
+                              -halfHeight, halfHeight, color);
+            break;
+        }
+        case CollisionShapeName::CONE:
+        {
+            // The origin of the cone is its centroid (at a quarter of the height above the base)
+            const ConeShape* coneShape = static_cast<const ConeShape*>(collider->getCollisionShape());
+            drawTruncatedCone(collider->getLocalToWorldTransform(), coneShape->getRadius(), decimal(0.0),
+                              decimal(-0.25) * coneShape->getHeight(), decimal(0.75) * coneShape->getHeight(), color);
+            break;
+        }
         case CollisionShapeName::CONVEX_MESH:
         {
             const ConvexMeshShape*  convexMeshShape = static_cast<const ConvexMeshShape*>(collider->getCollisionShape());
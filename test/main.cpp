@@ -39,12 +39,15 @@
 #include "tests/collision/TestDynamicAABBTree.h"
 #include "tests/collision/TestHalfEdgeStructure.h"
 #include "tests/collision/TestTriangleVertexArray.h"
+#include "tests/collision/TestQuickHull.h"
+#include "tests/collision/TestTriangleMesh.h"
 #include "tests/containers/TestArray.h"
 #include "tests/containers/TestMap.h"
 #include "tests/containers/TestSet.h"
 #include "tests/containers/TestDeque.h"
 #include "tests/containers/TestStack.h"
 #include "tests/engine/TestRigidBody.h"
+#include "tests/engine/TestPhysicsWorld.h"
 
 using namespace reactphysics3d;
 
@@ -79,11 +82,14 @@ int main() {
     testSuite.addTest(new TestCollisionWorld("CollisionWorld"));
     testSuite.addTest(new TestDynamicAABBTree("DynamicAABBTree"));
     testSuite.addTest(new TestHalfEdgeStructure("HalfEdgeStructure"));
+    testSuite.addTest(new TestQuickHull("QuickHull"));
+    testSuite.addTest(new TestTriangleMesh("TriangleMesh"));
 
 
     // ---------- Engine tests ---------- //
 
     testSuite.addTest(new TestRigidBody("RigidBody"));
+    testSuite.addTest(new TestPhysicsWorld("PhysicsWorld"));
 
     // Run the tests
     testSuite.run();
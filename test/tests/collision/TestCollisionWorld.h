@@ -143,6 +143,9 @@ class WorldCollisionCallback : public CollisionCallback
 
 		std::map<std::pair<const Collider*, const Collider*>, CollisionData> mCollisionDatas;
 
+        /// True if the flat contacts arrays match the contact pairs reported by the callback
+        bool mAreFlatContactsConsistent;
+
 		std::pair<const Collider*, const Collider*> getCollisionKeyPair(std::pair<const Collider*, const Collider*> pair) const {
 			
 			if (pair.first > pair.second) {
@@ -162,6 +165,11 @@ class WorldCollisionCallback : public CollisionCallback
         void reset()
         {
 			mCollisionDatas.clear();
+            mAreFlatContactsConsistent = true;
+        }
+
+        bool areFlatContactsConsistent() const {
+            return mAreFlatContactsConsistent;
         }
 
 		bool hasContacts() const {
@@ -187,12 +195,35 @@ class WorldCollisionCallback : public CollisionCallback
 
             CollisionData collisionData;
 
+            const Array<FlatContactPair>& flatContactPairs = callbackData.getFlatContactPairs();
+            const Array<FlatContactPoint>& flatContactPoints = callbackData.getFlatContactPoints();
+            mAreFlatContactsConsistent &= flatContactPairs.size() == callbackData.getNbContactPairs();
+
             // For each contact pair
             for (uint32 p=0; p < callbackData.getNbContactPairs(); p++) {
 
                 ContactPairData contactPairData;
                 ContactPair contactPair = callbackData.getContactPair(p);
 
+                // Check that the flat view of the contact pair matches the contact pair
+                if (p < flatContactPairs.size()) {
+
+                    const FlatContactPair& flatContactPair = flatContactPairs[p];
+                    mAreFlatContactsConsistent &= flatContactPair.body1Entity == contactPair.getBody1()->getEntity();
+                    mAreFlatContactsConsistent &= flatContactPair.collider2Entity == contactPair.getCollider2()->getEntity();
+                    mAreFlatContactsConsistent &= flatContactPair.eventType == contactPair.getEventType();
+                    mAreFlatContactsConsistent &= flatContactPair.nbContactPoints == contactPair.getNbContactPoints();
+
+                    for (uint32 c=0; c < flatContactPair.nbContactPoints && c < contactPair.getNbContactPoints(); c++) {
+
+                        ContactPoint contactPoint = contactPair.getContactPoint(c);
+                        const FlatContactPoint& flatContactPoint = flatContactPoints[flatContactPair.contactPointsIndex + c];
+                        const Vector3 worldPoint1 = contactPair.getCollider1()->getLocalToWorldTransform() * contactPoint.getLocalPointOnCollider1();
+                        mAreFlatContactsConsistent &= approxEqual(flatContactPoint.worldPointOnCollider1, worldPoint1, decimal(0.0001));
+                        mAreFlatContactsConsistent &= approxEqual(flatContactPoint.penetrationDepth, contactPoint.getPenetrationDepth());
+                    }
+                }
+
                 collisionData.bodies = std::make_pair(contactPair.getBody1(), contactPair.getBody2());
                 collisionData.colliders = std::make_pair(contactPair.getCollider1(), contactPair.getCollider2());
 
@@ -514,6 +545,9 @@ class TestCollisionWorld : public Test {
             testConvexMeshVsConvexMeshCollision();
             testConvexMeshVsCapsuleCollision();
             testConvexMeshVsConcaveMeshCollision();
+
+            testLargeConvexMeshCollision();
+            testCylinderAndConeCollision();
         }
 
 		void testNoCollisions() {
@@ -631,6 +665,7 @@ class TestCollisionWorld : public Test {
             mWorld->testCollision(mCollisionCallback);
 
             rp3d_test(mCollisionCallback.areCollidersColliding(mSphereCollider1, mSphereCollider2));
+            rp3d_test(mCollisionCallback.areFlatContactsConsistent());
 
 			// Get collision data
             const CollisionData* collisionData = mCollisionCallback.getCollisionData(mSphereCollider1, mSphereCollider2);
@@ -2026,6 +2061,39 @@ class TestCollisionWorld : public Test {
                                                          swappedBodiesCollisionData ? localBody1Point4 : localBody2Point4,
                                                          penetrationDepth4));
 
+            // ----- Test global collision test with the GJK and EPA algorithms ----- //
+
+            mWorld->setConvexPolyhedronEPAMinNbEdgePairs(1);
+            rp3d_test(mWorld->getConvexPolyhedronEPAMinNbEdgePairs() == 1);
+
+            mCollisionCallback.reset();
+            mWorld->testCollision(mCollisionCallback);
+
+            rp3d_test(mCollisionCallback.areCollidersColliding(mBoxCollider1, mConvexMeshCollider2));
+
+            // The contact points are computed by clipping the faces along the EPA normal
+            collisionData = mCollisionCallback.getCollisionData(mBoxCollider1, mConvexMeshCollider2);
+            rp3d_test(collisionData != nullptr);
+            rp3d_test(collisionData->getNbContactPairs() == 1);
+            rp3d_test(collisionData->getTotalNbContactPoints() == 4);
+
+            swappedBodiesCollisionData = collisionData->getBody1()->getEntity() != mBoxBody1->getEntity();
+
+            rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? localBody2Point1 : localBody1Point1,
+                                                         swappedBodiesCollisionData ? localBody1Point1 : localBody2Point1,
+                                                         penetrationDepth1));
+            rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? localBody2Point2 : localBody1Point2,
+                                                         swappedBodiesCollisionData ? localBody1Point2 : localBody2Point2,
+                                                         penetrationDepth2));
+            rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? localBody2Point3 : localBody1Point3,
+                                                         swappedBodiesCollisionData ? localBody1Point3 : localBody2Point3,
+                                                         penetrationDepth3));
+            rp3d_test(collisionData->hasContactPointSimilarTo(swappedBodiesCollisionData ? localBody2Point4 : localBody1Point4,
+                                                         swappedBodiesCollisionData ? localBody1Point4 : localBody2Point4,
+                                                         penetrationDepth4));
+
+            mWorld->setConvexPolyhedronEPAMinNbEdgePairs(0);
+
             // reset the init transforms
             mBoxBody1->setTransform(initTransform1);
             mConvexMeshBody2->setTransform(initTransform2);
@@ -2954,6 +3022,333 @@ class TestCollisionWorld : public Test {
             mCapsuleBody1->setTransform(initTransform1);
             mConcaveMeshBody->setTransform(initTransform2);
         }
+
+        void testLargeConvexMeshCollision() {
+
+            // Create a convex mesh with enough vertices to compute its support points with hill-climbing
+            // (sphere of radius 2 made of stacks and slices)
+            const uint32 nbStacks = 14;
+            const uint32 nbSlices = 20;
+            const decimal radius = decimal(2.0);
+            const uint32 nbVertices = 2 + (nbStacks - 1) * nbSlices;
+            const uint32 nbFaces = nbStacks * nbSlices;
+            rp3d_test(nbVertices >= CONVEX_MESH_HILL_CLIMBING_MIN_NB_VERTICES);
+
+            std::vector<float> vertices;
+            vertices.push_back(0); vertices.push_back(float(radius)); vertices.push_back(0);
+            for (uint32 k=1; k < nbStacks; k++) {
+                const decimal theta = PI_RP3D * decimal(k) / decimal(nbStacks);
+                for (uint32 j=0; j < nbSlices; j++) {
+                    const decimal phi = PI_TIMES_2 * decimal(j) / decimal(nbSlices);
+                    vertices.push_back(float(radius * std::sin(theta) * std::cos(phi)));
+                    vertices.push_back(float(radius * std::cos(theta)));
+                    vertices.push_back(float(radius * std::sin(theta) * std::sin(phi)));
+                }
+            }
+            vertices.push_back(0); vertices.push_back(float(-radius)); vertices.push_back(0);
+
+            // Index of the vertex of a given stack ring and slice
+            auto ringVertex = [&](uint32 k, uint32 j) { return int(1 + (k - 1) * nbSlices + (j % nbSlices)); };
+
+            std::vector<int> indices;
+            std::vector<PolygonVertexArray::PolygonFace> faces;
+            for (uint32 j=0; j < nbSlices; j++) {
+                faces.push_back({3, uint32(indices.size())});
+                indices.push_back(0); indices.push_back(ringVertex(1, j + 1)); indices.push_back(ringVertex(1, j));
+            }
+            for (uint32 k=1; k < nbStacks - 1; k++) {
+                for (uint32 j=0; j < nbSlices; j++) {
+                    faces.push_back({4, uint32(indices.size())});
+                    indices.push_back(ringVertex(k, j)); indices.push_back(ringVertex(k, j + 1));
+                    indices.push_back(ringVertex(k + 1, j + 1)); indices.push_back(ringVertex(k + 1, j));
+                }
+            }
+            for (uint32 j=0; j < nbSlices; j++) {
+                faces.push_back({3, uint32(indices.size())});
+                indices.push_back(ringVertex(nbStacks - 1, j)); indices.push_back(ringVertex(nbStacks - 1, j + 1));
+                indices.push_back(int(nbVertices - 1));
+            }
+            rp3d_test(faces.size() == nbFaces);
+
+            PolygonVertexArray polygonVertexArray(nbVertices, vertices.data(), 3 * sizeof(float), indices.data(), sizeof(int),
+                                                  nbFaces, faces.data(), PolygonVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                                  PolygonVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            PolyhedronMesh* polyhedronMesh = mPhysicsCommon.createPolyhedronMesh(&polygonVertexArray);
+            rp3d_test(polyhedronMesh != nullptr);
+            ConvexMeshShape* convexMeshShape = mPhysicsCommon.createConvexMeshShape(polyhedronMesh);
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(0.5));
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.3), decimal(0.3), decimal(0.3)));
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+            CollisionBody* convexMeshBody = world->createCollisionBody(Transform::identity());
+            convexMeshBody->addCollider(convexMeshShape, Transform::identity());
+            CollisionBody* sphereBody = world->createCollisionBody(Transform(Vector3(10, 0, 0), Quaternion::identity()));
+            sphereBody->addCollider(sphereShape, Transform::identity());
+            CollisionBody* boxBody = world->createCollisionBody(Transform(Vector3(-10, 0, 0), Quaternion::identity()));
+            boxBody->addCollider(boxShape, Transform::identity());
+
+            // The faces of the mesh are between the inner radius and the radius of the sphere
+            const decimal innerRadius = radius * std::cos(PI_RP3D / decimal(nbStacks));
+
+            // Move the shapes around the mesh (the GJK and SAT algorithms use the support points of the mesh)
+            bool areSphereTestsCorrect = true;
+            bool areBoxTestsCorrect = true;
+            for (uint32 a=0; a < 10; a++) {
+                for (uint32 b=0; b < 12; b++) {
+
+                    const decimal theta = decimal(0.15) + decimal(a) * decimal(0.3);
+                    const decimal phi = decimal(0.1) + decimal(b) * decimal(0.5);
+                    const Vector3 direction(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+
+                    sphereBody->setTransform(Transform(direction * (radius + decimal(0.55)), Quaternion::identity()));
+                    areSphereTestsCorrect &= !world->testOverlap(convexMeshBody, sphereBody);
+                    sphereBody->setTransform(Transform(direction * (innerRadius + decimal(0.4)), Quaternion::identity()));
+                    areSphereTestsCorrect &= world->testOverlap(convexMeshBody, sphereBody);
+
+                    boxBody->setTransform(Transform(direction * (radius + decimal(0.6)), Quaternion::identity()));
+                    areBoxTestsCorrect &= !world->testOverlap(convexMeshBody, boxBody);
+                    boxBody->setTransform(Transform(direction * (innerRadius + decimal(0.2)), Quaternion::identity()));
+                    areBoxTestsCorrect &= world->testOverlap(convexMeshBody, boxBody);
+                }
+            }
+            rp3d_test(areSphereTestsCorrect);
+            rp3d_test(areBoxTestsCorrect);
+
+            // A scaled mesh must use the support points of the scaled vertices
+            convexMeshShape->setScale(Vector3(1, 2, 1));
+            world->update(decimal(1.0) / decimal(60.0));
+            const Vector3 ellipsoidPoint(radius * std::cos(PI_RP3D / decimal(4.0)), decimal(2.0) * radius * std::sin(PI_RP3D / decimal(4.0)), 0);
+            const Vector3 ellipsoidNormal = Vector3(decimal(2.0), decimal(1.0), 0).getUnit();
+            sphereBody->setTransform(Transform(ellipsoidPoint + ellipsoidNormal * decimal(0.6), Quaternion::identity()));
+            rp3d_test(!world->testOverlap(convexMeshBody, sphereBody));
+            sphereBody->setTransform(Transform(ellipsoidPoint + ellipsoidNormal * decimal(0.3), Quaternion::identity()));
+            rp3d_test(world->testOverlap(convexMeshBody, sphereBody));
+            sphereBody->setTransform(Transform(Vector3(10, 0, 0), Quaternion::identity()));
+
+            // Two large convex meshes (the SAT algorithm caches the separating axis and the indices of the
+            // edges of the previous frame). The shapes are first separated in a frame and then tested again
+            // in a position where they overlap (the cached separating axis must not be a separating axis anymore).
+            convexMeshShape->setScale(Vector3(1, 1, 1));
+            ConvexMeshShape* convexMeshShape2 = mPhysicsCommon.createConvexMeshShape(polyhedronMesh);
+            CollisionBody* convexMeshBody2 = world->createCollisionBody(Transform::identity());
+            convexMeshBody2->addCollider(convexMeshShape2, Transform::identity());
+            const Quaternion orientation = Quaternion::fromEulerAngles(decimal(0.3), decimal(0.7), decimal(0.2));
+            bool areConvexMeshTestsCorrect = true;
+            for (uint32 a=0; a < 6; a++) {
+
+                const decimal theta = decimal(0.2) + decimal(a) * decimal(0.5);
+                const Vector3 direction(std::sin(theta), std::cos(theta), 0);
+
+                convexMeshBody2->setTransform(Transform(direction * (decimal(2.0) * radius + decimal(0.2)), orientation));
+                world->update(decimal(1.0) / decimal(60.0));
+                areConvexMeshTestsCorrect &= !world->testOverlap(convexMeshBody, convexMeshBody2);
+
+                convexMeshBody2->setTransform(Transform(direction * (decimal(2.0) * innerRadius - decimal(0.2)), orientation));
+                areConvexMeshTestsCorrect &= world->testOverlap(convexMeshBody, convexMeshBody2);
+                world->update(decimal(1.0) / decimal(60.0));
+                areConvexMeshTestsCorrect &= world->testOverlap(convexMeshBody, convexMeshBody2);
+
+                convexMeshBody2->setTransform(Transform(direction * (decimal(2.0) * radius + decimal(0.2)), orientation));
+                areConvexMeshTestsCorrect &= !world->testOverlap(convexMeshBody, convexMeshBody2);
+            }
+            rp3d_test(areConvexMeshTestsCorrect);
+
+            // Same tests with the GJK and EPA algorithms instead of the SAT algorithm. The penetration depth
+            // computed by EPA must be close to the overlap of the two spheres approximated by the meshes
+            world->setConvexPolyhedronEPAMinNbEdgePairs(1);
+            WorldCollisionCallback collisionCallback;
+            bool areEPATestsCorrect = true;
+            for (uint32 a=0; a < 6; a++) {
+
+                const decimal theta = decimal(0.2) + decimal(a) * decimal(0.5);
+                const Vector3 direction(std::sin(theta), std::cos(theta), 0);
+
+                convexMeshBody2->setTransform(Transform(direction * (decimal(2.0) * radius + decimal(0.2)), orientation));
+                areEPATestsCorrect &= !world->testOverlap(convexMeshBody, convexMeshBody2);
+
+                const decimal distance = decimal(2.0) * innerRadius - decimal(0.2);
+                convexMeshBody2->setTransform(Transform(direction * distance, orientation));
+                areEPATestsCorrect &= world->testOverlap(convexMeshBody, convexMeshBody2);
+
+                collisionCallback.reset();
+                world->testCollision(convexMeshBody, convexMeshBody2, collisionCallback);
+                const CollisionData* collisionData = collisionCallback.getCollisionData(convexMeshBody->getCollider(0),
+                                                                                       convexMeshBody2->getCollider(0));
+                areEPATestsCorrect &= collisionData != nullptr && collisionData->getTotalNbContactPoints() > 0;
+                if (collisionData != nullptr) {
+                    for (auto it = collisionData->contactPairs.begin(); it != collisionData->contactPairs.end(); ++it) {
+                        for (auto itPoint = it->contactPoints.begin(); itPoint != it->contactPoints.end(); ++itPoint) {
+                            areEPATestsCorrect &= itPoint->penetrationDepth > decimal(2.0) * innerRadius - distance &&
+                                                  itPoint->penetrationDepth < decimal(2.0) * radius - distance;
+                        }
+                    }
+                }
+            }
+            rp3d_test(areEPATestsCorrect);
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+            mPhysicsCommon.destroyConvexMeshShape(convexMeshShape2);
+            mPhysicsCommon.destroyConvexMeshShape(convexMeshShape);
+            mPhysicsCommon.destroySphereShape(sphereShape);
+            mPhysicsCommon.destroyBoxShape(boxShape);
+            mPhysicsCommon.destroyPolyhedronMesh(polyhedronMesh);
+        }
+
+        void testCylinderAndConeCollision() {
+
+            CylinderShape* cylinderShape = mPhysicsCommon.createCylinderShape(1, 2);
+            ConeShape* coneShape = mPhysicsCommon.createConeShape(1, 2);
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(3, decimal(0.5), 3));
+            SphereShape* sphereShape = mPhysicsCommon.createSphereShape(decimal(0.5));
+
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld();
+            CollisionBody* boxBody = world->createCollisionBody(Transform::identity());
+            Collider* boxCollider = boxBody->addCollider(boxShape, Transform::identity());
+            CollisionBody* cylinderBody = world->createCollisionBody(Transform(Vector3(20, 0, 0), Quaternion::identity()));
+            Collider* cylinderCollider = cylinderBody->addCollider(cylinderShape, Transform::identity());
+            CollisionBody* cylinderBody2 = world->createCollisionBody(Transform(Vector3(-20, 0, 0), Quaternion::identity()));
+            Collider* cylinderCollider2 = cylinderBody2->addCollider(cylinderShape, Transform::identity());
+            CollisionBody* coneBody = world->createCollisionBody(Transform(Vector3(0, 20, 0), Quaternion::identity()));
+            Collider* coneCollider = coneBody->addCollider(coneShape, Transform::identity());
+            CollisionBody* sphereBody = world->createCollisionBody(Transform(Vector3(0, -20, 0), Quaternion::identity()));
+            Collider* sphereCollider = sphereBody->addCollider(sphereShape, Transform::identity());
+
+            WorldCollisionCallback collisionCallback;
+
+            // Return true if all the contact points between two colliders have a given penetration depth
+            auto haveContactPointsDepth = [&](const Collider* collider1, const Collider* collider2, decimal depth, decimal epsilon) {
+                const CollisionData* collisionData = collisionCallback.getCollisionData(collider1, collider2);
+                if (collisionData == nullptr) return false;
+                bool isDepthCorrect = true;
+                for (auto it = collisionData->contactPairs.begin(); it != collisionData->contactPairs.end(); ++it) {
+                    for (auto itPoint = it->contactPoints.begin(); itPoint != it->contactPoints.end(); ++itPoint) {
+                        isDepthCorrect &= approxEqual(itPoint->penetrationDepth, depth, epsilon);
+                    }
+                }
+                return isDepthCorrect;
+            };
+
+            // ----- Cylinder standing on a box (four contact points on the rim of the bottom disc) ----- //
+
+            cylinderBody->setTransform(Transform(Vector3(0, decimal(1.6), 0), Quaternion::identity()));
+            rp3d_test(!world->testOverlap(boxBody, cylinderBody));
+
+            cylinderBody->setTransform(Transform(Vector3(0, decimal(1.4), 0), Quaternion::identity()));
+            rp3d_test(world->testOverlap(boxBody, cylinderBody));
+
+            collisionCallback.reset();
+            world->testCollision(boxBody, cylinderBody, collisionCallback);
+            rp3d_test(collisionCallback.areCollidersColliding(boxCollider, cylinderCollider));
+            rp3d_test(collisionCallback.getCollisionData(boxCollider, cylinderCollider)->getTotalNbContactPoints() == 4);
+            rp3d_test(haveContactPointsDepth(boxCollider, cylinderCollider, decimal(0.1), decimal(0.001)));
+
+            // ----- Tilted cylinder touching a box with the rim of its disc (single contact point) ----- //
+
+            const Quaternion tilt = Quaternion::fromEulerAngles(0, 0, PI_RP3D / decimal(4.0));
+            const decimal rimHeight = std::cos(PI_RP3D / decimal(4.0)) * decimal(2.0);
+            cylinderBody->setTransform(Transform(Vector3(0, decimal(0.5) + rimHeight - decimal(0.05), 0), tilt));
+            collisionCallback.reset();
+            world->testCollision(boxBody, cylinderBody, collisionCallback);
+            rp3d_test(collisionCallback.areCollidersColliding(boxCollider, cylinderCollider));
+            rp3d_test(collisionCallback.getCollisionData(boxCollider, cylinderCollider)->getTotalNbContactPoints() == 1);
+            rp3d_test(haveContactPointsDepth(boxCollider, cylinderCollider, decimal(0.05), decimal(0.001)));
+
+            cylinderBody->setTransform(Transform(Vector3(20, 0, 0), Quaternion::identity()));
+
+            // ----- Cylinder standing on another cylinder (disc against disc) ----- //
+
+            cylinderBody->setTransform(Transform(Vector3(0, 10, 0), Quaternion::identity()));
+            cylinderBody2->setTransform(Transform(Vector3(0, decimal(11.9), 0), Quaternion::identity()));
+            rp3d_test(world->testOverlap(cylinderBody, cylinderBody2));
+            collisionCallback.reset();
+            world->testCollision(cylinderBody, cylinderBody2, collisionCallback);
+            rp3d_test(collisionCallback.areCollidersColliding(cylinderCollider, cylinderCollider2));
+            rp3d_test(collisionCallback.getCollisionData(cylinderCollider, cylinderCollider2)->getTotalNbContactPoints() >= 3);
+            rp3d_test(haveContactPointsDepth(cylinderCollider, cylinderCollider2, decimal(0.1), decimal(0.001)));
+
+            cylinderBody->setTransform(Transform(Vector3(20, 0, 0), Quaternion::identity()));
+            cylinderBody2->setTransform(Transform(Vector3(-20, 0, 0), Quaternion::identity()));
+
+            // ----- Cone standing on its base on a box ----- //
+
+            // The base of the cone is a quarter of its height below its origin
+            coneBody->setTransform(Transform(Vector3(0, decimal(0.5) + decimal(0.5) + decimal(0.1), 0), Quaternion::identity()));
+            rp3d_test(!world->testOverlap(boxBody, coneBody));
+
+            coneBody->setTransform(Transform(Vector3(0, decimal(0.5) + decimal(0.5) - decimal(0.1), 0), Quaternion::identity()));
+            collisionCallback.reset();
+            world->testCollision(boxBody, coneBody, collisionCallback);
+            rp3d_test(collisionCallback.areCollidersColliding(boxCollider, coneCollider));
+            rp3d_test(collisionCallback.getCollisionData(boxCollider, coneCollider)->getTotalNbContactPoints() == 4);
+            rp3d_test(haveContactPointsDepth(boxCollider, coneCollider, decimal(0.1), decimal(0.001)));
+
+            // ----- Cone standing on its apex on a box (single contact point) ----- //
+
+            const Quaternion upsideDown = Quaternion::fromEulerAngles(PI_RP3D, 0, 0);
+            coneBody->setTransform(Transform(Vector3(0, decimal(0.5) + decimal(1.5) - decimal(0.05), 0), upsideDown));
+            collisionCallback.reset();
+            world->testCollision(boxBody, coneBody, collisionCallback);
+            rp3d_test(collisionCallback.areCollidersColliding(boxCollider, coneCollider));
+            rp3d_test(collisionCallback.getCollisionData(boxCollider, coneCollider)->getTotalNbContactPoints() == 1);
+            rp3d_test(haveContactPointsDepth(boxCollider, coneCollider, decimal(0.05), decimal(0.001)));
+
+            coneBody->setTransform(Transform(Vector3(0, 20, 0), Quaternion::identity()));
+
+            // ----- Sphere against the side of a cylinder ----- //
+
+            cylinderBody->setTransform(Transform(Vector3(0, -10, 0), Quaternion::identity()));
+
+            sphereBody->setTransform(Transform(Vector3(decimal(1.6), -10, 0), Quaternion::identity()));
+            rp3d_test(!world->testOverlap(cylinderBody, sphereBody));
+
+            // Shallow penetration (within the margin of the sphere)
+            sphereBody->setTransform(Transform(Vector3(decimal(1.4), -10, 0), Quaternion::identity()));
+            collisionCallback.reset();
+            world->testCollision(cylinderBody, sphereBody, collisionCallback);
+            rp3d_test(collisionCallback.areCollidersColliding(cylinderCollider, sphereCollider));
+            rp3d_test(collisionCallback.getCollisionData(cylinderCollider, sphereCollider)->getTotalNbContactPoints() == 1);
+            rp3d_test(haveContactPointsDepth(cylinderCollider, sphereCollider, decimal(0.1), decimal(0.001)));
+
+            // Deep penetration (the center of the sphere is inside the cylinder)
+            sphereBody->setTransform(Transform(Vector3(decimal(0.8), -10, 0), Quaternion::identity()));
+            collisionCallback.reset();
+            world->testCollision(cylinderBody, sphereBody, collisionCallback);
+            rp3d_test(collisionCallback.areCollidersColliding(cylinderCollider, sphereCollider));
+            rp3d_test(collisionCallback.getCollisionData(cylinderCollider, sphereCollider)->getTotalNbContactPoints() == 1);
+            rp3d_test(haveContactPointsDepth(cylinderCollider, sphereCollider, decimal(0.7), decimal(0.01)));
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+
+            // ----- A rigid cylinder and a rigid cone must rest on their disc ----- //
+
+            PhysicsWorld* dynamicWorld = mPhysicsCommon.createPhysicsWorld();
+            RigidBody* groundBody = dynamicWorld->createRigidBody(Transform::identity());
+            groundBody->setType(BodyType::STATIC);
+            groundBody->addCollider(boxShape, Transform::identity());
+            RigidBody* rigidCylinder = dynamicWorld->createRigidBody(Transform(Vector3(-1, decimal(1.6), 0), Quaternion::identity()));
+            rigidCylinder->addCollider(cylinderShape, Transform::identity());
+            rigidCylinder->updateMassPropertiesFromColliders();
+            RigidBody* rigidCone = dynamicWorld->createRigidBody(Transform(Vector3(decimal(1.5), decimal(1.1), 0), Quaternion::identity()));
+            rigidCone->addCollider(coneShape, Transform::identity());
+            rigidCone->updateMassPropertiesFromColliders();
+
+            for (uint32 i=0; i < 180; i++) {
+                dynamicWorld->update(decimal(1.0) / decimal(60.0));
+            }
+
+            const Vector3 cylinderUp = rigidCylinder->getTransform().getOrientation() * Vector3(0, 1, 0);
+            const Vector3 coneUp = rigidCone->getTransform().getOrientation() * Vector3(0, 1, 0);
+            rp3d_test(approxEqual(rigidCylinder->getTransform().getPosition().y, decimal(1.5), decimal(0.02)));
+            rp3d_test(approxEqual(rigidCone->getTransform().getPosition().y, decimal(1.0), decimal(0.02)));
+            rp3d_test(cylinderUp.y > decimal(0.999));
+            rp3d_test(coneUp.y > decimal(0.999));
+
+            mPhysicsCommon.destroyPhysicsWorld(dynamicWorld);
+            mPhysicsCommon.destroyCylinderShape(cylinderShape);
+            mPhysicsCommon.destroyConeShape(coneShape);
+            mPhysicsCommon.destroyBoxShape(boxShape);
+            mPhysicsCommon.destroySphereShape(sphereShape);
+        }
  };
 
 }
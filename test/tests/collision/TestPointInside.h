@@ -31,6 +31,8 @@
 #include <reactphysics3d/collision/shapes/BoxShape.h>
 #include <reactphysics3d/collision/shapes/SphereShape.h>
 #include <reactphysics3d/collision/shapes/CapsuleShape.h>
+#include <reactphysics3d/collision/shapes/CylinderShape.h>
+#include <reactphysics3d/collision/shapes/ConeShape.h>
 #include <reactphysics3d/collision/shapes/ConvexMeshShape.h>
 #include <reactphysics3d/engine/PhysicsWorld.h>
 #include <reactphysics3d/engine/PhysicsCommon.h>
@@ -75,6 +77,8 @@ class TestPointInside : public Test {
         BoxShape* mBoxShape;
         SphereShape* mSphereShape;
         CapsuleShape* mCapsuleShape;
+        CylinderShape* mCylinderShape;
+        ConeShape* mConeShape;
         ConvexMeshShape* mConvexMeshShape;
 
         // Transform
@@ -87,6 +91,8 @@ class TestPointInside : public Test {
         Collider* mBoxCollider;
         Collider* mSphereCollider;
         Collider* mCapsuleCollider;
+        Collider* mCylinderCollider;
+        Collider* mConeCollider;
         Collider* mConvexMeshCollider;
 
     public :
@@ -133,6 +139,12 @@ class TestPointInside : public Test {
             mCapsuleShape = mPhysicsCommon.createCapsuleShape(3, 10);
             mCapsuleCollider = mCapsuleBody->addCollider(mCapsuleShape, mShapeTransform);
 
+            mCylinderShape = mPhysicsCommon.createCylinderShape(3, 8);
+            mCylinderCollider = mCylinderBody->addCollider(mCylinderShape, mShapeTransform);
+
+            mConeShape = mPhysicsCommon.createConeShape(3, 8);
+            mConeCollider = mConeBody->addCollider(mConeShape, mShapeTransform);
+
             mConvexMeshCubeVertices[0] = -2; mConvexMeshCubeVertices[1] = -3; mConvexMeshCubeVertices[2] = 4;
             mConvexMeshCubeVertices[3] = 2; mConvexMeshCubeVertices[4] = -3; mConvexMeshCubeVertices[5] = 4;
             mConvexMeshCubeVertices[6] = 2; mConvexMeshCubeVertices[7] = -3; mConvexMeshCubeVertices[8] = -4;
@@ -180,6 +192,8 @@ class TestPointInside : public Test {
             mPhysicsCommon.destroyBoxShape(mBoxShape);
             mPhysicsCommon.destroySphereShape(mSphereShape);
             mPhysicsCommon.destroyCapsuleShape(mCapsuleShape);
+            mPhysicsCommon.destroyCylinderShape(mCylinderShape);
+            mPhysicsCommon.destroyConeShape(mConeShape);
             mPhysicsCommon.destroyConvexMeshShape(mConvexMeshShape);
             mPhysicsCommon.destroyPolyhedronMesh(mConvexMeshPolyhedronMesh);
             delete[] mConvexMeshPolygonFaces;
@@ -191,7 +205,10 @@ class TestPointInside : public Test {
             testBox();
             testSphere();
             testCapsule();
+            testCylinder();
+            testCone();
             testConvexMesh();
+            testConvexMeshBakedGeometry();
             testCompound();
         }
 
@@ -400,6 +417,65 @@ class TestPointInside : public Test {
             rp3d_test(!mCapsuleCollider->testPointInside(mLocalShapeToWorld * Vector3(2.5, -5, -2.7)));
         }
 
+        /// Test the Collider::testPointInside() and
+        /// CollisionBody::testPointInside() methods
+        void testCylinder() {
+
+            // Tests with CollisionBody
+            rp3d_test(mCylinderBody->testPointInside(mLocalShapeToWorld * Vector3(0, 0, 0)));
+            rp3d_test(mCylinderBody->testPointInside(mLocalShapeToWorld * Vector3(0, 3.9, 0)));
+            rp3d_test(mCylinderBody->testPointInside(mLocalShapeToWorld * Vector3(0, -3.9, 0)));
+            rp3d_test(mCylinderBody->testPointInside(mLocalShapeToWorld * Vector3(2.9, 0, 0)));
+            rp3d_test(mCylinderBody->testPointInside(mLocalShapeToWorld * Vector3(0, 0, -2.9)));
+            rp3d_test(mCylinderBody->testPointInside(mLocalShapeToWorld * Vector3(2, 3.9, 2)));
+            rp3d_test(mCylinderBody->testPointInside(mLocalShapeToWorld * Vector3(-2, -3.9, -2)));
+
+            rp3d_test(!mCylinderBody->testPointInside(mLocalShapeToWorld * Vector3(0, 4.1, 0)));
+            rp3d_test(!mCylinderBody->testPointInside(mLocalShapeToWorld * Vector3(0, -4.1, 0)));
+            rp3d_test(!mCylinderBody->testPointInside(mLocalShapeToWorld * Vector3(3.1, 0, 0)));
+            rp3d_test(!mCylinderBody->testPointInside(mLocalShapeToWorld * Vector3(0, 0, -3.1)));
+            rp3d_test(!mCylinderBody->testPointInside(mLocalShapeToWorld * Vector3(2.2, 3, 2.2)));
+            rp3d_test(!mCylinderBody->testPointInside(mLocalShapeToWorld * Vector3(-2.2, -3, 2.2)));
+
+            // Tests with Collider
+            rp3d_test(mCylinderCollider->testPointInside(mLocalShapeToWorld * Vector3(0, 0, 0)));
+            rp3d_test(mCylinderCollider->testPointInside(mLocalShapeToWorld * Vector3(2, 3.9, 2)));
+            rp3d_test(mCylinderCollider->testPointInside(mLocalShapeToWorld * Vector3(-2, -3.9, -2)));
+
+            rp3d_test(!mCylinderCollider->testPointInside(mLocalShapeToWorld * Vector3(0, 4.1, 0)));
+            rp3d_test(!mCylinderCollider->testPointInside(mLocalShapeToWorld * Vector3(2.2, 3, 2.2)));
+        }
+
+        /// Test the Collider::testPointInside() and
+        /// CollisionBody::testPointInside() methods
+        void testCone() {
+
+            // The origin of the cone is its centroid (base at y=-2 and apex at y=6)
+
+            // Tests with CollisionBody
+            rp3d_test(mConeBody->testPointInside(mLocalShapeToWorld * Vector3(0, 0, 0)));
+            rp3d_test(mConeBody->testPointInside(mLocalShapeToWorld * Vector3(0, 5.9, 0)));
+            rp3d_test(mConeBody->testPointInside(mLocalShapeToWorld * Vector3(0, -1.9, 0)));
+            rp3d_test(mConeBody->testPointInside(mLocalShapeToWorld * Vector3(2.9, -1.9, 0)));
+            rp3d_test(mConeBody->testPointInside(mLocalShapeToWorld * Vector3(0, -1.9, -2.9)));
+            rp3d_test(mConeBody->testPointInside(mLocalShapeToWorld * Vector3(1.4, 2, 0)));
+            rp3d_test(mConeBody->testPointInside(mLocalShapeToWorld * Vector3(0, 2, -1.4)));
+
+            rp3d_test(!mConeBody->testPointInside(mLocalShapeToWorld * Vector3(0, 6.1, 0)));
+            rp3d_test(!mConeBody->testPointInside(mLocalShapeToWorld * Vector3(0, -2.1, 0)));
+            rp3d_test(!mConeBody->testPointInside(mLocalShapeToWorld * Vector3(3.1, -1.9, 0)));
+            rp3d_test(!mConeBody->testPointInside(mLocalShapeToWorld * Vector3(1.6, 2, 0)));
+            rp3d_test(!mConeBody->testPointInside(mLocalShapeToWorld * Vector3(0, 2, -1.6)));
+            rp3d_test(!mConeBody->testPointInside(mLocalShapeToWorld * Vector3(0.5, 5.9, 0)));
+
+            // Tests with Collider
+            rp3d_test(mConeCollider->testPointInside(mLocalShapeToWorld * Vector3(0, 0, 0)));
+            rp3d_test(mConeCollider->testPointInside(mLocalShapeToWorld * Vector3(1.4, 2, 0)));
+
+            rp3d_test(!mConeCollider->testPointInside(mLocalShapeToWorld * Vector3(1.6, 2, 0)));
+            rp3d_test(!mConeCollider->testPointInside(mLocalShapeToWorld * Vector3(0, 6.1, 0)));
+        }
+
         /// Test the Collider::testPointInside() and
         /// CollisionBody::testPointInside() methods
         void testConvexMesh() {
@@ -457,6 +533,36 @@ class TestPointInside : public Test {
             rp3d_test(!mConvexMeshCollider->testPointInside(mLocalShapeToWorld * Vector3(1, -2, 4.5)));
         }
 
+        /// Test the vertices, face planes and edge directions baked in the polyhedron mesh
+        void testConvexMeshBakedGeometry() {
+
+            const decimal epsilon = decimal(0.0001);
+
+            rp3d_test(approxEqual(mConvexMeshPolyhedronMesh->getVertex(0), Vector3(-2, -3, 4), epsilon));
+            rp3d_test(approxEqual(mConvexMeshPolyhedronMesh->getVertex(6), Vector3(2, 3, -4), epsilon));
+
+            // The plane offset of each face is the distance from the origin to the face of the box
+            const decimal facesOffsets[6] = {3, 3, 4, 2, 4, 2};
+            for (uint32 f=0; f < mConvexMeshPolyhedronMesh->getNbFaces(); f++) {
+                rp3d_test(approxEqual(mConvexMeshPolyhedronMesh->getFacePlaneOffset(f), facesOffsets[f], epsilon));
+
+                const HalfEdgeStructure::Face& face = mConvexMeshShape->getFace(f);
+                const Vector3 faceVertex = mConvexMeshPolyhedronMesh->getVertex(face.faceVertices[0]);
+                rp3d_test(approxEqual(mConvexMeshPolyhedronMesh->getFaceNormal(f).dot(faceVertex), mConvexMeshPolyhedronMesh->getFacePlaneOffset(f), epsilon));
+            }
+
+            // The direction of each half-edge goes from its start vertex to the start vertex of its twin
+            for (uint32 e=0; e < mConvexMeshShape->getNbHalfEdges(); e++) {
+
+                const HalfEdgeStructure::Edge& edge = mConvexMeshShape->getHalfEdge(e);
+                const HalfEdgeStructure::Edge& twinEdge = mConvexMeshShape->getHalfEdge(edge.twinEdgeIndex);
+                const Vector3 direction = mConvexMeshShape->getVertexPosition(twinEdge.vertexIndex) - mConvexMeshShape->getVertexPosition(edge.vertexIndex);
+
+                rp3d_test(approxEqual(mConvexMeshShape->getEdgeDirection(e), direction, epsilon));
+                rp3d_test(approxEqual(mConvexMeshShape->getEdgeDirection(edge.twinEdgeIndex), -direction, epsilon));
+            }
+        }
+
         /// Test the CollisionBody::testPointInside() method
         void testCompound() {
 
@@ -0,0 +1,215 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_QUICK_HULL_H
+#define TEST_QUICK_HULL_H
+
+// Libraries
+#include <reactphysics3d/reactphysics3d.h>
+#include "Test.h"
+#include <cmath>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class TestQuickHull
+/**
+ * Unit test for the convex hull computation with the Quickhull algorithm.
+ */
+class TestQuickHull : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        /// Physics common
+        PhysicsCommon mPhysicsCommon;
+
+        /// Points on a unit sphere
+        Vector3 mSpherePoints[200];
+
+        // ---------- Methods ---------- //
+
+        /// Return true if all the points are inside the mesh
+        bool arePointsInsideMesh(const PolyhedronMesh* mesh, const Vector3* points, uint32 nbPoints) const {
+
+            for (uint32 i=0; i < nbPoints; i++) {
+                for (uint32 f=0; f < mesh->getNbFaces(); f++) {
+                    if (mesh->getFaceNormal(f).dot(points[i]) - mesh->getFacePlaneOffset(f) > decimal(0.0001)) {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestQuickHull(const std::string& name) : Test(name) {
+
+            // Generate pseudo-random points on a sphere
+            uint32 seed = 12345;
+            for (uint32 i=0; i < 200; i++) {
+                Vector3 point;
+                do {
+                    for (int j=0; j < 3; j++) {
+                        seed = seed * 1664525 + 1013904223;
+                        point[j] = decimal(seed >> 8) / decimal(1 << 24) * decimal(2.0) - decimal(1.0);
+                    }
+                } while (point.lengthSquare() < decimal(0.01));
+                mSpherePoints[i] = point.getUnit();
+            }
+        }
+
+        /// Run the tests
+        void run() {
+            testCubePoints();
+            testSpherePoints();
+            testMaxNbVertices();
+            testDegeneratePoints();
+        }
+
+        /// Test the convex hull of points on a grid inside a cube
+        void testCubePoints() {
+
+            // Points on a 5x5x5 grid (with coplanar and interior points)
+            Vector3 points[125];
+            uint32 nbPoints = 0;
+            for (int i=0; i < 5; i++) {
+                for (int j=0; j < 5; j++) {
+                    for (int k=0; k < 5; k++) {
+                        points[nbPoints++] = Vector3(decimal(i) * decimal(0.5) - 1, decimal(j) * decimal(0.5) - 1, decimal(k) * decimal(0.5) - 1);
+                    }
+                }
+            }
+
+            PolyhedronMesh* mesh = mPhysicsCommon.createConvexHull(points, nbPoints);
+            rp3d_test(mesh != nullptr);
+
+            // The coplanar triangles must have been merged into the six faces of the cube
+            rp3d_test(mesh->getNbVertices() == 8);
+            rp3d_test(mesh->getNbFaces() == 6);
+            for (uint32 f=0; f < mesh->getNbFaces(); f++) {
+                rp3d_test(mesh->getHalfEdgeStructure().getFace(f).faceVertices.size() == 4);
+                rp3d_test(approxEqual(mesh->getFacePlaneOffset(f), decimal(1.0), decimal(0.0001)));
+            }
+            for (uint32 v=0; v < mesh->getNbVertices(); v++) {
+                const Vector3 vertex = mesh->getVertex(v);
+                rp3d_test(approxEqual(std::abs(vertex.x), decimal(1.0)));
+                rp3d_test(approxEqual(std::abs(vertex.y), decimal(1.0)));
+                rp3d_test(approxEqual(std::abs(vertex.z), decimal(1.0)));
+            }
+            rp3d_test(arePointsInsideMesh(mesh, points, nbPoints));
+
+            // The hull can be used as a convex mesh collision shape
+            ConvexMeshShape* shape = mPhysicsCommon.createConvexMeshShape(mesh);
+            Vector3 min, max;
+            shape->getLocalBounds(min, max);
+            rp3d_test(approxEqual(min, Vector3(-1, -1, -1), decimal(0.0001)));
+            rp3d_test(approxEqual(max, Vector3(1, 1, 1), decimal(0.0001)));
+            rp3d_test(shape->getNbFaces() == 6);
+
+            mPhysicsCommon.destroyConvexMeshShape(shape);
+            mPhysicsCommon.destroyPolyhedronMesh(mesh);
+
+            // Rotated and translated grid
+            const Transform transform(Vector3(10, 5, 2), Quaternion::fromEulerAngles(decimal(0.3), decimal(0.7), decimal(1.1)));
+            for (uint32 i=0; i < nbPoints; i++) {
+                points[i] = transform * (points[i] * decimal(3.0));
+            }
+            mesh = mPhysicsCommon.createConvexHull(points, nbPoints);
+            rp3d_test(mesh != nullptr);
+            rp3d_test(mesh->getNbVertices() == 8);
+            rp3d_test(mesh->getNbFaces() == 6);
+            rp3d_test(arePointsInsideMesh(mesh, points, nbPoints));
+
+            mPhysicsCommon.destroyPolyhedronMesh(mesh);
+        }
+
+        /// Test the convex hull of points on a sphere
+        void testSpherePoints() {
+
+            PolyhedronMesh* mesh = mPhysicsCommon.createConvexHull(mSpherePoints, 200);
+            rp3d_test(mesh != nullptr);
+
+            // All the points are on the sphere and therefore they are all vertices of the hull
+            rp3d_test(mesh->getNbVertices() == 200);
+            rp3d_test(mesh->getNbFaces() >= 100);
+            rp3d_test(arePointsInsideMesh(mesh, mSpherePoints, 200));
+
+            // Check Euler formula
+            const HalfEdgeStructure& halfEdgeStructure = mesh->getHalfEdgeStructure();
+            rp3d_test(halfEdgeStructure.getNbVertices() + halfEdgeStructure.getNbFaces() - halfEdgeStructure.getNbHalfEdges() / 2 == 2);
+
+            mPhysicsCommon.destroyPolyhedronMesh(mesh);
+        }
+
+        /// Test the convex hull with a maximum number of vertices
+        void testMaxNbVertices() {
+
+            PolyhedronMesh* mesh = mPhysicsCommon.createConvexHull(mSpherePoints, 200, 16);
+            rp3d_test(mesh != nullptr);
+            rp3d_test(mesh->getNbVertices() <= 16);
+            rp3d_test(mesh->getNbVertices() >= 4);
+
+            // The vertices of the reduced hull are input points
+            for (uint32 v=0; v < mesh->getNbVertices(); v++) {
+                rp3d_test(approxEqual(mesh->getVertex(v).length(), decimal(1.0), decimal(0.0001)));
+            }
+
+            // The reduced hull is inside the sphere
+            const Vector3 center(0, 0, 0);
+            rp3d_test(arePointsInsideMesh(mesh, &center, 1));
+
+            mPhysicsCommon.destroyPolyhedronMesh(mesh);
+        }
+
+        /// Test the convex hull of degenerate sets of points
+        void testDegeneratePoints() {
+
+            // Not enough points
+            rp3d_test(mPhysicsCommon.createConvexHull(mSpherePoints, 3) == nullptr);
+
+            // Coincident points
+            Vector3 coincidentPoints[5] = {Vector3(1, 2, 3), Vector3(1, 2, 3), Vector3(1, 2, 3), Vector3(1, 2, 3), Vector3(1, 2, 3)};
+            rp3d_test(mPhysicsCommon.createConvexHull(coincidentPoints, 5) == nullptr);
+
+            // Collinear points
+            Vector3 collinearPoints[5] = {Vector3(0, 0, 0), Vector3(1, 1, 1), Vector3(2, 2, 2), Vector3(3, 3, 3), Vector3(-1, -1, -1)};
+            rp3d_test(mPhysicsCommon.createConvexHull(collinearPoints, 5) == nullptr);
+
+            // Coplanar points
+            Vector3 coplanarPoints[5] = {Vector3(0, 1, 0), Vector3(1, 1, 0), Vector3(1, 1, 1), Vector3(0, 1, 1), Vector3(decimal(0.5), 1, decimal(0.5))};
+            rp3d_test(mPhysicsCommon.createConvexHull(coplanarPoints, 5) == nullptr);
+        }
+ };
+
+}
+
+#endif
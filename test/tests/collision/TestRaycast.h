@@ -34,6 +34,8 @@
 #include <reactphysics3d/collision/shapes/BoxShape.h>
 #include <reactphysics3d/collision/shapes/SphereShape.h>
 #include <reactphysics3d/collision/shapes/CapsuleShape.h>
+#include <reactphysics3d/collision/shapes/CylinderShape.h>
+#include <reactphysics3d/collision/shapes/ConeShape.h>
 #include <reactphysics3d/collision/shapes/ConvexMeshShape.h>
 #include <reactphysics3d/collision/shapes/TriangleShape.h>
 #include <reactphysics3d/collision/shapes/ConcaveMeshShape.h>
@@ -121,6 +123,7 @@ class TestRaycast : public Test {
         CollisionBody* mCapsuleBody;
         CollisionBody* mConvexMeshBody;
         CollisionBody* mCylinderBody;
+        CollisionBody* mConeBody;
         CollisionBody* mCompoundBody;
         CollisionBody* mConcaveMeshBody;
         CollisionBody* mHeightFieldBody;
@@ -135,6 +138,8 @@ class TestRaycast : public Test {
         BoxShape* mBoxShape;
         SphereShape* mSphereShape;
         CapsuleShape* mCapsuleShape;
+        CylinderShape* mCylinderShape;
+        ConeShape* mConeShape;
         ConvexMeshShape* mConvexMeshShape;
         ConcaveMeshShape* mConcaveMeshShape;
         HeightFieldShape* mHeightFieldShape;
@@ -143,6 +148,8 @@ class TestRaycast : public Test {
         Collider* mBoxCollider;
         Collider* mSphereCollider;
         Collider* mCapsuleCollider;
+        Collider* mCylinderCollider;
+        Collider* mConeCollider;
         Collider* mConvexMeshCollider;
         Collider* mCompoundSphereCollider;
         Collider* mCompoundCapsuleCollider;
@@ -185,6 +192,7 @@ class TestRaycast : public Test {
             mCapsuleBody = mWorld->createCollisionBody(mBodyTransform);
             mConvexMeshBody = mWorld->createCollisionBody(mBodyTransform);
             mCylinderBody = mWorld->createCollisionBody(mBodyTransform);
+            mConeBody = mWorld->createCollisionBody(mBodyTransform);
             mCompoundBody = mWorld->createCollisionBody(mBodyTransform);
             mConcaveMeshBody = mWorld->createCollisionBody(mBodyTransform);
             mHeightFieldBody = mWorld->createCollisionBody(mBodyTransform);
@@ -207,6 +215,12 @@ class TestRaycast : public Test {
             mCapsuleShape = mPhysicsCommon.createCapsuleShape(2, 5);
             mCapsuleCollider = mCapsuleBody->addCollider(mCapsuleShape, mShapeTransform);
 
+            mCylinderShape = mPhysicsCommon.createCylinderShape(2, 6);
+            mCylinderCollider = mCylinderBody->addCollider(mCylinderShape, mShapeTransform);
+
+            mConeShape = mPhysicsCommon.createConeShape(2, 8);
+            mConeCollider = mConeBody->addCollider(mConeShape, mShapeTransform);
+
             mPolyhedronVertices[0] = -2; mPolyhedronVertices[1] = -3; mPolyhedronVertices[2] = 4;
             mPolyhedronVertices[3] = 2; mPolyhedronVertices[4] = -3; mPolyhedronVertices[5] = 4;
             mPolyhedronVertices[6] = 2; mPolyhedronVertices[7] = -3; mPolyhedronVertices[8] = -4;
@@ -294,6 +308,8 @@ class TestRaycast : public Test {
             mBoxCollider->setCollisionCategoryBits(CATEGORY1);
             mSphereCollider->setCollisionCategoryBits(CATEGORY1);
             mCapsuleCollider->setCollisionCategoryBits(CATEGORY1);
+            mCylinderCollider->setCollisionCategoryBits(CATEGORY1);
+            mConeCollider->setCollisionCategoryBits(CATEGORY1);
             mConvexMeshCollider->setCollisionCategoryBits(CATEGORY2);
             mCompoundSphereCollider->setCollisionCategoryBits(CATEGORY2);
             mCompoundCapsuleCollider->setCollisionCategoryBits(CATEGORY2);
@@ -308,6 +324,8 @@ class TestRaycast : public Test {
             mPhysicsCommon.destroyBoxShape(mBoxShape);
             mPhysicsCommon.destroySphereShape(mSphereShape);
             mPhysicsCommon.destroyCapsuleShape(mCapsuleShape);
+            mPhysicsCommon.destroyCylinderShape(mCylinderShape);
+            mPhysicsCommon.destroyConeShape(mConeShape);
             mPhysicsCommon.destroyConvexMeshShape(mConvexMeshShape);
             mPhysicsCommon.destroyConcaveMeshShape(mConcaveMeshShape);
             mPhysicsCommon.destroyHeightFieldShape(mHeightFieldShape);
@@ -323,6 +341,8 @@ class TestRaycast : public Test {
             testBox();
             testSphere();
             testCapsule();
+            testCylinder();
+            testCone();
             testConvexMesh();
             testCompound();
             testConcaveMesh();
@@ -991,6 +1011,184 @@ class TestRaycast : public Test {
             rp3d_test(mCallback.isHit);
         }
 
+        /// Test the Collider::raycast(), CollisionBody::raycast() and
+        /// PhysicsWorld::raycast() methods.
+        void testCylinder() {
+
+            // ----- Test feedback data ----- //
+            Ray raySide(mLocalShapeToWorld * Vector3(4, 1, 0), mLocalShapeToWorld * Vector3(-6, 1, 0));
+            Vector3 hitPointSide = mLocalShapeToWorld * Vector3(2, 1, 0);
+            Vector3 hitNormalSide = mLocalShapeToWorld.getOrientation() * Vector3(1, 0, 0);
+
+            Ray rayTop(mLocalShapeToWorld * Vector3(0, 6, 1), mLocalShapeToWorld * Vector3(0, -4, 1));
+            Vector3 hitPointTop = mLocalShapeToWorld * Vector3(0, 3, 1);
+            Vector3 hitNormalTop = mLocalShapeToWorld.getOrientation() * Vector3(0, 1, 0);
+
+            Ray rayBottom(mLocalShapeToWorld * Vector3(1, -5, 1), mLocalShapeToWorld * Vector3(1, 5, 1));
+            Vector3 hitPointBottom = mLocalShapeToWorld * Vector3(1, -3, 1);
+
+            mCallback.shapeToTest = mCylinderCollider;
+
+            // PhysicsWorld::raycast()
+            mCallback.reset();
+            mWorld->raycast(raySide, &mCallback);
+            rp3d_test(mCallback.isHit);
+            rp3d_test(mCallback.raycastInfo.body == mCylinderBody);
+            rp3d_test(mCallback.raycastInfo.collider == mCylinderCollider);
+            rp3d_test(approxEqual(mCallback.raycastInfo.hitFraction, decimal(0.2), epsilon));
+            rp3d_test(approxEqual(mCallback.raycastInfo.worldPoint.x, hitPointSide.x, epsilon));
+            rp3d_test(approxEqual(mCallback.raycastInfo.worldPoint.y, hitPointSide.y, epsilon));
+            rp3d_test(approxEqual(mCallback.raycastInfo.worldPoint.z, hitPointSide.z, epsilon));
+            rp3d_test(approxEqual(mCallback.raycastInfo.worldNormal.x, hitNormalSide.x, epsilon));
+            rp3d_test(approxEqual(mCallback.raycastInfo.worldNormal.y, hitNormalSide.y, epsilon));
+            rp3d_test(approxEqual(mCallback.raycastInfo.worldNormal.z, hitNormalSide.z, epsilon));
+
+            // Wrong category filter mask
+            mCallback.reset();
+            mWorld->raycast(raySide, &mCallback, CATEGORY2);
+            rp3d_test(!mCallback.isHit);
+
+            // CollisionBody::raycast()
+            RaycastInfo raycastInfo2;
+            rp3d_test(mCylinderBody->raycast(rayTop, raycastInfo2));
+            rp3d_test(raycastInfo2.collider == mCylinderCollider);
+            rp3d_test(approxEqual(raycastInfo2.hitFraction, decimal(0.3), epsilon));
+            rp3d_test(approxEqual(raycastInfo2.worldPoint.x, hitPointTop.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo2.worldPoint.y, hitPointTop.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo2.worldPoint.z, hitPointTop.z, epsilon));
+            rp3d_test(approxEqual(raycastInfo2.worldNormal.x, hitNormalTop.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo2.worldNormal.y, hitNormalTop.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo2.worldNormal.z, hitNormalTop.z, epsilon));
+
+            // Collider::raycast()
+            RaycastInfo raycastInfo3;
+            rp3d_test(mCylinderCollider->raycast(rayBottom, raycastInfo3));
+            rp3d_test(raycastInfo3.body == mCylinderBody);
+            rp3d_test(approxEqual(raycastInfo3.hitFraction, decimal(0.2), epsilon));
+            rp3d_test(approxEqual(raycastInfo3.worldPoint.x, hitPointBottom.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo3.worldPoint.y, hitPointBottom.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo3.worldPoint.z, hitPointBottom.z, epsilon));
+
+            Ray ray1(mLocalShapeToWorld * Vector3(0, 0, 0), mLocalShapeToWorld * Vector3(5, 7, -1));
+            Ray ray2(mLocalShapeToWorld * Vector3(3, 3.5, 0), mLocalShapeToWorld * Vector3(-3, 3.5, 0));
+            Ray ray3(mLocalShapeToWorld * Vector3(2.5, 0, -5), mLocalShapeToWorld * Vector3(2.5, 0, 5));
+            Ray ray4(mLocalShapeToWorld * Vector3(1.5, 6, 1.5), mLocalShapeToWorld * Vector3(1.5, -6, 1.5));
+            Ray ray5(mLocalShapeToWorld * Vector3(-5, 2.9, 0), mLocalShapeToWorld * Vector3(5, 2.9, 0));
+
+            // ----- Test raycast miss ----- //
+            rp3d_test(!mCylinderBody->raycast(ray1, raycastInfo3));
+            rp3d_test(!mCylinderCollider->raycast(ray1, raycastInfo3));
+            rp3d_test(!mCylinderBody->raycast(ray2, raycastInfo3));
+            rp3d_test(!mCylinderCollider->raycast(ray2, raycastInfo3));
+            rp3d_test(!mCylinderBody->raycast(ray3, raycastInfo3));
+            rp3d_test(!mCylinderCollider->raycast(ray3, raycastInfo3));
+            rp3d_test(!mCylinderBody->raycast(ray4, raycastInfo3));
+            rp3d_test(!mCylinderCollider->raycast(ray4, raycastInfo3));
+            mCallback.reset();
+            mWorld->raycast(Ray(raySide.point1, raySide.point2, decimal(0.1)), &mCallback);
+            rp3d_test(!mCallback.isHit);
+
+            // ----- Test raycast hits ----- //
+            rp3d_test(mCylinderBody->raycast(ray5, raycastInfo3));
+            rp3d_test(mCylinderCollider->raycast(ray5, raycastInfo3));
+            mCallback.reset();
+            mWorld->raycast(Ray(raySide.point1, raySide.point2, decimal(0.3)), &mCallback);
+            rp3d_test(mCallback.isHit);
+        }
+
+        /// Test the Collider::raycast(), CollisionBody::raycast() and
+        /// PhysicsWorld::raycast() methods.
+        void testCone() {
+
+            // The origin of the cone is its centroid (base at y=-2 and apex at y=6)
+
+            // ----- Test feedback data ----- //
+            const decimal slantLength = std::sqrt(decimal(8 * 8 + 2 * 2));
+
+            Ray raySide(mLocalShapeToWorld * Vector3(4, 2, 0), mLocalShapeToWorld * Vector3(-6, 2, 0));
+            Vector3 hitPointSide = mLocalShapeToWorld * Vector3(1, 2, 0);
+            Vector3 hitNormalSide = mLocalShapeToWorld.getOrientation() * Vector3(8 / slantLength, 2 / slantLength, 0);
+
+            Ray rayBase(mLocalShapeToWorld * Vector3(0.5, -5, 0), mLocalShapeToWorld * Vector3(0.5, 5, 0));
+            Vector3 hitPointBase = mLocalShapeToWorld * Vector3(0.5, -2, 0);
+            Vector3 hitNormalBase = mLocalShapeToWorld.getOrientation() * Vector3(0, -1, 0);
+
+            // Ray that crosses the apex plane before hitting the side of the cone
+            Ray rayAbove(mLocalShapeToWorld * Vector3(0.5, 12, 0), mLocalShapeToWorld * Vector3(0.5, 0, 0));
+            Vector3 hitPointAbove = mLocalShapeToWorld * Vector3(0.5, 4, 0);
+
+            mCallback.shapeToTest = mConeCollider;
+
+            // PhysicsWorld::raycast()
+            mCallback.reset();
+            mWorld->raycast(raySide, &mCallback);
+            rp3d_test(mCallback.isHit);
+            rp3d_test(mCallback.raycastInfo.body == mConeBody);
+            rp3d_test(mCallback.raycastInfo.collider == mConeCollider);
+            rp3d_test(approxEqual(mCallback.raycastInfo.hitFraction, decimal(0.3), epsilon));
+            rp3d_test(approxEqual(mCallback.raycastInfo.worldPoint.x, hitPointSide.x, epsilon));
+            rp3d_test(approxEqual(mCallback.raycastInfo.worldPoint.y, hitPointSide.y, epsilon));
+            rp3d_test(approxEqual(mCallback.raycastInfo.worldPoint.z, hitPointSide.z, epsilon));
+            rp3d_test(approxEqual(mCallback.raycastInfo.worldNormal.x, hitNormalSide.x, epsilon));
+            rp3d_test(approxEqual(mCallback.raycastInfo.worldNormal.y, hitNormalSide.y, epsilon));
+            rp3d_test(approxEqual(mCallback.raycastInfo.worldNormal.z, hitNormalSide.z, epsilon));
+
+            // Wrong category filter mask
+            mCallback.reset();
+            mWorld->raycast(raySide, &mCallback, CATEGORY2);
+            rp3d_test(!mCallback.isHit);
+
+            // CollisionBody::raycast()
+            RaycastInfo raycastInfo2;
+            rp3d_test(mConeBody->raycast(rayBase, raycastInfo2));
+            rp3d_test(raycastInfo2.collider == mConeCollider);
+            rp3d_test(approxEqual(raycastInfo2.hitFraction, decimal(0.3), epsilon));
+            rp3d_test(approxEqual(raycastInfo2.worldPoint.x, hitPointBase.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo2.worldPoint.y, hitPointBase.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo2.worldPoint.z, hitPointBase.z, epsilon));
+            rp3d_test(approxEqual(raycastInfo2.worldNormal.x, hitNormalBase.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo2.worldNormal.y, hitNormalBase.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo2.worldNormal.z, hitNormalBase.z, epsilon));
+
+            // Collider::raycast()
+            RaycastInfo raycastInfo3;
+            rp3d_test(mConeCollider->raycast(rayAbove, raycastInfo3));
+            rp3d_test(raycastInfo3.body == mConeBody);
+            rp3d_test(approxEqual(raycastInfo3.hitFraction, decimal(8.0 / 12.0), epsilon));
+            rp3d_test(approxEqual(raycastInfo3.worldPoint.x, hitPointAbove.x, epsilon));
+            rp3d_test(approxEqual(raycastInfo3.worldPoint.y, hitPointAbove.y, epsilon));
+            rp3d_test(approxEqual(raycastInfo3.worldPoint.z, hitPointAbove.z, epsilon));
+
+            Ray ray1(mLocalShapeToWorld * Vector3(0, 0, 0), mLocalShapeToWorld * Vector3(5, 7, -1));
+            Ray ray2(mLocalShapeToWorld * Vector3(1.5, 2, -5), mLocalShapeToWorld * Vector3(1.5, 2, 5));
+            Ray ray3(mLocalShapeToWorld * Vector3(3, -2.5, 0), mLocalShapeToWorld * Vector3(-3, -2.5, 0));
+            Ray ray4(mLocalShapeToWorld * Vector3(-5, 7, 0), mLocalShapeToWorld * Vector3(5, 7, 0));
+            Ray ray5(mLocalShapeToWorld * Vector3(0.5, 5, -5), mLocalShapeToWorld * Vector3(0.5, 5, 5));
+            Ray ray6(mLocalShapeToWorld * Vector3(0, 10, 0), mLocalShapeToWorld * Vector3(0, 0, 0));
+
+            // ----- Test raycast miss ----- //
+            rp3d_test(!mConeBody->raycast(ray1, raycastInfo3));
+            rp3d_test(!mConeCollider->raycast(ray1, raycastInfo3));
+            rp3d_test(!mConeBody->raycast(ray2, raycastInfo3));
+            rp3d_test(!mConeCollider->raycast(ray2, raycastInfo3));
+            rp3d_test(!mConeBody->raycast(ray3, raycastInfo3));
+            rp3d_test(!mConeCollider->raycast(ray3, raycastInfo3));
+            rp3d_test(!mConeBody->raycast(ray4, raycastInfo3));
+            rp3d_test(!mConeCollider->raycast(ray4, raycastInfo3));
+            rp3d_test(!mConeBody->raycast(ray5, raycastInfo3));
+            rp3d_test(!mConeCollider->raycast(ray5, raycastInfo3));
+            mCallback.reset();
+            mWorld->raycast(Ray(raySide.point1, raySide.point2, decimal(0.2)), &mCallback);
+            rp3d_test(!mCallback.isHit);
+
+            // ----- Test raycast hits ----- //
+            rp3d_test(mConeCollider->raycast(ray6, raycastInfo3));
+            rp3d_test(approxEqual(raycastInfo3.hitFraction, decimal(0.4), epsilon));
+            mCallback.reset();
+            mWorld->raycast(Ray(raySide.point1, raySide.point2, decimal(0.4)), &mCallback);
+            rp3d_test(mCallback.isHit);
+        }
+
         /// Test the Collider::raycast(), CollisionBody::raycast() and
         /// PhysicsWorld::raycast() methods.
         void testConvexMesh() {
@@ -0,0 +1,272 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_TRIANGLE_MESH_H
+#define TEST_TRIANGLE_MESH_H
+
+// Libraries
+#include <reactphysics3d/reactphysics3d.h>
+#include <reactphysics3d/memory/DefaultAllocator.h>
+#include "Test.h"
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class TestTriangleMesh
+/**
+ * Unit test for the internal edges of the triangle meshes and height fields.
+ */
+class TestTriangleMesh : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        /// Physics common
+        PhysicsCommon mPhysicsCommon;
+
+        /// Memory allocator
+        DefaultAllocator mAllocator;
+
+        // ---------- Methods ---------- //
+
+        /// Return the number of internal edges in some internal edges flags
+        static uint32 countInternalEdges(uint8 internalEdges) {
+            return ((internalEdges & 1) != 0) + ((internalEdges & 2) != 0) + ((internalEdges & 4) != 0);
+        }
+
+        /// Return the internal edges flags of the two triangles sharing the edge (0, 1) of a
+        /// mesh with four vertices where the two other vertices have a given height
+        void computeFoldedQuadInternalEdges(float height, uint8& internalEdges1, uint8& internalEdges2) {
+
+            const float vertices[12] = {0, 0, 0,   0, 0, 1,   1, height, 0.5f,   -1, height, 0.5f};
+            const uint32 indices[6] = {0, 1, 2,   1, 0, 3};
+
+            TriangleVertexArray triangleArray(4, vertices, 3 * sizeof(float), 2, indices, 3 * sizeof(uint32),
+                                              TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                              TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            TriangleMesh* mesh = mPhysicsCommon.createTriangleMesh();
+            mesh->addSubpart(&triangleArray);
+
+            internalEdges1 = mesh->getTriangleInternalEdges(0);
+            internalEdges2 = mesh->getTriangleInternalEdges(1);
+
+            mPhysicsCommon.destroyTriangleMesh(mesh);
+        }
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestTriangleMesh(const std::string& name) : Test(name) {
+
+        }
+
+        /// Run the tests
+        void run() {
+            testFlatMeshInternalEdges();
+            testFoldedMeshInternalEdges();
+            testSubpartsInternalEdges();
+            testHeightFieldInternalEdges();
+        }
+
+        /// Test the internal edges of a flat grid mesh
+        void testFlatMeshInternalEdges() {
+
+            // Grid of 3x3 vertices (2x2 quads) in the plane y=0 with the triangles facing up
+            float vertices[27];
+            for (int j=0; j < 3; j++) {
+                for (int i=0; i < 3; i++) {
+                    vertices[(j * 3 + i) * 3] = float(i);
+                    vertices[(j * 3 + i) * 3 + 1] = 0;
+                    vertices[(j * 3 + i) * 3 + 2] = float(j);
+                }
+            }
+            uint32 indices[24];
+            uint32 nbIndices = 0;
+            for (uint32 j=0; j < 2; j++) {
+                for (uint32 i=0; i < 2; i++) {
+                    const uint32 v = j * 3 + i;
+                    indices[nbIndices++] = v; indices[nbIndices++] = v + 3; indices[nbIndices++] = v + 1;
+                    indices[nbIndices++] = v + 1; indices[nbIndices++] = v + 3; indices[nbIndices++] = v + 4;
+                }
+            }
+
+            TriangleVertexArray triangleArray(9, vertices, 3 * sizeof(float), 8, indices, 3 * sizeof(uint32),
+                                              TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                              TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            TriangleMesh* mesh = mPhysicsCommon.createTriangleMesh();
+            mesh->addSubpart(&triangleArray);
+
+            // The 8 edges shared by two triangles are internal edges (on both triangles)
+            uint32 nbInternalEdges = 0;
+            for (uint32 t=0; t < 8; t++) {
+                nbInternalEdges += countInternalEdges(mesh->getTriangleInternalEdges(t));
+            }
+            rp3d_test(nbInternalEdges == 16);
+
+            // The edges on the border of the mesh are not internal edges
+            for (uint32 t=0; t < 8; t++) {
+
+                Vector3 triangleVertices[3];
+                triangleArray.getTriangleVertices(t, triangleVertices);
+
+                for (uint32 e=0; e < 3; e++) {
+                    const Vector3& v1 = triangleVertices[e];
+                    const Vector3& v2 = triangleVertices[(e + 1) % 3];
+                    const bool isBorder = (v1.x == 0 && v2.x == 0) || (v1.x == 2 && v2.x == 2) ||
+                                          (v1.z == 0 && v2.z == 0) || (v1.z == 2 && v2.z == 2);
+                    const bool isInternal = (mesh->getTriangleInternalEdges(t) & (1 << e)) != 0;
+                    rp3d_test(isBorder != isInternal);
+                }
+            }
+
+            mPhysicsCommon.destroyTriangleMesh(mesh);
+        }
+
+        /// Test the internal edge between two triangles with different angles
+        void testFoldedMeshInternalEdges() {
+
+            uint8 internalEdges1, internalEdges2;
+
+            // Flat surface
+            computeFoldedQuadInternalEdges(0, internalEdges1, internalEdges2);
+            rp3d_test(internalEdges1 == 1);
+            rp3d_test(internalEdges2 == 1);
+
+            // Concave surface (valley)
+            computeFoldedQuadInternalEdges(1, internalEdges1, internalEdges2);
+            rp3d_test(internalEdges1 == 1);
+            rp3d_test(internalEdges2 == 1);
+
+            // Convex surface (ridge)
+            computeFoldedQuadInternalEdges(-1, internalEdges1, internalEdges2);
+            rp3d_test(internalEdges1 == 0);
+            rp3d_test(internalEdges2 == 0);
+
+            // Almost flat convex surface
+            computeFoldedQuadInternalEdges(-0.01f, internalEdges1, internalEdges2);
+            rp3d_test(internalEdges1 == 1);
+            rp3d_test(internalEdges2 == 1);
+        }
+
+        /// Test that the triangles of different subparts are not adjacent
+        void testSubpartsInternalEdges() {
+
+            const float vertices[12] = {0, 0, 0,   0, 0, 1,   1, 0, 0.5f,   -1, 0, 0.5f};
+            const uint32 indices1[3] = {0, 1, 2};
+            const uint32 indices2[6] = {1, 0, 3,   0, 1, 2};
+
+            TriangleVertexArray triangleArray1(4, vertices, 3 * sizeof(float), 1, indices1, 3 * sizeof(uint32),
+                                               TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                               TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            TriangleVertexArray triangleArray2(4, vertices, 3 * sizeof(float), 2, indices2, 3 * sizeof(uint32),
+                                               TriangleVertexArray::VertexDataType::VERTEX_FLOAT_TYPE,
+                                               TriangleVertexArray::IndexDataType::INDEX_INTEGER_TYPE);
+            TriangleMesh* mesh = mPhysicsCommon.createTriangleMesh();
+            mesh->addSubpart(&triangleArray1);
+            mesh->addSubpart(&triangleArray2);
+
+            // The triangles are indexed in the order of the subparts
+            rp3d_test(mesh->getTriangleInternalEdges(0) == 0);
+            rp3d_test(mesh->getTriangleInternalEdges(1) == 1);
+            rp3d_test(mesh->getTriangleInternalEdges(2) == 1);
+
+            mPhysicsCommon.destroyTriangleMesh(mesh);
+        }
+
+        /// Test the internal edges of the triangles of a height field
+        void testHeightFieldInternalEdges() {
+
+            // Grid of 4x4 vertices with a ridge on the column 2
+            float flatHeights[16];
+            float ridgeHeights[16];
+            for (int j=0; j < 4; j++) {
+                for (int i=0; i < 4; i++) {
+                    flatHeights[j * 4 + i] = 0;
+                    ridgeHeights[j * 4 + i] = i == 2 ? 1.0f : 0.0f;
+                }
+            }
+
+            HeightFieldShape* flatHeightField = mPhysicsCommon.createHeightFieldShape(4, 4, 0, 0, flatHeights,
+                                                                                       HeightFieldShape::HeightDataType::HEIGHT_FLOAT_TYPE);
+            HeightFieldShape* ridgeHeightField = mPhysicsCommon.createHeightFieldShape(4, 4, 0, 1, ridgeHeights,
+                                                                                        HeightFieldShape::HeightDataType::HEIGHT_FLOAT_TYPE);
+
+            const AABB aabb(Vector3(-10, -10, -10), Vector3(10, 10, 10));
+
+            // Flat height field
+            Array<Vector3> triangleVertices(mAllocator);
+            Array<Vector3> triangleVerticesNormals(mAllocator);
+            Array<uint32> shapeIds(mAllocator);
+            Array<uint8> trianglesInternalEdges(mAllocator);
+            flatHeightField->computeOverlappingTriangles(aabb, triangleVertices, triangleVerticesNormals, shapeIds,
+                                                         trianglesInternalEdges, mAllocator);
+
+            rp3d_test(shapeIds.size() == 18);
+            rp3d_test(trianglesInternalEdges.size() == 18);
+
+            // The 21 edges shared by two triangles are internal edges (on both triangles)
+            uint32 nbInternalEdges = 0;
+            for (uint32 t=0; t < trianglesInternalEdges.size(); t++) {
+                nbInternalEdges += countInternalEdges(trianglesInternalEdges[t]);
+            }
+            rp3d_test(nbInternalEdges == 42);
+
+            // Height field with a ridge
+            triangleVertices.clear();
+            triangleVerticesNormals.clear();
+            shapeIds.clear();
+            trianglesInternalEdges.clear();
+            ridgeHeightField->computeOverlappingTriangles(aabb, triangleVertices, triangleVerticesNormals, shapeIds,
+                                                          trianglesInternalEdges, mAllocator);
+
+            rp3d_test(trianglesInternalEdges.size() == 18);
+
+            // The three edges on the ridge are not internal edges anymore
+            nbInternalEdges = 0;
+            for (uint32 t=0; t < trianglesInternalEdges.size(); t++) {
+
+                nbInternalEdges += countInternalEdges(trianglesInternalEdges[t]);
+
+                for (uint32 e=0; e < 3; e++) {
+                    const Vector3& v1 = triangleVertices[t * 3 + e];
+                    const Vector3& v2 = triangleVertices[t * 3 + (e + 1) % 3];
+                    if (approxEqual(v1.y, decimal(0.5)) && approxEqual(v2.y, decimal(0.5))) {
+                        rp3d_test((trianglesInternalEdges[t] & (1 << e)) == 0);
+                    }
+                }
+            }
+            rp3d_test(nbInternalEdges == 36);
+
+            mPhysicsCommon.destroyHeightFieldShape(flatHeightField);
+            mPhysicsCommon.destroyHeightFieldShape(ridgeHeightField);
+        }
+ };
+
+}
+
+#endif
@@ -0,0 +1,1096 @@
+/********************************************************************************
+* ReactPhysics3D physics library, http://www.reactphysics3d.com                 *
+* Copyright (c) 2010-2022 Daniel Chappuis                                       *
+*********************************************************************************
+*                                                                               *
+* This software is provided 'as-is', without any express or implied warranty.   *
+* In no event will the authors be held liable for any damages arising from the  *
+* use of this software.                                                         *
+*                                                                               *
+* Permission is granted to anyone to use this software for any purpose,         *
+* including commercial applications, and to alter it and redistribute it        *
+* freely, subject to the following restrictions:                                *
+*                                                                               *
+* 1. The origin of this software must not be misrepresented; you must not claim *
+*    that you wrote the original software. If you use this software in a        *
+*    product, an acknowledgment in the product documentation would be           *
+*    appreciated but is not required.                                           *
+*                                                                               *
+* 2. Altered source versions must be plainly marked as such, and must not be    *
+*    misrepresented as being the original software.                             *
+*                                                                               *
+* 3. This notice may not be removed or altered from any source distribution.    *
+*                                                                               *
+********************************************************************************/
+
+#ifndef TEST_PHYSICS_WORLD_H
+#define TEST_PHYSICS_WORLD_H
+
+// Libraries
+#include <reactphysics3d/reactphysics3d.h>
+#include <vector>
+
+/// Reactphysics3D namespace
+namespace reactphysics3d {
+
+// Class ContactCounterEventListener
+/**
+ * Event listener that counts the contact pairs reported during the last frame
+ */
+class ContactCounterEventListener : public EventListener {
+
+    public:
+
+        uint32 nbContactPairs = 0;
+
+        /// Called when some contacts occur
+        virtual void onContact(const CollisionCallback::CallbackData& callbackData) override {
+            nbContactPairs += callbackData.getNbContactPairs();
+        }
+};
+
+// Class PenetrationDepthEventListener
+/**
+ * Event listener that records the range of the penetration depths reported during the last frames
+ */
+class PenetrationDepthEventListener : public EventListener {
+
+    public:
+
+        uint32 nbContactPoints = 0;
+        decimal minPenetrationDepth = DECIMAL_LARGEST;
+        decimal maxPenetrationDepth = -DECIMAL_LARGEST;
+
+        /// Called when some contacts occur
+        virtual void onContact(const CollisionCallback::CallbackData& callbackData) override {
+
+            for (uint32 p=0; p < callbackData.getNbContactPairs(); p++) {
+
+                const CollisionCallback::ContactPair contactPair = callbackData.getContactPair(p);
+                for (uint32 c=0; c < contactPair.getNbContactPoints(); c++) {
+
+                    const decimal penetrationDepth = contactPair.getContactPoint(c).getPenetrationDepth();
+                    minPenetrationDepth = std::min(minPenetrationDepth, penetrationDepth);
+                    maxPenetrationDepth = std::max(maxPenetrationDepth, penetrationDepth);
+                    nbContactPoints++;
+                }
+            }
+        }
+
+        /// Reset the recorded penetration depths
+        void reset() {
+            nbContactPoints = 0;
+            minPenetrationDepth = DECIMAL_LARGEST;
+            maxPenetrationDepth = -DECIMAL_LARGEST;
+        }
+};
+
+// Class FrictionlessMaterialMixer
+/**
+ * Material mixer that removes the friction between all the colliders
+ */
+class FrictionlessMaterialMixer : public MaterialMixer {
+
+    public:
+
+        /// Return the friction coefficient of a contact between two colliders
+        virtual decimal mixFrictionCoefficients(const Material& /*material1*/, const Material& /*material2*/) const override {
+            return decimal(0.0);
+        }
+};
+
+// Class ClosestHitRaycastCallback
+/**
+ * Raycast callback that records the closest hit of a ray
+ */
+class ClosestHitRaycastCallback : public RaycastCallback {
+
+    public:
+
+        Collider* collider = nullptr;
+        decimal hitFraction = DECIMAL_LARGEST;
+
+        /// Called when a collider is hit by the ray
+        virtual decimal notifyRaycastHit(const RaycastInfo& raycastInfo) override {
+
+            if (raycastInfo.hitFraction < hitFraction) {
+                collider = raycastInfo.collider;
+                hitFraction = raycastInfo.hitFraction;
+            }
+
+            return raycastInfo.hitFraction;
+        }
+};
+
+// Class TestPhysicsWorld
+/**
+ * Unit test for the PhysicsWorld class.
+ */
+class TestPhysicsWorld : public Test {
+
+    private :
+
+        // ---------- Atributes ---------- //
+
+        PhysicsCommon mPhysicsCommon;
+        PhysicsWorld* mWorld;
+
+        RigidBody* mFloorBody;
+        RigidBody* mBoxBody1;
+        RigidBody* mBoxBody2;
+        RigidBody* mSphereBody;
+        RigidBody* mCapsuleBody;
+
+        Collider* mFloorCollider;
+        Collider* mBoxCollider1;
+        Collider* mBoxCollider2;
+        Collider* mSphereCollider;
+        Collider* mCapsuleCollider;
+
+    public :
+
+        // ---------- Methods ---------- //
+
+        /// Constructor
+        TestPhysicsWorld(const std::string& name) : Test(name) {
+
+            // Bodies must not fall asleep because we want the contacts to be processed at each frame
+            PhysicsWorld::WorldSettings settings;
+            settings.isSleepingEnabled = false;
+            mWorld = mPhysicsCommon.createPhysicsWorld(settings);
+
+            mFloorBody = mWorld->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+            mFloorBody->setType(BodyType::STATIC);
+            mFloorCollider = mFloorBody->addCollider(mPhysicsCommon.createBoxShape(Vector3(20, 1, 20)), Transform::identity());
+
+            mBoxBody1 = mWorld->createRigidBody(Transform(Vector3(0, 1, 0), Quaternion::identity()));
+            mBoxCollider1 = mBoxBody1->addCollider(mPhysicsCommon.createBoxShape(Vector3(1, 1, 1)), Transform::identity());
+
+            mBoxBody2 = mWorld->createRigidBody(Transform(Vector3(0, 3, 0), Quaternion::identity()));
+            mBoxCollider2 = mBoxBody2->addCollider(mPhysicsCommon.createBoxShape(Vector3(1, 1, 1)), Transform::identity());
+
+            mSphereBody = mWorld->createRigidBody(Transform(Vector3(5, 1, 0), Quaternion::identity()));
+            mSphereCollider = mSphereBody->addCollider(mPhysicsCommon.createSphereShape(1), Transform::identity());
+
+            mCapsuleBody = mWorld->createRigidBody(Transform(Vector3(-5, 1, 0), Quaternion::fromEulerAngles(0, 0, PI_RP3D * decimal(0.5))));
+            mCapsuleCollider = mCapsuleBody->addCollider(mPhysicsCommon.createCapsuleShape(1, 2), Transform::identity());
+        }
+
+        /// Destructor
+        virtual ~TestPhysicsWorld() {
+
+            mPhysicsCommon.destroyPhysicsWorld(mWorld);
+        }
+
+        /// Run the tests
+        void run() {
+            testNoHeapAllocationsInSteadyState();
+            testSleepingBodyOverlappingPairs();
+            testContactReportFilter();
+            testPerIslandSolver();
+            testSolverEarlyTermination();
+            testSolverPriority();
+            testSubsteps();
+            testArticulation();
+            testDirectJointSolver();
+            testJointsPositionCorrection();
+            testMaterialMixing();
+            testContactMargin();
+            testCompoundBody();
+            testConcaveMeshTriangleShapes();
+            testConcaveMeshTrianglesCache();
+        }
+
+        void testNoHeapAllocationsInSteadyState() {
+
+#ifndef NDEBUG
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+
+            // Let the bodies come to rest so that the sizes of the persistent buffers of the
+            // contact pipeline stabilize. The single frame allocator also needs several hundreds
+            // of frames to shrink its memory buffer to the amount of memory used per frame.
+            for (uint32 i=0; i < 1000; i++) {
+                mWorld->update(timeStep);
+            }
+
+            rp3d_test(mWorld->getNbRigidBodies() == 5);
+            rp3d_test(mBoxBody2->getTransform().getPosition().y > decimal(2.5));
+
+            // Once the simulation is in steady state, the frames should not allocate heap memory anymore
+            const uint64 nbAllocationsBefore = mWorld->getMemoryManager().getHeapAllocator().getNbTotalAllocations();
+
+            for (uint32 i=0; i < 100; i++) {
+                mWorld->update(timeStep);
+            }
+
+            const uint64 nbAllocationsAfter = mWorld->getMemoryManager().getHeapAllocator().getNbTotalAllocations();
+            rp3d_test(nbAllocationsAfter == nbAllocationsBefore);
+
+#endif
+
+        }
+
+        void testSleepingBodyOverlappingPairs() {
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+
+            PhysicsWorld::WorldSettings settings;
+            settings.gravity = Vector3::zero();
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+
+            RigidBody* box = world->createRigidBody(Transform::identity());
+            box->addCollider(mPhysicsCommon.createBoxShape(Vector3(1, 1, 1)), Transform::identity());
+
+            ContactCounterEventListener eventListener;
+            world->setEventListener(&eventListener);
+
+            world->update(timeStep);
+            box->setIsSleeping(true);
+            world->update(timeStep);
+            rp3d_test(box->isSleeping());
+
+            // A static body overlapping the sleeping body does not generate contacts (the overlapping
+            // pairs between a sleeping body and a static body are not created)
+            RigidBody* staticBody = world->createRigidBody(Transform(Vector3(0, decimal(1.5), 0), Quaternion::identity()));
+            staticBody->setType(BodyType::STATIC);
+            staticBody->addCollider(mPhysicsCommon.createBoxShape(Vector3(1, 1, 1)), Transform::identity());
+
+            eventListener.nbContactPairs = 0;
+            world->update(timeStep);
+            world->update(timeStep);
+            rp3d_test(box->isSleeping());
+            rp3d_test(eventListener.nbContactPairs == 0);
+
+            // When the body wakes up, the broad-phase must find the pair with the static body
+            box->setIsSleeping(false);
+            world->update(timeStep);
+            rp3d_test(!box->isSleeping());
+            rp3d_test(eventListener.nbContactPairs > 0);
+
+            world->setEventListener(nullptr);
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+        void testContactReportFilter() {
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+
+            ContactCounterEventListener eventListener;
+            mWorld->setEventListener(&eventListener);
+
+            // Let the bodies come to rest
+            for (uint32 i=0; i < 60; i++) {
+                mWorld->update(timeStep);
+            }
+
+            rp3d_test(mBoxCollider1->getReportContacts());
+            rp3d_test(approxEqual(mBoxCollider1->getContactReportImpulseThreshold(), decimal(0.0)));
+
+            // By default, all the contact pairs are reported
+            eventListener.nbContactPairs = 0;
+            mWorld->update(timeStep);
+            rp3d_test(eventListener.nbContactPairs == 4);
+
+            // Only report the contacts of the second box (in contact with the first box)
+            mFloorCollider->setReportContacts(false);
+            mBoxCollider1->setReportContacts(false);
+            mSphereCollider->setReportContacts(false);
+            mCapsuleCollider->setReportContacts(false);
+            rp3d_test(!mFloorCollider->getReportContacts());
+
+            eventListener.nbContactPairs = 0;
+            mWorld->update(timeStep);
+            rp3d_test(eventListener.nbContactPairs == 1);
+
+            // The persisting contact between the two boxes has a too small impulse to be reported
+            mBoxCollider2->setContactReportImpulseThreshold(decimal(1000.0));
+            rp3d_test(approxEqual(mBoxCollider2->getContactReportImpulseThreshold(), decimal(1000.0)));
+
+            eventListener.nbContactPairs = 0;
+            mWorld->update(timeStep);
+            rp3d_test(eventListener.nbContactPairs == 0);
+
+            mWorld->setEventListener(nullptr);
+        }
+
+        /// Create a world with several independent islands of bodies connected by contacts and joints
+        PhysicsWorld* createIslandsWorld(bool isPerIslandSolverEnabled, std::vector<RigidBody*>& bodies) {
+
+            PhysicsWorld::WorldSettings settings;
+            settings.isSleepingEnabled = false;
+            settings.isPerIslandSolverEnabled = isPerIslandSolverEnabled;
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+
+            RigidBody* floor = world->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+            floor->setType(BodyType::STATIC);
+            floor->addCollider(mPhysicsCommon.createBoxShape(Vector3(50, 1, 50)), Transform::identity());
+
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+
+            // Each island is a small stack of two boxes with a pendulum attached to the top box
+            for (uint32 i=0; i < 4; i++) {
+
+                const decimal x = decimal(i) * decimal(8.0);
+
+                RigidBody* box1 = world->createRigidBody(Transform(Vector3(x, decimal(0.5), 0), Quaternion::identity()));
+                box1->addCollider(boxShape, Transform::identity());
+                RigidBody* box2 = world->createRigidBody(Transform(Vector3(x + decimal(0.1), decimal(1.6), 0), Quaternion::identity()));
+                box2->addCollider(boxShape, Transform::identity());
+                RigidBody* pendulum = world->createRigidBody(Transform(Vector3(x + decimal(1.5), decimal(2.5), 0), Quaternion::identity()));
+                pendulum->addCollider(boxShape, Transform::identity());
+
+                HingeJointInfo jointInfo(box2, pendulum, Vector3(x + decimal(0.6), decimal(2.5), 0), Vector3(0, 0, 1));
+                world->createJoint(jointInfo);
+
+                bodies.push_back(box1);
+                bodies.push_back(box2);
+                bodies.push_back(pendulum);
+            }
+
+            return world;
+        }
+
+        void testPerIslandSolver() {
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+
+            std::vector<RigidBody*> bodies1;
+            std::vector<RigidBody*> bodies2;
+            PhysicsWorld* world1 = createIslandsWorld(false, bodies1);
+            PhysicsWorld* world2 = createIslandsWorld(true, bodies2);
+
+            rp3d_test(!world1->isPerIslandSolverEnabled());
+            rp3d_test(world2->isPerIslandSolverEnabled());
+
+            for (uint32 i=0; i < 120; i++) {
+                world1->update(timeStep);
+                world2->update(timeStep);
+            }
+
+            // The islands are independent and each one of them only contains a single joint. Therefore,
+            // solving the constraints island by island must give the same result as solving them globally.
+            for (size_t i=0; i < bodies1.size(); i++) {
+                const Vector3& position1 = bodies1[i]->getTransform().getPosition();
+                const Vector3& position2 = bodies2[i]->getTransform().getPosition();
+                rp3d_test(approxEqual(position1.x, position2.x));
+                rp3d_test(approxEqual(position1.y, position2.y));
+                rp3d_test(approxEqual(position1.z, position2.z));
+            }
+
+            // The top boxes must still be on top of the bottom ones
+            rp3d_test(bodies2[1]->getTransform().getPosition().y > decimal(1.0));
+
+            world2->enablePerIslandSolver(false);
+            rp3d_test(!world2->isPerIslandSolverEnabled());
+
+            mPhysicsCommon.destroyPhysicsWorld(world1);
+            mPhysicsCommon.destroyPhysicsWorld(world2);
+        }
+
+        void testSolverEarlyTermination() {
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+
+            std::vector<RigidBody*> bodies;
+            PhysicsWorld* world = createIslandsWorld(true, bodies);
+            world->setNbIterationsVelocitySolver(20);
+            world->setNbIterationsPositionSolver(10);
+
+            rp3d_test(approxEqual(world->getVelocitySolverTolerance(), decimal(0.0)));
+            rp3d_test(approxEqual(world->getPositionSolverTolerance(), decimal(0.0)));
+
+            // Without tolerance, all the iterations are done for each island
+            world->update(timeStep);
+            const PhysicsWorld::SolverStatistics& statistics = world->getSolverStatistics();
+            rp3d_test(statistics.nbIslands >= 4);
+            rp3d_test(statistics.nbVelocityIterations == statistics.nbIslands * 20);
+            rp3d_test(statistics.maxNbVelocityIterations == 20);
+            rp3d_test(statistics.nbPositionIterations == 0);
+            rp3d_test(statistics.maxNbPositionIterations == 0);
+
+            // Move a pendulum away from its hinge: only the island of this joint needs a position correction
+            bodies[2]->setTransform(Transform(bodies[2]->getTransform().getPosition() + Vector3(decimal(0.2), 0, 0), Quaternion::identity()));
+            world->update(timeStep);
+            rp3d_test(statistics.nbPositionIterations == 10);
+            rp3d_test(statistics.maxNbPositionIterations == 10);
+
+            // Let the pendulums come to rest
+            for (uint32 i=0; i < 600; i++) {
+                world->update(timeStep);
+            }
+
+            world->setVelocitySolverTolerance(decimal(0.01));
+            world->setPositionSolverTolerance(decimal(0.01));
+            rp3d_test(approxEqual(world->getVelocitySolverTolerance(), decimal(0.01)));
+            rp3d_test(approxEqual(world->getPositionSolverTolerance(), decimal(0.01)));
+
+            // The islands at rest converge before the maximum number of iterations
+            world->update(timeStep);
+            rp3d_test(statistics.nbIslands == 4);
+            rp3d_test(statistics.nbVelocityIterations >= 4);
+            rp3d_test(statistics.nbVelocityIterations < 4 * 20);
+            rp3d_test(statistics.maxNbVelocityIterations <= 20);
+            rp3d_test(statistics.nbPositionIterations < 4 * 10);
+
+            // The stacks must still be standing
+            for (size_t i=0; i < bodies.size(); i += 3) {
+                rp3d_test(bodies[i + 1]->getTransform().getPosition().y > decimal(1.0));
+            }
+
+            // In the global mode, the whole world is counted as a single island
+            world->enablePerIslandSolver(false);
+            world->update(timeStep);
+            rp3d_test(statistics.nbIslands == 1);
+            rp3d_test(statistics.nbVelocityIterations >= 1);
+            rp3d_test(statistics.nbVelocityIterations == statistics.maxNbVelocityIterations);
+            rp3d_test(statistics.nbVelocityIterations < 20);
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+        void testSolverPriority() {
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+
+            std::vector<RigidBody*> bodies;
+            PhysicsWorld* world = createIslandsWorld(true, bodies);
+            world->setNbIterationsVelocitySolver(20);
+
+            rp3d_test(approxEqual(bodies[0]->getSolverPriority(), decimal(1.0)));
+
+            // Let the top boxes fall on the bottom ones
+            for (uint32 i=0; i < 60; i++) {
+                world->update(timeStep);
+            }
+            const PhysicsWorld::SolverStatistics& statistics = world->getSolverStatistics();
+            rp3d_test(statistics.nbIslands == 4);
+            rp3d_test(statistics.nbVelocityIterations == 4 * 20);
+
+            // Lower the priority of all the bodies except the ones of the first island
+            for (size_t i=3; i < bodies.size(); i++) {
+                bodies[i]->setSolverPriority(decimal(0.25));
+            }
+            rp3d_test(approxEqual(bodies[3]->getSolverPriority(), decimal(0.25)));
+
+            world->update(timeStep);
+            rp3d_test(statistics.nbVelocityIterations == 20 + 3 * 5);
+            rp3d_test(statistics.maxNbVelocityIterations == 20);
+
+            // An island is solved with the largest priority of its bodies
+            bodies[3]->setSolverPriority(decimal(1.0));
+            world->update(timeStep);
+            rp3d_test(statistics.nbVelocityIterations == 2 * 20 + 2 * 5);
+
+            // An island is always solved at least once
+            for (size_t i=6; i < bodies.size(); i++) {
+                bodies[i]->setSolverPriority(decimal(0.0));
+            }
+            world->update(timeStep);
+            rp3d_test(statistics.nbVelocityIterations == 2 * 20 + 2 * 1);
+
+            for (uint32 i=0; i < 120; i++) {
+                world->update(timeStep);
+            }
+
+            // The stacks must still be standing
+            for (size_t i=0; i < bodies.size(); i += 3) {
+                rp3d_test(bodies[i + 1]->getTransform().getPosition().y > decimal(1.0));
+            }
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+        void testSubsteps() {
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+
+            PhysicsWorld::WorldSettings settings;
+            settings.isSleepingEnabled = false;
+            settings.defaultNbSubsteps = 4;
+            settings.defaultVelocitySolverNbIterations = 2;
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+
+            rp3d_test(world->getNbSubsteps() == 4);
+
+            RigidBody* floor = world->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+            floor->setType(BodyType::STATIC);
+            floor->addCollider(mPhysicsCommon.createBoxShape(Vector3(50, 1, 50)), Transform::identity());
+
+            // Tall stack of boxes
+            BoxShape* boxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5)));
+            RigidBody* topBox = nullptr;
+            for (uint32 i=0; i < 10; i++) {
+                topBox = world->createRigidBody(Transform(Vector3(0, decimal(0.5) + decimal(i), 0), Quaternion::identity()));
+                topBox->addCollider(boxShape, Transform::identity());
+            }
+
+            for (uint32 i=0; i < 300; i++) {
+                world->update(timeStep);
+            }
+
+            // The iterations of all the sub-steps are counted
+            const PhysicsWorld::SolverStatistics& statistics = world->getSolverStatistics();
+            rp3d_test(statistics.nbIslands == 1);
+            rp3d_test(statistics.nbVelocityIterations == 4 * 2);
+            rp3d_test(statistics.maxNbVelocityIterations == 2);
+            // There is no joint to correct
+            rp3d_test(statistics.nbPositionIterations == 0);
+
+            // The stack must still be standing
+            const Vector3 topPosition = topBox->getTransform().getPosition();
+            rp3d_test(topPosition.y > decimal(9.0));
+            rp3d_test(std::abs(topPosition.x) < decimal(0.1));
+            rp3d_test(std::abs(topPosition.z) < decimal(0.1));
+
+            world->setNbSubsteps(1);
+            rp3d_test(world->getNbSubsteps() == 1);
+
+            world->update(timeStep);
+            rp3d_test(statistics.nbVelocityIterations == 2);
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+        /// Create a vertical chain of bodies hanging from a static body with a heavy body at the end
+        PhysicsWorld* createChainWorld(bool isArticulated, std::vector<RigidBody*>& bodies, std::vector<Joint*>& joints) {
+
+            PhysicsWorld::WorldSettings settings;
+            settings.isSleepingEnabled = false;
+            settings.defaultVelocitySolverNbIterations = 4;
+            settings.defaultPositionSolverNbIterations = 1;
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+
+            RigidBody* anchor = world->createRigidBody(Transform::identity());
+            anchor->setType(BodyType::STATIC);
+
+            RigidBody* previousBody = anchor;
+            for (uint32 i=0; i < 10; i++) {
+
+                RigidBody* body = world->createRigidBody(Transform(Vector3(0, -decimal(0.5) * decimal(i + 1), 0), Quaternion::identity()));
+                const decimal mass = i == 9 ? decimal(100.0) : decimal(1.0);
+                body->setMass(mass);
+                body->setLocalInertiaTensor(Vector3(mass, mass, mass) * decimal(0.01));
+
+                BallAndSocketJointInfo jointInfo(previousBody, body, Vector3(0, -decimal(0.5) * decimal(i) - decimal(0.25), 0));
+                jointInfo.isArticulated = isArticulated;
+                joints.push_back(world->createJoint(jointInfo));
+
+                bodies.push_back(body);
+                previousBody = body;
+            }
+
+            return world;
+        }
+
+        void testArticulation() {
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+
+            std::vector<RigidBody*> bodies1;
+            std::vector<RigidBody*> bodies2;
+            std::vector<Joint*> joints1;
+            std::vector<Joint*> joints2;
+            PhysicsWorld* world1 = createChainWorld(false, bodies1, joints1);
+            PhysicsWorld* world2 = createChainWorld(true, bodies2, joints2);
+
+            rp3d_test(!joints1[0]->isArticulated());
+            rp3d_test(joints2[0]->isArticulated());
+
+            for (uint32 i=0; i < 120; i++) {
+                world1->update(timeStep);
+                world2->update(timeStep);
+            }
+
+            // With a few iterations, the iterative solver cannot hold the heavy body and the chain stretches
+            const decimal restPositionY = decimal(-5.0);
+            rp3d_test(bodies1[9]->getTransform().getPosition().y < restPositionY - decimal(0.05));
+
+            // The articulation solver satisfies the joints exactly and the chain does not stretch
+            rp3d_test(approxEqual(bodies2[9]->getTransform().getPosition().y, restPositionY, decimal(0.001)));
+            for (uint32 i=1; i < 10; i++) {
+                const Vector3 anchor1 = bodies2[i-1]->getTransform() * Vector3(0, decimal(-0.25), 0);
+                const Vector3 anchor2 = bodies2[i]->getTransform() * Vector3(0, decimal(0.25), 0);
+                rp3d_test((anchor1 - anchor2).length() < decimal(0.001));
+            }
+
+            // Closing a loop with an articulated joint (solved by the iterative solver) and using
+            // the per-island solver must keep the chain in place
+            RigidBody* anchor2 = world2->createRigidBody(Transform(Vector3(0, decimal(-5.25), 0), Quaternion::identity()));
+            anchor2->setType(BodyType::STATIC);
+            BallAndSocketJointInfo loopJointInfo(bodies2[9], anchor2, Vector3(0, decimal(-5.25), 0));
+            loopJointInfo.isArticulated = true;
+            world2->createJoint(loopJointInfo);
+            world2->enablePerIslandSolver(true);
+
+            for (uint32 i=0; i < 60; i++) {
+                world2->update(timeStep);
+            }
+            rp3d_test(approxEqual(bodies2[9]->getTransform().getPosition().y, restPositionY, decimal(0.001)));
+
+            // The joints can be moved back to the iterative solver
+            joints2[0]->setIsArticulated(false);
+            rp3d_test(!joints2[0]->isArticulated());
+
+            mPhysicsCommon.destroyPhysicsWorld(world1);
+            mPhysicsCommon.destroyPhysicsWorld(world2);
+        }
+
+        /// Create a ladder made of two chains of bodies linked by rungs (the joints form loops)
+        PhysicsWorld* createLadderWorld(uint32 directJointSolverMaxNbBodies, std::vector<RigidBody*>& bodies) {
+
+            PhysicsWorld::WorldSettings settings;
+            settings.isSleepingEnabled = false;
+            settings.defaultVelocitySolverNbIterations = 4;
+            settings.defaultPositionSolverNbIterations = 1;
+            settings.directJointSolverMaxNbBodies = directJointSolverMaxNbBodies;
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+
+            RigidBody* anchor = world->createRigidBody(Transform::identity());
+            anchor->setType(BodyType::STATIC);
+
+            RigidBody* previousLeftBody = anchor;
+            RigidBody* previousRightBody = anchor;
+            for (uint32 i=0; i < 8; i++) {
+
+                const decimal y = -decimal(i + 1);
+                const decimal mass = i == 7 ? decimal(50.0) : decimal(1.0);
+                RigidBody* leftBody = world->createRigidBody(Transform(Vector3(0, y, 0), Quaternion::identity()));
+                RigidBody* rightBody = world->createRigidBody(Transform(Vector3(1, y, 0), Quaternion::identity()));
+                leftBody->setMass(mass);
+                rightBody->setMass(mass);
+                leftBody->setLocalInertiaTensor(Vector3(mass, mass, mass) * decimal(0.05));
+                rightBody->setLocalInertiaTensor(Vector3(mass, mass, mass) * decimal(0.05));
+
+                world->createJoint(BallAndSocketJointInfo(previousLeftBody, leftBody, Vector3(0, y + decimal(0.5), 0)));
+                world->createJoint(BallAndSocketJointInfo(previousRightBody, rightBody, Vector3(1, y + decimal(0.5), 0)));
+                world->createJoint(BallAndSocketJointInfo(leftBody, rightBody, Vector3(decimal(0.5), y, 0)));
+
+                bodies.push_back(leftBody);
+                bodies.push_back(rightBody);
+                previousLeftBody = leftBody;
+                previousRightBody = rightBody;
+            }
+
+            return world;
+        }
+
+        void testDirectJointSolver() {
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+
+            std::vector<RigidBody*> bodies1;
+            std::vector<RigidBody*> bodies2;
+            PhysicsWorld* world1 = createLadderWorld(0, bodies1);
+            PhysicsWorld* world2 = createLadderWorld(32, bodies2);
+
+            rp3d_test(world1->getDirectJointSolverMaxNbBodies() == 0);
+            rp3d_test(world2->getDirectJointSolverMaxNbBodies() == 32);
+
+            for (uint32 i=0; i < 300; i++) {
+                world1->update(timeStep);
+                world2->update(timeStep);
+            }
+
+            // With a few iterations, the iterative solver cannot hold the heavy bodies and the ladder stretches
+            const decimal restPositionY = decimal(-8.0);
+            rp3d_test(bodies1[14]->getTransform().getPosition().y < restPositionY - decimal(0.05));
+
+            // The direct solver satisfies the joints of the island exactly
+            rp3d_test(approxEqual(bodies2[14]->getTransform().getPosition().y, restPositionY, decimal(0.001)));
+            rp3d_test(approxEqual(bodies2[15]->getTransform().getPosition().y, restPositionY, decimal(0.001)));
+
+            // An island with more bodies than the maximum is solved by the iterative solver
+            // (warm started with the impulses computed by the direct solver)
+            world2->setDirectJointSolverMaxNbBodies(4);
+            rp3d_test(world2->getDirectJointSolverMaxNbBodies() == 4);
+            for (uint32 i=0; i < 60; i++) {
+                world2->update(timeStep);
+            }
+            rp3d_test(approxEqual(bodies2[14]->getTransform().getPosition().y, restPositionY, decimal(0.1)));
+
+            mPhysicsCommon.destroyPhysicsWorld(world1);
+            mPhysicsCommon.destroyPhysicsWorld(world2);
+        }
+
+        void testJointsPositionCorrection() {
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+
+            PhysicsWorld::WorldSettings settings;
+            settings.isSleepingEnabled = false;
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+
+            RigidBody* anchor = world->createRigidBody(Transform::identity());
+            anchor->setType(BodyType::STATIC);
+
+            // Long chain hanging under the static body
+            const uint32 nbBodies = 20;
+            std::vector<RigidBody*> bodies;
+            RigidBody* previousBody = anchor;
+            for (uint32 i=0; i < nbBodies; i++) {
+
+                const decimal y = -decimal(i + 1);
+                RigidBody* body = world->createRigidBody(Transform(Vector3(0, y, 0), Quaternion::identity()));
+                body->setLocalInertiaTensor(Vector3(decimal(0.05), decimal(0.05), decimal(0.05)));
+                world->createJoint(BallAndSocketJointInfo(previousBody, body, Vector3(0, y + decimal(0.5), 0)));
+
+                bodies.push_back(body);
+                previousBody = body;
+            }
+
+            for (uint32 i=0; i < 600; i++) {
+                world->update(timeStep);
+            }
+
+            // The small position errors of the joints are corrected and the chain does not sag
+            for (uint32 i=1; i < nbBodies; i++) {
+                const Vector3 anchor1 = bodies[i-1]->getTransform() * Vector3(0, decimal(-0.5), 0);
+                const Vector3 anchor2 = bodies[i]->getTransform() * Vector3(0, decimal(0.5), 0);
+                rp3d_test((anchor1 - anchor2).length() < decimal(0.001));
+            }
+            const Vector3 chainEnd = bodies[nbBodies - 1]->getTransform() * Vector3(0, decimal(-0.5), 0);
+            rp3d_test(chainEnd.y > -decimal(nbBodies) - decimal(0.5) - decimal(0.003));
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+        void testMaterialMixing() {
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+
+            PhysicsWorld::WorldSettings settings;
+            settings.isSleepingEnabled = false;
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+
+            RigidBody* floor = world->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+            floor->setType(BodyType::STATIC);
+            Collider* floorCollider = floor->addCollider(mPhysicsCommon.createBoxShape(Vector3(100, 1, 100)), Transform::identity());
+            floorCollider->getMaterial().setFrictionCoefficient(decimal(1.0));
+
+            RigidBody* box = world->createRigidBody(Transform(Vector3(0, decimal(0.5), 0), Quaternion::identity()));
+            Collider* boxCollider = box->addCollider(mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5))), Transform::identity());
+            boxCollider->getMaterial().setFrictionCoefficient(decimal(1.0));
+
+            // With the default mixer, the friction stops the sliding box
+            for (uint32 i=0; i < 30; i++) {
+                world->update(timeStep);
+            }
+            box->setLinearVelocity(Vector3(2, 0, 0));
+            for (uint32 i=0; i < 60; i++) {
+                world->update(timeStep);
+            }
+            rp3d_test(box->getLinearVelocity().x < decimal(0.1));
+
+            // The mixed friction of the existing pair is recomputed with the new mixer
+            FrictionlessMaterialMixer frictionlessMixer;
+            world->setMaterialMixer(&frictionlessMixer);
+            box->setLinearVelocity(Vector3(2, 0, 0));
+            for (uint32 i=0; i < 30; i++) {
+                world->update(timeStep);
+            }
+            rp3d_test(approxEqual(box->getLinearVelocity().x, decimal(2.0), decimal(0.05)));
+
+            // Back to the default mixer
+            world->setMaterialMixer(nullptr);
+            for (uint32 i=0; i < 60; i++) {
+                world->update(timeStep);
+            }
+            rp3d_test(box->getLinearVelocity().x < decimal(0.1));
+
+            // A material modified through the reference of the collider is taken into account
+            boxCollider->getMaterial().setFrictionCoefficient(decimal(0.0));
+            box->setLinearVelocity(Vector3(2, 0, 0));
+            for (uint32 i=0; i < 30; i++) {
+                world->update(timeStep);
+            }
+            rp3d_test(approxEqual(box->getLinearVelocity().x, decimal(2.0), decimal(0.05)));
+
+            // Modifying a copy of the material does not modify the material of the collider
+            Material materialCopy = boxCollider->getMaterial();
+            materialCopy.setFrictionCoefficient(decimal(1.0));
+            rp3d_test(approxEqual(boxCollider->getMaterial().getFrictionCoefficient(), decimal(0.0)));
+            box->setLinearVelocity(Vector3(2, 0, 0));
+            for (uint32 i=0; i < 30; i++) {
+                world->update(timeStep);
+            }
+            rp3d_test(approxEqual(box->getLinearVelocity().x, decimal(2.0), decimal(0.05)));
+
+            // A material assigned through the reference of the collider is taken into account
+            boxCollider->getMaterial() = materialCopy;
+            for (uint32 i=0; i < 60; i++) {
+                world->update(timeStep);
+            }
+            rp3d_test(box->getLinearVelocity().x < decimal(0.1));
+
+            // The assigned material is still owned by the collider
+            boxCollider->getMaterial().setFrictionCoefficient(decimal(0.0));
+            box->setLinearVelocity(Vector3(2, 0, 0));
+            for (uint32 i=0; i < 30; i++) {
+                world->update(timeStep);
+            }
+            rp3d_test(approxEqual(box->getLinearVelocity().x, decimal(2.0), decimal(0.05)));
+
+            // A copy of the material can still be modified after the collider has been removed
+            Material removedMaterial = boxCollider->getMaterial();
+            box->removeCollider(boxCollider);
+            removedMaterial.setBounciness(decimal(0.5));
+            rp3d_test(approxEqual(removedMaterial.getBounciness(), decimal(0.5)));
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+        void testContactMargin() {
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+
+            PhysicsWorld::WorldSettings settings;
+            settings.isSleepingEnabled = false;
+            settings.gravity = Vector3::zero();
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+
+            rp3d_test(world->getContactMargin() == decimal(0.0));
+
+            RigidBody* floor = world->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+            floor->setType(BodyType::STATIC);
+            floor->addCollider(mPhysicsCommon.createBoxShape(Vector3(50, 1, 50)), Transform::identity());
+
+            // A box and a sphere slightly above the floor
+            RigidBody* box = world->createRigidBody(Transform(Vector3(0, decimal(0.52), 0), Quaternion::identity()));
+            box->addCollider(mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5))), Transform::identity());
+            RigidBody* sphere = world->createRigidBody(Transform(Vector3(5, decimal(0.52), 0), Quaternion::identity()));
+            sphere->addCollider(mPhysicsCommon.createSphereShape(decimal(0.5)), Transform::identity());
+
+            PenetrationDepthEventListener eventListener;
+            world->setEventListener(&eventListener);
+
+            // Without contact margin, the separated shapes do not generate contacts
+            world->update(timeStep);
+            rp3d_test(eventListener.nbContactPoints == 0);
+
+            // With a contact margin, speculative contacts are reported with a negative penetration depth
+            world->setContactMargin(decimal(0.05));
+            rp3d_test(world->getContactMargin() == decimal(0.05));
+            world->update(timeStep);
+            rp3d_test(eventListener.nbContactPoints > 0);
+            rp3d_test(eventListener.maxPenetrationDepth < decimal(0.0));
+            rp3d_test(eventListener.minPenetrationDepth > decimal(-0.05));
+
+            // The speculative contacts do not push the bodies apart
+            rp3d_test(approxEqual(box->getTransform().getPosition().y, decimal(0.52), decimal(0.001)));
+            rp3d_test(approxEqual(sphere->getTransform().getPosition().y, decimal(0.52), decimal(0.001)));
+
+            // The overlap queries are not affected by the contact margin
+            rp3d_test(!world->testOverlap(box, floor));
+            rp3d_test(!world->testOverlap(sphere, floor));
+
+            // Fast bodies are stopped at the surface of the floor instead of penetrating it
+            box->setLinearVelocity(Vector3(0, -2, 0));
+            sphere->setLinearVelocity(Vector3(0, -2, 0));
+            eventListener.reset();
+            for (uint32 i=0; i < 10; i++) {
+                world->update(timeStep);
+            }
+            rp3d_test(eventListener.maxPenetrationDepth < decimal(0.005));
+            rp3d_test(box->getTransform().getPosition().y > decimal(0.495));
+            rp3d_test(sphere->getTransform().getPosition().y > decimal(0.495));
+
+            world->setEventListener(nullptr);
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+        void testCompoundBody() {
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+
+            PhysicsWorld::WorldSettings settings;
+            settings.isSleepingEnabled = false;
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+
+            RigidBody* floor = world->createRigidBody(Transform(Vector3(0, -1, 0), Quaternion::identity()));
+            floor->setType(BodyType::STATIC);
+            floor->addCollider(mPhysicsCommon.createBoxShape(Vector3(50, 1, 50)), Transform::identity());
+
+            // Two identical bodies made of 27 small boxes, only the first one is a compound body
+            BoxShape* smallBoxShape = mPhysicsCommon.createBoxShape(Vector3(decimal(0.25), decimal(0.25), decimal(0.25)));
+            RigidBody* compoundBody = world->createRigidBody(Transform(Vector3(-5, 2, 0), Quaternion::identity()));
+            RigidBody* body = world->createRigidBody(Transform(Vector3(5, 2, 0), Quaternion::identity()));
+            compoundBody->setIsCompound(true);
+            rp3d_test(compoundBody->isCompound());
+            rp3d_test(!body->isCompound());
+            for (int x=-1; x <= 1; x++) {
+                for (int y=-1; y <= 1; y++) {
+                    for (int z=-1; z <= 1; z++) {
+                        const Transform localTransform(Vector3(x, y, z) * decimal(0.5), Quaternion::identity());
+                        compoundBody->addCollider(smallBoxShape, localTransform);
+                        body->addCollider(smallBoxShape, localTransform);
+                    }
+                }
+            }
+            compoundBody->updateMassPropertiesFromColliders();
+            body->updateMassPropertiesFromColliders();
+
+            // A second compound body falling on top of the first one
+            RigidBody* stackedBody = world->createRigidBody(Transform(Vector3(-5, 4, 0), Quaternion::identity()));
+            stackedBody->setIsCompound(true);
+            stackedBody->addCollider(smallBoxShape, Transform(Vector3(decimal(-0.25), 0, 0), Quaternion::identity()));
+            stackedBody->addCollider(smallBoxShape, Transform(Vector3(decimal(0.25), 0, 0), Quaternion::identity()));
+            stackedBody->updateMassPropertiesFromColliders();
+
+            // Both bodies must fall and come to rest on the floor at the same height
+            for (uint32 i=0; i < 180; i++) {
+                world->update(timeStep);
+            }
+            rp3d_test(approxEqual(compoundBody->getTransform().getPosition().y, decimal(0.75), decimal(0.02)));
+            rp3d_test(approxEqual(compoundBody->getTransform().getPosition().y, body->getTransform().getPosition().y, decimal(0.001)));
+            rp3d_test(world->testOverlap(compoundBody, floor));
+            rp3d_test(approxEqual(stackedBody->getTransform().getPosition().y, decimal(1.75), decimal(0.03)));
+            rp3d_test(world->testOverlap(compoundBody, stackedBody));
+
+            // The colliders of the compound body must be reported by the raycasts
+            ClosestHitRaycastCallback raycastCallback;
+            world->raycast(Ray(Vector3(decimal(-5.6), 5, 0), Vector3(decimal(-5.6), -5, 0)), &raycastCallback);
+            rp3d_test(raycastCallback.collider != nullptr);
+            rp3d_test(raycastCallback.collider->getBody() == compoundBody);
+            const decimal topY = compoundBody->getTransform().getPosition().y + decimal(0.75);
+            rp3d_test(approxEqual(raycastCallback.hitFraction, (decimal(5.0) - topY) / decimal(10.0), decimal(0.01)));
+
+            // The AABB overlap queries must test the colliders of the compound body
+            rp3d_test(world->testAAABBOverlap(AABB(Vector3(decimal(-5.7), decimal(1.0), decimal(-0.1)), Vector3(decimal(-5.6), decimal(1.1), decimal(0.1)))));
+            rp3d_test(!world->testAAABBOverlap(AABB(Vector3(decimal(-5.75), decimal(1.7), decimal(-0.1)), Vector3(decimal(-5.65), decimal(1.8), decimal(0.1)))));
+
+            // Keep only the bottom layer of boxes of the compound body and turn it back into a regular body
+            for (uint32 i=compoundBody->getNbColliders(); i > 0; i--) {
+                Collider* collider = compoundBody->getCollider(i - 1);
+                if (collider->getLocalToBodyTransform().getPosition().y > decimal(-0.25)) {
+                    compoundBody->removeCollider(collider);
+                }
+            }
+            rp3d_test(compoundBody->getNbColliders() == 9);
+            compoundBody->updateMassPropertiesFromColliders();
+            compoundBody->setIsCompound(false);
+            rp3d_test(!compoundBody->isCompound());
+            for (uint32 i=0; i < 60; i++) {
+                world->update(timeStep);
+            }
+            rp3d_test(approxEqual(compoundBody->getTransform().getPosition().y, decimal(0.75), decimal(0.02)));
+            rp3d_test(world->testOverlap(compoundBody, floor));
+
+            // Removing all the colliders of a compound body
+            body->setIsCompound(true);
+            while (body->getNbColliders() > 0) {
+                body->removeCollider(body->getCollider(0));
+            }
+            world->update(timeStep);
+            rp3d_test(!world->testOverlap(body, floor));
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+        void testConcaveMeshTriangleShapes() {
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+
+            PhysicsWorld::WorldSettings settings;
+            settings.isSleepingEnabled = false;
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+
+            // Flat height field terrain
+            const int nbGridColumns = 20;
+            const int nbGridRows = 20;
+            std::vector<float> heights(nbGridColumns * nbGridRows, 0.0f);
+            HeightFieldShape* heightFieldShape = mPhysicsCommon.createHeightFieldShape(nbGridColumns, nbGridRows, -1, 1, heights.data(),
+                                                                                       HeightFieldShape::HeightDataType::HEIGHT_FLOAT_TYPE);
+            RigidBody* terrain = world->createRigidBody(Transform::identity());
+            terrain->setType(BodyType::STATIC);
+            terrain->addCollider(heightFieldShape, Transform::identity());
+
+            // A capsule and a box resting on several triangles of the terrain
+            RigidBody* capsule = world->createRigidBody(Transform(Vector3(decimal(-2.3), 1, decimal(0.4)), Quaternion::fromEulerAngles(0, 0, PI_RP3D * decimal(0.5))));
+            capsule->addCollider(mPhysicsCommon.createCapsuleShape(decimal(0.5), 3), Transform::identity());
+            RigidBody* box = world->createRigidBody(Transform(Vector3(decimal(2.6), 1, decimal(-0.3)), Quaternion::identity()));
+            box->addCollider(mPhysicsCommon.createBoxShape(Vector3(decimal(1.5), decimal(0.5), decimal(1.5))), Transform::identity());
+
+            for (uint32 i=0; i < 300; i++) {
+                world->update(timeStep);
+            }
+
+            rp3d_test(approxEqual(capsule->getTransform().getPosition().y, decimal(0.5), decimal(0.02)));
+            rp3d_test(approxEqual(box->getTransform().getPosition().y, decimal(0.5), decimal(0.02)));
+            rp3d_test(world->testOverlap(capsule, terrain));
+            rp3d_test(world->testOverlap(box, terrain));
+
+#ifndef NDEBUG
+
+            // The triangle shapes of the terrain are reused between the frames and do not allocate heap memory
+            const uint64 nbAllocationsBefore = world->getMemoryManager().getHeapAllocator().getNbTotalAllocations();
+
+            for (uint32 i=0; i < 100; i++) {
+                world->update(timeStep);
+            }
+
+            const uint64 nbAllocationsAfter = world->getMemoryManager().getHeapAllocator().getNbTotalAllocations();
+            rp3d_test(nbAllocationsAfter == nbAllocationsBefore);
+
+#endif
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+
+        void testConcaveMeshTrianglesCache() {
+
+            const decimal timeStep = decimal(1.0) / decimal(60.0);
+
+            PhysicsWorld::WorldSettings settings;
+            settings.isSleepingEnabled = false;
+            PhysicsWorld* world = mPhysicsCommon.createPhysicsWorld(settings);
+
+            // Flat height field terrain (with its surface at y=1)
+            const int nbGridColumns = 40;
+            const int nbGridRows = 10;
+            std::vector<float> heights(nbGridColumns * nbGridRows, 2.0f);
+            HeightFieldShape* heightFieldShape = mPhysicsCommon.createHeightFieldShape(nbGridColumns, nbGridRows, 0, 2, heights.data(),
+                                                                                       HeightFieldShape::HeightDataType::HEIGHT_FLOAT_TYPE);
+            RigidBody* terrain = world->createRigidBody(Transform::identity());
+            terrain->setType(BodyType::STATIC);
+            Collider* terrainCollider = terrain->addCollider(heightFieldShape, Transform::identity());
+            terrainCollider->getMaterial().setFrictionCoefficient(decimal(0.0));
+
+            // A frictionless box resting on the terrain
+            RigidBody* box = world->createRigidBody(Transform(Vector3(-15, decimal(1.5), 0), Quaternion::identity()));
+            Collider* boxCollider = box->addCollider(mPhysicsCommon.createBoxShape(Vector3(decimal(0.5), decimal(0.5), decimal(0.5))), Transform::identity());
+            boxCollider->getMaterial().setFrictionCoefficient(decimal(0.0));
+
+            for (uint32 i=0; i < 60; i++) {
+                world->update(timeStep);
+            }
+            rp3d_test(approxEqual(box->getTransform().getPosition().y, decimal(1.5), decimal(0.02)));
+
+            // The box slides across the terrain and leaves the regions of the cached triangles several times
+            box->setLinearVelocity(Vector3(10, 0, 0));
+            for (uint32 i=0; i < 150; i++) {
+                world->update(timeStep);
+                rp3d_test(box->getTransform().getPosition().y > decimal(1.45));
+            }
+            rp3d_test(box->getTransform().getPosition().x > decimal(5.0));
+            rp3d_test(approxEqual(box->getTransform().getPosition().y, decimal(1.5), decimal(0.02)));
+
+            // Scaling the terrain raises its surface to y=1.1. The triangles cached with the previous
+            // scale must not be used anymore even if the box is still inside the cached region.
+            box->setLinearVelocity(Vector3::zero());
+            for (uint32 i=0; i < 30; i++) {
+                world->update(timeStep);
+            }
+            heightFieldShape->setScale(Vector3(1, decimal(1.1), 1));
+            for (uint32 i=0; i < 60; i++) {
+                world->update(timeStep);
+            }
+            rp3d_test(approxEqual(box->getTransform().getPosition().y, decimal(1.6), decimal(0.02)));
+
+            mPhysicsCommon.destroyPhysicsWorld(world);
+        }
+ };
+
+}
+
+#endif